@@ -0,0 +1,78 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+// Points on a torus, the radius of the ball is scaled with the point spacing.
+class BallPivotingFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        size_t number_of_points = size_t(state.range(0));
+        if (pcd && pcd->points_.size() == number_of_points) {
+            return;
+        }
+        auto torus = geometry::TriangleMesh::CreateTorus(1.0, 0.4, 200, 100);
+        torus->ComputeVertexNormals();
+        pcd = torus->SamplePointsUniformly(number_of_points, false, 0);
+        double spacing =
+                std::sqrt(torus->GetSurfaceArea() / double(number_of_points));
+        radii = {2 * spacing, 4 * spacing};
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::shared_ptr<geometry::PointCloud> pcd;
+    std::vector<double> radii;
+};
+
+BENCHMARK_DEFINE_F(BallPivotingFixture, Serial)(benchmark::State& state) {
+    for (auto _ : state) {
+        geometry::TriangleMesh::CreateFromPointCloudBallPivoting(*pcd, radii);
+    }
+}
+
+BENCHMARK_DEFINE_F(BallPivotingFixture, Parallel)(benchmark::State& state) {
+    for (auto _ : state) {
+        geometry::TriangleMesh::CreateFromPointCloudBallPivoting(*pcd, radii,
+                                                                 true);
+    }
+}
+
+BENCHMARK_REGISTER_F(BallPivotingFixture, Serial)
+        ->Args({100000})
+        ->Args({5000000})
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(1);
+BENCHMARK_REGISTER_F(BallPivotingFixture, Parallel)
+        ->Args({100000})
+        ->Args({5000000})
+        ->Unit(benchmark::kMillisecond)
+        ->Iterations(1);
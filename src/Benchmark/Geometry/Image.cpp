@@ -0,0 +1,162 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "Open3D/Geometry/Image.h"
+
+#include <random>
+
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+class ImageFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        int width = int(state.range(0));
+        int height = int(state.range(1));
+        if (image_.width_ == width && image_.height_ == height) {
+            return;
+        }
+        image_.Prepare(width, height, 1, 4);
+        std::mt19937 rng(0);
+        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+        for (int v = 0; v < height; v++) {
+            for (int u = 0; u < width; u++) {
+                *image_.PointerAt<float>(u, v) = dist(rng);
+            }
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+
+    geometry::Image image_;
+};
+
+// The benchmarks with Reuse in their name write into images that are
+// allocated once, as a tracker processing a stream of frames does.
+BENCHMARK_DEFINE_F(ImageFixture, FilterGaussian3)(benchmark::State& state) {
+    for (auto _ : state) {
+        image_.Filter(geometry::Image::FilterType::Gaussian3);
+    }
+}
+
+BENCHMARK_DEFINE_F(ImageFixture, FilterGaussian3Reuse)
+(benchmark::State& state) {
+    geometry::Image output;
+    for (auto _ : state) {
+        image_.Filter(geometry::Image::FilterType::Gaussian3, output);
+    }
+}
+
+BENCHMARK_DEFINE_F(ImageFixture, FilterGaussian7Reuse)
+(benchmark::State& state) {
+    geometry::Image output;
+    for (auto _ : state) {
+        image_.Filter(geometry::Image::FilterType::Gaussian7, output);
+    }
+}
+
+BENCHMARK_DEFINE_F(ImageFixture, FilterSobel)(benchmark::State& state) {
+    for (auto _ : state) {
+        image_.Filter(geometry::Image::FilterType::Sobel3Dx);
+        image_.Filter(geometry::Image::FilterType::Sobel3Dy);
+    }
+}
+
+BENCHMARK_DEFINE_F(ImageFixture, FilterSobelReuse)(benchmark::State& state) {
+    geometry::Image dx, dy;
+    for (auto _ : state) {
+        image_.Filter(geometry::Image::FilterType::Sobel3Dx, dx);
+        image_.Filter(geometry::Image::FilterType::Sobel3Dy, dy);
+    }
+}
+
+BENCHMARK_DEFINE_F(ImageFixture, Downsample)(benchmark::State& state) {
+    for (auto _ : state) {
+        image_.Downsample();
+    }
+}
+
+BENCHMARK_DEFINE_F(ImageFixture, DownsampleReuse)(benchmark::State& state) {
+    geometry::Image output;
+    for (auto _ : state) {
+        image_.Downsample(output);
+    }
+}
+
+BENCHMARK_DEFINE_F(ImageFixture, CreatePyramid)(benchmark::State& state) {
+    for (auto _ : state) {
+        image_.CreatePyramid(4);
+    }
+}
+
+BENCHMARK_DEFINE_F(ImageFixture, CreatePyramidReuse)
+(benchmark::State& state) {
+    geometry::ImagePyramid pyramid;
+    for (auto _ : state) {
+        image_.CreatePyramid(4, true, pyramid);
+    }
+}
+
+BENCHMARK_REGISTER_F(ImageFixture, FilterGaussian3)
+        ->Args({640, 480})
+        ->Args({1920, 1080})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ImageFixture, FilterGaussian3Reuse)
+        ->Args({640, 480})
+        ->Args({1920, 1080})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ImageFixture, FilterGaussian7Reuse)
+        ->Args({640, 480})
+        ->Args({1920, 1080})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ImageFixture, FilterSobel)
+        ->Args({640, 480})
+        ->Args({1920, 1080})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ImageFixture, FilterSobelReuse)
+        ->Args({640, 480})
+        ->Args({1920, 1080})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ImageFixture, Downsample)
+        ->Args({640, 480})
+        ->Args({1920, 1080})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ImageFixture, DownsampleReuse)
+        ->Args({640, 480})
+        ->Args({1920, 1080})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ImageFixture, CreatePyramid)
+        ->Args({640, 480})
+        ->Args({1920, 1080})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ImageFixture, CreatePyramidReuse)
+        ->Args({640, 480})
+        ->Args({1920, 1080})
+        ->Unit(benchmark::kMillisecond);
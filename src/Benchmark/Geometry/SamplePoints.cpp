@@ -46,7 +46,12 @@ BENCHMARK_DEFINE_F(SamplePointsFixture, Poisson)(benchmark::State& state) {
     }
 }
 
-BENCHMARK_REGISTER_F(SamplePointsFixture, Poisson)->Args({123})->Args({1000});
+BENCHMARK_REGISTER_F(SamplePointsFixture, Poisson)
+        ->Args({123})
+        ->Args({1000})
+        ->Args({10000})
+        ->Args({100000})
+        ->Unit(benchmark::kMillisecond);
 
 BENCHMARK_DEFINE_F(SamplePointsFixture, Uniform)(benchmark::State& state) {
     for (auto _ : state) {
@@ -54,4 +59,9 @@ BENCHMARK_DEFINE_F(SamplePointsFixture, Uniform)(benchmark::State& state) {
     }
 }
 
-BENCHMARK_REGISTER_F(SamplePointsFixture, Uniform)->Args({123})->Args({1000});
+BENCHMARK_REGISTER_F(SamplePointsFixture, Uniform)
+        ->Args({123})
+        ->Args({1000})
+        ->Args({1000000})
+        ->Args({10000000})
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,77 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+// A sphere with 40k triangles, with vertex normals, colors and triangle uvs.
+// Each level of subdivision multiplies the number of triangles by 4.
+class SubdivideFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        if (trimesh) {
+            return;
+        }
+        trimesh = geometry::TriangleMesh::CreateSphere(1.0, 100);
+        trimesh->ComputeVertexNormals();
+        trimesh->vertex_colors_.resize(trimesh->vertices_.size());
+        for (size_t vidx = 0; vidx < trimesh->vertices_.size(); ++vidx) {
+            trimesh->vertex_colors_[vidx] = trimesh->vertices_[vidx].cwiseAbs();
+        }
+        for (const auto& triangle : trimesh->triangles_) {
+            for (int i = 0; i < 3; ++i) {
+                trimesh->triangle_uvs_.push_back(
+                        trimesh->vertices_[triangle(i)].head<2>());
+            }
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+    std::shared_ptr<geometry::TriangleMesh> trimesh;
+};
+
+BENCHMARK_DEFINE_F(SubdivideFixture, Midpoint)(benchmark::State& state) {
+    for (auto _ : state) {
+        trimesh->SubdivideMidpoint(int(state.range(0)));
+    }
+}
+
+BENCHMARK_DEFINE_F(SubdivideFixture, Loop)(benchmark::State& state) {
+    for (auto _ : state) {
+        trimesh->SubdivideLoop(int(state.range(0)));
+    }
+}
+
+BENCHMARK_REGISTER_F(SubdivideFixture, Midpoint)
+        ->DenseRange(1, 4)
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(SubdivideFixture, Loop)
+        ->DenseRange(1, 4)
+        ->Unit(benchmark::kMillisecond);
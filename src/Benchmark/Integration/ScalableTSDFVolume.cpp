@@ -0,0 +1,180 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "Open3D/Integration/ScalableTSDFVolume.h"
+
+#include <iomanip>
+#include <sstream>
+
+#include "Open3D/Camera/PinholeCameraTrajectory.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+class ScalableTSDFVolumeFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        if (!images_.empty()) {
+            return;
+        }
+        io::ReadPinholeCameraTrajectory(
+                std::string(TEST_DATA_DIR) + "/RGBD/odometry.log",
+                trajectory_);
+        for (size_t i = 0; i < trajectory_.parameters_.size(); i++) {
+            std::ostringstream suffix;
+            suffix << std::setfill('0') << std::setw(5) << i;
+            geometry::Image color, depth;
+            io::ReadImage(std::string(TEST_DATA_DIR) + "/RGBD/color/" +
+                                  suffix.str() + ".jpg",
+                          color);
+            io::ReadImage(std::string(TEST_DATA_DIR) + "/RGBD/depth/" +
+                                  suffix.str() + ".png",
+                          depth);
+            images_.push_back(geometry::RGBDImage::CreateFromColorAndDepth(
+                    color, depth, 1000.0, 4.0, false));
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+
+    void Integrate(integration::TSDFVolume& volume) {
+        for (size_t i = 0; i < images_.size(); i++) {
+            volume.Integrate(*images_[i],
+                             trajectory_.parameters_[i].intrinsic_,
+                             trajectory_.parameters_[i].extrinsic_);
+        }
+    }
+
+    camera::PinholeCameraTrajectory trajectory_;
+    std::vector<std::shared_ptr<geometry::RGBDImage>> images_;
+};
+
+// Integrates the 640x480 frames of the sequence into a cleared volume with
+// voxels of state.range(0) millimeters.
+BENCHMARK_DEFINE_F(ScalableTSDFVolumeFixture, Integrate)
+(benchmark::State& state) {
+    double voxel_length = state.range(0) * 0.001;
+    integration::ScalableTSDFVolume volume(
+            voxel_length, 5.0 * voxel_length,
+            integration::TSDFVolumeColorType::RGB8);
+    for (auto _ : state) {
+        volume.Reset();
+        Integrate(volume);
+    }
+    state.counters["frames_per_second"] =
+            benchmark::Counter(double(images_.size()),
+                               benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK_DEFINE_F(ScalableTSDFVolumeFixture, ExtractTriangleMesh)
+(benchmark::State& state) {
+    double voxel_length = state.range(0) * 0.001;
+    integration::ScalableTSDFVolume volume(
+            voxel_length, 5.0 * voxel_length,
+            integration::TSDFVolumeColorType::RGB8);
+    Integrate(volume);
+    for (auto _ : state) {
+        volume.ExtractTriangleMesh();
+    }
+}
+
+// Extracts the patches changed by a frame whose depth is cropped to a window
+// of 2 * state.range(1) pixels, as in a live preview updated every frame.
+BENCHMARK_DEFINE_F(ScalableTSDFVolumeFixture, ExtractTriangleMeshPatches)
+(benchmark::State& state) {
+    double voxel_length = state.range(0) * 0.001;
+    integration::ScalableTSDFVolume volume(
+            voxel_length, 5.0 * voxel_length,
+            integration::TSDFVolumeColorType::RGB8);
+    Integrate(volume);
+    volume.ExtractTriangleMeshPatches();
+    geometry::RGBDImage rgbd = *images_[0];
+    int window = int(state.range(1));
+    for (int v = 0; v < rgbd.depth_.height_; v++) {
+        for (int u = 0; u < rgbd.depth_.width_; u++) {
+            if (std::abs(u - rgbd.depth_.width_ / 2) > window ||
+                std::abs(v - rgbd.depth_.height_ / 2) > window) {
+                *rgbd.depth_.PointerAt<float>(u, v) = 0.0f;
+            }
+        }
+    }
+    size_t num_patches = 0;
+    for (auto _ : state) {
+        state.PauseTiming();
+        volume.Integrate(rgbd, trajectory_.parameters_[0].intrinsic_,
+                         trajectory_.parameters_[0].extrinsic_);
+        state.ResumeTiming();
+        num_patches = volume.ExtractTriangleMeshPatches().size();
+    }
+    state.counters["patches"] = double(num_patches);
+}
+
+// Renders the volume at the pose of the first frame with an image width of
+// state.range(1) pixels.
+BENCHMARK_DEFINE_F(ScalableTSDFVolumeFixture, RayCast)
+(benchmark::State& state) {
+    double voxel_length = state.range(0) * 0.001;
+    integration::ScalableTSDFVolume volume(
+            voxel_length, 5.0 * voxel_length,
+            integration::TSDFVolumeColorType::RGB8);
+    Integrate(volume);
+    const auto& intrinsic = trajectory_.parameters_[0].intrinsic_;
+    double scale = double(state.range(1)) / intrinsic.width_;
+    camera::PinholeCameraIntrinsic scaled(
+            int(intrinsic.width_ * scale), int(intrinsic.height_ * scale),
+            intrinsic.GetFocalLength().first * scale,
+            intrinsic.GetFocalLength().second * scale,
+            intrinsic.GetPrincipalPoint().first * scale,
+            intrinsic.GetPrincipalPoint().second * scale);
+    for (auto _ : state) {
+        volume.RayCast(scaled, trajectory_.parameters_[0].extrinsic_);
+    }
+}
+
+BENCHMARK_REGISTER_F(ScalableTSDFVolumeFixture, Integrate)
+        ->Args({4})
+        ->Args({8})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ScalableTSDFVolumeFixture, ExtractTriangleMesh)
+        ->Args({4})
+        ->Args({8})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ScalableTSDFVolumeFixture, ExtractTriangleMeshPatches)
+        ->Args({4, 32})
+        ->Args({4, 128})
+        ->Args({4, 320})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(ScalableTSDFVolumeFixture, RayCast)
+        ->Args({4, 320})
+        ->Args({4, 640})
+        ->Args({8, 320})
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,163 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "Open3D/Integration/UniformTSDFVolume.h"
+
+#include <iomanip>
+#include <sstream>
+
+#include "Open3D/Camera/PinholeCameraTrajectory.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+class UniformTSDFVolumeFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        if (!images_.empty()) {
+            return;
+        }
+        io::ReadPinholeCameraTrajectory(
+                std::string(TEST_DATA_DIR) + "/RGBD/odometry.log",
+                trajectory_);
+        for (size_t i = 0; i < trajectory_.parameters_.size(); i++) {
+            std::ostringstream suffix;
+            suffix << std::setfill('0') << std::setw(5) << i;
+            geometry::Image color, depth;
+            io::ReadImage(std::string(TEST_DATA_DIR) + "/RGBD/color/" +
+                                  suffix.str() + ".jpg",
+                          color);
+            io::ReadImage(std::string(TEST_DATA_DIR) + "/RGBD/depth/" +
+                                  suffix.str() + ".png",
+                          depth);
+            images_.push_back(geometry::RGBDImage::CreateFromColorAndDepth(
+                    color, depth, 1000.0, 4.0, false));
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+
+    std::shared_ptr<integration::UniformTSDFVolume> CreateVolume(
+            const benchmark::State& state) {
+        return std::make_shared<integration::UniformTSDFVolume>(
+                4.0, int(state.range(0)), 0.04,
+                integration::TSDFVolumeColorType::RGB8,
+                Eigen::Vector3d::Zero(),
+                integration::TSDFVolumeStorageType(state.range(1)));
+    }
+
+    void Integrate(integration::UniformTSDFVolume& volume) {
+        for (size_t i = 0; i < images_.size(); i++) {
+            volume.Integrate(*images_[i],
+                             trajectory_.parameters_[i].intrinsic_,
+                             trajectory_.parameters_[i].extrinsic_);
+        }
+    }
+
+    camera::PinholeCameraTrajectory trajectory_;
+    std::vector<std::shared_ptr<geometry::RGBDImage>> images_;
+};
+
+// Integrates all frames of the sequence into a cleared volume.
+BENCHMARK_DEFINE_F(UniformTSDFVolumeFixture, Integrate)
+(benchmark::State& state) {
+    auto volume = CreateVolume(state);
+    for (auto _ : state) {
+        volume->Reset();
+        Integrate(*volume);
+    }
+    state.counters["bytes_per_voxel"] =
+            double(volume->GetStorageSize()) / volume->voxel_num_;
+}
+
+BENCHMARK_DEFINE_F(UniformTSDFVolumeFixture, ExtractTriangleMesh)
+(benchmark::State& state) {
+    auto volume = CreateVolume(state);
+    Integrate(*volume);
+    for (auto _ : state) {
+        volume->ExtractTriangleMesh();
+    }
+    state.counters["bytes_per_voxel"] =
+            double(volume->GetStorageSize()) / volume->voxel_num_;
+}
+
+BENCHMARK_DEFINE_F(UniformTSDFVolumeFixture, ExtractPointCloud)
+(benchmark::State& state) {
+    auto volume = CreateVolume(state);
+    Integrate(*volume);
+    for (auto _ : state) {
+        volume->ExtractPointCloud();
+    }
+}
+
+BENCHMARK_DEFINE_F(UniformTSDFVolumeFixture, ExtractVoxelGrid)
+(benchmark::State& state) {
+    auto volume = CreateVolume(state);
+    Integrate(*volume);
+    for (auto _ : state) {
+        volume->ExtractVoxelGrid();
+    }
+}
+
+// Arguments are the resolution and the TSDFVolumeStorageType.
+BENCHMARK_REGISTER_F(UniformTSDFVolumeFixture, Integrate)
+        ->Args({128, 0})
+        ->Args({128, 1})
+        ->Args({128, 2})
+        ->Args({256, 0})
+        ->Args({256, 1})
+        ->Args({256, 2})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(UniformTSDFVolumeFixture, ExtractTriangleMesh)
+        ->Args({128, 0})
+        ->Args({128, 1})
+        ->Args({128, 2})
+        ->Args({256, 0})
+        ->Args({256, 1})
+        ->Args({256, 2})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(UniformTSDFVolumeFixture, ExtractPointCloud)
+        ->Args({128, 0})
+        ->Args({128, 1})
+        ->Args({128, 2})
+        ->Args({256, 0})
+        ->Args({256, 1})
+        ->Args({256, 2})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(UniformTSDFVolumeFixture, ExtractVoxelGrid)
+        ->Args({128, 0})
+        ->Args({128, 1})
+        ->Args({128, 2})
+        ->Args({256, 0})
+        ->Args({256, 1})
+        ->Args({256, 2})
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,121 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "Open3D/Odometry/Odometry.h"
+
+#include <iomanip>
+#include <sstream>
+
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+class RGBDOdometryFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        if (!images_.empty()) {
+            return;
+        }
+        for (int i = 0; i < 5; i++) {
+            std::ostringstream suffix;
+            suffix << std::setfill('0') << std::setw(5) << i;
+            geometry::Image color, depth;
+            io::ReadImage(std::string(TEST_DATA_DIR) + "/RGBD/color/" +
+                                  suffix.str() + ".jpg",
+                          color);
+            io::ReadImage(std::string(TEST_DATA_DIR) + "/RGBD/depth/" +
+                                  suffix.str() + ".png",
+                          depth);
+            images_.push_back(
+                    geometry::RGBDImage::CreateFromColorAndDepth(color, depth));
+        }
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+
+    std::vector<std::shared_ptr<geometry::RGBDImage>> images_;
+};
+
+// Tracks the consecutive 640x480 frames of the sequence with the hybrid term
+// if state.range(0) is 1, with the color term otherwise.
+BENCHMARK_DEFINE_F(RGBDOdometryFixture, ComputeRGBDOdometry)
+(benchmark::State& state) {
+    camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    odometry::RGBDOdometryJacobianFromHybridTerm hybrid;
+    odometry::RGBDOdometryJacobianFromColorTerm color;
+    const odometry::RGBDOdometryJacobian& jacobian =
+            state.range(0) == 1 ? (const odometry::RGBDOdometryJacobian&)hybrid
+                                : color;
+    for (auto _ : state) {
+        for (size_t i = 0; i + 1 < images_.size(); i++) {
+            odometry::ComputeRGBDOdometry(*images_[i], *images_[i + 1],
+                                          intrinsic,
+                                          Eigen::Matrix4d::Identity(),
+                                          jacobian);
+        }
+    }
+    state.counters["frames_per_second"] = benchmark::Counter(
+            double(images_.size() - 1),
+            benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK_REGISTER_F(RGBDOdometryFixture, ComputeRGBDOdometry)
+        ->Args({1})
+        ->Args({0})
+        ->Unit(benchmark::kMillisecond);
+
+// Tracks the same frames with an RGBDOdometryTracker, which keeps the
+// pyramids of the previous frame.
+BENCHMARK_DEFINE_F(RGBDOdometryFixture, RGBDOdometryTracker)
+(benchmark::State& state) {
+    odometry::RGBDOdometryTracker tracker(camera::PinholeCameraIntrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault));
+    odometry::RGBDOdometryJacobianFromHybridTerm hybrid;
+    odometry::RGBDOdometryJacobianFromColorTerm color;
+    const odometry::RGBDOdometryJacobian& jacobian =
+            state.range(0) == 1 ? (const odometry::RGBDOdometryJacobian&)hybrid
+                                : color;
+    for (auto _ : state) {
+        tracker.Reset();
+        for (size_t i = 0; i < images_.size(); i++) {
+            tracker.Track(*images_[i], Eigen::Matrix4d::Identity(), jacobian);
+        }
+    }
+    state.counters["frames_per_second"] = benchmark::Counter(
+            double(images_.size() - 1),
+            benchmark::Counter::kIsIterationInvariantRate);
+}
+
+BENCHMARK_REGISTER_F(RGBDOdometryFixture, RGBDOdometryTracker)
+        ->Args({1})
+        ->Args({0})
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,97 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/Feature.h"
+
+#include <cmath>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+class FeatureFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        // Height field z = 0.1 sin(6x) cos(4y) on a n x n grid over the unit
+        // square, with analytic normals.
+        int n = int(state.range(0));
+        if (int(pcd_.points_.size()) == n * n) {
+            return;
+        }
+        pcd_.points_.resize(n * n);
+        pcd_.normals_.resize(n * n);
+        for (int i = 0; i < n; i++) {
+            for (int j = 0; j < n; j++) {
+                double x = double(i) / n, y = double(j) / n;
+                double z = 0.1 * std::sin(6.0 * x) * std::cos(4.0 * y);
+                double dzdx = 0.6 * std::cos(6.0 * x) * std::cos(4.0 * y);
+                double dzdy = -0.4 * std::sin(6.0 * x) * std::sin(4.0 * y);
+                pcd_.points_[i * n + j] = Eigen::Vector3d(x, y, z);
+                pcd_.normals_[i * n + j] =
+                        Eigen::Vector3d(-dzdx, -dzdy, 1.0).normalized();
+            }
+        }
+        radius_ = 5.0 / n;
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+
+    geometry::PointCloud pcd_;
+    double radius_ = 0.0;
+};
+
+BENCHMARK_DEFINE_F(FeatureFixture, ComputeFPFHFeature)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        registration::ComputeFPFHFeature(
+                pcd_, geometry::KDTreeSearchParamHybrid(radius_, 100));
+    }
+}
+
+BENCHMARK_REGISTER_F(FeatureFixture, ComputeFPFHFeature)
+        ->Args({100})
+        ->Args({300})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(FeatureFixture, ComputeFPFHFeatureCompact)
+(benchmark::State& state) {
+    auto precision = registration::CompactFeature::Precision(state.range(1));
+    for (auto _ : state) {
+        registration::ComputeFPFHFeatureCompact(
+                pcd_, geometry::KDTreeSearchParamHybrid(radius_, 100),
+                precision);
+    }
+}
+
+BENCHMARK_REGISTER_F(FeatureFixture, ComputeFPFHFeatureCompact)
+        ->Args({100, 0})
+        ->Args({300, 0})
+        ->Args({100, 1})
+        ->Args({300, 1})
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,234 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Geometry>
+#include <cmath>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/ColoredICP.h"
+#include "Open3D/Registration/GeneralizedICP.h"
+#include "Open3D/Registration/MultiScaleICP.h"
+#include "Open3D/Registration/Registration.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+namespace {
+
+/// Samples the height field z = 0.1 sin(6x) cos(4y) on a n x n grid over the
+/// unit square, shifted by offset grid cells, with analytic normals and a gray
+/// pattern as colors.
+std::shared_ptr<geometry::PointCloud> CreateHeightField(int n, double offset) {
+    auto pcd = std::make_shared<geometry::PointCloud>();
+    pcd->points_.resize(n * n);
+    pcd->normals_.resize(n * n);
+    pcd->colors_.resize(n * n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            double x = (i + offset) / n, y = (j + offset) / n;
+            double z = 0.1 * std::sin(6.0 * x) * std::cos(4.0 * y);
+            double dzdx = 0.6 * std::cos(6.0 * x) * std::cos(4.0 * y);
+            double dzdy = -0.4 * std::sin(6.0 * x) * std::sin(4.0 * y);
+            pcd->points_[i * n + j] = Eigen::Vector3d(x, y, z);
+            pcd->normals_[i * n + j] =
+                    Eigen::Vector3d(-dzdx, -dzdy, 1.0).normalized();
+            pcd->colors_[i * n + j] = Eigen::Vector3d::Constant(
+                    0.5 + 0.3 * std::sin(10.0 * x) * std::cos(8.0 * y));
+        }
+    }
+    return pcd;
+}
+
+}  // unnamed namespace
+
+class RegistrationICPFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        int n = int(state.range(0));
+        if (target_ && int(target_->points_.size()) == n * n) {
+            return;
+        }
+        target_ = CreateHeightField(n, 0.0);
+        source_ = CreateHeightField(n, 0.5);
+        Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+        transformation.block<3, 3>(0, 0) =
+                Eigen::AngleAxisd(0.02, Eigen::Vector3d(0.0, 0.6, 0.8))
+                        .toRotationMatrix();
+        transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.01, -0.02, 0.01);
+        source_->Transform(transformation);
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+
+    std::shared_ptr<geometry::PointCloud> source_, target_;
+};
+
+BENCHMARK_DEFINE_F(RegistrationICPFixture, PointToPoint)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        registration::RegistrationICP(
+                *source_, *target_, 0.05, Eigen::Matrix4d::Identity(),
+                registration::TransformationEstimationPointToPoint(),
+                registration::ICPConvergenceCriteria(0.0, 0.0, 10));
+    }
+}
+
+BENCHMARK_DEFINE_F(RegistrationICPFixture, PointToPlane)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        registration::RegistrationICP(
+                *source_, *target_, 0.05, Eigen::Matrix4d::Identity(),
+                registration::TransformationEstimationPointToPlane(),
+                registration::ICPConvergenceCriteria(0.0, 0.0, 10));
+    }
+}
+
+BENCHMARK_DEFINE_F(RegistrationICPFixture, PointToPlaneTukey)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        registration::RegistrationICP(
+                *source_, *target_, 0.05, Eigen::Matrix4d::Identity(),
+                registration::TransformationEstimationPointToPlane(
+                        std::make_shared<registration::TukeyLoss>(0.05)),
+                registration::ICPConvergenceCriteria(0.0, 0.0, 10));
+    }
+}
+
+BENCHMARK_DEFINE_F(RegistrationICPFixture, GeneralizedICP)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        registration::RegistrationGeneralizedICP(
+                *source_, *target_, 0.05, Eigen::Matrix4d::Identity(),
+                registration::TransformationEstimationForGeneralizedICP(),
+                registration::ICPConvergenceCriteria(0.0, 0.0, 10));
+    }
+}
+
+BENCHMARK_DEFINE_F(RegistrationICPFixture, ColoredICP)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        registration::RegistrationColoredICP(
+                *source_, *target_, 0.05, Eigen::Matrix4d::Identity(),
+                registration::ICPConvergenceCriteria(0.0, 0.0, 10));
+    }
+}
+
+// The color gradients of the target are estimated once for all iterations.
+BENCHMARK_DEFINE_F(RegistrationICPFixture, ColoredICPCachedTarget)
+(benchmark::State& state) {
+    registration::ColoredICPTarget target(*target_, 0.1);
+    for (auto _ : state) {
+        registration::RegistrationColoredICP(
+                *source_, target, 0.05, Eigen::Matrix4d::Identity(),
+                registration::ICPConvergenceCriteria(0.0, 0.0, 10));
+    }
+}
+
+const std::vector<registration::MultiScaleICPLevel> multi_scale_levels = {
+        {0.02, 0.05, registration::ICPConvergenceCriteria(1e-6, 1e-6, 30)},
+        {0.01, 0.02, registration::ICPConvergenceCriteria(1e-6, 1e-6, 20)},
+        {0.0, 0.01, registration::ICPConvergenceCriteria(1e-6, 1e-6, 10)}};
+
+// Downsamples, estimates normals and registers every level of both clouds.
+BENCHMARK_DEFINE_F(RegistrationICPFixture, MultiScaleByHand)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+        for (const auto& level : multi_scale_levels) {
+            std::shared_ptr<geometry::PointCloud> source, target;
+            if (level.voxel_size_ > 0.0) {
+                source = source_->VoxelDownSample(level.voxel_size_);
+                target = target_->VoxelDownSample(level.voxel_size_);
+                geometry::KDTreeSearchParamHybrid param(
+                        2.0 * level.voxel_size_, 30);
+                source->EstimateNormals(param);
+                target->EstimateNormals(param);
+            } else {
+                source = source_;
+                target = target_;
+            }
+            auto result = registration::RegistrationICP(
+                    *source, *target, level.max_correspondence_distance_,
+                    transformation,
+                    registration::TransformationEstimationPointToPlane(),
+                    level.criteria_);
+            transformation = result.transformation_;
+        }
+    }
+}
+
+BENCHMARK_DEFINE_F(RegistrationICPFixture, MultiScale)
+(benchmark::State& state) {
+    for (auto _ : state) {
+        registration::RegistrationMultiScaleICP(*source_, *target_,
+                                                multi_scale_levels);
+    }
+}
+
+BENCHMARK_DEFINE_F(RegistrationICPFixture, MultiScaleCachedTarget)
+(benchmark::State& state) {
+    registration::MultiScaleICPTarget target(*target_, {0.02, 0.01, 0.0});
+    for (auto _ : state) {
+        registration::RegistrationMultiScaleICP(*source_, target,
+                                                multi_scale_levels);
+    }
+}
+
+BENCHMARK_REGISTER_F(RegistrationICPFixture, PointToPoint)
+        ->Args({100})
+        ->Args({1000})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(RegistrationICPFixture, PointToPlane)
+        ->Args({100})
+        ->Args({1000})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(RegistrationICPFixture, PointToPlaneTukey)
+        ->Args({100})
+        ->Args({1000})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(RegistrationICPFixture, GeneralizedICP)
+        ->Args({100})
+        ->Args({1000})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(RegistrationICPFixture, ColoredICP)
+        ->Args({100})
+        ->Args({300})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(RegistrationICPFixture, ColoredICPCachedTarget)
+        ->Args({100})
+        ->Args({300})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(RegistrationICPFixture, MultiScaleByHand)
+        ->Args({300})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(RegistrationICPFixture, MultiScale)
+        ->Args({300})
+        ->Unit(benchmark::kMillisecond);
+BENCHMARK_REGISTER_F(RegistrationICPFixture, MultiScaleCachedTarget)
+        ->Args({300})
+        ->Unit(benchmark::kMillisecond);
@@ -0,0 +1,183 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2018 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/Registration/CorrespondenceChecker.h"
+#include "Open3D/Registration/FastGlobalRegistration.h"
+#include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/FeatureIndex.h"
+#include "Open3D/Registration/FragmentRegistration.h"
+#include "Open3D/Registration/Registration.h"
+#include "benchmark/benchmark.h"
+
+using namespace open3d;
+
+class RegistrationRANSACFixture : public benchmark::Fixture {
+public:
+    void SetUp(const benchmark::State& state) {
+        std::tie(source_, source_fpfh_) =
+                Preprocess(TEST_DATA_DIR "/Feature/cloud_bin_0.pcd");
+        std::tie(target_, target_fpfh_) =
+                Preprocess(TEST_DATA_DIR "/Feature/cloud_bin_1.pcd");
+    }
+
+    void TearDown(const benchmark::State& state) {
+        // empty
+    }
+
+    std::tuple<std::shared_ptr<geometry::PointCloud>,
+               std::shared_ptr<registration::Feature>>
+    Preprocess(const char* file_name) {
+        auto pcd = io::CreatePointCloudFromFile(file_name)->VoxelDownSample(
+                voxel_size_);
+        pcd->EstimateNormals(
+                geometry::KDTreeSearchParamHybrid(voxel_size_ * 2, 30));
+        auto fpfh = registration::ComputeFPFHFeature(
+                *pcd, geometry::KDTreeSearchParamHybrid(voxel_size_ * 5, 100));
+        return std::make_tuple(pcd, fpfh);
+    }
+
+    const double voxel_size_ = 0.05;
+    std::shared_ptr<geometry::PointCloud> source_, target_;
+    std::shared_ptr<registration::Feature> source_fpfh_, target_fpfh_;
+};
+
+BENCHMARK_DEFINE_F(RegistrationRANSACFixture, FeatureMatching)
+(benchmark::State& state) {
+    auto checker_edge_length =
+            registration::CorrespondenceCheckerBasedOnEdgeLength(0.9);
+    auto checker_distance =
+            registration::CorrespondenceCheckerBasedOnDistance(voxel_size_ *
+                                                               1.5);
+    int max_iteration = int(state.range(0));
+    bool mutual_filter = state.range(1) != 0;
+    int maximum_feature_checks = int(state.range(2));
+    int64_t iterations = 0;
+    for (auto _ : state) {
+        registration::RegistrationRANSACBasedOnFeatureMatching(
+                *source_, *target_, *source_fpfh_, *target_fpfh_,
+                voxel_size_ * 1.5,
+                registration::TransformationEstimationPointToPoint(false), 4,
+                {checker_edge_length, checker_distance},
+                registration::RANSACConvergenceCriteria(max_iteration,
+                                                        max_iteration),
+                mutual_filter, maximum_feature_checks);
+        iterations += max_iteration;
+    }
+    state.counters["iterations"] = benchmark::Counter(
+            double(iterations), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK_REGISTER_F(RegistrationRANSACFixture, FeatureMatching)
+        ->Args({10000, 0, -1})
+        ->Args({100000, 0, -1})
+        ->Args({10000, 1, -1})
+        ->Args({10000, 0, 64})
+        ->Args({10000, 1, 64})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(RegistrationRANSACFixture, MatchFeatures)
+(benchmark::State& state) {
+    bool mutual_filter = state.range(0) != 0;
+    int max_checks = int(state.range(1));
+    for (auto _ : state) {
+        registration::MatchFeatures(*source_fpfh_, *target_fpfh_,
+                                    mutual_filter, max_checks);
+    }
+}
+
+BENCHMARK_REGISTER_F(RegistrationRANSACFixture, MatchFeatures)
+        ->Args({0, -1})
+        ->Args({0, 16})
+        ->Args({0, 64})
+        ->Args({1, -1})
+        ->Args({1, 64})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(RegistrationRANSACFixture, FastGlobalRegistration)
+(benchmark::State& state) {
+    registration::FastGlobalRegistrationOption option;
+    option.maximum_feature_checks_ = int(state.range(0));
+    for (auto _ : state) {
+        registration::FastGlobalRegistration(*source_, *target_, *source_fpfh_,
+                                             *target_fpfh_, option);
+    }
+}
+
+BENCHMARK_REGISTER_F(RegistrationRANSACFixture, FastGlobalRegistration)
+        ->Args({-1})
+        ->Args({64})
+        ->Args({256})
+        ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_DEFINE_F(RegistrationRANSACFixture, RegisterFragmentPairs)
+(benchmark::State& state) {
+    bool batched = state.range(0) != 0;
+    registration::FragmentRegistrationOption option(voxel_size_);
+    option.global_registration_ =
+            registration::GlobalRegistrationMethod(state.range(1));
+    // Four fragments in a sequence with all loop closures.
+    geometry::PointCloud source = *io::CreatePointCloudFromFile(
+            TEST_DATA_DIR "/Feature/cloud_bin_0.pcd");
+    geometry::PointCloud target = *io::CreatePointCloudFromFile(
+            TEST_DATA_DIR "/Feature/cloud_bin_1.pcd");
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.1, 0.0, 0.0);
+    std::vector<geometry::PointCloud> fragments = {source, target, source,
+                                                   target};
+    fragments[2].Transform(transformation);
+    fragments[3].Transform(transformation);
+    std::vector<registration::FragmentPair> pairs;
+    for (int s = 0; s < 4; s++) {
+        for (int t = s + 1; t < 4; t++) {
+            pairs.push_back(registration::FragmentPair(s, t, t != s + 1));
+        }
+    }
+    for (auto _ : state) {
+        if (batched) {
+            registration::RegisterFragmentPairs(fragments, pairs, option);
+        } else {
+            // Every pair is registered on its own, repeating the
+            // preprocessing of the fragments.
+            for (const auto& pair : pairs) {
+                registration::RegisterFragmentPairs(
+                        {fragments[pair.source_id_],
+                         fragments[pair.target_id_]},
+                        {registration::FragmentPair(0, 1, pair.uncertain_,
+                                                    pair.init_)},
+                        option);
+            }
+        }
+    }
+}
+
+BENCHMARK_REGISTER_F(RegistrationRANSACFixture, RegisterFragmentPairs)
+        ->Args({0, 0})
+        ->Args({1, 0})
+        ->Args({0, 1})
+        ->Args({1, 1})
+        ->Unit(benchmark::kMillisecond);
@@ -26,6 +26,8 @@
 
 #include "Open3D/Geometry/Image.h"
 
+#include <algorithm>
+
 namespace {
 /// Isotropic 2D kernels are separable:
 /// two 1D kernels are applied in x and y direction.
@@ -35,6 +37,107 @@ const std::vector<double> Gaussian7 = {0.03125, 0.109375, 0.21875, 0.28125,
                                        0.21875, 0.109375, 0.03125};
 const std::vector<double> Sobel31 = {-1.0, 0.0, 1.0};
 const std::vector<double> Sobel32 = {1.0, 2.0, 1.0};
+
+/// Number of rows of the output of a separable filter computed by a thread at
+/// a time. Each band filters the rows it needs horizontally into a ring of
+/// kernel size rows, which stays in cache for the vertical pass.
+const int FILTER_BAND_ROWS = 32;
+
+/// Filters the row `in` of `width` pixels horizontally with `kernel` into
+/// `out`, replicating the border pixels. KERNEL_SIZE unrolls the taps of the
+/// common kernels, 0 takes the size from `kernel_size`.
+template <int KERNEL_SIZE>
+void FilterRow(const float *in,
+               int width,
+               const float *kernel,
+               int kernel_size,
+               float *out) {
+    const int size = KERNEL_SIZE > 0 ? KERNEL_SIZE : kernel_size;
+    const int half = size / 2;
+    const int x_begin = std::min(half, width);
+    const int x_end = std::max(x_begin, width - half);
+    auto FilterClamped = [&](int x) {
+        float sum = 0.0f;
+        for (int i = 0; i < size; i++) {
+            int x_shift = std::min(std::max(x + i - half, 0), width - 1);
+            sum += in[x_shift] * kernel[i];
+        }
+        out[x] = sum;
+    };
+    for (int x = 0; x < x_begin; x++) {
+        FilterClamped(x);
+    }
+    for (int x = x_begin; x < x_end; x++) {
+        const float *pi = in + x - half;
+        float sum = 0.0f;
+        for (int i = 0; i < size; i++) {
+            sum += pi[i] * kernel[i];
+        }
+        out[x] = sum;
+    }
+    for (int x = x_end; x < width; x++) {
+        FilterClamped(x);
+    }
+}
+
+/// Sums the rows `rows` of `width` pixels weighted by `kernel` into `out`.
+template <int KERNEL_SIZE>
+void FilterColumns(const float *const *rows,
+                   int width,
+                   const float *kernel,
+                   int kernel_size,
+                   float *out) {
+    const int size = KERNEL_SIZE > 0 ? KERNEL_SIZE : kernel_size;
+    for (int x = 0; x < width; x++) {
+        float sum = 0.0f;
+        for (int i = 0; i < size; i++) {
+            sum += rows[i][x] * kernel[i];
+        }
+        out[x] = sum;
+    }
+}
+
+void FilterRow(const float *in,
+               int width,
+               const std::vector<float> &kernel,
+               float *out) {
+    switch (kernel.size()) {
+        case 3:
+            FilterRow<3>(in, width, kernel.data(), 3, out);
+            break;
+        case 5:
+            FilterRow<5>(in, width, kernel.data(), 5, out);
+            break;
+        case 7:
+            FilterRow<7>(in, width, kernel.data(), 7, out);
+            break;
+        default:
+            FilterRow<0>(in, width, kernel.data(), int(kernel.size()), out);
+            break;
+    }
+}
+
+void FilterColumns(const float *const *rows,
+                   int width,
+                   const std::vector<float> &kernel,
+                   float *out) {
+    switch (kernel.size()) {
+        case 3:
+            FilterColumns<3>(rows, width, kernel.data(), 3, out);
+            break;
+        case 5:
+            FilterColumns<5>(rows, width, kernel.data(), 5, out);
+            break;
+        case 7:
+            FilterColumns<7>(rows, width, kernel.data(), 7, out);
+            break;
+        default:
+            FilterColumns<0>(rows, width, kernel.data(), int(kernel.size()),
+                             out);
+            break;
+    }
+}
+
 }  // unnamed namespace
 
 namespace open3d {
@@ -136,42 +239,42 @@ Image &Image::LinearTransform(double scale, double offset /* = 0.0*/) {
     if (num_of_channels_ != 1 || bytes_per_channel_ != 4) {
         utility::LogError("[LinearTransform] Unsupported image format.");
     }
-    for (int y = 0; y < height_; y++) {
-        for (int x = 0; x < width_; x++) {
-            float *p = PointerAt<float>(x, y);
-            (*p) = (float)(scale * (*p) + offset);
-        }
+    float *data = reinterpret_cast<float *>(data_.data());
+    const int num_pixels = width_ * height_;
+    for (int i = 0; i < num_pixels; i++) {
+        data[i] = (float)(scale * data[i] + offset);
     }
     return *this;
 }
 
 std::shared_ptr<Image> Image::Downsample() const {
     auto output = std::make_shared<Image>();
+    Downsample(*output);
+    return output;
+}
+
+void Image::Downsample(Image &output) const {
     if (num_of_channels_ != 1 || bytes_per_channel_ != 4) {
         utility::LogError("[Downsample] Unsupported image format.");
     }
-    int half_width = (int)floor((double)width_ / 2.0);
-    int half_height = (int)floor((double)height_ / 2.0);
-    output->Prepare(half_width, half_height, 1, 4);
+    if (&output == this) {
+        utility::LogError("[Downsample] Output must not be the input image.");
+    }
+    output.Prepare(width_ / 2, height_ / 2, 1, 4);
 
 #ifdef _OPENMP
-#ifdef _WIN32
 #pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
 #endif
-#endif
-    for (int y = 0; y < output->height_; y++) {
-        for (int x = 0; x < output->width_; x++) {
-            float *p1 = PointerAt<float>(x * 2, y * 2);
-            float *p2 = PointerAt<float>(x * 2 + 1, y * 2);
-            float *p3 = PointerAt<float>(x * 2, y * 2 + 1);
-            float *p4 = PointerAt<float>(x * 2 + 1, y * 2 + 1);
-            float *p = output->PointerAt<float>(x, y);
-            *p = (*p1 + *p2 + *p3 + *p4) / 4.0f;
+    for (int y = 0; y < output.height_; y++) {
+        const float *row0 = PointerAt<float>(0, y * 2);
+        const float *row1 = PointerAt<float>(0, y * 2 + 1);
+        float *po = output.PointerAt<float>(0, y);
+        for (int x = 0; x < output.width_; x++) {
+            po[x] = (row0[x * 2] + row0[x * 2 + 1] + row1[x * 2] +
+                     row1[x * 2 + 1]) /
+                    4.0f;
         }
     }
-    return output;
 }
 
 std::shared_ptr<Image> Image::FilterHorizontal(
@@ -184,84 +287,127 @@ std::shared_ptr<Image> Image::FilterHorizontal(
                 "size.");
     }
     output->Prepare(width_, height_, 1, 4);
-
-    const int half_kernel_size = (int)(floor((double)kernel.size() / 2.0));
+    const std::vector<float> kernel_f(kernel.begin(), kernel.end());
 
 #ifdef _OPENMP
-#ifdef _WIN32
 #pragma omp parallel for schedule(static)
-#else
-#pragma omp parallel for collapse(2) schedule(static)
-#endif
 #endif
     for (int y = 0; y < height_; y++) {
-        for (int x = 0; x < width_; x++) {
-            float *po = output->PointerAt<float>(x, y, 0);
-            double temp = 0;
-            for (int i = -half_kernel_size; i <= half_kernel_size; i++) {
-                int x_shift = x + i;
-                if (x_shift < 0) x_shift = 0;
-                if (x_shift > width_ - 1) x_shift = width_ - 1;
-                float *pi = PointerAt<float>(x_shift, y, 0);
-                temp += (*pi * (float)kernel[i + half_kernel_size]);
-            }
-            *po = (float)temp;
-        }
+        FilterRow(PointerAt<float>(0, y), width_, kernel_f,
+                  output->PointerAt<float>(0, y));
     }
     return output;
 }
 
 std::shared_ptr<Image> Image::Filter(Image::FilterType type) const {
     auto output = std::make_shared<Image>();
-    if (num_of_channels_ != 1 || bytes_per_channel_ != 4) {
-        utility::LogError("[Filter] Unsupported image format.");
-    }
+    Filter(type, *output);
+    return output;
+}
 
+void Image::Filter(Image::FilterType type, Image &output) const {
     switch (type) {
         case Image::FilterType::Gaussian3:
-            output = Filter(Gaussian3, Gaussian3);
+            Filter(Gaussian3, Gaussian3, output);
             break;
         case Image::FilterType::Gaussian5:
-            output = Filter(Gaussian5, Gaussian5);
+            Filter(Gaussian5, Gaussian5, output);
             break;
         case Image::FilterType::Gaussian7:
-            output = Filter(Gaussian7, Gaussian7);
+            Filter(Gaussian7, Gaussian7, output);
             break;
         case Image::FilterType::Sobel3Dx:
-            output = Filter(Sobel31, Sobel32);
+            Filter(Sobel31, Sobel32, output);
             break;
         case Image::FilterType::Sobel3Dy:
-            output = Filter(Sobel32, Sobel31);
+            Filter(Sobel32, Sobel31, output);
             break;
         default:
             utility::LogError("[Filter] Unsupported filter type.");
             break;
     }
-    return output;
 }
 
 ImagePyramid Image::FilterPyramid(const ImagePyramid &input,
                                   Image::FilterType type) {
-    std::vector<std::shared_ptr<Image>> output;
+    ImagePyramid output;
+    FilterPyramid(input, type, output);
+    return output;
+}
+
+void Image::FilterPyramid(const ImagePyramid &input,
+                          Image::FilterType type,
+                          ImagePyramid &output) {
+    output.resize(input.size());
     for (size_t i = 0; i < input.size(); i++) {
-        auto layer_filtered = input[i]->Filter(type);
-        output.push_back(layer_filtered);
+        if (!output[i]) {
+            output[i] = std::make_shared<Image>();
+        }
+        input[i]->Filter(type, *output[i]);
     }
-    return output;
 }
 
 std::shared_ptr<Image> Image::Filter(const std::vector<double> &dx,
                                      const std::vector<double> &dy) const {
     auto output = std::make_shared<Image>();
-    if (num_of_channels_ != 1 || bytes_per_channel_ != 4) {
-        utility::LogError("[Filter] Unsupported image format.");
+    Filter(dx, dy, *output);
+    return output;
+}
+
+void Image::Filter(const std::vector<double> &dx,
+                   const std::vector<double> &dy,
+                   Image &output) const {
+    if (num_of_channels_ != 1 || bytes_per_channel_ != 4 ||
+        dx.size() % 2 != 1 || dy.size() % 2 != 1) {
+        utility::LogError("[Filter] Unsupported image format or kernel size.");
     }
+    if (&output == this) {
+        utility::LogError("[Filter] Output must not be the input image.");
+    }
+    output.Prepare(width_, height_, 1, 4);
+    const std::vector<float> dx_f(dx.begin(), dx.end());
+    const std::vector<float> dy_f(dy.begin(), dy.end());
+    const int size = int(dy.size());
+    const int half = size / 2;
+    const int num_bands = (height_ + FILTER_BAND_ROWS - 1) / FILTER_BAND_ROWS;
 
-    auto temp1 = FilterHorizontal(dx);
-    auto temp2 = temp1->Transpose();
-    auto temp3 = temp2->FilterHorizontal(dy);
-    auto temp4 = temp3->Transpose();
-    return temp4;
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        // Row r of the input, filtered horizontally, is kept in the slot
+        // r % size of the ring while the output rows r - half to r + half
+        // are computed.
+        std::vector<float> ring(size_t(size) * width_);
+        std::vector<const float *> rows(size);
+        auto FilterRowToRing = [&](int r) {
+            int slot = ((r % size) + size) % size;
+            int y = std::min(std::max(r, 0), height_ - 1);
+            FilterRow(PointerAt<float>(0, y), width_, dx_f,
+                      ring.data() + size_t(slot) * width_);
+        };
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int band = 0; band < num_bands; band++) {
+            int y_begin = band * FILTER_BAND_ROWS;
+            int y_end = std::min(y_begin + FILTER_BAND_ROWS, height_);
+            for (int r = y_begin - half; r < y_begin + half; r++) {
+                FilterRowToRing(r);
+            }
+            for (int y = y_begin; y < y_end; y++) {
+                FilterRowToRing(y + half);
+                for (int i = 0; i < size; i++) {
+                    int slot = (((y - half + i) % size) + size) % size;
+                    rows[i] = ring.data() + size_t(slot) * width_;
+                }
+                FilterColumns(rows.data(), width_, dy_f,
+                              output.PointerAt<float>(0, y));
+            }
+        }
+#ifdef _OPENMP
+    }
+#endif
 }
 
 std::shared_ptr<Image> Image::Transpose() const {
@@ -172,16 +172,33 @@ public:
     /// Function to filter image with pre-defined filtering type.
     std::shared_ptr<Image> Filter(Image::FilterType type) const;
 
+    /// Function to filter image with pre-defined filtering type into
+    /// `output`, whose buffer is reused if it already has the size of the
+    /// image. `output` must not be the image itself.
+    void Filter(Image::FilterType type, Image &output) const;
+
     /// Function to filter image with arbitrary dx, dy separable filters.
     std::shared_ptr<Image> Filter(const std::vector<double> &dx,
                                   const std::vector<double> &dy) const;
 
+    /// Function to filter image with arbitrary dx, dy separable filters into
+    /// `output`. The rows are filtered horizontally and then vertically in
+    /// bands, in single precision.
+    void Filter(const std::vector<double> &dx,
+                const std::vector<double> &dy,
+                Image &output) const;
+
     std::shared_ptr<Image> FilterHorizontal(
             const std::vector<double> &kernel) const;
 
     /// Function to 2x image downsample using simple 2x2 averaging.
     std::shared_ptr<Image> Downsample() const;
 
+    /// Function to 2x image downsample using simple 2x2 averaging into
+    /// `output`, whose buffer is reused. `output` must not be the image
+    /// itself.
+    void Downsample(Image &output) const;
+
     /// Function to dilate 8bit mask map.
     std::shared_ptr<Image> Dilate(int half_kernel_size = 1) const;
 
@@ -205,10 +222,22 @@ public:
     static ImagePyramid FilterPyramid(const ImagePyramid &input,
                                       Image::FilterType type);
 
+    /// Function to filter image pyramid into `output`, reusing its images.
+    static void FilterPyramid(const ImagePyramid &input,
+                              Image::FilterType type,
+                              ImagePyramid &output);
+
     /// Function to create image pyramid.
     ImagePyramid CreatePyramid(size_t num_of_levels,
                                bool with_gaussian_filter = true) const;
 
+    /// Function to create image pyramid into `pyramid`. The images of
+    /// `pyramid` are overwritten and their buffers reused, so that pyramids
+    /// of a stream of images are built without allocations.
+    void CreatePyramid(size_t num_of_levels,
+                       bool with_gaussian_filter,
+                       ImagePyramid &pyramid) const;
+
     /// Function to create a depthmap boundary mask from depth image.
     std::shared_ptr<Image> CreateDepthBoundaryMask(
             double depth_threshold_for_discontinuity_check = 0.1,
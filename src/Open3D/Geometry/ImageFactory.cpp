@@ -144,31 +144,39 @@ template std::shared_ptr<Image> Image::CreateImageFromFloatImage<uint16_t>()
 
 ImagePyramid Image::CreatePyramid(size_t num_of_levels,
                                   bool with_gaussian_filter /*= true*/) const {
-    std::vector<std::shared_ptr<Image>> pyramid_image;
-    pyramid_image.clear();
+    ImagePyramid pyramid_image;
+    CreatePyramid(num_of_levels, with_gaussian_filter, pyramid_image);
+    return pyramid_image;
+}
+
+void Image::CreatePyramid(size_t num_of_levels,
+                          bool with_gaussian_filter,
+                          ImagePyramid &pyramid_image) const {
     if ((num_of_channels_ != 1) || (bytes_per_channel_ != 4)) {
         utility::LogError("[CreateImagePyramid] Unsupported image format.");
     }
 
+    pyramid_image.resize(num_of_levels);
+    for (auto &level : pyramid_image) {
+        if (!level) {
+            level = std::make_shared<Image>();
+        }
+    }
+    Image level_b;
     for (size_t i = 0; i < num_of_levels; i++) {
         if (i == 0) {
-            std::shared_ptr<Image> input_copy_ptr = std::make_shared<Image>();
-            *input_copy_ptr = *this;
-            pyramid_image.push_back(input_copy_ptr);
+            *pyramid_image[0] = *this;
         } else {
             if (with_gaussian_filter) {
                 // https://en.wikipedia.org/wiki/Pyramid_(image_processing)
-                auto level_b = pyramid_image[i - 1]->Filter(
-                        Image::FilterType::Gaussian3);
-                auto level_bd = level_b->Downsample();
-                pyramid_image.push_back(level_bd);
+                pyramid_image[i - 1]->Filter(Image::FilterType::Gaussian3,
+                                             level_b);
+                level_b.Downsample(*pyramid_image[i]);
             } else {
-                auto level_d = pyramid_image[i - 1]->Downsample();
-                pyramid_image.push_back(level_d);
+                pyramid_image[i - 1]->Downsample(*pyramid_image[i]);
             }
         }
     }
-    return pyramid_image;
 }
 
 }  // namespace geometry
@@ -50,36 +50,56 @@ Eigen::Vector2d RGBDImage::GetMaxBound() const {
 RGBDImagePyramid RGBDImage::FilterPyramid(
         const RGBDImagePyramid &rgbd_image_pyramid, Image::FilterType type) {
     RGBDImagePyramid rgbd_image_pyramid_filtered;
-    rgbd_image_pyramid_filtered.clear();
+    FilterPyramid(rgbd_image_pyramid, type, rgbd_image_pyramid_filtered);
+    return rgbd_image_pyramid_filtered;
+}
+
+void RGBDImage::FilterPyramid(const RGBDImagePyramid &rgbd_image_pyramid,
+                              Image::FilterType type,
+                              RGBDImagePyramid &output) {
     int num_of_levels = (int)rgbd_image_pyramid.size();
+    output.resize(num_of_levels);
     for (int level = 0; level < num_of_levels; level++) {
-        auto color_level = rgbd_image_pyramid[level]->color_;
-        auto depth_level = rgbd_image_pyramid[level]->depth_;
-        auto color_level_filtered = color_level.Filter(type);
-        auto depth_level_filtered = depth_level.Filter(type);
-        auto rgbd_image_level_filtered = std::make_shared<RGBDImage>(
-                RGBDImage(*color_level_filtered, *depth_level_filtered));
-        rgbd_image_pyramid_filtered.push_back(rgbd_image_level_filtered);
+        if (!output[level]) {
+            output[level] = std::make_shared<RGBDImage>();
+        }
+        rgbd_image_pyramid[level]->color_.Filter(type, output[level]->color_);
+        rgbd_image_pyramid[level]->depth_.Filter(type, output[level]->depth_);
     }
-    return rgbd_image_pyramid_filtered;
 }
 
 RGBDImagePyramid RGBDImage::CreatePyramid(
         size_t num_of_levels,
         bool with_gaussian_filter_for_color /* = true */,
         bool with_gaussian_filter_for_depth /* = false */) const {
-    ImagePyramid color_pyramid =
-            color_.CreatePyramid(num_of_levels, with_gaussian_filter_for_color);
-    ImagePyramid depth_pyramid =
-            depth_.CreatePyramid(num_of_levels, with_gaussian_filter_for_depth);
     RGBDImagePyramid rgbd_image_pyramid;
-    rgbd_image_pyramid.clear();
+    CreatePyramid(num_of_levels, with_gaussian_filter_for_color,
+                  with_gaussian_filter_for_depth, rgbd_image_pyramid);
+    return rgbd_image_pyramid;
+}
+
+void RGBDImage::CreatePyramid(size_t num_of_levels,
+                              bool with_gaussian_filter_for_color,
+                              bool with_gaussian_filter_for_depth,
+                              RGBDImagePyramid &pyramid) const {
+    pyramid.resize(num_of_levels);
+    // The color and depth pyramids alias the images of the levels, so that
+    // they are built in place.
+    ImagePyramid color_pyramid(num_of_levels);
+    ImagePyramid depth_pyramid(num_of_levels);
     for (size_t level = 0; level < num_of_levels; level++) {
-        auto rgbd_image_level = std::make_shared<RGBDImage>(
-                RGBDImage(*color_pyramid[level], *depth_pyramid[level]));
-        rgbd_image_pyramid.push_back(rgbd_image_level);
+        if (!pyramid[level]) {
+            pyramid[level] = std::make_shared<RGBDImage>();
+        }
+        color_pyramid[level] =
+                std::shared_ptr<Image>(pyramid[level], &pyramid[level]->color_);
+        depth_pyramid[level] =
+                std::shared_ptr<Image>(pyramid[level], &pyramid[level]->depth_);
     }
-    return rgbd_image_pyramid;
+    color_.CreatePyramid(num_of_levels, with_gaussian_filter_for_color,
+                         color_pyramid);
+    depth_.CreatePyramid(num_of_levels, with_gaussian_filter_for_depth,
+                         depth_pyramid);
 }
 
 }  // namespace geometry
@@ -130,11 +130,24 @@ public:
     static RGBDImagePyramid FilterPyramid(
             const RGBDImagePyramid &rgbd_image_pyramid, Image::FilterType type);
 
+    /// Filters the color and depth images of `rgbd_image_pyramid` into
+    /// `output`, reusing the images of its levels.
+    static void FilterPyramid(const RGBDImagePyramid &rgbd_image_pyramid,
+                              Image::FilterType type,
+                              RGBDImagePyramid &output);
+
     RGBDImagePyramid CreatePyramid(
             size_t num_of_levels,
             bool with_gaussian_filter_for_color = true,
             bool with_gaussian_filter_for_depth = false) const;
 
+    /// Creates the pyramid into `pyramid`. The images of its levels are
+    /// overwritten and their buffers reused.
+    void CreatePyramid(size_t num_of_levels,
+                       bool with_gaussian_filter_for_color,
+                       bool with_gaussian_filter_for_depth,
+                       RGBDImagePyramid &pyramid) const;
+
 public:
     /// The color image.
     Image color_;
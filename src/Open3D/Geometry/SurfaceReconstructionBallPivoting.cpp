@@ -32,19 +32,20 @@
 
 #include <Eigen/Dense>
 
-#include <iostream>
-#include <list>
+#include <algorithm>
+#include <deque>
+#include <numeric>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
 namespace open3d {
 namespace geometry {
 
-class BallPivotingVertex;
-class BallPivotingEdge;
-class BallPivotingTriangle;
-
-typedef BallPivotingVertex* BallPivotingVertexPtr;
-typedef std::shared_ptr<BallPivotingEdge> BallPivotingEdgePtr;
-typedef std::shared_ptr<BallPivotingTriangle> BallPivotingTrianglePtr;
+// Vertices, edges and triangles of the ball pivoting front live in indexed
+// pools (see BallPivotingRegion) and refer to each other by their pool index,
+// -1 denoting no element.
 
 class BallPivotingVertex {
 public:
@@ -53,108 +54,109 @@ public:
     BallPivotingVertex(int idx,
                        const Eigen::Vector3d& point,
                        const Eigen::Vector3d& normal)
-        : idx_(idx), point_(point), normal_(normal), type_(Orphan) {}
-
-    void UpdateType();
+        : idx_(idx),
+          point_(point),
+          normal_(normal),
+          edge_(-1),
+          type_(Orphan),
+          region_(0) {}
 
 public:
     int idx_;
     const Eigen::Vector3d& point_;
     const Eigen::Vector3d& normal_;
-    std::unordered_set<BallPivotingEdgePtr> edges_;
+    /// First edge of the list of edges adjacent to the vertex. The list is
+    /// threaded through the edges, see BallPivotingEdge::Next.
+    int edge_;
     Type type_;
+    /// Region that owns the vertex in the parallel reconstruction.
+    int region_;
 };
 
 class BallPivotingEdge {
 public:
     enum Type { Border = 0, Front = 1, Inner = 2 };
 
-    BallPivotingEdge(BallPivotingVertexPtr source, BallPivotingVertexPtr target)
-        : source_(source), target_(target), type_(Type::Front) {}
-
-    void AddAdjacentTriangle(BallPivotingTrianglePtr triangle);
-    BallPivotingVertexPtr GetOppositeVertex();
+    BallPivotingEdge(int source, int target)
+        : source_(source),
+          target_(target),
+          triangle0_(-1),
+          triangle1_(-1),
+          source_next_(-1),
+          target_next_(-1),
+          type_(Type::Front) {}
+
+    /// Next edge in the edge list of vertex \param vidx.
+    int Next(int vidx) const {
+        return vidx == source_ ? source_next_ : target_next_;
+    }
 
 public:
-    BallPivotingVertexPtr source_;
-    BallPivotingVertexPtr target_;
-    BallPivotingTrianglePtr triangle0_;
-    BallPivotingTrianglePtr triangle1_;
+    int source_;
+    int target_;
+    int triangle0_;
+    int triangle1_;
+    int source_next_;
+    int target_next_;
     Type type_;
 };
 
 class BallPivotingTriangle {
 public:
-    BallPivotingTriangle(BallPivotingVertexPtr vert0,
-                         BallPivotingVertexPtr vert1,
-                         BallPivotingVertexPtr vert2,
-                         Eigen::Vector3d ball_center)
+    BallPivotingTriangle(int vert0,
+                         int vert1,
+                         int vert2,
+                         const Eigen::Vector3d& ball_center)
         : vert0_(vert0),
           vert1_(vert1),
           vert2_(vert2),
           ball_center_(ball_center) {}
 
 public:
-    BallPivotingVertexPtr vert0_;
-    BallPivotingVertexPtr vert1_;
-    BallPivotingVertexPtr vert2_;
+    int vert0_;
+    int vert1_;
+    int vert2_;
     Eigen::Vector3d ball_center_;
 };
 
-void BallPivotingVertex::UpdateType() {
-    if (edges_.empty()) {
-        type_ = Type::Orphan;
-    } else {
-        for (const BallPivotingEdgePtr& edge : edges_) {
-            if (edge->type_ != BallPivotingEdge::Type::Inner) {
-                type_ = Type::Front;
-                return;
-            }
-        }
-        type_ = Type::Inner;
-    }
-}
+/// Edge and triangle pools and fronts of a part of the reconstruction. In the
+/// parallel reconstruction every region only creates triangles between the
+/// vertices it owns, hence regions never touch each other's state. Pivots and
+/// seeds that need vertices of another region are deferred to a serial
+/// stitching pass.
+class BallPivotingRegion {
+public:
+    explicit BallPivotingRegion(int region) : region_(region) {}
 
-void BallPivotingEdge::AddAdjacentTriangle(BallPivotingTrianglePtr triangle) {
-    if (triangle != triangle0_ && triangle != triangle1_) {
-        if (triangle0_ == nullptr) {
-            triangle0_ = triangle;
-            type_ = Type::Front;
-            // update orientation
-            BallPivotingVertexPtr opp = GetOppositeVertex();
-            Eigen::Vector3d tr_norm =
-                    (target_->point_ - source_->point_)
-                            .cross(opp->point_ - source_->point_);
-            tr_norm /= tr_norm.norm();
-            Eigen::Vector3d pt_norm =
-                    source_->normal_ + target_->normal_ + opp->normal_;
-            pt_norm /= pt_norm.norm();
-            if (pt_norm.dot(tr_norm) < 0) {
-                std::swap(target_, source_);
-            }
-        } else if (triangle1_ == nullptr) {
-            triangle1_ = triangle;
-            type_ = Type::Inner;
-        } else {
-            utility::LogDebug("!!! This case should not happen");
-        }
-    }
-}
+public:
+    /// Index of the region, -1 if all vertices may be used.
+    int region_;
+    std::vector<int> vertices_;
+    std::vector<BallPivotingEdge> edges_;
+    std::vector<BallPivotingTriangle> triangles_;
+    std::deque<int> edge_front_;
+    std::vector<int> border_edges_;
+    /// Deferred front edges and seed vertices with the index of their radius.
+    std::vector<std::pair<int, size_t>> deferred_edges_;
+    std::vector<std::pair<int, size_t>> deferred_seeds_;
+    std::vector<Eigen::Vector3i> mesh_triangles_;
+    std::vector<Eigen::Vector3d> mesh_triangle_normals_;
+};
 
-BallPivotingVertexPtr BallPivotingEdge::GetOppositeVertex() {
-    if (triangle0_ != nullptr) {
-        if (triangle0_->vert0_->idx_ != source_->idx_ &&
-            triangle0_->vert0_->idx_ != target_->idx_) {
-            return triangle0_->vert0_;
-        } else if (triangle0_->vert1_->idx_ != source_->idx_ &&
-                   triangle0_->vert1_->idx_ != target_->idx_) {
-            return triangle0_->vert1_;
-        } else {
-            return triangle0_->vert2_;
-        }
-    } else {
-        return nullptr;
-    }
+/// Returns the number of slabs of the parallel reconstruction of a point
+/// cloud with bounding box \param extent, or 0 if it is too small for more
+/// than one slab. Slabs are kept wider than 8 times the largest ball.
+static int ComputeBallPivotingRegionCount(const Eigen::Vector3d& extent,
+                                          double max_radius) {
+#ifdef _OPENMP
+    int num_threads = omp_get_max_threads();
+#else
+    int num_threads = 1;
+#endif
+    int num_regions =
+            std::min(4 * num_threads,
+                     int(std::min(extent.maxCoeff() / (8 * max_radius), 1e6)));
+    return num_regions < 2 ? 0 : num_regions;
 }
 
 class BallPivoting {
@@ -165,27 +167,25 @@ public:
         mesh_->vertices_ = pcd.points_;
         mesh_->vertex_normals_ = pcd.normals_;
         mesh_->vertex_colors_ = pcd.colors_;
-        for (size_t vidx = 0; vidx < pcd.points_.size(); ++vidx) {
-            vertices.emplace_back(new BallPivotingVertex(static_cast<int>(vidx),
-                                                         pcd.points_[vidx],
-                                                         pcd.normals_[vidx]));
+        if (has_normals_) {
+            vertices.reserve(pcd.points_.size());
+            for (size_t vidx = 0; vidx < pcd.points_.size(); ++vidx) {
+                vertices.emplace_back(static_cast<int>(vidx), pcd.points_[vidx],
+                                      pcd.normals_[vidx]);
+            }
         }
     }
 
-    virtual ~BallPivoting() {
-        for (auto vert : vertices) {
-            delete vert;
-        }
-    }
+    virtual ~BallPivoting() {}
 
     bool ComputeBallCenter(int vidx1,
                            int vidx2,
                            int vidx3,
                            double radius,
-                           Eigen::Vector3d& center) {
-        const Eigen::Vector3d& v1 = vertices[vidx1]->point_;
-        const Eigen::Vector3d& v2 = vertices[vidx2]->point_;
-        const Eigen::Vector3d& v3 = vertices[vidx3]->point_;
+                           Eigen::Vector3d& center) const {
+        const Eigen::Vector3d& v1 = vertices[vidx1].point_;
+        const Eigen::Vector3d& v2 = vertices[vidx2].point_;
+        const Eigen::Vector3d& v3 = vertices[vidx3].point_;
         double c = (v2 - v1).squaredNorm();
         double b = (v1 - v3).squaredNorm();
         double a = (v3 - v2).squaredNorm();
@@ -216,9 +216,9 @@ public:
         if (height >= 0.0) {
             Eigen::Vector3d tr_norm = (v2 - v1).cross(v3 - v1);
             tr_norm /= tr_norm.norm();
-            Eigen::Vector3d pt_norm = vertices[vidx1]->normal_ +
-                                      vertices[vidx2]->normal_ +
-                                      vertices[vidx3]->normal_;
+            Eigen::Vector3d pt_norm = vertices[vidx1].normal_ +
+                                      vertices[vidx2].normal_ +
+                                      vertices[vidx3].normal_;
             pt_norm /= pt_norm.norm();
             if (tr_norm.dot(pt_norm) < 0) {
                 tr_norm *= -1;
@@ -231,72 +231,143 @@ public:
         return false;
     }
 
-    BallPivotingEdgePtr GetLinkingEdge(const BallPivotingVertexPtr& v0,
-                                       const BallPivotingVertexPtr& v1) {
-        for (BallPivotingEdgePtr edge0 : v0->edges_) {
-            for (BallPivotingEdgePtr edge1 : v1->edges_) {
-                if (edge0->source_->idx_ == edge1->source_->idx_ &&
-                    edge0->target_->idx_ == edge1->target_->idx_) {
-                    return edge0;
-                }
+    bool Owns(const BallPivotingRegion& region, int vidx) const {
+        return region.region_ < 0 || vertices[vidx].region_ == region.region_;
+    }
+
+    void UpdateType(const BallPivotingRegion& region, int vidx) {
+        BallPivotingVertex& vertex = vertices[vidx];
+        if (vertex.edge_ < 0) {
+            vertex.type_ = BallPivotingVertex::Type::Orphan;
+            return;
+        }
+        for (int eidx = vertex.edge_; eidx >= 0;
+             eidx = region.edges_[eidx].Next(vidx)) {
+            if (region.edges_[eidx].type_ != BallPivotingEdge::Type::Inner) {
+                vertex.type_ = BallPivotingVertex::Type::Front;
+                return;
             }
         }
-        return nullptr;
+        vertex.type_ = BallPivotingVertex::Type::Inner;
     }
 
-    void CreateTriangle(const BallPivotingVertexPtr& v0,
-                        const BallPivotingVertexPtr& v1,
-                        const BallPivotingVertexPtr& v2,
+    int GetOppositeVertex(const BallPivotingRegion& region, int eidx) const {
+        const BallPivotingEdge& edge = region.edges_[eidx];
+        if (edge.triangle0_ < 0) {
+            return -1;
+        }
+        const BallPivotingTriangle& triangle =
+                region.triangles_[edge.triangle0_];
+        if (triangle.vert0_ != edge.source_ &&
+            triangle.vert0_ != edge.target_) {
+            return triangle.vert0_;
+        } else if (triangle.vert1_ != edge.source_ &&
+                   triangle.vert1_ != edge.target_) {
+            return triangle.vert1_;
+        } else {
+            return triangle.vert2_;
+        }
+    }
+
+    void AddAdjacentTriangle(BallPivotingRegion& region, int eidx, int tidx) {
+        BallPivotingEdge& edge = region.edges_[eidx];
+        if (tidx == edge.triangle0_ || tidx == edge.triangle1_) {
+            return;
+        }
+        if (edge.triangle0_ < 0) {
+            edge.triangle0_ = tidx;
+            edge.type_ = BallPivotingEdge::Type::Front;
+            // update orientation
+            const BallPivotingVertex& src = vertices[edge.source_];
+            const BallPivotingVertex& tgt = vertices[edge.target_];
+            const BallPivotingVertex& opp =
+                    vertices[GetOppositeVertex(region, eidx)];
+            Eigen::Vector3d tr_norm = (tgt.point_ - src.point_)
+                                              .cross(opp.point_ - src.point_);
+            tr_norm /= tr_norm.norm();
+            Eigen::Vector3d pt_norm = src.normal_ + tgt.normal_ + opp.normal_;
+            pt_norm /= pt_norm.norm();
+            if (pt_norm.dot(tr_norm) < 0) {
+                std::swap(edge.target_, edge.source_);
+                std::swap(edge.target_next_, edge.source_next_);
+            }
+        } else if (edge.triangle1_ < 0) {
+            edge.triangle1_ = tidx;
+            edge.type_ = BallPivotingEdge::Type::Inner;
+        } else {
+            utility::LogDebug("!!! This case should not happen");
+        }
+    }
+
+    int GetLinkingEdge(const BallPivotingRegion& region, int v0, int v1) const {
+        for (int eidx = vertices[v0].edge_; eidx >= 0;
+             eidx = region.edges_[eidx].Next(v0)) {
+            const BallPivotingEdge& edge = region.edges_[eidx];
+            if (edge.source_ == v1 || edge.target_ == v1) {
+                return eidx;
+            }
+        }
+        return -1;
+    }
+
+    int AddEdge(BallPivotingRegion& region, int v0, int v1) {
+        int eidx = int(region.edges_.size());
+        region.edges_.emplace_back(v0, v1);
+        BallPivotingEdge& edge = region.edges_.back();
+        edge.source_next_ = vertices[v0].edge_;
+        edge.target_next_ = vertices[v1].edge_;
+        vertices[v0].edge_ = eidx;
+        vertices[v1].edge_ = eidx;
+        return eidx;
+    }
+
+    void CreateTriangle(BallPivotingRegion& region,
+                        int v0,
+                        int v1,
+                        int v2,
                         const Eigen::Vector3d& center) {
         utility::LogDebug(
-                "[CreateTriangle] with v0.idx={}, v1.idx={}, v2.idx={}",
-                v0->idx_, v1->idx_, v2->idx_);
-        BallPivotingTrianglePtr triangle =
-                std::make_shared<BallPivotingTriangle>(v0, v1, v2, center);
-
-        BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v1);
-        if (e0 == nullptr) {
-            e0 = std::make_shared<BallPivotingEdge>(v0, v1);
-        }
-        e0->AddAdjacentTriangle(triangle);
-        v0->edges_.insert(e0);
-        v1->edges_.insert(e0);
-
-        BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
-        if (e1 == nullptr) {
-            e1 = std::make_shared<BallPivotingEdge>(v1, v2);
-        }
-        e1->AddAdjacentTriangle(triangle);
-        v1->edges_.insert(e1);
-        v2->edges_.insert(e1);
-
-        BallPivotingEdgePtr e2 = GetLinkingEdge(v2, v0);
-        if (e2 == nullptr) {
-            e2 = std::make_shared<BallPivotingEdge>(v2, v0);
-        }
-        e2->AddAdjacentTriangle(triangle);
-        v2->edges_.insert(e2);
-        v0->edges_.insert(e2);
-
-        v0->UpdateType();
-        v1->UpdateType();
-        v2->UpdateType();
-
-        Eigen::Vector3d face_normal =
-                ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
-        if (face_normal.dot(v0->normal_) > -1e-16) {
-            mesh_->triangles_.emplace_back(
-                    Eigen::Vector3i(v0->idx_, v1->idx_, v2->idx_));
+                "[CreateTriangle] with v0.idx={}, v1.idx={}, v2.idx={}", v0,
+                v1, v2);
+        int tidx = int(region.triangles_.size());
+        region.triangles_.emplace_back(v0, v1, v2, center);
+
+        int e0 = GetLinkingEdge(region, v0, v1);
+        if (e0 < 0) {
+            e0 = AddEdge(region, v0, v1);
+        }
+        AddAdjacentTriangle(region, e0, tidx);
+
+        int e1 = GetLinkingEdge(region, v1, v2);
+        if (e1 < 0) {
+            e1 = AddEdge(region, v1, v2);
+        }
+        AddAdjacentTriangle(region, e1, tidx);
+
+        int e2 = GetLinkingEdge(region, v2, v0);
+        if (e2 < 0) {
+            e2 = AddEdge(region, v2, v0);
+        }
+        AddAdjacentTriangle(region, e2, tidx);
+
+        UpdateType(region, v0);
+        UpdateType(region, v1);
+        UpdateType(region, v2);
+
+        const BallPivotingVertex& vert0 = vertices[v0];
+        Eigen::Vector3d face_normal = ComputeFaceNormal(
+                vert0.point_, vertices[v1].point_, vertices[v2].point_);
+        if (face_normal.dot(vert0.normal_) > -1e-16) {
+            region.mesh_triangles_.emplace_back(Eigen::Vector3i(v0, v1, v2));
         } else {
-            mesh_->triangles_.emplace_back(
-                    Eigen::Vector3i(v0->idx_, v2->idx_, v1->idx_));
+            region.mesh_triangles_.emplace_back(Eigen::Vector3i(v0, v2, v1));
         }
-        mesh_->triangle_normals_.push_back(face_normal);
+        region.mesh_triangle_normals_.push_back(face_normal);
     }
 
     Eigen::Vector3d ComputeFaceNormal(const Eigen::Vector3d& v0,
                                       const Eigen::Vector3d& v1,
-                                      const Eigen::Vector3d& v2) {
+                                      const Eigen::Vector3d& v2) const {
         Eigen::Vector3d normal = (v1 - v0).cross(v2 - v0);
         double norm = normal.norm();
         if (norm > 0) {
@@ -305,54 +376,45 @@ public:
         return normal;
     }
 
-    bool IsCompatible(const BallPivotingVertexPtr& v0,
-                      const BallPivotingVertexPtr& v1,
-                      const BallPivotingVertexPtr& v2) {
-        utility::LogDebug("[IsCompatible] v0.idx={}, v1.idx={}, v2.idx={}",
-                          v0->idx_, v1->idx_, v2->idx_);
+    bool IsCompatible(int vidx0, int vidx1, int vidx2) const {
+        const BallPivotingVertex& v0 = vertices[vidx0];
+        const BallPivotingVertex& v1 = vertices[vidx1];
+        const BallPivotingVertex& v2 = vertices[vidx2];
         Eigen::Vector3d normal =
-                ComputeFaceNormal(v0->point_, v1->point_, v2->point_);
-        if (normal.dot(v0->normal_) < -1e-16) {
+                ComputeFaceNormal(v0.point_, v1.point_, v2.point_);
+        if (normal.dot(v0.normal_) < -1e-16) {
             normal *= -1;
         }
-        bool ret = normal.dot(v0->normal_) > -1e-16 &&
-                   normal.dot(v1->normal_) > -1e-16 &&
-                   normal.dot(v2->normal_) > -1e-16;
-        utility::LogDebug("[IsCompatible] returns = {}", ret);
+        bool ret = normal.dot(v0.normal_) > -1e-16 &&
+                   normal.dot(v1.normal_) > -1e-16 &&
+                   normal.dot(v2.normal_) > -1e-16;
+        utility::LogDebug("[IsCompatible] v0.idx={}, v1.idx={}, v2.idx={}",
+                          vidx0, vidx1, vidx2);
         return ret;
     }
 
-    BallPivotingVertexPtr FindCandidateVertex(
-            const BallPivotingEdgePtr& edge,
-            double radius,
-            Eigen::Vector3d& candidate_center) {
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), radius={}",
-                          edge->source_->idx_, edge->target_->idx_, radius);
-        BallPivotingVertexPtr src = edge->source_;
-        BallPivotingVertexPtr tgt = edge->target_;
-
-        const BallPivotingVertexPtr opp = edge->GetOppositeVertex();
+    /// Pivots the ball around edge \param eidx and returns the first vertex it
+    /// hits, or -1. Only positions and normals of the neighbors are read, so
+    /// the candidate may belong to another region.
+    int FindCandidateVertex(const BallPivotingRegion& region,
+                            int eidx,
+                            double radius,
+                            Eigen::Vector3d& candidate_center) const {
+        const BallPivotingEdge& edge = region.edges_[eidx];
+        const int src_idx = edge.source_;
+        const int tgt_idx = edge.target_;
+        const int opp_idx = GetOppositeVertex(region, eidx);
+        const BallPivotingVertex& src = vertices[src_idx];
+        const BallPivotingVertex& tgt = vertices[tgt_idx];
+        const BallPivotingVertex& opp = vertices[opp_idx];
         utility::LogDebug("[FindCandidateVertex] edge=({}, {}), opp={}",
-                          src->idx_, tgt->idx_, opp->idx_);
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", src->idx_,
-                          src->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] tgt={} => {}", tgt->idx_,
-                          tgt->point_.transpose());
-        utility::LogDebug("[FindCandidateVertex] src={} => {}", opp->idx_,
-                          opp->point_.transpose());
-
-        Eigen::Vector3d mp = 0.5 * (src->point_ + tgt->point_);
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), mp={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          mp.transpose());
-
-        BallPivotingTrianglePtr triangle = edge->triangle0_;
-        const Eigen::Vector3d& center = triangle->ball_center_;
-        utility::LogDebug("[FindCandidateVertex] edge=({}, {}), center={}",
-                          edge->source_->idx_, edge->target_->idx_,
-                          center.transpose());
-
-        Eigen::Vector3d v = tgt->point_ - src->point_;
+                          src_idx, tgt_idx, opp_idx);
+
+        Eigen::Vector3d mp = 0.5 * (src.point_ + tgt.point_);
+        const Eigen::Vector3d& center =
+                region.triangles_[edge.triangle0_].ball_center_;
+
+        Eigen::Vector3d v = tgt.point_ - src.point_;
         v /= v.norm();
 
         Eigen::Vector3d a = center - mp;
@@ -364,62 +426,41 @@ public:
         utility::LogDebug("[FindCandidateVertex] found {} potential candidates",
                           indices.size());
 
-        BallPivotingVertexPtr min_candidate = nullptr;
+        int min_candidate = -1;
         double min_angle = 2 * M_PI;
         for (auto nbidx : indices) {
-            utility::LogDebug("[FindCandidateVertex] nbidx {:d}", nbidx);
-            const BallPivotingVertexPtr& candidate = vertices[nbidx];
-            if (candidate->idx_ == src->idx_ || candidate->idx_ == tgt->idx_ ||
-                candidate->idx_ == opp->idx_) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} is a triangle "
-                        "vertex of the edge",
-                        candidate->idx_);
+            if (nbidx == src_idx || nbidx == tgt_idx || nbidx == opp_idx) {
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate={:d} => {}",
-                              candidate->idx_, candidate->point_.transpose());
+            const BallPivotingVertex& candidate = vertices[nbidx];
 
             bool coplanar = IntersectionTest::PointsCoplanar(
-                    src->point_, tgt->point_, opp->point_, candidate->point_);
+                    src.point_, tgt.point_, opp.point_, candidate.point_);
             if (coplanar && (IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, src->point_,
-                                     opp->point_) < 1e-12 ||
+                                     mp, candidate.point_, src.point_,
+                                     opp.point_) < 1e-12 ||
                              IntersectionTest::LineSegmentsMinimumDistance(
-                                     mp, candidate->point_, tgt->point_,
-                                     opp->point_) < 1e-12)) {
+                                     mp, candidate.point_, tgt.point_,
+                                     opp.point_) < 1e-12)) {
                 utility::LogDebug(
                         "[FindCandidateVertex] candidate {:d} is intersecting "
                         "the existing triangle",
-                        candidate->idx_);
+                        nbidx);
                 continue;
             }
 
             Eigen::Vector3d new_center;
-            if (!ComputeBallCenter(src->idx_, tgt->idx_, candidate->idx_,
-                                   radius, new_center)) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} can not compute "
-                        "ball",
-                        candidate->idx_);
+            if (!ComputeBallCenter(src_idx, tgt_idx, nbidx, radius,
+                                   new_center)) {
                 continue;
             }
-            utility::LogDebug("[FindCandidateVertex] candidate {:d} center={}",
-                              candidate->idx_, new_center.transpose());
 
             Eigen::Vector3d b = new_center - mp;
             b /= b.norm();
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} v={}, a={}, b={}",
-                    candidate->idx_, v.transpose(), a.transpose(),
-                    b.transpose());
 
             double cosinus = a.dot(b);
             cosinus = std::min(cosinus, 1.0);
             cosinus = std::max(cosinus, -1.0);
-            utility::LogDebug(
-                    "[FindCandidateVertex] candidate {:d} cosinus={:f}",
-                    candidate->idx_, cosinus);
 
             double angle = std::acos(cosinus);
 
@@ -429,140 +470,121 @@ public:
             }
 
             if (angle >= min_angle) {
-                utility::LogDebug(
-                        "[FindCandidateVertex] candidate {:d} angle {:f} > "
-                        "min_angle {:f}",
-                        candidate->idx_, angle, min_angle);
                 continue;
             }
 
             bool empty_ball = true;
             for (auto nbidx2 : indices) {
-                const BallPivotingVertexPtr& nb = vertices[nbidx2];
-                if (nb->idx_ == src->idx_ || nb->idx_ == tgt->idx_ ||
-                    nb->idx_ == candidate->idx_) {
+                if (nbidx2 == src_idx || nbidx2 == tgt_idx ||
+                    nbidx2 == nbidx) {
                     continue;
                 }
-                if ((new_center - nb->point_).norm() < radius - 1e-16) {
-                    utility::LogDebug(
-                            "[FindCandidateVertex] candidate {:d} not an empty "
-                            "ball",
-                            candidate->idx_);
+                if ((new_center - vertices[nbidx2].point_).norm() <
+                    radius - 1e-16) {
                     empty_ball = false;
                     break;
                 }
             }
 
             if (empty_ball) {
-                utility::LogDebug("[FindCandidateVertex] candidate {:d} works",
-                                  candidate->idx_);
                 min_angle = angle;
-                min_candidate = vertices[nbidx];
+                min_candidate = nbidx;
                 candidate_center = new_center;
             }
         }
 
-        if (min_candidate == nullptr) {
-            utility::LogDebug("[FindCandidateVertex] returns nullptr");
-        } else {
-            utility::LogDebug("[FindCandidateVertex] returns {:d}",
-                              min_candidate->idx_);
-        }
+        utility::LogDebug("[FindCandidateVertex] returns {:d}", min_candidate);
         return min_candidate;
     }
 
-    void ExpandTriangulation(double radius) {
+    void ExpandTriangulation(BallPivotingRegion& region,
+                             double radius,
+                             size_t radius_idx) {
         utility::LogDebug("[ExpandTriangulation] radius={}", radius);
-        while (!edge_front_.empty()) {
-            BallPivotingEdgePtr edge = edge_front_.front();
-            edge_front_.pop_front();
-            if (edge->type_ != BallPivotingEdge::Front) {
+        while (!region.edge_front_.empty()) {
+            int eidx = region.edge_front_.front();
+            region.edge_front_.pop_front();
+            if (region.edges_[eidx].type_ != BallPivotingEdge::Front) {
                 continue;
             }
 
             Eigen::Vector3d center;
-            BallPivotingVertexPtr candidate =
-                    FindCandidateVertex(edge, radius, center);
-            if (candidate == nullptr ||
-                candidate->type_ == BallPivotingVertex::Type::Inner ||
-                !IsCompatible(candidate, edge->source_, edge->target_)) {
-                edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+            int candidate = FindCandidateVertex(region, eidx, radius, center);
+            if (candidate >= 0 && !Owns(region, candidate)) {
+                region.deferred_edges_.emplace_back(eidx, radius_idx);
+                continue;
+            }
+            const int source = region.edges_[eidx].source_;
+            const int target = region.edges_[eidx].target_;
+            if (candidate < 0 ||
+                vertices[candidate].type_ == BallPivotingVertex::Type::Inner ||
+                !IsCompatible(candidate, source, target)) {
+                region.edges_[eidx].type_ = BallPivotingEdge::Type::Border;
+                region.border_edges_.push_back(eidx);
                 continue;
             }
 
-            BallPivotingEdgePtr e0 = GetLinkingEdge(candidate, edge->source_);
-            BallPivotingEdgePtr e1 = GetLinkingEdge(candidate, edge->target_);
-            if ((e0 != nullptr && e0->type_ != BallPivotingEdge::Type::Front) ||
-                (e1 != nullptr && e1->type_ != BallPivotingEdge::Type::Front)) {
-                edge->type_ = BallPivotingEdge::Type::Border;
-                border_edges_.push_back(edge);
+            int e0 = GetLinkingEdge(region, candidate, source);
+            int e1 = GetLinkingEdge(region, candidate, target);
+            if ((e0 >= 0 && region.edges_[e0].type_ !=
+                                    BallPivotingEdge::Type::Front) ||
+                (e1 >= 0 && region.edges_[e1].type_ !=
+                                    BallPivotingEdge::Type::Front)) {
+                region.edges_[eidx].type_ = BallPivotingEdge::Type::Border;
+                region.border_edges_.push_back(eidx);
                 continue;
             }
 
-            CreateTriangle(edge->source_, edge->target_, candidate, center);
+            CreateTriangle(region, source, target, candidate, center);
 
-            e0 = GetLinkingEdge(candidate, edge->source_);
-            e1 = GetLinkingEdge(candidate, edge->target_);
-            if (e0->type_ == BallPivotingEdge::Type::Front) {
-                edge_front_.push_front(e0);
+            e0 = GetLinkingEdge(region, candidate, source);
+            e1 = GetLinkingEdge(region, candidate, target);
+            if (region.edges_[e0].type_ == BallPivotingEdge::Type::Front) {
+                region.edge_front_.push_front(e0);
             }
-            if (e1->type_ == BallPivotingEdge::Type::Front) {
-                edge_front_.push_front(e1);
+            if (region.edges_[e1].type_ == BallPivotingEdge::Type::Front) {
+                region.edge_front_.push_front(e1);
             }
         }
     }
 
-    bool TryTriangleSeed(const BallPivotingVertexPtr& v0,
-                         const BallPivotingVertexPtr& v1,
-                         const BallPivotingVertexPtr& v2,
+    bool TryTriangleSeed(const BallPivotingRegion& region,
+                         int v0,
+                         int v1,
+                         int v2,
                          const std::vector<int>& nb_indices,
                          double radius,
-                         Eigen::Vector3d& center) {
+                         Eigen::Vector3d& center) const {
         utility::LogDebug(
                 "[TryTriangleSeed] v0.idx={}, v1.idx={}, v2.idx={}, "
                 "radius={}",
-                v0->idx_, v1->idx_, v2->idx_, radius);
+                v0, v1, v2, radius);
 
         if (!IsCompatible(v0, v1, v2)) {
             return false;
         }
 
-        BallPivotingEdgePtr e0 = GetLinkingEdge(v0, v2);
-        BallPivotingEdgePtr e1 = GetLinkingEdge(v1, v2);
-        if (e0 != nullptr && e0->type_ == BallPivotingEdge::Type::Inner) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} because e0 is inner edge",
-                    false);
+        int e0 = GetLinkingEdge(region, v0, v2);
+        int e1 = GetLinkingEdge(region, v1, v2);
+        if (e0 >= 0 &&
+            region.edges_[e0].type_ == BallPivotingEdge::Type::Inner) {
             return false;
         }
-        if (e1 != nullptr && e1->type_ == BallPivotingEdge::Type::Inner) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} because e1 is inner edge",
-                    false);
+        if (e1 >= 0 &&
+            region.edges_[e1].type_ == BallPivotingEdge::Type::Inner) {
             return false;
         }
 
-        if (!ComputeBallCenter(v0->idx_, v1->idx_, v2->idx_, radius, center)) {
-            utility::LogDebug(
-                    "[TryTriangleSeed] returns {} could not compute ball "
-                    "center",
-                    false);
+        if (!ComputeBallCenter(v0, v1, v2, radius, center)) {
             return false;
         }
 
         // test if no other point is within the ball
         for (const auto& nbidx : nb_indices) {
-            const BallPivotingVertexPtr& v = vertices[nbidx];
-            if (v->idx_ == v0->idx_ || v->idx_ == v1->idx_ ||
-                v->idx_ == v2->idx_) {
+            if (nbidx == v0 || nbidx == v1 || nbidx == v2) {
                 continue;
             }
-            if ((center - v->point_).norm() < radius - 1e-16) {
-                utility::LogDebug(
-                        "[TryTriangleSeed] returns {} computed ball is not "
-                        "empty",
-                        false);
+            if ((center - vertices[nbidx].point_).norm() < radius - 1e-16) {
                 return false;
             }
         }
@@ -571,22 +593,32 @@ public:
         return true;
     }
 
-    bool TrySeed(BallPivotingVertexPtr& v, double radius) {
-        utility::LogDebug("[TrySeed] with v.idx={}, radius={}", v->idx_,
-                          radius);
+    bool TrySeed(BallPivotingRegion& region,
+                 int vidx,
+                 double radius,
+                 size_t radius_idx) {
+        utility::LogDebug("[TrySeed] with v.idx={}, radius={}", vidx, radius);
         std::vector<int> indices;
         std::vector<double> dists2;
-        kdtree_.SearchRadius(v->point_, 2 * radius, indices, dists2);
+        kdtree_.SearchRadius(vertices[vidx].point_, 2 * radius, indices,
+                             dists2);
         if (indices.size() < 3u) {
             return false;
         }
 
+        // The neighborhood reaches into another region, the seed is retried
+        // by the stitching pass if no triangle can be found in this region.
+        bool crosses_region = false;
         for (size_t nbidx0 = 0; nbidx0 < indices.size(); ++nbidx0) {
-            const BallPivotingVertexPtr& nb0 = vertices[indices[nbidx0]];
-            if (nb0->type_ != BallPivotingVertex::Type::Orphan) {
+            const int nb0 = indices[nbidx0];
+            if (!Owns(region, nb0)) {
+                crosses_region = true;
                 continue;
             }
-            if (nb0->idx_ == v->idx_) {
+            if (vertices[nb0].type_ != BallPivotingVertex::Type::Orphan) {
+                continue;
+            }
+            if (nb0 == vidx) {
                 continue;
             }
 
@@ -594,163 +626,300 @@ public:
             Eigen::Vector3d center;
             for (size_t nbidx1 = nbidx0 + 1; nbidx1 < indices.size();
                  ++nbidx1) {
-                const BallPivotingVertexPtr& nb1 = vertices[indices[nbidx1]];
-                if (nb1->type_ != BallPivotingVertex::Type::Orphan) {
+                const int nb1 = indices[nbidx1];
+                if (!Owns(region, nb1) ||
+                    vertices[nb1].type_ != BallPivotingVertex::Type::Orphan) {
                     continue;
                 }
-                if (nb1->idx_ == v->idx_) {
+                if (nb1 == vidx) {
                     continue;
                 }
-                if (TryTriangleSeed(v, nb0, nb1, indices, radius, center)) {
-                    candidate_vidx2 = nb1->idx_;
+                if (TryTriangleSeed(region, vidx, nb0, nb1, indices, radius,
+                                    center)) {
+                    candidate_vidx2 = nb1;
                     break;
                 }
             }
 
             if (candidate_vidx2 >= 0) {
-                const BallPivotingVertexPtr& nb1 = vertices[candidate_vidx2];
+                const int nb1 = candidate_vidx2;
 
-                BallPivotingEdgePtr e0 = GetLinkingEdge(v, nb1);
-                if (e0 != nullptr &&
-                    e0->type_ != BallPivotingEdge::Type::Front) {
+                int e0 = GetLinkingEdge(region, vidx, nb1);
+                if (e0 >= 0 && region.edges_[e0].type_ !=
+                                       BallPivotingEdge::Type::Front) {
                     continue;
                 }
-                BallPivotingEdgePtr e1 = GetLinkingEdge(nb0, nb1);
-                if (e1 != nullptr &&
-                    e1->type_ != BallPivotingEdge::Type::Front) {
+                int e1 = GetLinkingEdge(region, nb0, nb1);
+                if (e1 >= 0 && region.edges_[e1].type_ !=
+                                       BallPivotingEdge::Type::Front) {
                     continue;
                 }
-                BallPivotingEdgePtr e2 = GetLinkingEdge(v, nb0);
-                if (e2 != nullptr &&
-                    e2->type_ != BallPivotingEdge::Type::Front) {
+                int e2 = GetLinkingEdge(region, vidx, nb0);
+                if (e2 >= 0 && region.edges_[e2].type_ !=
+                                       BallPivotingEdge::Type::Front) {
                     continue;
                 }
 
-                CreateTriangle(v, nb0, nb1, center);
+                CreateTriangle(region, vidx, nb0, nb1, center);
 
-                e0 = GetLinkingEdge(v, nb1);
-                e1 = GetLinkingEdge(nb0, nb1);
-                e2 = GetLinkingEdge(v, nb0);
-                if (e0->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e0);
+                e0 = GetLinkingEdge(region, vidx, nb1);
+                e1 = GetLinkingEdge(region, nb0, nb1);
+                e2 = GetLinkingEdge(region, vidx, nb0);
+                if (region.edges_[e0].type_ == BallPivotingEdge::Type::Front) {
+                    region.edge_front_.push_front(e0);
                 }
-                if (e1->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e1);
+                if (region.edges_[e1].type_ == BallPivotingEdge::Type::Front) {
+                    region.edge_front_.push_front(e1);
                 }
-                if (e2->type_ == BallPivotingEdge::Type::Front) {
-                    edge_front_.push_front(e2);
+                if (region.edges_[e2].type_ == BallPivotingEdge::Type::Front) {
+                    region.edge_front_.push_front(e2);
                 }
 
-                if (edge_front_.size() > 0) {
-                    utility::LogDebug(
-                            "[TrySeed] edge_front_.size() > 0 => return "
-                            "true");
+                if (region.edge_front_.size() > 0) {
                     return true;
                 }
             }
         }
 
+        if (crosses_region) {
+            region.deferred_seeds_.emplace_back(vidx, radius_idx);
+        }
         utility::LogDebug("[TrySeed] return false");
         return false;
     }
 
-    void FindSeedTriangle(double radius) {
-        for (size_t vidx = 0; vidx < vertices.size(); ++vidx) {
-            utility::LogDebug("[FindSeedTriangle] with radius={}, vidx={}",
-                              radius, vidx);
-            if (vertices[vidx]->type_ == BallPivotingVertex::Type::Orphan) {
-                if (TrySeed(vertices[vidx], radius)) {
-                    ExpandTriangulation(radius);
+    void FindSeedTriangle(BallPivotingRegion& region,
+                          const std::vector<int>& seeds,
+                          double radius,
+                          size_t radius_idx) {
+        for (int vidx : seeds) {
+            if (vertices[vidx].type_ == BallPivotingVertex::Type::Orphan) {
+                if (TrySeed(region, vidx, radius, radius_idx)) {
+                    ExpandTriangulation(region, radius, radius_idx);
                 }
             }
         }
     }
 
-    std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii) {
-        if (!has_normals_) {
-            utility::LogError("ReconstructBallPivoting requires normals");
-        }
+    /// Moves the border edges that the ball of \param radius can pivot on
+    /// again back to the front.
+    void UpdateBorderEdges(BallPivotingRegion& region, double radius) {
+        size_t num_border_edges = 0;
+        for (int eidx : region.border_edges_) {
+            const BallPivotingTriangle& triangle =
+                    region.triangles_[region.edges_[eidx].triangle0_];
+
+            Eigen::Vector3d center;
+            if (ComputeBallCenter(triangle.vert0_, triangle.vert1_,
+                                  triangle.vert2_, radius, center)) {
+                std::vector<int> indices;
+                std::vector<double> dists2;
+                kdtree_.SearchRadius(center, radius, indices, dists2);
+                bool empty_ball = true;
+                for (auto idx : indices) {
+                    if (idx != triangle.vert0_ && idx != triangle.vert1_ &&
+                        idx != triangle.vert2_) {
+                        empty_ball = false;
+                        break;
+                    }
+                }
 
-        mesh_->triangles_.clear();
+                if (empty_ball) {
+                    region.edges_[eidx].type_ = BallPivotingEdge::Type::Front;
+                    region.edge_front_.push_back(eidx);
+                    continue;
+                }
+            }
+            region.border_edges_[num_border_edges++] = eidx;
+        }
+        region.border_edges_.resize(num_border_edges);
+    }
 
-        for (double radius : radii) {
-            utility::LogDebug("[Run] ################################");
+    void ReconstructRegion(BallPivotingRegion& region,
+                           const std::vector<double>& radii) {
+        for (size_t radius_idx = 0; radius_idx < radii.size(); ++radius_idx) {
+            double radius = radii[radius_idx];
             utility::LogDebug("[Run] change to radius {:.4f}", radius);
-            if (radius <= 0) {
-                utility::LogError(
-                        "got an invalid, negative radius as parameter");
+            UpdateBorderEdges(region, radius);
+            if (region.edge_front_.empty()) {
+                FindSeedTriangle(region, region.vertices_, radius, radius_idx);
+            } else {
+                ExpandTriangulation(region, radius, radius_idx);
             }
+        }
+    }
 
-            // update radius => update border edges
-            for (auto it = border_edges_.begin(); it != border_edges_.end();) {
-                BallPivotingEdgePtr edge = *it;
-                BallPivotingTrianglePtr triangle = edge->triangle0_;
-                utility::LogDebug(
-                        "[Run] try edge {:d}-{:d} of triangle {:d}-{:d}-{:d}",
-                        edge->source_->idx_, edge->target_->idx_,
-                        triangle->vert0_->idx_, triangle->vert1_->idx_,
-                        triangle->vert2_->idx_);
-
-                Eigen::Vector3d center;
-                if (ComputeBallCenter(triangle->vert0_->idx_,
-                                      triangle->vert1_->idx_,
-                                      triangle->vert2_->idx_, radius, center)) {
-                    utility::LogDebug("[Run]   yes, we can work on this");
-                    std::vector<int> indices;
-                    std::vector<double> dists2;
-                    kdtree_.SearchRadius(center, radius, indices, dists2);
-                    bool empty_ball = true;
-                    for (auto idx : indices) {
-                        if (idx != triangle->vert0_->idx_ &&
-                            idx != triangle->vert1_->idx_ &&
-                            idx != triangle->vert2_->idx_) {
-                            utility::LogDebug(
-                                    "[Run]   but no, the ball is not empty");
-                            empty_ball = false;
-                            break;
-                        }
-                    }
+    /// Splits the vertices into slabs of equal size along the longest axis of
+    /// the bounding box. Slabs are kept wider than the largest ball.
+    std::vector<BallPivotingRegion> PartitionRegions(double max_radius) {
+        Eigen::Vector3d extent =
+                mesh_->GetMaxBound() - mesh_->GetMinBound();
+        int axis;
+        extent.maxCoeff(&axis);
+        int num_regions = ComputeBallPivotingRegionCount(extent, max_radius);
+
+        std::vector<BallPivotingRegion> regions;
+        if (num_regions == 0) {
+            return regions;
+        }
+        std::vector<double> coords(vertices.size());
+        for (size_t vidx = 0; vidx < vertices.size(); ++vidx) {
+            coords[vidx] = vertices[vidx].point_(axis);
+        }
+        std::vector<double> splits;
+        for (int r = 1; r < num_regions; ++r) {
+            auto nth = coords.begin() + coords.size() * r / num_regions;
+            std::nth_element(coords.begin(), nth, coords.end());
+            splits.push_back(*nth);
+        }
+        std::sort(splits.begin(), splits.end());
 
-                    if (empty_ball) {
-                        utility::LogDebug(
-                                "[Run]   yeah, add edge to edge_front_: {:d}",
-                                edge_front_.size());
-                        edge->type_ = BallPivotingEdge::Type::Front;
-                        edge_front_.push_back(edge);
-                        it = border_edges_.erase(it);
-                        continue;
-                    }
+        for (int r = 0; r < num_regions; ++r) {
+            regions.emplace_back(r);
+        }
+        for (auto& vertex : vertices) {
+            vertex.region_ = int(std::upper_bound(splits.begin(), splits.end(),
+                                                  vertex.point_(axis)) -
+                                 splits.begin());
+            regions[vertex.region_].vertices_.push_back(vertex.idx_);
+        }
+        return regions;
+    }
+
+    /// Moves the pools of all regions into \param global. Edge and triangle
+    /// indices are offset by the size of the pools of the preceding regions.
+    void MergeRegions(std::vector<BallPivotingRegion>& regions,
+                      BallPivotingRegion& global) {
+        std::vector<int> edge_offsets(regions.size());
+        for (size_t r = 0; r < regions.size(); ++r) {
+            BallPivotingRegion& region = regions[r];
+            const int edge_offset = int(global.edges_.size());
+            const int triangle_offset = int(global.triangles_.size());
+            auto Shift = [](int idx, int offset) {
+                return idx < 0 ? idx : idx + offset;
+            };
+            edge_offsets[r] = edge_offset;
+            for (BallPivotingEdge edge : region.edges_) {
+                edge.triangle0_ = Shift(edge.triangle0_, triangle_offset);
+                edge.triangle1_ = Shift(edge.triangle1_, triangle_offset);
+                edge.source_next_ = Shift(edge.source_next_, edge_offset);
+                edge.target_next_ = Shift(edge.target_next_, edge_offset);
+                global.edges_.push_back(edge);
+            }
+            global.triangles_.insert(global.triangles_.end(),
+                                     region.triangles_.begin(),
+                                     region.triangles_.end());
+            for (const auto& deferred : region.deferred_edges_) {
+                global.deferred_edges_.emplace_back(
+                        deferred.first + edge_offset, deferred.second);
+            }
+            global.deferred_seeds_.insert(global.deferred_seeds_.end(),
+                                          region.deferred_seeds_.begin(),
+                                          region.deferred_seeds_.end());
+            global.mesh_triangles_.insert(global.mesh_triangles_.end(),
+                                          region.mesh_triangles_.begin(),
+                                          region.mesh_triangles_.end());
+            global.mesh_triangle_normals_.insert(
+                    global.mesh_triangle_normals_.end(),
+                    region.mesh_triangle_normals_.begin(),
+                    region.mesh_triangle_normals_.end());
+            region = BallPivotingRegion(region.region_);
+        }
+        for (auto& vertex : vertices) {
+            if (vertex.edge_ >= 0) {
+                vertex.edge_ += edge_offsets[vertex.region_];
+            }
+        }
+    }
+
+    /// Continues the reconstruction across region boundaries from the pivots
+    /// and seeds deferred by the regions. The border edges of the regions
+    /// already failed the larger balls inside their region, only the border
+    /// edges created here are revisited, and radii with neither deferred work
+    /// nor border edges are skipped.
+    void StitchRegions(BallPivotingRegion& global,
+                       const std::vector<double>& radii) {
+        std::vector<std::vector<int>> edges(radii.size());
+        std::vector<std::vector<int>> seeds(radii.size());
+        for (const auto& deferred : global.deferred_edges_) {
+            edges[deferred.second].push_back(deferred.first);
+        }
+        for (const auto& deferred : global.deferred_seeds_) {
+            seeds[deferred.second].push_back(deferred.first);
+        }
+        for (size_t radius_idx = 0; radius_idx < radii.size(); ++radius_idx) {
+            if (global.border_edges_.empty() && edges[radius_idx].empty() &&
+                seeds[radius_idx].empty()) {
+                continue;
+            }
+            double radius = radii[radius_idx];
+            UpdateBorderEdges(global, radius);
+            for (int eidx : edges[radius_idx]) {
+                if (global.edges_[eidx].type_ ==
+                    BallPivotingEdge::Type::Front) {
+                    global.edge_front_.push_back(eidx);
                 }
-                ++it;
             }
+            ExpandTriangulation(global, radius, radius_idx);
+            FindSeedTriangle(global, seeds[radius_idx], radius, radius_idx);
+        }
+    }
 
-            // do the reconstruction
-            if (edge_front_.empty()) {
-                FindSeedTriangle(radius);
-            } else {
-                ExpandTriangulation(radius);
+    std::shared_ptr<TriangleMesh> Run(const std::vector<double>& radii,
+                                      bool parallel) {
+        if (!has_normals_) {
+            utility::LogError("ReconstructBallPivoting requires normals");
+        }
+        for (double radius : radii) {
+            if (radius <= 0) {
+                utility::LogError(
+                        "got an invalid, negative radius as parameter");
             }
+        }
 
-            utility::LogDebug("[Run] mesh_ has {:d} triangles",
-                              mesh_->triangles_.size());
-            utility::LogDebug("[Run] ################################");
+        BallPivotingRegion global(-1);
+        std::vector<BallPivotingRegion> regions;
+        if (parallel && !radii.empty()) {
+            regions = PartitionRegions(
+                    *std::max_element(radii.begin(), radii.end()));
         }
+        if (regions.empty()) {
+            global.vertices_.resize(vertices.size());
+            std::iota(global.vertices_.begin(), global.vertices_.end(), 0);
+            ReconstructRegion(global, radii);
+        } else {
+            utility::LogDebug("[Run] reconstruct {:d} regions in parallel",
+                              regions.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (int r = 0; r < int(regions.size()); ++r) {
+                ReconstructRegion(regions[r], radii);
+            }
+            MergeRegions(regions, global);
+            StitchRegions(global, radii);
+        }
+
+        mesh_->triangles_ = std::move(global.mesh_triangles_);
+        mesh_->triangle_normals_ = std::move(global.mesh_triangle_normals_);
+        utility::LogDebug("[Run] mesh_ has {:d} triangles",
+                          mesh_->triangles_.size());
         return mesh_;
     }
 
 private:
     bool has_normals_;
     KDTreeFlann kdtree_;
-    std::list<BallPivotingEdgePtr> edge_front_;
-    std::list<BallPivotingEdgePtr> border_edges_;
-    std::vector<BallPivotingVertexPtr> vertices;
+    std::vector<BallPivotingVertex> vertices;
     std::shared_ptr<TriangleMesh> mesh_;
 };
 
 std::shared_ptr<TriangleMesh> TriangleMesh::CreateFromPointCloudBallPivoting(
-        const PointCloud& pcd, const std::vector<double>& radii) {
+        const PointCloud& pcd,
+        const std::vector<double>& radii,
+        bool parallel /* = false */) {
     BallPivoting bp(pcd);
-    return bp.Run(radii);
+    return bp.Run(radii, parallel);
 }
 
 }  // namespace geometry
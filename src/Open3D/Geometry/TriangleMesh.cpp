@@ -32,6 +32,8 @@
 #include "Open3D/Geometry/Qhull.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <cstdint>
 #include <numeric>
 #include <queue>
 #include <random>
@@ -46,6 +48,26 @@
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Finalizer of the SplitMix64 generator, maps consecutive integers to
+/// statistically independent 64 bit values.
+inline uint64_t SplitMix64(uint64_t z) {
+    z += 0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/// Counter-based uniform random number in [0, 1). Unlike a sequential
+/// generator, the value of a given counter can be computed by any thread.
+inline double UniformRandom(uint64_t key, uint64_t counter) {
+    return double(SplitMix64(key ^ SplitMix64(counter)) >> 11) *
+           (1.0 / 9007199254740992.0);
+}
+
+}  // unnamed namespace
+
 TriangleMesh &TriangleMesh::Clear() {
     MeshBase::Clear();
     triangles_.clear();
@@ -446,8 +468,6 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
         std::random_device rd;
         seed = rd();
     }
-    std::mt19937 mt(seed);
-    std::uniform_real_distribution<double> dist(0.0, 1.0);
     auto pcd = std::make_shared<PointCloud>();
     pcd->points_.resize(number_of_points);
     if (has_vert_normal || use_triangle_normal) {
@@ -459,17 +479,33 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
     if (has_vert_color) {
         pcd->colors_.resize(number_of_points);
     }
-    size_t point_idx = 0;
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        size_t n = size_t(std::round(triangle_areas[tidx] * number_of_points));
-        while (point_idx < n) {
-            double r1 = dist(mt);
-            double r2 = dist(mt);
+
+    // Triangle tidx gets the points of its interval of the cdf, so the first
+    // point of every triangle is known in advance. Point pidx is drawn with the
+    // counters 2 * pidx and 2 * pidx + 1 of a counter-based random number
+    // generator, hence the result only depends on the seed and not on the
+    // number of threads.
+    const uint64_t key = SplitMix64(uint64_t(uint32_t(seed)));
+    const int n_triangles = int(triangles_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < n_triangles; ++tidx) {
+        size_t begin = tidx == 0 ? 0
+                                 : size_t(std::round(triangle_areas[tidx - 1] *
+                                                     number_of_points));
+        size_t end = tidx == n_triangles - 1
+                             ? number_of_points
+                             : size_t(std::round(triangle_areas[tidx] *
+                                                 number_of_points));
+        const Eigen::Vector3i &triangle = triangles_[tidx];
+        for (size_t point_idx = begin; point_idx < end; ++point_idx) {
+            double r1 = UniformRandom(key, 2 * point_idx);
+            double r2 = UniformRandom(key, 2 * point_idx + 1);
             double a = (1 - std::sqrt(r1));
             double b = std::sqrt(r1) * (1 - r2);
             double c = std::sqrt(r1) * r2;
 
-            const Eigen::Vector3i &triangle = triangles_[tidx];
             pcd->points_[point_idx] = a * vertices_[triangle(0)] +
                                       b * vertices_[triangle(1)] +
                                       c * vertices_[triangle(2)];
@@ -486,8 +522,6 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsUniformlyImpl(
                                           b * vertex_colors_[triangle(1)] +
                                           c * vertex_colors_[triangle(2)];
             }
-
-            point_idx++;
         }
     }
 
@@ -564,8 +598,7 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
                                  (2 * std::sqrt(3.)));
     double r_min = r_max * beta * (1 - std::pow(ratio, gamma));
 
-    std::vector<double> weights(pcl->points_.size());
-    std::vector<bool> deleted(pcl->points_.size(), false);
+    const int n_init = int(pcl->points_.size());
     KDTreeFlann kdtree(*pcl);
 
     auto WeightFcn = [&](double d2) {
@@ -576,38 +609,156 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
         return std::pow(1 - d / r_max, alpha);
     };
 
-    auto ComputePointWeight = [&](int pidx0) {
-        std::vector<int> nbs;
+    // Precompute the neighbours of every sample and the weights they
+    // contribute. Removing a sample then only subtracts its contribution from
+    // the weights of its neighbours, without searching the KD-tree again.
+    std::vector<std::vector<int>> nbs(n_init);
+    std::vector<std::vector<double>> nb_weights(n_init);
+    std::vector<double> weights(n_init, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int pidx0 = 0; pidx0 < n_init; ++pidx0) {
+        std::vector<int> indices;
         std::vector<double> dists2;
-        kdtree.SearchRadius(pcl->points_[pidx0], r_max, nbs, dists2);
-        double weight = 0;
-        for (size_t nbidx = 0; nbidx < nbs.size(); ++nbidx) {
-            int pidx1 = nbs[nbidx];
-            // only count weights if not the same point if not deleted
-            if (pidx0 == pidx1 || deleted[pidx1]) {
+        kdtree.SearchRadius(pcl->points_[pidx0], r_max, indices, dists2);
+        nbs[pidx0].reserve(indices.size());
+        nb_weights[pidx0].reserve(indices.size());
+        for (size_t nbidx = 0; nbidx < indices.size(); ++nbidx) {
+            if (indices[nbidx] == pidx0) {
                 continue;
             }
-            weight += WeightFcn(dists2[nbidx]);
+            double weight = WeightFcn(dists2[nbidx]);
+            nbs[pidx0].push_back(indices[nbidx]);
+            nb_weights[pidx0].push_back(weight);
+            weights[pidx0] += weight;
         }
+    }
 
-        weights[pidx0] = weight;
+    // Not a std::vector<bool>, samples are deleted concurrently.
+    std::vector<uint8_t> deleted(n_init, 0);
+    auto DeleteSample = [&](int pidx) {
+        deleted[pidx] = 1;
+        for (size_t nbidx = 0; nbidx < nbs[pidx].size(); ++nbidx) {
+            weights[nbs[pidx][nbidx]] -= nb_weights[pidx][nbidx];
+        }
     };
 
-    // init weights and priority queue
     typedef std::tuple<int, double> QueueEntry;
     auto WeightCmp = [](const QueueEntry &a, const QueueEntry &b) {
         return std::get<1>(a) < std::get<1>(b);
     };
-    std::priority_queue<QueueEntry, std::vector<QueueEntry>,
-                        decltype(WeightCmp)>
-            queue(WeightCmp);
-    for (size_t pidx0 = 0; pidx0 < pcl->points_.size(); ++pidx0) {
-        ComputePointWeight(int(pidx0));
-        queue.push(QueueEntry(int(pidx0), weights[pidx0]));
-    };
+    typedef std::priority_queue<QueueEntry, std::vector<QueueEntry>,
+                                decltype(WeightCmp)>
+            Queue;
+
+    // Parallel sample elimination: the samples are binned into cells that are
+    // wider than 2 * r_max. Cells whose coordinates have the same parities are
+    // at least one cell apart, they never change the weights of the same
+    // samples and can eliminate their samples concurrently. Each cell
+    // eliminates samples until twice its share of number_of_points is left,
+    // the remaining samples are eliminated globally below, which keeps the
+    // quality of the serial elimination. The result does not depend on the
+    // number of threads.
+    const double cell_slack = 2.0;
+    const double cell_size = 2.5 * r_max;
+    const Eigen::Vector3d min_bound = pcl->GetMinBound();
+    const Eigen::Vector3d extent = pcl->GetMaxBound() - min_bound;
+    if (ratio * cell_slack < 1 && extent.maxCoeff() / cell_size < (1 << 20)) {
+        Eigen::Vector3i num_cells = Eigen::Vector3i::Ones();
+        for (int d = 0; d < 3; ++d) {
+            num_cells(d) += int(extent(d) / cell_size);
+        }
+        std::vector<std::pair<int64_t, int>> cell_keys(n_init);
+        std::vector<int> cell_colors(n_init);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int pidx = 0; pidx < n_init; ++pidx) {
+            Eigen::Vector3i cell;
+            for (int d = 0; d < 3; ++d) {
+                cell(d) = std::min(
+                        int((pcl->points_[pidx](d) - min_bound(d)) / cell_size),
+                        num_cells(d) - 1);
+            }
+            cell_keys[pidx] = std::make_pair(
+                    (int64_t(cell(0)) * num_cells(1) + cell(1)) * num_cells(2) +
+                            cell(2),
+                    pidx);
+            cell_colors[pidx] =
+                    (cell(0) & 1) | ((cell(1) & 1) << 1) | ((cell(2) & 1) << 2);
+        }
+        std::sort(cell_keys.begin(), cell_keys.end());
+        std::vector<int> cell_begin;
+        for (int kidx = 0; kidx < n_init; ++kidx) {
+            if (kidx == 0 ||
+                cell_keys[kidx].first != cell_keys[kidx - 1].first) {
+                cell_begin.push_back(kidx);
+            }
+        }
+        const int n_cells = int(cell_begin.size());
+        cell_begin.push_back(n_init);
+        std::vector<int> point_cell(n_init);
+        std::vector<std::vector<int>> color_cells(8);
+        for (int cidx = 0; cidx < n_cells; ++cidx) {
+            for (int kidx = cell_begin[cidx]; kidx < cell_begin[cidx + 1];
+                 ++kidx) {
+                point_cell[cell_keys[kidx].second] = cidx;
+            }
+            color_cells[cell_colors[cell_keys[cell_begin[cidx]].second]]
+                    .push_back(cidx);
+        }
+
+        for (const auto &cells : color_cells) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+            for (int idx = 0; idx < int(cells.size()); ++idx) {
+                const int cidx = cells[idx];
+                size_t cell_number_of_points =
+                        cell_begin[cidx + 1] - cell_begin[cidx];
+                size_t cell_target = size_t(std::ceil(
+                        cell_slack * ratio * cell_number_of_points));
+                if (cell_number_of_points <= cell_target) {
+                    continue;
+                }
+                Queue queue(WeightCmp);
+                for (int kidx = cell_begin[cidx]; kidx < cell_begin[cidx + 1];
+                     ++kidx) {
+                    int pidx = cell_keys[kidx].second;
+                    queue.push(QueueEntry(pidx, weights[pidx]));
+                }
+                while (cell_number_of_points > cell_target) {
+                    int pidx;
+                    double weight;
+                    std::tie(pidx, weight) = queue.top();
+                    queue.pop();
+                    if (deleted[pidx] || weight != weights[pidx]) {
+                        continue;
+                    }
+                    DeleteSample(pidx);
+                    cell_number_of_points--;
+                    for (int nb : nbs[pidx]) {
+                        if (!deleted[nb] && point_cell[nb] == cidx) {
+                            queue.push(QueueEntry(nb, weights[nb]));
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // init priority queue
+    Queue queue(WeightCmp);
+    size_t current_number_of_points = 0;
+    for (int pidx0 = 0; pidx0 < n_init; ++pidx0) {
+        if (!deleted[pidx0]) {
+            queue.push(QueueEntry(pidx0, weights[pidx0]));
+            current_number_of_points++;
+        }
+    }
 
     // sample elimination
-    size_t current_number_of_points = pcl->points_.size();
     while (current_number_of_points > number_of_points) {
         int pidx;
         double weight;
@@ -619,17 +770,13 @@ std::shared_ptr<PointCloud> TriangleMesh::SamplePointsPoissonDisk(
             continue;
         }
 
-        // delete current sample
-        deleted[pidx] = true;
+        // delete current sample and update the weights of its neighbours
+        DeleteSample(pidx);
         current_number_of_points--;
-
-        // update weights
-        std::vector<int> nbs;
-        std::vector<double> dists2;
-        kdtree.SearchRadius(pcl->points_[pidx], r_max, nbs, dists2);
-        for (int nb : nbs) {
-            ComputePointWeight(nb);
-            queue.push(QueueEntry(nb, weights[nb]));
+        for (int nb : nbs[pidx]) {
+            if (!deleted[nb]) {
+                queue.push(QueueEntry(nb, weights[nb]));
+            }
         }
     }
 
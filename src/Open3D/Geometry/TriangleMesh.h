@@ -358,6 +358,8 @@ public:
     /// normals. The triangle normals will be computed and added to the mesh
     /// if necessary. \param seed Sets the seed value used in the random
     /// generator, set to -1 to use a random seed value with each function call.
+    /// The triangles are sampled in parallel, the result only depends on the
+    /// seed.
     std::shared_ptr<PointCloud> SamplePointsUniformly(
             size_t number_of_points,
             bool use_triangle_normal = false,
@@ -368,7 +370,9 @@ public:
     /// Generating Poisson Disk Sample Sets", EUROGRAPHICS, 2015 The PointCloud
     /// \param pcl_init is used for sample elimination if given, otherwise a
     /// PointCloud is first uniformly sampled with \param init_number_of_points
-    /// x \param number_of_points number of points.
+    /// x \param number_of_points number of points. Most of the samples are
+    /// eliminated in parallel in independent cells of the bounding box, the
+    /// result only depends on the seed.
     /// \param use_triangle_normal Set to true to assign the triangle
     /// normals to the returned points instead of the interpolated vertex
     /// normals. The triangle normals will be computed and added to the mesh
@@ -383,7 +387,8 @@ public:
 
     /// Function to subdivide triangle mesh using the simple midpoint algorithm.
     /// Each triangle is subdivided into four triangles per iteration and the
-    /// new vertices lie on the midpoint of the triangle edges.
+    /// new vertices lie on the midpoint of the triangle edges. Triangle uvs
+    /// are interpolated linearly.
     /// \param number_of_iterations defines a single iteration splits each
     /// triangle into four triangles that cover the same surface.
     std::shared_ptr<TriangleMesh> SubdivideMidpoint(
@@ -392,6 +397,7 @@ public:
     /// Function to subdivide triangle mesh using Loop's scheme.
     /// Cf. Charles T. Loop, "Smooth subdivision surfaces based on triangles",
     /// 1987. Each triangle is subdivided into four triangles per iteration.
+    /// Triangle uvs are interpolated linearly.
     /// \param number_of_iterations defines a single iteration splits each
     /// triangle into four triangles that cover the same surface.
     std::shared_ptr<TriangleMesh> SubdivideLoop(int number_of_iterations) const;
@@ -525,9 +531,13 @@ public:
     /// created.
     /// \param pcd defines the PointCloud from which the TriangleMesh surface is
     /// reconstructed. Has to contain normals. \param radii defines the radii of
-    /// the ball that are used for the surface reconstruction.
+    /// the ball that are used for the surface reconstruction. If \param
+    /// parallel is true, slabs of the point cloud are reconstructed
+    /// concurrently and stitched together afterwards.
     static std::shared_ptr<TriangleMesh> CreateFromPointCloudBallPivoting(
-            const PointCloud &pcd, const std::vector<double> &radii);
+            const PointCloud &pcd,
+            const std::vector<double> &radii,
+            bool parallel = false);
 
     /// \brief Function that computes a triangle mesh from a oriented PointCloud
     /// pcd. This implements the Screened Poisson Reconstruction proposed in
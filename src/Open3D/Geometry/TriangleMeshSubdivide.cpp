@@ -27,83 +27,225 @@
 #include "Open3D/Geometry/TriangleMesh.h"
 
 #include <Eigen/Dense>
-#include <queue>
-#include <tuple>
+#include <algorithm>
+#include <cstdint>
+#include <utility>
 
 #include "Open3D/Utility/Console.h"
 
 namespace open3d {
 namespace geometry {
 
+namespace {
+
+/// Edge connectivity of a triangle list. The unique edges are found by sorting
+/// the 3 * n half edges of the triangles by their ordered vertex pair instead
+/// of inserting them into a hash map. Edges are numbered in the order in which
+/// they first occur in the triangle list.
+struct SubdivisionEdges {
+    /// Ordered vertex indices of every edge.
+    std::vector<Eigen::Vector2i> edges_;
+    /// Ids of the edges (0, 1), (1, 2) and (2, 0) of every triangle.
+    std::vector<Eigen::Vector3i> triangle_edges_;
+    /// Half edges 3 * tidx + k, i.e. edge k of triangle tidx, grouped by edge.
+    /// The half edges of edge eidx are stored in the range
+    /// [half_edge_begin_[eidx], half_edge_begin_[eidx + 1]).
+    std::vector<int> half_edges_;
+    std::vector<int> half_edge_begin_;
+
+    int NumberOfTriangles(int eidx) const {
+        return half_edge_begin_[eidx + 1] - half_edge_begin_[eidx];
+    }
+};
+
+SubdivisionEdges ComputeSubdivisionEdges(
+        const std::vector<Eigen::Vector3i> &triangles) {
+    const int n_half_edges = int(3 * triangles.size());
+    std::vector<std::pair<uint64_t, int>> keys(n_half_edges);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int hidx = 0; hidx < n_half_edges; ++hidx) {
+        const Eigen::Vector3i &triangle = triangles[hidx / 3];
+        uint32_t vidx0 = uint32_t(triangle(hidx % 3));
+        uint32_t vidx1 = uint32_t(triangle((hidx + 1) % 3));
+        if (vidx0 > vidx1) {
+            std::swap(vidx0, vidx1);
+        }
+        keys[hidx] = std::make_pair((uint64_t(vidx0) << 32) | vidx1, hidx);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    // After sorting, the first half edge of a group of equal keys is the one
+    // that occurs first in the triangle list.
+    std::vector<int> group_begin;
+    for (int kidx = 0; kidx < n_half_edges; ++kidx) {
+        if (kidx == 0 || keys[kidx].first != keys[kidx - 1].first) {
+            group_begin.push_back(kidx);
+        }
+    }
+    const int n_edges = int(group_begin.size());
+    group_begin.push_back(n_half_edges);
+
+    std::vector<int> half_edge_to_edge(n_half_edges, -1);
+    for (int gidx = 0; gidx < n_edges; ++gidx) {
+        half_edge_to_edge[keys[group_begin[gidx]].second] = 0;
+    }
+    int eidx = 0;
+    for (int hidx = 0; hidx < n_half_edges; ++hidx) {
+        if (half_edge_to_edge[hidx] == 0) {
+            half_edge_to_edge[hidx] = eidx++;
+        }
+    }
+
+    SubdivisionEdges result;
+    result.edges_.resize(n_edges);
+    result.triangle_edges_.resize(triangles.size());
+    result.half_edges_.resize(n_half_edges);
+    result.half_edge_begin_.resize(n_edges + 1, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int gidx = 0; gidx < n_edges; ++gidx) {
+        int eidx = half_edge_to_edge[keys[group_begin[gidx]].second];
+        uint64_t key = keys[group_begin[gidx]].first;
+        result.edges_[eidx] = Eigen::Vector2i(int(key >> 32),
+                                              int(key & 0xFFFFFFFF));
+        result.half_edge_begin_[eidx + 1] =
+                group_begin[gidx + 1] - group_begin[gidx];
+    }
+    for (int eidx = 0; eidx < n_edges; ++eidx) {
+        result.half_edge_begin_[eidx + 1] += result.half_edge_begin_[eidx];
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int gidx = 0; gidx < n_edges; ++gidx) {
+        int eidx = half_edge_to_edge[keys[group_begin[gidx]].second];
+        int offset = result.half_edge_begin_[eidx];
+        for (int kidx = group_begin[gidx]; kidx < group_begin[gidx + 1];
+             ++kidx) {
+            int hidx = keys[kidx].second;
+            result.half_edges_[offset++] = hidx;
+            result.triangle_edges_[hidx / 3](hidx % 3) = eidx;
+        }
+    }
+    return result;
+}
+
+/// Replaces every triangle by its 4 children. The vertex inserted on edge
+/// eidx has the index n_vertices + eidx. Triangle uvs are interpolated
+/// linearly and the material ids are inherited by the children.
+void SubdivideTriangles(TriangleMesh &mesh,
+                        const SubdivisionEdges &edges,
+                        int n_vertices) {
+    const int n_triangles = int(mesh.triangles_.size());
+    const bool has_triangle_uvs = mesh.HasTriangleUvs();
+    const bool has_material_ids = mesh.HasTriangleMaterialIds();
+    std::vector<Eigen::Vector3i> new_triangles(4 * n_triangles);
+    std::vector<Eigen::Vector2d> new_triangle_uvs;
+    if (has_triangle_uvs) {
+        new_triangle_uvs.resize(12 * n_triangles);
+    }
+    std::vector<int> new_material_ids;
+    if (has_material_ids) {
+        new_material_ids.resize(4 * n_triangles);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int tidx = 0; tidx < n_triangles; ++tidx) {
+        const Eigen::Vector3i &triangle = mesh.triangles_[tidx];
+        const Eigen::Vector3i &triangle_edges = edges.triangle_edges_[tidx];
+        int vidx0 = triangle(0);
+        int vidx1 = triangle(1);
+        int vidx2 = triangle(2);
+        int vidx01 = n_vertices + triangle_edges(0);
+        int vidx12 = n_vertices + triangle_edges(1);
+        int vidx20 = n_vertices + triangle_edges(2);
+        new_triangles[tidx * 4 + 0] = Eigen::Vector3i(vidx0, vidx01, vidx20);
+        new_triangles[tidx * 4 + 1] = Eigen::Vector3i(vidx01, vidx1, vidx12);
+        new_triangles[tidx * 4 + 2] = Eigen::Vector3i(vidx12, vidx2, vidx20);
+        new_triangles[tidx * 4 + 3] = Eigen::Vector3i(vidx01, vidx12, vidx20);
+        if (has_triangle_uvs) {
+            const Eigen::Vector2d &uv0 = mesh.triangle_uvs_[tidx * 3 + 0];
+            const Eigen::Vector2d &uv1 = mesh.triangle_uvs_[tidx * 3 + 1];
+            const Eigen::Vector2d &uv2 = mesh.triangle_uvs_[tidx * 3 + 2];
+            Eigen::Vector2d uv01 = 0.5 * (uv0 + uv1);
+            Eigen::Vector2d uv12 = 0.5 * (uv1 + uv2);
+            Eigen::Vector2d uv20 = 0.5 * (uv2 + uv0);
+            Eigen::Vector2d *uvs = &new_triangle_uvs[tidx * 12];
+            uvs[0] = uv0, uvs[1] = uv01, uvs[2] = uv20;
+            uvs[3] = uv01, uvs[4] = uv1, uvs[5] = uv12;
+            uvs[6] = uv12, uvs[7] = uv2, uvs[8] = uv20;
+            uvs[9] = uv01, uvs[10] = uv12, uvs[11] = uv20;
+        }
+        if (has_material_ids) {
+            std::fill_n(new_material_ids.begin() + tidx * 4, 4,
+                        mesh.triangle_material_ids_[tidx]);
+        }
+    }
+    mesh.triangles_ = std::move(new_triangles);
+    if (has_triangle_uvs) {
+        mesh.triangle_uvs_ = std::move(new_triangle_uvs);
+    }
+    if (has_material_ids) {
+        mesh.triangle_material_ids_ = std::move(new_material_ids);
+    }
+}
+
+}  // unnamed namespace
+
 std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
         int number_of_iterations) const {
-    if (HasTriangleUvs()) {
-        utility::LogWarning(
-                "[SubdivideMidpoint] This mesh contains triangle uvs that are "
-                "not handled in this function");
-    }
     auto mesh = std::make_shared<TriangleMesh>();
     mesh->vertices_ = vertices_;
     mesh->vertex_colors_ = vertex_colors_;
     mesh->vertex_normals_ = vertex_normals_;
     mesh->triangles_ = triangles_;
+    if (HasTriangleUvs()) {
+        mesh->triangle_uvs_ = triangle_uvs_;
+        mesh->textures_ = textures_;
+    }
+    if (HasTriangleMaterialIds()) {
+        mesh->triangle_material_ids_ = triangle_material_ids_;
+    }
 
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
 
-    // Compute and return midpoint.
-    // Also adds edge - new vertex refrence to new_verts map.
-    auto SubdivideEdge =
-            [&](std::unordered_map<Eigen::Vector2i, int,
-                                   utility::hash_eigen::hash<Eigen::Vector2i>>&
-                        new_verts,
-                int vidx0, int vidx1) {
-                int min = std::min(vidx0, vidx1);
-                int max = std::max(vidx0, vidx1);
-                Eigen::Vector2i edge(min, max);
-                if (new_verts.count(edge) == 0) {
-                    mesh->vertices_.push_back(0.5 * (mesh->vertices_[min] +
-                                                     mesh->vertices_[max]));
-                    if (has_vert_normal) {
-                        mesh->vertex_normals_.push_back(
-                                0.5 * (mesh->vertex_normals_[min] +
-                                       mesh->vertex_normals_[max]));
-                    }
-                    if (has_vert_color) {
-                        mesh->vertex_colors_.push_back(
-                                0.5 * (mesh->vertex_colors_[min] +
-                                       mesh->vertex_colors_[max]));
-                    }
-                    int vidx01 = int(mesh->vertices_.size()) - 1;
-                    new_verts[edge] = vidx01;
-                    return vidx01;
-                } else {
-                    return new_verts[edge];
-                }
-            };
     for (int iter = 0; iter < number_of_iterations; ++iter) {
-        std::unordered_map<Eigen::Vector2i, int,
-                           utility::hash_eigen::hash<Eigen::Vector2i>>
-                new_verts;
-        std::vector<Eigen::Vector3i> new_triangles(4 * mesh->triangles_.size());
-        for (size_t tidx = 0; tidx < mesh->triangles_.size(); ++tidx) {
-            const auto& triangle = mesh->triangles_[tidx];
-            int vidx0 = triangle(0);
-            int vidx1 = triangle(1);
-            int vidx2 = triangle(2);
-            int vidx01 = SubdivideEdge(new_verts, vidx0, vidx1);
-            int vidx12 = SubdivideEdge(new_verts, vidx1, vidx2);
-            int vidx20 = SubdivideEdge(new_verts, vidx2, vidx0);
-            new_triangles[tidx * 4 + 0] =
-                    Eigen::Vector3i(vidx0, vidx01, vidx20);
-            new_triangles[tidx * 4 + 1] =
-                    Eigen::Vector3i(vidx01, vidx1, vidx12);
-            new_triangles[tidx * 4 + 2] =
-                    Eigen::Vector3i(vidx12, vidx2, vidx20);
-            new_triangles[tidx * 4 + 3] =
-                    Eigen::Vector3i(vidx01, vidx12, vidx20);
+        SubdivisionEdges edges = ComputeSubdivisionEdges(mesh->triangles_);
+        const int n_vertices = int(mesh->vertices_.size());
+        const int n_edges = int(edges.edges_.size());
+        mesh->vertices_.resize(n_vertices + n_edges);
+        if (has_vert_normal) {
+            mesh->vertex_normals_.resize(n_vertices + n_edges);
+        }
+        if (has_vert_color) {
+            mesh->vertex_colors_.resize(n_vertices + n_edges);
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int eidx = 0; eidx < n_edges; ++eidx) {
+            int vidx0 = edges.edges_[eidx](0);
+            int vidx1 = edges.edges_[eidx](1);
+            int vidx01 = n_vertices + eidx;
+            mesh->vertices_[vidx01] =
+                    0.5 * (mesh->vertices_[vidx0] + mesh->vertices_[vidx1]);
+            if (has_vert_normal) {
+                mesh->vertex_normals_[vidx01] =
+                        0.5 * (mesh->vertex_normals_[vidx0] +
+                               mesh->vertex_normals_[vidx1]);
+            }
+            if (has_vert_color) {
+                mesh->vertex_colors_[vidx01] =
+                        0.5 * (mesh->vertex_colors_[vidx0] +
+                               mesh->vertex_colors_[vidx1]);
+            }
         }
-        mesh->triangles_ = new_triangles;
+        SubdivideTriangles(*mesh, edges, n_vertices);
     }
 
     if (HasTriangleNormals()) {
@@ -115,258 +257,199 @@ std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideMidpoint(
 
 std::shared_ptr<TriangleMesh> TriangleMesh::SubdivideLoop(
         int number_of_iterations) const {
-    if (HasTriangleUvs()) {
-        utility::LogWarning(
-                "[SubdivideLoop] This mesh contains triangle uvs that are not "
-                "handled in this function");
-    }
-    typedef std::unordered_map<Eigen::Vector2i, int,
-                               utility::hash_eigen::hash<Eigen::Vector2i>>
-            EdgeNewVertMap;
-    typedef std::unordered_map<Eigen::Vector2i, std::unordered_set<int>,
-                               utility::hash_eigen::hash<Eigen::Vector2i>>
-            EdgeTrianglesMap;
-    typedef std::vector<std::unordered_set<int>> VertexNeighbours;
-
     bool has_vert_normal = HasVertexNormals();
     bool has_vert_color = HasVertexColors();
 
-    auto UpdateVertex = [&](int vidx,
-                            const std::shared_ptr<TriangleMesh>& old_mesh,
-                            std::shared_ptr<TriangleMesh>& new_mesh,
-                            const std::unordered_set<int>& nbs,
-                            const EdgeTrianglesMap& edge_to_triangles) {
-        // check if boundary edge and get nb vertices in that case
-        std::unordered_set<int> boundary_nbs;
-        for (int nb : nbs) {
-            const Eigen::Vector2i edge = GetOrderedEdge(vidx, nb);
-            if (edge_to_triangles.at(edge).size() == 1) {
-                boundary_nbs.insert(nb);
+    auto old_mesh = std::make_shared<TriangleMesh>();
+    old_mesh->vertices_ = vertices_;
+    old_mesh->vertex_colors_ = vertex_colors_;
+    old_mesh->vertex_normals_ = vertex_normals_;
+    old_mesh->triangles_ = triangles_;
+    if (HasTriangleUvs()) {
+        old_mesh->triangle_uvs_ = triangle_uvs_;
+        old_mesh->textures_ = textures_;
+    }
+    if (HasTriangleMaterialIds()) {
+        old_mesh->triangle_material_ids_ = triangle_material_ids_;
+    }
+
+    for (int iter = 0; iter < number_of_iterations; ++iter) {
+        SubdivisionEdges edges = ComputeSubdivisionEdges(old_mesh->triangles_);
+        const int n_vertices = int(old_mesh->vertices_.size());
+        const int n_edges = int(edges.edges_.size());
+        if (iter == 0) {
+            for (int eidx = 0; eidx < n_edges; ++eidx) {
+                if (edges.NumberOfTriangles(eidx) > 2) {
+                    utility::LogWarning("[SubdivideLoop] non-manifold edge.");
+                    break;
+                }
             }
         }
 
-        // in manifold meshes this should not happen
-        if (boundary_nbs.size() > 2) {
-            utility::LogWarning(
-                    "[SubdivideLoop] boundary edge with > 2 neighbours, maybe "
-                    "mesh is not manifold.");
+        // Edges incident to every vertex.
+        std::vector<int> vertex_edge_begin(n_vertices + 1, 0);
+        for (const auto &edge : edges.edges_) {
+            vertex_edge_begin[edge(0) + 1]++;
+            vertex_edge_begin[edge(1) + 1]++;
         }
-
-        double beta, alpha;
-        if (boundary_nbs.size() >= 2) {
-            beta = 1. / 8.;
-            alpha = 1. - boundary_nbs.size() * beta;
-        } else if (nbs.size() == 3) {
-            beta = 3. / 16.;
-            alpha = 1. - nbs.size() * beta;
-        } else {
-            beta = 3. / (8. * nbs.size());
-            alpha = 1. - nbs.size() * beta;
+        for (int vidx = 0; vidx < n_vertices; ++vidx) {
+            vertex_edge_begin[vidx + 1] += vertex_edge_begin[vidx];
+        }
+        std::vector<int> vertex_edges(2 * n_edges);
+        {
+            std::vector<int> offsets(vertex_edge_begin.begin(),
+                                     vertex_edge_begin.end() - 1);
+            for (int eidx = 0; eidx < n_edges; ++eidx) {
+                vertex_edges[offsets[edges.edges_[eidx](0)]++] = eidx;
+                vertex_edges[offsets[edges.edges_[eidx](1)]++] = eidx;
+            }
         }
 
-        new_mesh->vertices_[vidx] = alpha * old_mesh->vertices_[vidx];
+        auto new_mesh = std::make_shared<TriangleMesh>();
+        new_mesh->vertices_.resize(n_vertices + n_edges);
         if (has_vert_normal) {
-            new_mesh->vertex_normals_[vidx] =
-                    alpha * old_mesh->vertex_normals_[vidx];
+            new_mesh->vertex_normals_.resize(n_vertices + n_edges);
         }
         if (has_vert_color) {
-            new_mesh->vertex_colors_[vidx] =
-                    alpha * old_mesh->vertex_colors_[vidx];
+            new_mesh->vertex_colors_.resize(n_vertices + n_edges);
         }
 
-        auto Update = [&](int nb) {
-            new_mesh->vertices_[vidx] += beta * old_mesh->vertices_[nb];
+        // Vertex points.
+        bool non_manifold_boundary = false;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) reduction(|| : non_manifold_boundary)
+#endif
+        for (int vidx = 0; vidx < n_vertices; ++vidx) {
+            const int n_nbs =
+                    vertex_edge_begin[vidx + 1] - vertex_edge_begin[vidx];
+            int n_boundary_nbs = 0;
+            for (int idx = vertex_edge_begin[vidx];
+                 idx < vertex_edge_begin[vidx + 1]; ++idx) {
+                if (edges.NumberOfTriangles(vertex_edges[idx]) == 1) {
+                    n_boundary_nbs++;
+                }
+            }
+            // in manifold meshes this should not happen
+            if (n_boundary_nbs > 2) {
+                non_manifold_boundary = true;
+            }
+
+            double beta, alpha;
+            if (n_boundary_nbs >= 2) {
+                beta = 1. / 8.;
+                alpha = 1. - n_boundary_nbs * beta;
+            } else if (n_nbs == 0) {
+                beta = 0.;
+                alpha = 1.;
+            } else if (n_nbs == 3) {
+                beta = 3. / 16.;
+                alpha = 1. - n_nbs * beta;
+            } else {
+                beta = 3. / (8. * n_nbs);
+                alpha = 1. - n_nbs * beta;
+            }
+
+            Eigen::Vector3d vertex = alpha * old_mesh->vertices_[vidx];
+            Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+            Eigen::Vector3d color = Eigen::Vector3d::Zero();
             if (has_vert_normal) {
-                new_mesh->vertex_normals_[vidx] +=
-                        beta * old_mesh->vertex_normals_[nb];
+                normal = alpha * old_mesh->vertex_normals_[vidx];
             }
             if (has_vert_color) {
-                new_mesh->vertex_colors_[vidx] +=
-                        beta * old_mesh->vertex_colors_[nb];
+                color = alpha * old_mesh->vertex_colors_[vidx];
             }
-        };
-        if (boundary_nbs.size() >= 2) {
-            for (int nb : boundary_nbs) {
-                Update(nb);
+            for (int idx = vertex_edge_begin[vidx];
+                 idx < vertex_edge_begin[vidx + 1]; ++idx) {
+                int eidx = vertex_edges[idx];
+                if (n_boundary_nbs >= 2 && edges.NumberOfTriangles(eidx) != 1) {
+                    continue;
+                }
+                const Eigen::Vector2i &edge = edges.edges_[eidx];
+                int nb = edge(0) == vidx ? edge(1) : edge(0);
+                vertex += beta * old_mesh->vertices_[nb];
+                if (has_vert_normal) {
+                    normal += beta * old_mesh->vertex_normals_[nb];
+                }
+                if (has_vert_color) {
+                    color += beta * old_mesh->vertex_colors_[nb];
+                }
             }
-        } else {
-            for (int nb : nbs) {
-                Update(nb);
+            new_mesh->vertices_[vidx] = vertex;
+            if (has_vert_normal) {
+                new_mesh->vertex_normals_[vidx] = normal;
+            }
+            if (has_vert_color) {
+                new_mesh->vertex_colors_[vidx] = color;
             }
         }
-    };
-
-    auto SubdivideEdge = [&](int vidx0, int vidx1,
-                             const std::shared_ptr<TriangleMesh>& old_mesh,
-                             std::shared_ptr<TriangleMesh>& new_mesh,
-                             EdgeNewVertMap& new_verts,
-                             const EdgeTrianglesMap& edge_to_triangles) {
-        Eigen::Vector2i edge = GetOrderedEdge(vidx0, vidx1);
-        if (new_verts.count(edge) == 0) {
-            Eigen::Vector3d new_vert =
+        if (non_manifold_boundary) {
+            utility::LogWarning(
+                    "[SubdivideLoop] boundary edge with > 2 neighbours, maybe "
+                    "mesh is not manifold.");
+        }
+
+        // Edge points.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (int eidx = 0; eidx < n_edges; ++eidx) {
+            int vidx0 = edges.edges_[eidx](0);
+            int vidx1 = edges.edges_[eidx](1);
+            Eigen::Vector3d vertex =
                     old_mesh->vertices_[vidx0] + old_mesh->vertices_[vidx1];
-            Eigen::Vector3d new_normal;
+            Eigen::Vector3d normal = Eigen::Vector3d::Zero();
+            Eigen::Vector3d color = Eigen::Vector3d::Zero();
             if (has_vert_normal) {
-                new_normal = old_mesh->vertex_normals_[vidx0] +
-                             old_mesh->vertex_normals_[vidx1];
+                normal = old_mesh->vertex_normals_[vidx0] +
+                         old_mesh->vertex_normals_[vidx1];
             }
-            Eigen::Vector3d new_color;
             if (has_vert_color) {
-                new_color = old_mesh->vertex_colors_[vidx0] +
-                            old_mesh->vertex_colors_[vidx1];
+                color = old_mesh->vertex_colors_[vidx0] +
+                        old_mesh->vertex_colors_[vidx1];
             }
 
-            const auto& edge_triangles = edge_to_triangles.at(edge);
-            if (edge_triangles.size() < 2) {
-                new_vert *= 0.5;
-                if (has_vert_normal) {
-                    new_normal *= 0.5;
-                }
-                if (has_vert_color) {
-                    new_color *= 0.5;
-                }
+            const int n_adjacent_trias = edges.NumberOfTriangles(eidx);
+            if (n_adjacent_trias < 2) {
+                vertex *= 0.5;
+                normal *= 0.5;
+                color *= 0.5;
             } else {
-                new_vert *= 3. / 8.;
-                if (has_vert_normal) {
-                    new_normal *= 3. / 8.;
-                }
-                if (has_vert_color) {
-                    new_color *= 3. / 8.;
-                }
-                size_t n_adjacent_trias = edge_triangles.size();
+                vertex *= 3. / 8.;
+                normal *= 3. / 8.;
+                color *= 3. / 8.;
                 double scale = 1. / (4. * n_adjacent_trias);
-                for (int tidx : edge_triangles) {
-                    const auto& tria = old_mesh->triangles_[tidx];
-                    int vidx2 =
-                            (tria(0) != vidx0 && tria(0) != vidx1)
-                                    ? tria(0)
-                                    : ((tria(1) != vidx0 && tria(1) != vidx1)
-                                               ? tria(1)
-                                               : tria(2));
-                    new_vert += scale * old_mesh->vertices_[vidx2];
+                for (int idx = edges.half_edge_begin_[eidx];
+                     idx < edges.half_edge_begin_[eidx + 1]; ++idx) {
+                    int hidx = edges.half_edges_[idx];
+                    // The vertex opposite to edge k of a triangle.
+                    int vidx2 = old_mesh->triangles_[hidx / 3]((hidx + 2) % 3);
+                    vertex += scale * old_mesh->vertices_[vidx2];
                     if (has_vert_normal) {
-                        new_normal += scale * old_mesh->vertex_normals_[vidx2];
+                        normal += scale * old_mesh->vertex_normals_[vidx2];
                     }
                     if (has_vert_color) {
-                        new_color += scale * old_mesh->vertex_colors_[vidx2];
+                        color += scale * old_mesh->vertex_colors_[vidx2];
                     }
                 }
             }
 
-            int vidx01 = int(old_mesh->vertices_.size() + new_verts.size());
-
-            new_mesh->vertices_[vidx01] = new_vert;
+            int vidx01 = n_vertices + eidx;
+            new_mesh->vertices_[vidx01] = vertex;
             if (has_vert_normal) {
-                new_mesh->vertex_normals_[vidx01] = new_normal;
+                new_mesh->vertex_normals_[vidx01] = normal;
             }
             if (has_vert_color) {
-                new_mesh->vertex_colors_[vidx01] = new_color;
+                new_mesh->vertex_colors_[vidx01] = color;
             }
-
-            new_verts[edge] = vidx01;
-            return vidx01;
-        } else {
-            int vidx01 = new_verts[edge];
-            return vidx01;
-        }
-    };
-
-    auto InsertTriangle = [&](int tidx, int vidx0, int vidx1, int vidx2,
-                              std::shared_ptr<TriangleMesh>& mesh,
-                              EdgeTrianglesMap& edge_to_triangles,
-                              VertexNeighbours& vertex_neighbours) {
-        mesh->triangles_[tidx] = Eigen::Vector3i(vidx0, vidx1, vidx2);
-        edge_to_triangles[GetOrderedEdge(vidx0, vidx1)].insert(tidx);
-        edge_to_triangles[GetOrderedEdge(vidx1, vidx2)].insert(tidx);
-        edge_to_triangles[GetOrderedEdge(vidx2, vidx0)].insert(tidx);
-        vertex_neighbours[vidx0].insert(vidx1);
-        vertex_neighbours[vidx0].insert(vidx2);
-        vertex_neighbours[vidx1].insert(vidx0);
-        vertex_neighbours[vidx1].insert(vidx2);
-        vertex_neighbours[vidx2].insert(vidx0);
-        vertex_neighbours[vidx2].insert(vidx1);
-    };
-
-    EdgeTrianglesMap edge_to_triangles;
-    VertexNeighbours vertex_neighbours(vertices_.size());
-    for (size_t tidx = 0; tidx < triangles_.size(); ++tidx) {
-        const auto& tria = triangles_[tidx];
-        Eigen::Vector2i e0 = GetOrderedEdge(tria(0), tria(1));
-        edge_to_triangles[e0].insert(int(tidx));
-        Eigen::Vector2i e1 = GetOrderedEdge(tria(1), tria(2));
-        edge_to_triangles[e1].insert(int(tidx));
-        Eigen::Vector2i e2 = GetOrderedEdge(tria(2), tria(0));
-        edge_to_triangles[e2].insert(int(tidx));
-
-        if (edge_to_triangles[e0].size() > 2 ||
-            edge_to_triangles[e1].size() > 2 ||
-            edge_to_triangles[e2].size() > 2) {
-            utility::LogWarning("[SubdivideLoop] non-manifold edge.");
-        }
-
-        vertex_neighbours[tria(0)].insert(tria(1));
-        vertex_neighbours[tria(0)].insert(tria(2));
-        vertex_neighbours[tria(1)].insert(tria(0));
-        vertex_neighbours[tria(1)].insert(tria(2));
-        vertex_neighbours[tria(2)].insert(tria(0));
-        vertex_neighbours[tria(2)].insert(tria(1));
-    }
-
-    auto old_mesh = std::make_shared<TriangleMesh>();
-    old_mesh->vertices_ = vertices_;
-    old_mesh->vertex_colors_ = vertex_colors_;
-    old_mesh->vertex_normals_ = vertex_normals_;
-    old_mesh->triangles_ = triangles_;
-
-    for (int iter = 0; iter < number_of_iterations; ++iter) {
-        size_t n_new_vertices =
-                old_mesh->vertices_.size() + edge_to_triangles.size();
-        size_t n_new_triangles = 4 * old_mesh->triangles_.size();
-        auto new_mesh = std::make_shared<TriangleMesh>();
-        new_mesh->vertices_.resize(n_new_vertices);
-        if (has_vert_normal) {
-            new_mesh->vertex_normals_.resize(n_new_vertices);
-        }
-        if (has_vert_color) {
-            new_mesh->vertex_colors_.resize(n_new_vertices);
-        }
-        new_mesh->triangles_.resize(n_new_triangles);
-
-        EdgeNewVertMap new_verts;
-        EdgeTrianglesMap new_edge_to_triangles;
-        VertexNeighbours new_vertex_neighbours(n_new_vertices);
-
-        for (size_t vidx = 0; vidx < old_mesh->vertices_.size(); ++vidx) {
-            UpdateVertex(int(vidx), old_mesh, new_mesh, vertex_neighbours[vidx],
-                         edge_to_triangles);
-        }
-
-        for (size_t tidx = 0; tidx < old_mesh->triangles_.size(); ++tidx) {
-            const auto& triangle = old_mesh->triangles_[tidx];
-            int vidx0 = triangle(0);
-            int vidx1 = triangle(1);
-            int vidx2 = triangle(2);
-
-            int vidx01 = SubdivideEdge(vidx0, vidx1, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx12 = SubdivideEdge(vidx1, vidx2, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-            int vidx20 = SubdivideEdge(vidx2, vidx0, old_mesh, new_mesh,
-                                       new_verts, edge_to_triangles);
-
-            InsertTriangle(int(tidx) * 4 + 0, vidx0, vidx01, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 1, vidx01, vidx1, vidx12, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 2, vidx12, vidx2, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
-            InsertTriangle(int(tidx) * 4 + 3, vidx01, vidx12, vidx20, new_mesh,
-                           new_edge_to_triangles, new_vertex_neighbours);
         }
 
+        SubdivideTriangles(*old_mesh, edges, n_vertices);
+        new_mesh->triangles_ = std::move(old_mesh->triangles_);
+        new_mesh->triangle_uvs_ = std::move(old_mesh->triangle_uvs_);
+        new_mesh->triangle_material_ids_ =
+                std::move(old_mesh->triangle_material_ids_);
+        new_mesh->textures_ = std::move(old_mesh->textures_);
         old_mesh = std::move(new_mesh);
-        edge_to_triangles = std::move(new_edge_to_triangles);
-        vertex_neighbours = std::move(new_vertex_neighbours);
     }
 
     if (HasTriangleNormals()) {
@@ -0,0 +1,122 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "Open3D/IO/ClassIO/TSDFVolumeIO.h"
+
+#include <unordered_map>
+
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+static const std::unordered_map<
+        std::string,
+        std::function<std::shared_ptr<integration::TSDFVolume>(
+                const std::string &)>>
+        file_extension_to_tsdfvolume_read_function{
+                {"tsdf", ReadTSDFVolumeFromTSDF},
+        };
+
+static const std::unordered_map<
+        std::string,
+        std::function<bool(const std::string &,
+                           const integration::TSDFVolume &,
+                           const bool)>>
+        file_extension_to_tsdfvolume_write_function{
+                {"tsdf", WriteTSDFVolumeToTSDF},
+        };
+
+static const std::unordered_map<
+        std::string,
+        std::function<bool(const std::string &,
+                           integration::ScalableTSDFVolume &,
+                           const geometry::AxisAlignedBoundingBox &)>>
+        file_extension_to_tsdfvolume_units_read_function{
+                {"tsdf", ReadTSDFVolumeUnitsFromTSDF},
+        };
+
+}  // unnamed namespace
+
+namespace io {
+
+std::shared_ptr<integration::TSDFVolume> CreateTSDFVolumeFromFile(
+        const std::string &filename) {
+    std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    auto map_itr =
+            file_extension_to_tsdfvolume_read_function.find(filename_ext);
+    if (map_itr == file_extension_to_tsdfvolume_read_function.end()) {
+        utility::LogWarning(
+                "Read integration::TSDFVolume failed: unknown file "
+                "extension.");
+        return nullptr;
+    }
+    return map_itr->second(filename);
+}
+
+bool WriteTSDFVolume(const std::string &filename,
+                     const integration::TSDFVolume &volume,
+                     bool compressed /* = true*/) {
+    std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    auto map_itr =
+            file_extension_to_tsdfvolume_write_function.find(filename_ext);
+    if (map_itr == file_extension_to_tsdfvolume_write_function.end()) {
+        utility::LogWarning(
+                "Write integration::TSDFVolume failed: unknown file "
+                "extension.");
+        return false;
+    }
+    return map_itr->second(filename, volume, compressed);
+}
+
+bool ReadTSDFVolumeUnits(const std::string &filename,
+                         integration::ScalableTSDFVolume &volume,
+                         const geometry::AxisAlignedBoundingBox &bound) {
+    std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    auto map_itr =
+            file_extension_to_tsdfvolume_units_read_function.find(filename_ext);
+    if (map_itr == file_extension_to_tsdfvolume_units_read_function.end()) {
+        utility::LogWarning(
+                "Read integration::ScalableTSDFVolume failed: unknown file "
+                "extension.");
+        return false;
+    }
+    int num_units = volume.volume_units_.Size();
+    bool success = map_itr->second(filename, volume, bound);
+    utility::LogDebug("Read integration::ScalableTSDFVolume: {:d} new units.",
+                      volume.volume_units_.Size() - num_units);
+    return success;
+}
+
+}  // namespace io
+}  // namespace open3d
@@ -0,0 +1,81 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <memory>
+#include <string>
+
+#include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Integration/ScalableTSDFVolume.h"
+#include "Open3D/Integration/TSDFVolume.h"
+#include "Open3D/Integration/UniformTSDFVolume.h"
+
+namespace open3d {
+namespace io {
+
+/// Factory function to create a UniformTSDFVolume or a ScalableTSDFVolume from
+/// a file.
+/// \return return nullptr if fail to read the file.
+std::shared_ptr<integration::TSDFVolume> CreateTSDFVolumeFromFile(
+        const std::string &filename);
+
+/// The general entrance for writing a UniformTSDFVolume or a
+/// ScalableTSDFVolume to a file, e.g. to checkpoint a reconstruction.
+/// The function calls write functions based on the extension name of filename.
+/// If `compressed` is true, the blocks of voxels are compressed separately.
+/// \return return true if the write function is successful, false otherwise.
+bool WriteTSDFVolume(const std::string &filename,
+                     const integration::TSDFVolume &volume,
+                     bool compressed = true);
+
+/// \brief Pages the volume units of a ScalableTSDFVolume file that intersect
+/// `bound` into `volume`.
+///
+/// The blocks outside of `bound` are skipped without being decompressed, so
+/// that parts of scenes larger than memory can be loaded, and released again
+/// with ScalableTSDFVolume::RemoveVolumeUnits. The units already in `volume`
+/// are overwritten. The voxel length, truncation, color type and unit
+/// resolution of `volume` must match the file.
+/// \return return true if the read function is successful, false otherwise.
+bool ReadTSDFVolumeUnits(const std::string &filename,
+                         integration::ScalableTSDFVolume &volume,
+                         const geometry::AxisAlignedBoundingBox &bound);
+
+std::shared_ptr<integration::TSDFVolume> ReadTSDFVolumeFromTSDF(
+        const std::string &filename);
+
+bool WriteTSDFVolumeToTSDF(const std::string &filename,
+                           const integration::TSDFVolume &volume,
+                           bool compressed);
+
+bool ReadTSDFVolumeUnitsFromTSDF(const std::string &filename,
+                                 integration::ScalableTSDFVolume &volume,
+                                 const geometry::AxisAlignedBoundingBox &bound);
+
+}  // namespace io
+}  // namespace open3d
@@ -49,6 +49,16 @@ static const std::unordered_map<
                 {"glb", ReadTriangleMeshFromGLTF},
         };
 
+static const std::unordered_map<
+        std::string,
+        std::function<bool(
+                const std::string &, const TriangleStreamCallback &, bool)>>
+        file_extension_to_trianglemesh_stream_read_function{
+                {"ply", ReadTriangleMeshStreamedFromPLY},
+                {"stl", ReadTriangleMeshStreamedFromSTL},
+                {"obj", ReadTriangleMeshStreamedFromOBJ},
+        };
+
 static const std::unordered_map<
         std::string,
         std::function<bool(const std::string &,
@@ -110,6 +120,23 @@ bool ReadTriangleMesh(const std::string &filename,
     return success;
 }
 
+bool ReadTriangleMeshStreamed(const std::string &filename,
+                              const TriangleStreamCallback &callback,
+                              bool print_progress /* = false */) {
+    std::string filename_ext =
+            utility::filesystem::GetFileExtensionInLowerCase(filename);
+    auto map_itr =
+            file_extension_to_trianglemesh_stream_read_function.find(
+                    filename_ext);
+    if (map_itr == file_extension_to_trianglemesh_stream_read_function.end()) {
+        utility::LogWarning(
+                "Stream geometry::TriangleMesh failed: unknown file "
+                "extension.");
+        return false;
+    }
+    return map_itr->second(filename, callback, print_progress);
+}
+
 bool WriteTriangleMesh(const std::string &filename,
                        const geometry::TriangleMesh &mesh,
                        bool write_ascii /* = false*/,
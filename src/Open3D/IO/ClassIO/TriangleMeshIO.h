@@ -26,6 +26,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 
 #include "Open3D/Geometry/TriangleMesh.h"
@@ -61,10 +62,33 @@ bool WriteTriangleMesh(const std::string &filename,
                        bool write_triangle_uvs = true,
                        bool print_progress = false);
 
+/// Function called for every triangle read by ReadTriangleMeshStreamed, with
+/// the positions of the three corners of the triangle. Returning false stops
+/// the reading.
+typedef std::function<bool(const Eigen::Vector3d &,
+                           const Eigen::Vector3d &,
+                           const Eigen::Vector3d &)>
+        TriangleStreamCallback;
+
+/// The general entrance for streaming the triangles of a file without building
+/// a TriangleMesh. Only the vertex positions of indexed formats (.ply, .obj)
+/// are kept, in single precision, while the faces are read; binary .stl files
+/// are read in fixed-size chunks. Polygons are split into triangle fans and
+/// faces with less than three vertices are skipped.
+/// \return return true if the read function is successful or was stopped by
+/// the callback, false otherwise.
+bool ReadTriangleMeshStreamed(const std::string &filename,
+                              const TriangleStreamCallback &callback,
+                              bool print_progress = false);
+
 bool ReadTriangleMeshFromPLY(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress);
 
+bool ReadTriangleMeshStreamedFromPLY(const std::string &filename,
+                                     const TriangleStreamCallback &callback,
+                                     bool print_progress);
+
 bool WriteTriangleMeshToPLY(const std::string &filename,
                             const geometry::TriangleMesh &mesh,
                             bool write_ascii,
@@ -78,6 +102,10 @@ bool ReadTriangleMeshFromSTL(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress);
 
+bool ReadTriangleMeshStreamedFromSTL(const std::string &filename,
+                                     const TriangleStreamCallback &callback,
+                                     bool print_progress);
+
 bool WriteTriangleMeshToSTL(const std::string &filename,
                             const geometry::TriangleMesh &mesh,
                             bool write_ascii,
@@ -91,6 +119,10 @@ bool ReadTriangleMeshFromOBJ(const std::string &filename,
                              geometry::TriangleMesh &mesh,
                              bool print_progress);
 
+bool ReadTriangleMeshStreamedFromOBJ(const std::string &filename,
+                                     const TriangleStreamCallback &callback,
+                                     bool print_progress);
+
 bool WriteTriangleMeshToOBJ(const std::string &filename,
                             const geometry::TriangleMesh &mesh,
                             bool write_ascii,
@@ -24,6 +24,7 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdlib>
 #include <fstream>
 #include <numeric>
 #include <vector>
@@ -159,6 +160,90 @@ bool ReadTriangleMeshFromOBJ(const std::string& filename,
     return true;
 }
 
+bool ReadTriangleMeshStreamedFromOBJ(const std::string& filename,
+                                     const TriangleStreamCallback& callback,
+                                     bool print_progress) {
+    std::ifstream file(filename.c_str(), std::ios::in | std::ios::binary);
+    if (!file) {
+        utility::LogWarning("Read OBJ failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    file.seekg(0, std::ios::end);
+    const size_t file_size = size_t(file.tellg());
+    file.seekg(0, std::ios::beg);
+
+    // The progress is reported per megabyte of the file since the number of
+    // faces is not known in advance.
+    const size_t progress_step = 1 << 20;
+    utility::ConsoleProgressBar progress_bar(file_size / progress_step + 1,
+                                             "Reading OBJ: ", print_progress);
+    size_t bytes_read = 0;
+    size_t next_progress = progress_step;
+
+    std::vector<Eigen::Vector3f> vertices;
+    std::vector<long> face;
+    std::string line;
+    while (std::getline(file, line)) {
+        bytes_read += line.size() + 1;
+        while (bytes_read >= next_progress) {
+            ++progress_bar;
+            next_progress += progress_step;
+        }
+        const char* ptr = line.c_str();
+        if (ptr[0] == 'v' && (ptr[1] == ' ' || ptr[1] == '\t')) {
+            char* end;
+            Eigen::Vector3f v;
+            ptr++;
+            for (int i = 0; i < 3; i++) {
+                v(i) = std::strtof(ptr, &end);
+                if (end == ptr) {
+                    utility::LogWarning(
+                            "Read OBJ failed: invalid vertex \"{}\".", line);
+                    return false;
+                }
+                ptr = end;
+            }
+            vertices.push_back(v);
+        } else if (ptr[0] == 'f' && (ptr[1] == ' ' || ptr[1] == '\t')) {
+            face.clear();
+            ptr++;
+            while (true) {
+                char* end;
+                long idx = std::strtol(ptr, &end, 10);
+                if (end == ptr) {
+                    break;
+                }
+                // Skip the texture coordinate and normal indices.
+                ptr = end;
+                while (*ptr != '\0' && *ptr != ' ' && *ptr != '\t') {
+                    ptr++;
+                }
+                // Negative indices refer to the end of the vertex list.
+                idx = idx < 0 ? long(vertices.size()) + idx : idx - 1;
+                if (idx < 0 || idx >= long(vertices.size())) {
+                    utility::LogWarning(
+                            "Read OBJ failed: face refers to an invalid "
+                            "vertex.");
+                    return false;
+                }
+                face.push_back(idx);
+            }
+            if (face.size() < 3) {
+                continue;
+            }
+            const Eigen::Vector3d v0 = vertices[face[0]].cast<double>();
+            for (size_t i = 1; i + 1 < face.size(); i++) {
+                if (!callback(v0, vertices[face[i]].cast<double>(),
+                              vertices[face[i + 1]].cast<double>())) {
+                    return true;
+                }
+            }
+        }
+    }
+    return true;
+}
+
 bool WriteTriangleMeshToOBJ(const std::string& filename,
                             const geometry::TriangleMesh& mesh,
                             bool write_ascii /* = false*/,
@@ -206,6 +206,82 @@ int ReadFaceCallBack(p_ply_argument argument) {
 
 }  // namespace ply_trianglemesh_reader
 
+namespace ply_trianglemesh_stream_reader {
+
+struct PLYReaderState {
+    utility::ConsoleProgressBar *progress_bar;
+    const TriangleStreamCallback *callback;
+    std::vector<Eigen::Vector3f> vertices;
+    long vertex_index;
+    long vertex_num;
+    std::vector<long> face;
+    long face_index;
+    long face_num;
+    bool stopped;
+};
+
+int ReadVertexCallback(p_ply_argument argument) {
+    PLYReaderState *state_ptr;
+    long index;
+    ply_get_argument_user_data(argument, reinterpret_cast<void **>(&state_ptr),
+                               &index);
+    if (state_ptr->vertex_index >= state_ptr->vertex_num) {
+        return 0;
+    }
+
+    double value = ply_get_argument_value(argument);
+    state_ptr->vertices[state_ptr->vertex_index](index) = float(value);
+    if (index == 2) {  // reading 'z'
+        state_ptr->vertex_index++;
+        ++(*state_ptr->progress_bar);
+    }
+    return 1;
+}
+
+int ReadFaceCallBack(p_ply_argument argument) {
+    PLYReaderState *state_ptr;
+    long dummy, length, index;
+    ply_get_argument_user_data(argument, reinterpret_cast<void **>(&state_ptr),
+                               &dummy);
+    double value = ply_get_argument_value(argument);
+    if (state_ptr->face_index >= state_ptr->face_num) {
+        return 0;
+    }
+
+    ply_get_argument_property(argument, NULL, &length, &index);
+    if (index == -1) {
+        state_ptr->face.clear();
+    } else {
+        long vidx = long(value);
+        // Faces can only refer to vertices that have already been streamed.
+        if (vidx < 0 || vidx >= state_ptr->vertex_index) {
+            utility::LogWarning(
+                    "Read PLY failed: face refers to an invalid vertex.");
+            return 0;
+        }
+        state_ptr->face.push_back(vidx);
+    }
+    if (long(state_ptr->face.size()) == length) {
+        const auto &vertices = state_ptr->vertices;
+        const auto &face = state_ptr->face;
+        // Faces with less than three vertices, including empty vertex lists,
+        // have no triangle.
+        for (long i = 1; i + 1 < length; i++) {
+            if (!(*state_ptr->callback)(vertices[face[0]].cast<double>(),
+                                        vertices[face[i]].cast<double>(),
+                                        vertices[face[i + 1]].cast<double>())) {
+                state_ptr->stopped = true;
+                return 0;
+            }
+        }
+        state_ptr->face_index++;
+        ++(*state_ptr->progress_bar);
+    }
+    return 1;
+}
+
+}  // namespace ply_trianglemesh_stream_reader
+
 namespace ply_lineset_reader {
 
 struct PLYReaderState {
@@ -571,6 +647,63 @@ bool ReadTriangleMeshFromPLY(const std::string &filename,
     return true;
 }
 
+bool ReadTriangleMeshStreamedFromPLY(const std::string &filename,
+                                     const TriangleStreamCallback &callback,
+                                     bool print_progress) {
+    using namespace ply_trianglemesh_stream_reader;
+
+    p_ply ply_file = ply_open(filename.c_str(), NULL, 0, NULL);
+    if (!ply_file) {
+        utility::LogWarning("Read PLY failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    if (!ply_read_header(ply_file)) {
+        utility::LogWarning("Read PLY failed: unable to parse header.");
+        ply_close(ply_file);
+        return false;
+    }
+
+    PLYReaderState state;
+    state.callback = &callback;
+    state.stopped = false;
+    state.vertex_num = ply_set_read_cb(ply_file, "vertex", "x",
+                                       ReadVertexCallback, &state, 0);
+    ply_set_read_cb(ply_file, "vertex", "y", ReadVertexCallback, &state, 1);
+    ply_set_read_cb(ply_file, "vertex", "z", ReadVertexCallback, &state, 2);
+
+    if (state.vertex_num <= 0) {
+        utility::LogWarning("Read PLY failed: number of vertex <= 0.");
+        ply_close(ply_file);
+        return false;
+    }
+
+    state.face_num = ply_set_read_cb(ply_file, "face", "vertex_indices",
+                                     ReadFaceCallBack, &state, 0);
+    if (state.face_num == 0) {
+        state.face_num = ply_set_read_cb(ply_file, "face", "vertex_index",
+                                         ReadFaceCallBack, &state, 0);
+    }
+
+    state.vertex_index = 0;
+    state.face_index = 0;
+    state.vertices.resize(state.vertex_num);
+
+    utility::ConsoleProgressBar progress_bar(state.vertex_num + state.face_num,
+                                             "Reading PLY: ", print_progress);
+    state.progress_bar = &progress_bar;
+
+    if (!ply_read(ply_file) && !state.stopped) {
+        utility::LogWarning("Read PLY failed: unable to read file: {}",
+                            filename);
+        ply_close(ply_file);
+        return false;
+    }
+
+    ply_close(ply_file);
+    return true;
+}
+
 bool WriteTriangleMeshToPLY(const std::string &filename,
                             const geometry::TriangleMesh &mesh,
                             bool write_ascii /* = false*/,
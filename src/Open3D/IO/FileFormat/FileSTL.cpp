@@ -24,6 +24,8 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <vector>
 
@@ -101,6 +103,67 @@ bool ReadTriangleMeshFromSTL(const std::string &filename,
     return true;
 }
 
+bool ReadTriangleMeshStreamedFromSTL(const std::string &filename,
+                                     const TriangleStreamCallback &callback,
+                                     bool print_progress) {
+    FILE *myFile = utility::filesystem::FOpen(filename.c_str(), "rb");
+    if (!myFile) {
+        utility::LogWarning("Read STL failed: unable to open file.");
+        return false;
+    }
+
+    char header[80] = "";
+    uint32_t num_of_triangles = 0;
+    if (fread(header, sizeof(char), 80, myFile) != 80 ||
+        fread(&num_of_triangles, sizeof(uint32_t), 1, myFile) != 1) {
+        utility::LogWarning("Read STL failed: unable to read header.");
+        fclose(myFile);
+        return false;
+    }
+    if (num_of_triangles == 0) {
+        utility::LogWarning("Read STL failed: empty file.");
+        fclose(myFile);
+        return false;
+    }
+
+    // Each record holds a normal, three corners and a 2 byte attribute.
+    const size_t record_size = 50;
+    const size_t chunk_triangles = 4096;
+    std::vector<char> buffer(record_size * chunk_triangles);
+
+    utility::ConsoleProgressBar progress_bar(num_of_triangles,
+                                             "Reading STL: ", print_progress);
+    size_t num_read = 0;
+    while (num_read < num_of_triangles) {
+        size_t num_chunk = std::min(chunk_triangles,
+                                    size_t(num_of_triangles) - num_read);
+        if (fread(buffer.data(), record_size, num_chunk, myFile) !=
+            num_chunk) {
+            utility::LogWarning("Read STL failed: not enough triangles.");
+            fclose(myFile);
+            return false;
+        }
+        for (size_t i = 0; i < num_chunk; i++) {
+            const char *record = buffer.data() + i * record_size;
+            Eigen::Vector3d corners[3];
+            for (int j = 0; j < 3; j++) {
+                float xyz[3];
+                memcpy(xyz, record + 12 * (j + 1), sizeof(xyz));
+                corners[j] = Eigen::Vector3d(xyz[0], xyz[1], xyz[2]);
+            }
+            if (!callback(corners[0], corners[1], corners[2])) {
+                fclose(myFile);
+                return true;
+            }
+            ++progress_bar;
+        }
+        num_read += num_chunk;
+    }
+
+    fclose(myFile);
+    return true;
+}
+
 bool WriteTriangleMeshToSTL(const std::string &filename,
                             const geometry::TriangleMesh &mesh,
                             bool write_ascii /* = false*/,
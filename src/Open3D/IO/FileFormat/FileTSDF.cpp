@@ -0,0 +1,593 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <liblzf/lzf.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include "Open3D/IO/ClassIO/TSDFVolumeIO.h"
+#include "Open3D/Utility/Console.h"
+#include "Open3D/Utility/FileSystem.h"
+
+// The .tsdf format is a header followed by a sequence of blocks of voxels:
+// the slabs of constant x index of a UniformTSDFVolume that hold observed
+// voxels, or the volume units of a ScalableTSDFVolume. Every block is
+// compressed with LZF on its own and can be skipped without decompressing it.
+// The voxel data of a block is stored as planes of TSDF values, weights and
+// colors in the storage type of the volume, so that the empty space compresses
+// well and volumes are restored exactly.
+
+namespace open3d {
+
+namespace {
+using namespace io;
+
+const char TSDF_MAGIC[8] = {'O', '3', 'D', 'T', 'S', 'D', 'F', '\0'};
+const uint32_t TSDF_VERSION = 1;
+const uint32_t TSDF_UNIFORM_VOLUME = 0;
+const uint32_t TSDF_SCALABLE_VOLUME = 1;
+/// Largest resolution accepted when reading, so that the voxel indices of a
+/// UniformTSDFVolume fit in an int.
+const int32_t TSDF_MAX_RESOLUTION = 1024;
+
+struct TSDFFileHeader {
+    char magic_[8];
+    uint32_t version_;
+    uint32_t volume_type_;
+    uint32_t color_type_;
+    uint32_t storage_type_;
+    /// Resolution of a UniformTSDFVolume or of the units of a
+    /// ScalableTSDFVolume.
+    int32_t resolution_;
+    int32_t depth_sampling_stride_;
+    /// Length of a UniformTSDFVolume or of the units of a ScalableTSDFVolume.
+    double length_;
+    double voxel_length_;
+    double sdf_trunc_;
+    double origin_[3];
+    uint64_t num_blocks_;
+};
+
+struct TSDFFileBlockHeader {
+    /// Slab index of a UniformTSDFVolume in index_[0], or volume unit index.
+    int32_t index_[3];
+    uint32_t raw_size_;
+    /// Size of the data in the file, raw_size_ if it is not compressed.
+    uint32_t stored_size_;
+};
+
+template <typename T>
+void AppendArray(std::vector<char> &buffer, const T *data, size_t n) {
+    size_t offset = buffer.size();
+    buffer.resize(offset + n * sizeof(T));
+    memcpy(buffer.data() + offset, data, n * sizeof(T));
+}
+
+template <typename T>
+const char *ExtractArray(const char *ptr, T *data, size_t n) {
+    memcpy(data, ptr, n * sizeof(T));
+    return ptr + n * sizeof(T);
+}
+
+/// Number of bytes of the voxel data of n voxels with the given color and
+/// storage type.
+size_t VoxelDataSize(integration::TSDFVolumeColorType color_type,
+                     integration::TSDFVolumeStorageType storage_type,
+                     size_t n) {
+    bool rgb8 = color_type == integration::TSDFVolumeColorType::RGB8;
+    bool gray32 = color_type == integration::TSDFVolumeColorType::Gray32;
+    switch (storage_type) {
+        case integration::TSDFVolumeStorageType::Float32:
+            return n * (2 * sizeof(float) + (rgb8 ? 3 : 0) +
+                        (gray32 ? sizeof(float) : 0));
+        case integration::TSDFVolumeStorageType::Int16:
+            return n * (sizeof(int16_t) + sizeof(uint16_t) + (rgb8 ? 3 : 0) +
+                        (gray32 ? sizeof(float) : 0));
+        default:
+            return n * (2 * sizeof(float) +
+                        (rgb8 || gray32 ? 3 * sizeof(double) : 0));
+    }
+}
+
+/// Number of bytes of the voxel data of n voxels of `volume`.
+size_t VoxelDataSize(const integration::UniformTSDFVolume &volume, size_t n) {
+    return VoxelDataSize(volume.color_type_, volume.storage_type_, n);
+}
+
+/// Appends the voxel data of the voxels [begin, begin + n) to `buffer`.
+void PackVoxels(const integration::UniformTSDFVolume &volume,
+                size_t begin,
+                size_t n,
+                std::vector<char> &buffer) {
+    buffer.clear();
+    buffer.reserve(VoxelDataSize(volume, n));
+    bool has_color =
+            volume.color_type_ != integration::TSDFVolumeColorType::NoColor;
+    switch (volume.storage_type_) {
+        case integration::TSDFVolumeStorageType::Float32:
+            AppendArray(buffer, volume.tsdf_.data() + begin, n);
+            AppendArray(buffer, volume.weight_.data() + begin, n);
+            break;
+        case integration::TSDFVolumeStorageType::Int16:
+            AppendArray(buffer, volume.tsdf_int16_.data() + begin, n);
+            AppendArray(buffer, volume.weight_uint16_.data() + begin, n);
+            break;
+        default: {
+            std::vector<float> plane(n);
+            for (size_t i = 0; i < n; i++) {
+                plane[i] = volume.voxels_[begin + i].tsdf_;
+            }
+            AppendArray(buffer, plane.data(), n);
+            for (size_t i = 0; i < n; i++) {
+                plane[i] = volume.voxels_[begin + i].weight_;
+            }
+            AppendArray(buffer, plane.data(), n);
+            if (has_color) {
+                std::vector<double> color_plane(n);
+                for (int c = 0; c < 3; c++) {
+                    for (size_t i = 0; i < n; i++) {
+                        color_plane[i] = volume.voxels_[begin + i].color_(c);
+                    }
+                    AppendArray(buffer, color_plane.data(), n);
+                }
+            }
+            return;
+        }
+    }
+    if (volume.color_type_ == integration::TSDFVolumeColorType::RGB8) {
+        AppendArray(buffer, volume.color_rgb8_.data() + 3 * begin, 3 * n);
+    } else if (volume.color_type_ == integration::TSDFVolumeColorType::Gray32) {
+        AppendArray(buffer, volume.color_gray32_.data() + begin, n);
+    }
+}
+
+/// Restores the voxels [begin, begin + n) from the data written by
+/// PackVoxels.
+void UnpackVoxels(const char *ptr,
+                  size_t begin,
+                  size_t n,
+                  integration::UniformTSDFVolume &volume) {
+    bool has_color =
+            volume.color_type_ != integration::TSDFVolumeColorType::NoColor;
+    switch (volume.storage_type_) {
+        case integration::TSDFVolumeStorageType::Float32:
+            ptr = ExtractArray(ptr, volume.tsdf_.data() + begin, n);
+            ptr = ExtractArray(ptr, volume.weight_.data() + begin, n);
+            break;
+        case integration::TSDFVolumeStorageType::Int16:
+            ptr = ExtractArray(ptr, volume.tsdf_int16_.data() + begin, n);
+            ptr = ExtractArray(ptr, volume.weight_uint16_.data() + begin, n);
+            break;
+        default: {
+            std::vector<float> plane(n);
+            ptr = ExtractArray(ptr, plane.data(), n);
+            for (size_t i = 0; i < n; i++) {
+                volume.voxels_[begin + i].tsdf_ = plane[i];
+            }
+            ptr = ExtractArray(ptr, plane.data(), n);
+            for (size_t i = 0; i < n; i++) {
+                volume.voxels_[begin + i].weight_ = plane[i];
+            }
+            if (has_color) {
+                std::vector<double> color_plane(n);
+                for (int c = 0; c < 3; c++) {
+                    ptr = ExtractArray(ptr, color_plane.data(), n);
+                    for (size_t i = 0; i < n; i++) {
+                        volume.voxels_[begin + i].color_(c) = color_plane[i];
+                    }
+                }
+            }
+            return;
+        }
+    }
+    if (volume.color_type_ == integration::TSDFVolumeColorType::RGB8) {
+        ExtractArray(ptr, volume.color_rgb8_.data() + 3 * begin, 3 * n);
+    } else if (volume.color_type_ == integration::TSDFVolumeColorType::Gray32) {
+        ExtractArray(ptr, volume.color_gray32_.data() + begin, n);
+    }
+}
+
+bool WriteBlock(FILE *file,
+                const Eigen::Vector3i &index,
+                const std::vector<char> &buffer,
+                bool compressed,
+                std::vector<char> &buffer_compressed) {
+    TSDFFileBlockHeader header;
+    for (int i = 0; i < 3; i++) {
+        header.index_[i] = index(i);
+    }
+    header.raw_size_ = (uint32_t)buffer.size();
+    header.stored_size_ = 0;
+    const char *data = buffer.data();
+    if (compressed) {
+        // Blocks that LZF cannot shrink are stored as they are.
+        buffer_compressed.resize(buffer.size());
+        header.stored_size_ = lzf_compress(
+                buffer.data(), header.raw_size_, buffer_compressed.data(),
+                header.raw_size_ > 0 ? header.raw_size_ - 1 : 0);
+        data = buffer_compressed.data();
+    }
+    if (header.stored_size_ == 0) {
+        header.stored_size_ = header.raw_size_;
+        data = buffer.data();
+    }
+    if (fwrite(&header, sizeof(header), 1, file) != 1 ||
+        fwrite(data, 1, header.stored_size_, file) != header.stored_size_) {
+        utility::LogWarning("Write TSDF failed: unexpected error.");
+        return false;
+    }
+    return true;
+}
+
+bool ReadBlockHeader(FILE *file, TSDFFileBlockHeader &header) {
+    if (fread(&header, sizeof(header), 1, file) != 1) {
+        utility::LogWarning("Read TSDF failed: unexpected EOF.");
+        return false;
+    }
+    return true;
+}
+
+/// Reads the data of the block of `header` into `buffer`, decompressing it if
+/// needed.
+bool ReadBlockData(FILE *file,
+                   const TSDFFileBlockHeader &header,
+                   std::vector<char> &buffer,
+                   std::vector<char> &buffer_compressed) {
+    // Blocks are stored uncompressed when compression does not pay off.
+    if (header.stored_size_ > header.raw_size_) {
+        utility::LogWarning("Read TSDF failed: invalid block.");
+        return false;
+    }
+    buffer.resize(header.raw_size_);
+    bool compressed = header.stored_size_ != header.raw_size_;
+    std::vector<char> &stored = compressed ? buffer_compressed : buffer;
+    stored.resize(header.stored_size_);
+    if (fread(stored.data(), 1, header.stored_size_, file) !=
+        header.stored_size_) {
+        utility::LogWarning("Read TSDF failed: unexpected EOF.");
+        return false;
+    }
+    if (compressed &&
+        lzf_decompress(buffer_compressed.data(), header.stored_size_,
+                       buffer.data(), header.raw_size_) != header.raw_size_) {
+        utility::LogWarning("Read TSDF failed: decompression failed.");
+        return false;
+    }
+    return true;
+}
+
+bool ReadHeader(FILE *file, TSDFFileHeader &header) {
+    if (fread(&header, sizeof(header), 1, file) != 1) {
+        utility::LogWarning("Read TSDF failed: unexpected EOF.");
+        return false;
+    }
+    if (memcmp(header.magic_, TSDF_MAGIC, sizeof(TSDF_MAGIC)) != 0 ||
+        header.version_ != TSDF_VERSION) {
+        utility::LogWarning("Read TSDF failed: unsupported file format.");
+        return false;
+    }
+    if (header.resolution_ <= 0 || header.resolution_ > TSDF_MAX_RESOLUTION ||
+        header.color_type_ > 2 || header.storage_type_ > 2 ||
+        (header.volume_type_ == TSDF_UNIFORM_VOLUME &&
+         header.num_blocks_ > uint64_t(header.resolution_)) ||
+        (header.volume_type_ == TSDF_SCALABLE_VOLUME &&
+         header.storage_type_ !=
+                 (uint32_t)integration::TSDFVolumeStorageType::Voxel)) {
+        utility::LogWarning("Read TSDF failed: invalid header.");
+        return false;
+    }
+    // Every block needs at least its header in the rest of the file, which
+    // bounds the number of blocks before anything is allocated for them.
+    long position = ftell(file);
+    if (position < 0 || fseek(file, 0, SEEK_END) != 0) {
+        utility::LogWarning("Read TSDF failed: unexpected error.");
+        return false;
+    }
+    long end = ftell(file);
+    if (end < position || fseek(file, position, SEEK_SET) != 0) {
+        utility::LogWarning("Read TSDF failed: unexpected error.");
+        return false;
+    }
+    if (header.num_blocks_ >
+        uint64_t(end - position) / sizeof(TSDFFileBlockHeader)) {
+        utility::LogWarning("Read TSDF failed: unexpected EOF.");
+        return false;
+    }
+    return true;
+}
+
+/// Reads the blocks of a UniformTSDFVolume file into `volume`.
+bool ReadUniformBlocks(FILE *file,
+                       const TSDFFileHeader &header,
+                       integration::UniformTSDFVolume &volume) {
+    std::vector<char> buffer, buffer_compressed;
+    const size_t slab_size = size_t(volume.resolution_) * volume.resolution_;
+    for (uint64_t b = 0; b < header.num_blocks_; b++) {
+        TSDFFileBlockHeader block;
+        if (!ReadBlockHeader(file, block)) {
+            return false;
+        }
+        if (block.index_[0] < 0 || block.index_[0] >= volume.resolution_ ||
+            block.raw_size_ != VoxelDataSize(volume, slab_size)) {
+            utility::LogWarning("Read TSDF failed: invalid block.");
+            return false;
+        }
+        if (!ReadBlockData(file, block, buffer, buffer_compressed)) {
+            return false;
+        }
+        UnpackVoxels(buffer.data(), block.index_[0] * slab_size, slab_size,
+                     volume);
+    }
+    return true;
+}
+
+/// Reads the blocks of a ScalableTSDFVolume file into `volume`, skipping the
+/// units for which Skip(index) returns true.
+template <typename SkipFunc>
+bool ReadScalableBlocks(FILE *file,
+                        const TSDFFileHeader &header,
+                        integration::ScalableTSDFVolume &volume,
+                        SkipFunc Skip) {
+    std::vector<char> buffer, buffer_compressed;
+    const int resolution = volume.volume_unit_resolution_;
+    const size_t unit_size = size_t(resolution) * resolution * resolution;
+    // The units of a ScalableTSDFVolume always use the Voxel storage.
+    const size_t unit_data_size =
+            VoxelDataSize(volume.color_type_,
+                          integration::TSDFVolumeStorageType::Voxel, unit_size);
+    for (uint64_t b = 0; b < header.num_blocks_; b++) {
+        TSDFFileBlockHeader block;
+        if (!ReadBlockHeader(file, block)) {
+            return false;
+        }
+        Eigen::Vector3i index(block.index_[0], block.index_[1],
+                              block.index_[2]);
+        uint64_t packed_index;
+        if (block.raw_size_ != unit_data_size ||
+            !integration::VoxelBlockHashMap<
+                    integration::ScalableTSDFVolume::VolumeUnit>::
+                    PackKey(index, packed_index)) {
+            utility::LogWarning("Read TSDF failed: invalid block.");
+            return false;
+        }
+        if (Skip(index)) {
+            if (fseek(file, block.stored_size_, SEEK_CUR) != 0) {
+                utility::LogWarning("Read TSDF failed: unexpected EOF.");
+                return false;
+            }
+            continue;
+        }
+        if (!ReadBlockData(file, block, buffer, buffer_compressed)) {
+            return false;
+        }
+        // The unit is only created once its data is known to be complete.
+        auto unit = volume.OpenVolumeUnit(index);
+        UnpackVoxels(buffer.data(), 0, unit_size, *unit);
+    }
+    return true;
+}
+
+bool WriteUniformTSDFVolume(FILE *file,
+                            const integration::UniformTSDFVolume &volume,
+                            bool compressed) {
+    TSDFFileHeader header;
+    memcpy(header.magic_, TSDF_MAGIC, sizeof(TSDF_MAGIC));
+    header.version_ = TSDF_VERSION;
+    header.volume_type_ = TSDF_UNIFORM_VOLUME;
+    header.color_type_ = (uint32_t)volume.color_type_;
+    header.storage_type_ = (uint32_t)volume.storage_type_;
+    header.resolution_ = volume.resolution_;
+    header.depth_sampling_stride_ = 0;
+    header.length_ = volume.length_;
+    header.voxel_length_ = volume.voxel_length_;
+    header.sdf_trunc_ = volume.sdf_trunc_;
+    for (int i = 0; i < 3; i++) {
+        header.origin_[i] = volume.origin_(i);
+    }
+    // Only the slabs holding observed voxels are written.
+    const int slab_size = volume.resolution_ * volume.resolution_;
+    std::vector<int> slabs;
+    for (int x = 0; x < volume.resolution_; x++) {
+        for (int i = x * slab_size; i < (x + 1) * slab_size; i++) {
+            if (volume.GetWeight(i) != 0.0f) {
+                slabs.push_back(x);
+                break;
+            }
+        }
+    }
+    header.num_blocks_ = slabs.size();
+    if (fwrite(&header, sizeof(header), 1, file) != 1) {
+        utility::LogWarning("Write TSDF failed: unexpected error.");
+        return false;
+    }
+    std::vector<char> buffer, buffer_compressed;
+    for (int x : slabs) {
+        PackVoxels(volume, size_t(x) * slab_size, slab_size, buffer);
+        if (!WriteBlock(file, Eigen::Vector3i(x, 0, 0), buffer, compressed,
+                        buffer_compressed)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool WriteScalableTSDFVolume(FILE *file,
+                             const integration::ScalableTSDFVolume &volume,
+                             bool compressed) {
+    TSDFFileHeader header;
+    memcpy(header.magic_, TSDF_MAGIC, sizeof(TSDF_MAGIC));
+    header.version_ = TSDF_VERSION;
+    header.volume_type_ = TSDF_SCALABLE_VOLUME;
+    header.color_type_ = (uint32_t)volume.color_type_;
+    header.storage_type_ = (uint32_t)integration::TSDFVolumeStorageType::Voxel;
+    header.resolution_ = volume.volume_unit_resolution_;
+    header.depth_sampling_stride_ = volume.depth_sampling_stride_;
+    header.length_ = volume.volume_unit_length_;
+    header.voxel_length_ = volume.voxel_length_;
+    header.sdf_trunc_ = volume.sdf_trunc_;
+    for (int i = 0; i < 3; i++) {
+        header.origin_[i] = 0.0;
+    }
+    header.num_blocks_ = 0;
+    for (const auto &unit : volume.volume_units_) {
+        header.num_blocks_ += unit.volume_ ? 1 : 0;
+    }
+    if (fwrite(&header, sizeof(header), 1, file) != 1) {
+        utility::LogWarning("Write TSDF failed: unexpected error.");
+        return false;
+    }
+    std::vector<char> buffer, buffer_compressed;
+    for (const auto &unit : volume.volume_units_) {
+        if (!unit.volume_) {
+            continue;
+        }
+        PackVoxels(*unit.volume_, 0, unit.volume_->voxel_num_, buffer);
+        if (!WriteBlock(file, unit.index_, buffer, compressed,
+                        buffer_compressed)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+}  // unnamed namespace
+
+namespace io {
+
+std::shared_ptr<integration::TSDFVolume> ReadTSDFVolumeFromTSDF(
+        const std::string &filename) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read TSDF failed: unable to open file: {}",
+                            filename);
+        return nullptr;
+    }
+    TSDFFileHeader header;
+    if (!ReadHeader(file, header)) {
+        fclose(file);
+        return nullptr;
+    }
+    auto color_type = (integration::TSDFVolumeColorType)header.color_type_;
+    std::shared_ptr<integration::TSDFVolume> volume;
+    bool success = false;
+    if (header.volume_type_ == TSDF_UNIFORM_VOLUME) {
+        auto uniform = std::make_shared<integration::UniformTSDFVolume>(
+                header.length_, header.resolution_, header.sdf_trunc_,
+                color_type,
+                Eigen::Vector3d(header.origin_[0], header.origin_[1],
+                                header.origin_[2]),
+                (integration::TSDFVolumeStorageType)header.storage_type_);
+        success = ReadUniformBlocks(file, header, *uniform);
+        volume = uniform;
+    } else if (header.volume_type_ == TSDF_SCALABLE_VOLUME) {
+        auto scalable = std::make_shared<integration::ScalableTSDFVolume>(
+                header.voxel_length_, header.sdf_trunc_, color_type,
+                header.resolution_, header.depth_sampling_stride_);
+        scalable->volume_units_.Reserve(int(std::min(
+                header.num_blocks_,
+                uint64_t(std::numeric_limits<int>::max() / 2))));
+        success = ReadScalableBlocks(
+                file, header, *scalable,
+                [](const Eigen::Vector3i &index) { return false; });
+        volume = scalable;
+    } else {
+        utility::LogWarning("Read TSDF failed: unknown volume type.");
+    }
+    fclose(file);
+    return success ? volume : nullptr;
+}
+
+bool WriteTSDFVolumeToTSDF(const std::string &filename,
+                           const integration::TSDFVolume &volume,
+                           bool compressed) {
+    auto uniform =
+            dynamic_cast<const integration::UniformTSDFVolume *>(&volume);
+    auto scalable =
+            dynamic_cast<const integration::ScalableTSDFVolume *>(&volume);
+    if (uniform == nullptr && scalable == nullptr) {
+        utility::LogWarning("Write TSDF failed: unsupported volume type.");
+        return false;
+    }
+    FILE *file = utility::filesystem::FOpen(filename, "wb");
+    if (file == NULL) {
+        utility::LogWarning("Write TSDF failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    bool success = uniform ? WriteUniformTSDFVolume(file, *uniform, compressed)
+                           : WriteScalableTSDFVolume(file, *scalable,
+                                                     compressed);
+    fclose(file);
+    return success;
+}
+
+bool ReadTSDFVolumeUnitsFromTSDF(
+        const std::string &filename,
+        integration::ScalableTSDFVolume &volume,
+        const geometry::AxisAlignedBoundingBox &bound) {
+    FILE *file = utility::filesystem::FOpen(filename, "rb");
+    if (file == NULL) {
+        utility::LogWarning("Read TSDF failed: unable to open file: {}",
+                            filename);
+        return false;
+    }
+    TSDFFileHeader header;
+    if (!ReadHeader(file, header)) {
+        fclose(file);
+        return false;
+    }
+    if (header.volume_type_ != TSDF_SCALABLE_VOLUME ||
+        header.resolution_ != volume.volume_unit_resolution_ ||
+        header.color_type_ != (uint32_t)volume.color_type_ ||
+        std::abs(header.voxel_length_ - volume.voxel_length_) >
+                1e-9 * volume.voxel_length_ ||
+        std::abs(header.sdf_trunc_ - volume.sdf_trunc_) >
+                1e-9 * volume.sdf_trunc_) {
+        utility::LogWarning(
+                "Read TSDF failed: the file does not match the volume.");
+        fclose(file);
+        return false;
+    }
+    const double unit_length = header.length_;
+    bool success = ReadScalableBlocks(
+            file, header, volume, [&](const Eigen::Vector3i &index) {
+                Eigen::Vector3d min_bound = index.cast<double>() * unit_length;
+                Eigen::Vector3d max_bound =
+                        min_bound + Eigen::Vector3d::Constant(unit_length);
+                return (min_bound.array() > bound.max_bound_.array()).any() ||
+                       (max_bound.array() < bound.min_bound_.array()).any();
+            });
+    fclose(file);
+    return success;
+}
+
+}  // namespace io
+}  // namespace open3d
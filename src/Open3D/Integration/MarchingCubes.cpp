@@ -0,0 +1,540 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "Open3D/Integration/MarchingCubes.h"
+
+#include "Open3D/Integration/MarchingCubesConst.h"
+#include "Open3D/Integration/UniformTSDFVolume.h"
+
+namespace open3d {
+namespace integration {
+
+namespace {
+
+/// TSDF values and validity of the voxels of a block and of a one voxel
+/// border around it, that is of the voxels in [-1, size + 1]^3.
+class BlockCache {
+public:
+    BlockCache(const std::vector<TSDFVolumeBlock> &blocks, int block_resolution)
+        : blocks_(blocks), block_resolution_(block_resolution) {}
+
+    void Load(int block_id) {
+        block_ = &blocks_[block_id];
+        dims_ = block_->size_ + Eigen::Vector3i(3, 3, 3);
+        tsdf_.resize(dims_.prod());
+        valid_.resize(dims_.prod());
+        for (int k = 0; k < 8; k++) {
+            corner_offsets_[k] =
+                    Offset(shift[k]) - Offset(Eigen::Vector3i::Zero());
+        }
+        has_inside_ = false;
+        has_outside_ = false;
+        // The voxels along z are contiguous in the volumes, every row is read
+        // as three runs in the blocks at z - 1, z and z + 1.
+        const Eigen::Vector3i &size = block_->size_;
+        for (int x = -1; x <= size(0) + 1; x++) {
+            int nx = x < 0 ? 0 : (x < size(0) ? 1 : 2);
+            int lx = x < 0 ? x + block_resolution_
+                           : (nx == 1 ? x : x - size(0));
+            for (int y = -1; y <= size(1) + 1; y++) {
+                int ny = y < 0 ? 0 : (y < size(1) ? 1 : 2);
+                int ly = y < 0 ? y + block_resolution_
+                               : (ny == 1 ? y : y - size(1));
+                int neighbor = nx + 3 * ny;
+                int idx = Offset(Eigen::Vector3i(x, y, -1));
+                LoadRun(neighbor,
+                        Eigen::Vector3i(lx, ly, block_resolution_ - 1), 1,
+                        idx);
+                LoadRun(neighbor + 9, Eigen::Vector3i(lx, ly, 0), size(2),
+                        idx + 1);
+                LoadRun(neighbor + 18, Eigen::Vector3i(lx, ly, 0), 2,
+                        idx + 1 + size(2));
+            }
+        }
+    }
+
+    /// Returns true if the loaded voxels have valid TSDF values of both signs.
+    bool HasSurface() const { return has_inside_ && has_outside_; }
+
+    /// Finds the volume and the voxel index of the voxel at `xyz`, relative to
+    /// the first voxel of the block, and the number of voxels following it
+    /// along z in the same volume. Returns false if the voxel is absent.
+    bool Locate(const Eigen::Vector3i &xyz,
+                const UniformTSDFVolume *&volume,
+                int &index,
+                int &run_length) const {
+        int neighbor = 13;
+        Eigen::Vector3i local = xyz;
+        for (int i = 0, step = 1; i < 3; i++, step *= 3) {
+            if (xyz(i) < 0) {
+                neighbor -= step;
+                local(i) += block_resolution_;
+            } else if (xyz(i) >= block_->size_(i)) {
+                neighbor += step;
+                local(i) -= block_->size_(i);
+            }
+        }
+        int block_id = block_->neighbors_[neighbor];
+        if (block_id < 0) {
+            return false;
+        }
+        const TSDFVolumeBlock &block = blocks_[block_id];
+        if ((local.array() < 0).any() ||
+            (local.array() >= block.size_.array()).any()) {
+            return false;
+        }
+        volume = block.volume_;
+        index = volume->IndexOf(block.offset_ + local);
+        run_length = block.size_(2) - local(2);
+        return true;
+    }
+
+    /// Returns the marching cubes index of the cube whose first corner is at
+    /// `xyz`, 0 if the cube has an invalid corner or no surface.
+    int CubeIndex(const Eigen::Vector3i &xyz) const {
+        int base = Offset(xyz);
+        int cube_index = 0;
+        for (int k = 0; k < 8; k++) {
+            int idx = base + corner_offsets_[k];
+            if (!valid_[idx]) {
+                return 0;
+            }
+            if (tsdf_[idx] < 0.0f) {
+                cube_index |= (1 << k);
+            }
+        }
+        return cube_index == 255 ? 0 : cube_index;
+    }
+
+    float TSDF(const Eigen::Vector3i &xyz) const { return tsdf_[Offset(xyz)]; }
+
+    Eigen::Vector3d Gradient(const Eigen::Vector3i &xyz) const {
+        int idx = Offset(xyz);
+        int stride_x = dims_(1) * dims_(2);
+        return Eigen::Vector3d(tsdf_[idx + stride_x] - tsdf_[idx - stride_x],
+                               tsdf_[idx + dims_(2)] - tsdf_[idx - dims_(2)],
+                               tsdf_[idx + 1] - tsdf_[idx - 1]);
+    }
+
+    Eigen::Vector3d Color(const Eigen::Vector3i &xyz) const {
+        const UniformTSDFVolume *volume;
+        int index, run_length;
+        if (!Locate(xyz, volume, index, run_length)) {
+            return Eigen::Vector3d::Zero();
+        }
+        return volume->GetColor(index);
+    }
+
+private:
+    int Offset(const Eigen::Vector3i &xyz) const {
+        return ((xyz(0) + 1) * dims_(1) + (xyz(1) + 1)) * dims_(2) +
+               (xyz(2) + 1);
+    }
+
+    /// Loads `length` voxels along z starting at voxel `local` of the neighbor
+    /// block `neighbor` into tsdf_[idx...].
+    void LoadRun(int neighbor,
+                 const Eigen::Vector3i &local,
+                 int length,
+                 int idx) {
+        int block_id = block_->neighbors_[neighbor];
+        int n = 0;
+        const UniformTSDFVolume *volume = nullptr;
+        int index = 0;
+        if (block_id >= 0) {
+            const TSDFVolumeBlock &block = blocks_[block_id];
+            if (local(0) < block.size_(0) && local(1) < block.size_(1)) {
+                n = std::min(length, block.size_(2) - local(2));
+                volume = block.volume_;
+                index = volume->IndexOf(block.offset_ + local);
+            }
+        }
+        switch (n > 0 ? volume->storage_type_ : TSDFVolumeStorageType::Voxel) {
+            case TSDFVolumeStorageType::Float32:
+                CopyRun(n, idx, [&](int k) { return volume->tsdf_[index + k]; },
+                        [&](int k) { return volume->weight_[index + k]; });
+                break;
+            case TSDFVolumeStorageType::Int16:
+                CopyRun(n, idx,
+                        [&](int k) {
+                            return volume->tsdf_int16_[index + k] *
+                                   (1.0f / 32767.0f);
+                        },
+                        [&](int k) {
+                            return (float)volume->weight_uint16_[index + k];
+                        });
+                break;
+            default:
+                CopyRun(n, idx,
+                        [&](int k) { return volume->voxels_[index + k].tsdf_; },
+                        [&](int k) {
+                            return volume->voxels_[index + k].weight_;
+                        });
+                break;
+        }
+        int k = n;
+        for (; k < length; k++) {
+            tsdf_[idx + k] = 0.0f;
+            valid_[idx + k] = 0;
+        }
+    }
+
+    template <typename TSDFFunc, typename WeightFunc>
+    void CopyRun(int n, int idx, TSDFFunc tsdf_at, WeightFunc weight_at) {
+        for (int k = 0; k < n; k++) {
+            float tsdf = tsdf_at(k);
+            bool valid = weight_at(k) != 0.0f;
+            tsdf_[idx + k] = tsdf;
+            valid_[idx + k] = valid;
+            if (valid) {
+                has_inside_ |= tsdf < 0.0f;
+                has_outside_ |= tsdf >= 0.0f;
+            }
+        }
+    }
+
+    const std::vector<TSDFVolumeBlock> &blocks_;
+    int block_resolution_;
+    const TSDFVolumeBlock *block_ = nullptr;
+    Eigen::Vector3i dims_;
+    int corner_offsets_[8];
+    bool has_inside_ = false;
+    bool has_outside_ = false;
+    std::vector<float> tsdf_;
+    std::vector<uint8_t> valid_;
+};
+
+/// Number of triangles of every marching cubes index.
+int NumTriangles(int cube_index) {
+    int n = 0;
+    while (tri_table[cube_index][3 * n] != -1) {
+        n++;
+    }
+    return n;
+}
+
+/// Offset of voxel `xyz` in the per voxel arrays of a block of `size` voxels,
+/// ordered like the voxels of UniformTSDFVolume.
+inline int VoxelOffset(const Eigen::Vector3i &size,
+                       const Eigen::Vector3i &xyz) {
+    return (xyz(0) * size(1) + xyz(1)) * size(2) + xyz(2);
+}
+
+/// Number of the bits of `mask` below bit `axis`.
+inline int Rank(uint8_t mask, int axis) {
+    return ((mask & 1) && axis > 0) + ((mask & 2) && axis > 1);
+}
+
+/// Marks in `mask` the edges holding a vertex of the cubes whose first corner
+/// is in [cube_begin, size)^3, for the edges of the voxels in
+/// [0, mask_size)^3. Returns the number of triangles of the cubes in
+/// [0, size)^3.
+int MarkEdges(const BlockCache &cache,
+              const Eigen::Vector3i &size,
+              int cube_begin,
+              const Eigen::Vector3i &mask_size,
+              std::vector<uint8_t> &mask) {
+    mask.assign(mask_size.prod(), 0);
+    int num_triangles = 0;
+    for (int x = cube_begin; x < size(0); x++) {
+        for (int y = cube_begin; y < size(1); y++) {
+            for (int z = cube_begin; z < size(2); z++) {
+                Eigen::Vector3i xyz(x, y, z);
+                int cube_index = cache.CubeIndex(xyz);
+                if (cube_index == 0) {
+                    continue;
+                }
+                if (x >= 0 && y >= 0 && z >= 0) {
+                    num_triangles += NumTriangles(cube_index);
+                }
+                for (int i = 0; i < 12; i++) {
+                    if (!(edge_table[cube_index] & (1 << i))) {
+                        continue;
+                    }
+                    Eigen::Vector3i owner = xyz + edge_shift[i].head<3>();
+                    if ((owner.array() >= 0).all() &&
+                        (owner.array() < mask_size.array()).all()) {
+                        mask[VoxelOffset(mask_size, owner)] |=
+                                (1 << edge_shift[i](3));
+                    }
+                }
+            }
+        }
+    }
+    return num_triangles;
+}
+
+/// Stores in `prefix` the number of vertices of the voxels before every voxel
+/// of `mask` and returns the number of vertices of `mask`.
+int PrefixSumVertices(const std::vector<uint8_t> &mask,
+                      std::vector<int> &prefix) {
+    prefix.resize(mask.size());
+    int num_vertices = 0;
+    for (size_t v = 0; v < mask.size(); v++) {
+        prefix[v] = num_vertices;
+        num_vertices +=
+                (mask[v] & 1) + ((mask[v] >> 1) & 1) + ((mask[v] >> 2) & 1);
+    }
+    return num_vertices;
+}
+
+/// Writes the vertices of the edges marked in `mask`, a mask of the voxels in
+/// [0, mask_size)^3 of the loaded block, to mesh from index vertex_id on.
+void WriteVertices(const BlockCache &cache,
+                   const TSDFVolumeBlock &block,
+                   const Eigen::Vector3i &mask_size,
+                   const std::vector<uint8_t> &mask,
+                   double voxel_length,
+                   TSDFVolumeColorType color_type,
+                   geometry::TriangleMesh &mesh,
+                   int vertex_id) {
+    const Eigen::Vector3d origin =
+            block.volume_->origin_ +
+            (block.offset_.cast<double>() + Eigen::Vector3d(0.5, 0.5, 0.5)) *
+                    voxel_length;
+    int v = 0;
+    for (int x = 0; x < mask_size(0); x++) {
+        for (int y = 0; y < mask_size(1); y++) {
+            for (int z = 0; z < mask_size(2); z++, v++) {
+                if (mask[v] == 0) {
+                    continue;
+                }
+                Eigen::Vector3i xyz0(x, y, z);
+                for (int axis = 0; axis < 3; axis++) {
+                    if (!(mask[v] & (1 << axis))) {
+                        continue;
+                    }
+                    Eigen::Vector3i xyz1 = xyz0;
+                    xyz1(axis) += 1;
+                    double f0 = std::abs((double)cache.TSDF(xyz0));
+                    double f1 = std::abs((double)cache.TSDF(xyz1));
+                    double t = f0 / (f0 + f1);
+                    Eigen::Vector3d pt =
+                            origin + xyz0.cast<double>() * voxel_length;
+                    pt(axis) += t * voxel_length;
+                    mesh.vertices_[vertex_id] = pt;
+                    mesh.vertex_normals_[vertex_id] =
+                            ((1.0 - t) * cache.Gradient(xyz0) +
+                             t * cache.Gradient(xyz1))
+                                    .normalized();
+                    if (color_type != TSDFVolumeColorType::NoColor) {
+                        Eigen::Vector3d c0 = cache.Color(xyz0);
+                        Eigen::Vector3d c1 = cache.Color(xyz1);
+                        if (color_type == TSDFVolumeColorType::RGB8) {
+                            c0 /= 255.0;
+                            c1 /= 255.0;
+                        }
+                        mesh.vertex_colors_[vertex_id] =
+                                (f1 * c0 + f0 * c1) / (f0 + f1);
+                    }
+                    vertex_id++;
+                }
+            }
+        }
+    }
+}
+
+/// Writes the triangles of the cubes whose first corner is in [0, size)^3 to
+/// mesh from index triangle_id on. VertexIdOf(owner, axis) returns the id of
+/// the vertex on edge `axis` of the voxel `owner`.
+template <typename VertexIdFunc>
+void WriteTriangles(const BlockCache &cache,
+                    const Eigen::Vector3i &size,
+                    VertexIdFunc VertexIdOf,
+                    geometry::TriangleMesh &mesh,
+                    int triangle_id) {
+    int edge_to_index[12];
+    for (int x = 0; x < size(0); x++) {
+        for (int y = 0; y < size(1); y++) {
+            for (int z = 0; z < size(2); z++) {
+                Eigen::Vector3i xyz(x, y, z);
+                int cube_index = cache.CubeIndex(xyz);
+                if (cube_index == 0) {
+                    continue;
+                }
+                for (int i = 0; i < 12; i++) {
+                    if (edge_table[cube_index] & (1 << i)) {
+                        edge_to_index[i] =
+                                VertexIdOf(xyz + edge_shift[i].head<3>(),
+                                           edge_shift[i](3));
+                    }
+                }
+                for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
+                    mesh.triangles_[triangle_id++] = Eigen::Vector3i(
+                            edge_to_index[tri_table[cube_index][i]],
+                            edge_to_index[tri_table[cube_index][i + 2]],
+                            edge_to_index[tri_table[cube_index][i + 1]]);
+                }
+            }
+        }
+    }
+}
+
+/// Allocates the vertices, normals, colors and triangles of `mesh`.
+void ResizeMesh(geometry::TriangleMesh &mesh,
+                int num_vertices,
+                int num_triangles,
+                TSDFVolumeColorType color_type) {
+    mesh.vertices_.resize(num_vertices);
+    mesh.vertex_normals_.resize(num_vertices);
+    if (color_type != TSDFVolumeColorType::NoColor) {
+        mesh.vertex_colors_.resize(num_vertices);
+    }
+    mesh.triangles_.resize(num_triangles);
+}
+
+}  // unnamed namespace
+
+std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMeshFromBlocks(
+        const std::vector<TSDFVolumeBlock> &blocks,
+        int block_resolution,
+        double voxel_length,
+        TSDFVolumeColorType color_type) {
+    auto mesh = std::make_shared<geometry::TriangleMesh>();
+    int num_blocks = (int)blocks.size();
+    // For every owned voxel, the edges holding a vertex as bits 0 (x), 1 (y)
+    // and 2 (z), and the number of vertices of the block before the voxel.
+    std::vector<std::vector<uint8_t>> edge_masks(num_blocks);
+    std::vector<std::vector<int>> vertex_prefixes(num_blocks);
+    std::vector<int> vertex_offsets(num_blocks + 1, 0);
+    std::vector<int> triangle_offsets(num_blocks + 1, 0);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        BlockCache cache(blocks, block_resolution);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int b = 0; b < num_blocks; b++) {
+            cache.Load(b);
+            if (!cache.HasSurface()) {
+                continue;
+            }
+            // The cubes starting at -1 belong to the preceding blocks, they
+            // are visited for the vertices they place on the owned edges.
+            const Eigen::Vector3i &size = blocks[b].size_;
+            triangle_offsets[b + 1] =
+                    MarkEdges(cache, size, -1, size, edge_masks[b]);
+            vertex_offsets[b + 1] =
+                    PrefixSumVertices(edge_masks[b], vertex_prefixes[b]);
+        }
+    }
+    for (int b = 0; b < num_blocks; b++) {
+        vertex_offsets[b + 1] += vertex_offsets[b];
+        triangle_offsets[b + 1] += triangle_offsets[b];
+    }
+    ResizeMesh(*mesh, vertex_offsets[num_blocks], triangle_offsets[num_blocks],
+               color_type);
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        BlockCache cache(blocks, block_resolution);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int b = 0; b < num_blocks; b++) {
+            if (vertex_offsets[b] == vertex_offsets[b + 1] &&
+                triangle_offsets[b] == triangle_offsets[b + 1]) {
+                continue;
+            }
+            cache.Load(b);
+            const TSDFVolumeBlock &block = blocks[b];
+            WriteVertices(cache, block, block.size_, edge_masks[b],
+                          voxel_length, color_type, *mesh, vertex_offsets[b]);
+            // The vertices on the far faces of the block belong to the
+            // following blocks.
+            auto VertexIdOf = [&](Eigen::Vector3i owner, int axis) {
+                int neighbor = 13;
+                for (int i = 0, step = 1; i < 3; i++, step *= 3) {
+                    if (owner(i) >= block.size_(i)) {
+                        neighbor += step;
+                        owner(i) -= block.size_(i);
+                    }
+                }
+                int owner_block = block.neighbors_[neighbor];
+                int v = VoxelOffset(blocks[owner_block].size_, owner);
+                return vertex_offsets[owner_block] +
+                       vertex_prefixes[owner_block][v] +
+                       Rank(edge_masks[owner_block][v], axis);
+            };
+            WriteTriangles(cache, block.size_, VertexIdOf, *mesh,
+                           triangle_offsets[b]);
+        }
+    }
+    return mesh;
+}
+
+std::vector<std::shared_ptr<geometry::TriangleMesh>>
+ExtractTriangleMeshPatchesFromBlocks(const std::vector<TSDFVolumeBlock> &blocks,
+                                     int num_patches,
+                                     int block_resolution,
+                                     double voxel_length,
+                                     TSDFVolumeColorType color_type) {
+    std::vector<std::shared_ptr<geometry::TriangleMesh>> patches(num_patches);
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        BlockCache cache(blocks, block_resolution);
+        std::vector<uint8_t> mask;
+        std::vector<int> prefix;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic)
+#endif
+        for (int b = 0; b < num_patches; b++) {
+            patches[b] = std::make_shared<geometry::TriangleMesh>();
+            cache.Load(b);
+            if (!cache.HasSurface()) {
+                continue;
+            }
+            // A patch holds all the vertices of its triangles, including the
+            // ones on its far faces.
+            const TSDFVolumeBlock &block = blocks[b];
+            const Eigen::Vector3i mask_size =
+                    block.size_ + Eigen::Vector3i::Ones();
+            int num_triangles =
+                    MarkEdges(cache, block.size_, 0, mask_size, mask);
+            int num_vertices = PrefixSumVertices(mask, prefix);
+            ResizeMesh(*patches[b], num_vertices, num_triangles, color_type);
+            WriteVertices(cache, block, mask_size, mask, voxel_length,
+                          color_type, *patches[b], 0);
+            auto VertexIdOf = [&](const Eigen::Vector3i &owner, int axis) {
+                int v = VoxelOffset(mask_size, owner);
+                return prefix[v] + Rank(mask[v], axis);
+            };
+            WriteTriangles(cache, block.size_, VertexIdOf, *patches[b], 0);
+        }
+    }
+    return patches;
+}
+
+}  // namespace integration
+}  // namespace open3d
@@ -0,0 +1,98 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <Eigen/Core>
+#include <array>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/Integration/TSDFVolume.h"
+
+namespace open3d {
+namespace integration {
+
+class UniformTSDFVolume;
+
+/// Number of voxels along each axis of the blocks a UniformTSDFVolume is split
+/// into for marching cubes.
+static const int MARCHING_CUBES_BLOCK_RESOLUTION = 16;
+
+/// \struct TSDFVolumeBlock
+///
+/// A box of voxels of a UniformTSDFVolume, the unit of work of the parallel
+/// marching cubes extraction.
+struct TSDFVolumeBlock {
+    /// Volume holding the voxels of the block.
+    const UniformTSDFVolume *volume_ = nullptr;
+    /// Grid index of the first voxel of the block in volume_.
+    Eigen::Vector3i offset_ = Eigen::Vector3i::Zero();
+    /// Number of voxels of the block along each axis.
+    Eigen::Vector3i size_ = Eigen::Vector3i::Zero();
+    /// Blocks around this one, the block at offset (dx, dy, dz) in
+    /// {-1, 0, 1}^3 is neighbors_[(dx + 1) + 3 * (dy + 1) + 9 * (dz + 1)] and
+    /// -1 if absent. neighbors_[13] is the block itself.
+    std::array<int, 27> neighbors_;
+};
+
+/// \brief Extracts the triangle mesh of the zero level set of the TSDF stored
+/// in `blocks` with marching cubes, based on
+/// http://paulbourke.net/geometry/polygonise/
+///
+/// The blocks are processed in parallel. Every voxel owns the vertices on its
+/// three edges in the positive directions, so that the vertices shared by
+/// cubes of different blocks are created once. A first pass counts the
+/// vertices and triangles of every block, prefix sums give the ranges of the
+/// output arrays written by the second pass. The vertex normals are the
+/// central difference gradients of the TSDF interpolated along the edges.
+///
+/// All blocks except the last ones along an axis must have `block_resolution`
+/// voxels along that axis.
+std::shared_ptr<geometry::TriangleMesh> ExtractTriangleMeshFromBlocks(
+        const std::vector<TSDFVolumeBlock> &blocks,
+        int block_resolution,
+        double voxel_length,
+        TSDFVolumeColorType color_type);
+
+/// \brief Extracts the triangles of the cubes whose first corner lies in each
+/// of the blocks [0, num_patches) as separate meshes.
+///
+/// The blocks after num_patches only provide the voxels around the patches.
+/// Every patch holds all the vertices of its triangles, the vertices on the
+/// faces shared by two patches are duplicated. Blocks without surface give
+/// empty meshes.
+std::vector<std::shared_ptr<geometry::TriangleMesh>>
+ExtractTriangleMeshPatchesFromBlocks(const std::vector<TSDFVolumeBlock> &blocks,
+                                     int num_patches,
+                                     int block_resolution,
+                                     double voxel_length,
+                                     TSDFVolumeColorType color_type);
+
+}  // namespace integration
+}  // namespace open3d
@@ -26,6 +26,13 @@
 
 #include "Open3D/Integration/ScalableTSDFVolume.h"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <limits>
+#include <tuple>
 #include <unordered_set>
 
 #include "Open3D/Geometry/PointCloud.h"
@@ -36,6 +43,518 @@
 namespace open3d {
 namespace integration {
 
+namespace {
+
+/// Returns true if an observed voxel of `volume` has a TSDF of zero or below.
+bool HasSurface(const UniformTSDFVolume &volume) {
+    for (const auto &voxel : volume.voxels_) {
+        if (voxel.weight_ != 0.0f && voxel.tsdf_ <= 0.0f) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/// Volumes of a unit and of the 7 units after it, indexed by the bits of
+/// their offsets, which VolumeUnitSampler looks up on first use.
+struct UnitNeighborhood {
+    void Reset(const UniformTSDFVolume *unit) {
+        units_[0] = unit;
+        found_ = 1;
+    }
+
+    const UniformTSDFVolume *units_[8];
+    /// Bit i is set once units_[i] is looked up.
+    int found_;
+};
+
+/// Trilinear interpolation of the voxels of a ScalableTSDFVolume for RayCast.
+/// The samples are located relative to a volume unit, so that the samples
+/// along a ray inside a unit need neither hash map lookups nor rounding
+/// functions.
+class VolumeUnitSampler {
+public:
+    VolumeUnitSampler(const ScalableTSDFVolume &volume)
+        : volume_(volume), resolution_(volume.volume_unit_resolution_) {}
+
+    /// Returns the volume unit at `index`, or nullptr if it is not allocated.
+    const ScalableTSDFVolume::VolumeUnit *FindVolumeUnit(
+            const Eigen::Vector3i &index) const {
+        int block = volume_.volume_units_.Find(index);
+        if (block < 0 || !volume_.volume_units_.GetBlock(block).volume_) {
+            return nullptr;
+        }
+        return &volume_.volume_units_.GetBlock(block);
+    }
+
+    /// Returns the volume of the unit at `index`, or nullptr if it is not
+    /// allocated.
+    const UniformTSDFVolume *FindUnit(const Eigen::Vector3i &index) const {
+        const ScalableTSDFVolume::VolumeUnit *unit = FindVolumeUnit(index);
+        return unit == nullptr ? nullptr : unit->volume_.get();
+    }
+
+    /// Interpolates the TSDF, and the color if `color` is not null, at the
+    /// grid coordinates `local` relative to the unit at `index`, whose
+    /// neighborhood is `units`, in which the voxel centers of the unit are at
+    /// [0, resolution)^3. Returns false if one of the 8 voxels around the
+    /// sample is unobserved.
+    bool Sample(const Eigen::Vector3i &index,
+                UnitNeighborhood &units,
+                const Eigen::Vector3d &local,
+                float &tsdf,
+                Eigen::Vector3f *color = nullptr) const {
+        // Rounds down for coordinates above -1.
+        Eigen::Vector3i l0(int(local(0) + 1.0) - 1, int(local(1) + 1.0) - 1,
+                           int(local(2) + 1.0) - 1);
+        if (l0.minCoeff() < 0 || l0.maxCoeff() >= resolution_) {
+            return Sample(index.cast<double>() * resolution_ + local, tsdf,
+                          color);
+        }
+        return SampleCell(index, units, l0,
+                          (local - l0.cast<double>()).cast<float>(), tsdf,
+                          color);
+    }
+
+    /// Interpolates at the grid coordinates `g` of the volume, in which the
+    /// voxel centers are at integers.
+    bool Sample(const Eigen::Vector3d &g,
+                float &tsdf,
+                Eigen::Vector3f *color = nullptr) const {
+        Eigen::Vector3i g0(int(std::floor(g(0))), int(std::floor(g(1))),
+                           int(std::floor(g(2))));
+        Eigen::Vector3i index;
+        for (int i = 0; i < 3; i++) {
+            index(i) = g0(i) >= 0 ? g0(i) / resolution_
+                                  : -((resolution_ - 1 - g0(i)) / resolution_);
+        }
+        UnitNeighborhood units;
+        units.Reset(FindUnit(index));
+        if (units.units_[0] == nullptr) {
+            return false;
+        }
+        return SampleCell(index, units, g0 - index * resolution_,
+                          (g - g0.cast<double>()).cast<float>(), tsdf, color);
+    }
+
+    /// Hints the cache about the voxels that Sample(index, unit, local) reads.
+    void Prefetch(const UniformTSDFVolume *unit,
+                  const Eigen::Vector3d &local) const {
+#if defined(__GNUC__)
+        Eigen::Vector3i l0(int(local(0) + 1.0) - 1, int(local(1) + 1.0) - 1,
+                           int(local(2) + 1.0) - 1);
+        if (l0.minCoeff() < 0 || l0.maxCoeff() >= resolution_ - 1) {
+            return;
+        }
+        const geometry::TSDFVoxel *base =
+                unit->voxels_.data() + unit->IndexOf(l0);
+        const int sx = resolution_ * resolution_, sy = resolution_;
+        for (int i = 0; i < 4; i++) {
+            const geometry::TSDFVoxel *voxel =
+                    base + (i & 1) * sx + ((i >> 1) & 1) * sy;
+            __builtin_prefetch(&voxel[0].tsdf_);
+            __builtin_prefetch(&voxel[1].weight_);
+        }
+#endif
+    }
+
+private:
+    /// Interpolates in the cell whose first voxel is the voxel `l0` of the
+    /// unit at `index`, at the offset `r` in the cell.
+    bool SampleCell(const Eigen::Vector3i &index,
+                    UnitNeighborhood &units,
+                    const Eigen::Vector3i &l0,
+                    const Eigen::Vector3f &r,
+                    float &tsdf,
+                    Eigen::Vector3f *color) const {
+        const geometry::TSDFVoxel *voxels[8];
+        if (l0.maxCoeff() < resolution_ - 1) {
+            const UniformTSDFVolume *unit = units.units_[0];
+            const geometry::TSDFVoxel *base =
+                    unit->voxels_.data() + unit->IndexOf(l0);
+            const int sx = resolution_ * resolution_, sy = resolution_;
+            for (int i = 0; i < 8; i++) {
+                voxels[i] = base + (i & 1) * sx + ((i >> 1) & 1) * sy +
+                            ((i >> 2) & 1);
+            }
+        } else {
+            // The cell reaches into the units after `index`.
+            for (int i = 0; i < 8; i++) {
+                Eigen::Vector3i l1 =
+                        l0 + Eigen::Vector3i(i & 1, (i >> 1) & 1, (i >> 2) & 1);
+                int offset = 0;
+                for (int j = 0; j < 3; j++) {
+                    if (l1(j) == resolution_) {
+                        l1(j) = 0;
+                        offset |= 1 << j;
+                    }
+                }
+                if (!(units.found_ & (1 << offset))) {
+                    units.units_[offset] = FindUnit(
+                            index + Eigen::Vector3i(offset & 1,
+                                                    (offset >> 1) & 1,
+                                                    (offset >> 2) & 1));
+                    units.found_ |= 1 << offset;
+                }
+                const UniformTSDFVolume *unit = units.units_[offset];
+                if (unit == nullptr) {
+                    return false;
+                }
+                voxels[i] = &unit->voxels_[unit->IndexOf(l1)];
+            }
+        }
+        // The corners are gathered into packets, so that the weights and the
+        // interpolation are computed in SIMD registers.
+        Eigen::Array<float, 8, 1> f, weight;
+        for (int i = 0; i < 8; i++) {
+            f(i) = voxels[i]->tsdf_;
+            weight(i) = voxels[i]->weight_;
+        }
+        if ((weight == 0.0f).any()) {
+            return false;
+        }
+        const float x0 = 1.0f - r(0), x1 = r(0);
+        const float y0 = 1.0f - r(1), y1 = r(1);
+        const float z0 = 1.0f - r(2), z1 = r(2);
+        Eigen::Array<float, 8, 1> wx, wy, wz;
+        wx << x0, x1, x0, x1, x0, x1, x0, x1;
+        wy << y0, y0, y1, y1, y0, y0, y1, y1;
+        wz << z0, z0, z0, z0, z1, z1, z1, z1;
+        const Eigen::Array<float, 8, 1> w = wx * wy * wz;
+        tsdf = (w * f).sum();
+        if (color != nullptr) {
+            color->setZero();
+            for (int i = 0; i < 8; i++) {
+                *color += w(i) * voxels[i]->color_.cast<float>();
+            }
+        }
+        return true;
+    }
+
+    const ScalableTSDFVolume &volume_;
+    const int resolution_;
+};
+
+/// Number of rays that TSDFRayCaster marches in turns, so that the voxels of
+/// the next sample of a ray are fetched while the other rays are sampled.
+static const int RAY_CAST_BATCH_SIZE = 8;
+
+/// State of a ray of TSDFRayCaster, whose points are origin + t * direction,
+/// at depth t in the camera. The positions are in the grid coordinates of
+/// VolumeUnitSampler, in which the volume unit at `index` spans
+/// [index, index + 1) * volume_unit_resolution_.
+struct RayCastRay {
+    int u_, v_;
+    Eigen::Vector3d dir_camera_;
+    Eigen::Vector3d g_dir_;
+    /// Traversal of the units as the voxels in Amanatides and Woo, "A Fast
+    /// Voxel Traversal Algorithm for Ray Tracing", 1987.
+    Eigen::Vector3i index_;
+    Eigen::Vector3i index_step_;
+    Eigen::Vector3d t_next_;
+    Eigen::Vector3d t_delta_;
+    int axis_;
+    /// The unit at `index_` with its neighborhood, and the ray origin
+    /// relative to it.
+    UnitNeighborhood units_;
+    Eigen::Vector3d local_origin_;
+    /// Inside a unit without surface, the samples between t_skip_ and
+    /// t_resume_ are skipped, the cells there lie within the unit.
+    double t_skip_, t_resume_;
+    double t_, t_exit_, t_end_;
+    double voxel_step_, trunc_step_;
+    double t_prev_;
+    float tsdf_prev_;
+    bool has_prev_;
+};
+
+/// Casts the rays of ScalableTSDFVolume::RayCast. The rays step by one voxel
+/// near the surface and by up to the truncation in empty space, and jump
+/// over the units that are not allocated.
+class TSDFRayCaster {
+public:
+    TSDFRayCaster(const ScalableTSDFVolume &volume,
+                  const camera::PinholeCameraIntrinsic &intrinsic,
+                  const Eigen::Matrix4d &extrinsic,
+                  double depth_min,
+                  double depth_max,
+                  const Eigen::Vector3d &min_bound,
+                  const Eigen::Vector3d &max_bound,
+                  geometry::Image &vertex_map,
+                  geometry::Image &normal_map,
+                  geometry::Image &color_map)
+        : sampler_(volume),
+          resolution_(volume.volume_unit_resolution_),
+          voxel_length_(volume.voxel_length_),
+          sdf_trunc_(volume.sdf_trunc_),
+          fx_(intrinsic.GetFocalLength().first),
+          fy_(intrinsic.GetFocalLength().second),
+          cx_(intrinsic.GetPrincipalPoint().first),
+          cy_(intrinsic.GetPrincipalPoint().second),
+          depth_min_(depth_min),
+          depth_max_(depth_max),
+          min_bound_(min_bound),
+          max_bound_(max_bound),
+          vertex_map_(vertex_map),
+          normal_map_(normal_map),
+          color_map_(color_map) {
+        Eigen::Matrix4d pose = extrinsic.inverse();
+        rotation_ = pose.block<3, 3>(0, 0);
+        origin_ = pose.block<3, 1>(0, 3);
+        g_origin_ = origin_ / voxel_length_ - Eigen::Vector3d::Constant(0.5);
+        normal_rotation_ = extrinsic.block<3, 3>(0, 0).cast<float>();
+        has_color_ = volume.color_type_ != TSDFVolumeColorType::NoColor;
+        color_scale_ = volume.color_type_ == TSDFVolumeColorType::RGB8
+                               ? 1.0f / 255.0f
+                               : 1.0f;
+    }
+
+    /// Casts the rays of the pixels [u0, u1) x [v0, v1).
+    void CastTile(int u0, int v0, int u1, int v1) const {
+        const int tile_width = u1 - u0;
+        const int num_pixels = tile_width * (v1 - v0);
+        int next_pixel = 0;
+        auto StartNextRay = [&](RayCastRay &ray) {
+            while (next_pixel < num_pixels) {
+                int u = u0 + next_pixel % tile_width;
+                int v = v0 + next_pixel / tile_width;
+                next_pixel++;
+                if (StartRay(u, v, ray)) {
+                    return true;
+                }
+            }
+            return false;
+        };
+        RayCastRay rays[RAY_CAST_BATCH_SIZE];
+        int num_rays = 0;
+        while (num_rays < RAY_CAST_BATCH_SIZE && StartNextRay(rays[num_rays])) {
+            num_rays++;
+        }
+        while (num_rays > 0) {
+            for (int i = 0; i < num_rays;) {
+                if (Step(rays[i]) || StartNextRay(rays[i])) {
+                    i++;
+                } else {
+                    rays[i] = rays[--num_rays];
+                }
+            }
+        }
+    }
+
+private:
+    /// Sets up the ray of pixel (u, v), returns false if it misses the
+    /// allocated units.
+    bool StartRay(int u, int v, RayCastRay &ray) const {
+        ray.u_ = u;
+        ray.v_ = v;
+        ray.dir_camera_ =
+                Eigen::Vector3d((u - cx_) / fx_, (v - cy_) / fy_, 1.0);
+        const Eigen::Vector3d dir = rotation_ * ray.dir_camera_;
+        // Clips the ray to the bounding box of the units in the frustum.
+        ray.t_ = depth_min_;
+        ray.t_end_ = depth_max_;
+        for (int i = 0; i < 3; i++) {
+            if (dir(i) == 0.0) {
+                if (origin_(i) < min_bound_(i) || origin_(i) > max_bound_(i)) {
+                    return false;
+                }
+                continue;
+            }
+            double t0 = (min_bound_(i) - origin_(i)) / dir(i);
+            double t1 = (max_bound_(i) - origin_(i)) / dir(i);
+            ray.t_ = std::max(ray.t_, std::min(t0, t1));
+            ray.t_end_ = std::min(ray.t_end_, std::max(t0, t1));
+        }
+        if (ray.t_ >= ray.t_end_) {
+            return false;
+        }
+        ray.g_dir_ = dir / voxel_length_;
+        ray.voxel_step_ = 1.0 / ray.g_dir_.norm();
+        ray.trunc_step_ = 0.8 * sdf_trunc_ / voxel_length_ * ray.voxel_step_;
+        const Eigen::Vector3d g = g_origin_ + ray.t_ * ray.g_dir_;
+        for (int i = 0; i < 3; i++) {
+            ray.index_(i) = int(std::floor(g(i) / resolution_));
+            double g_dir = ray.g_dir_(i);
+            ray.index_step_(i) = g_dir > 0.0 ? 1 : (g_dir < 0.0 ? -1 : 0);
+            if (ray.index_step_(i) == 0) {
+                ray.t_next_(i) = std::numeric_limits<double>::infinity();
+                ray.t_delta_(i) = std::numeric_limits<double>::infinity();
+                continue;
+            }
+            int bound = ray.index_(i) + (ray.index_step_(i) > 0 ? 1 : 0);
+            ray.t_next_(i) = (bound * resolution_ - g_origin_(i)) / g_dir;
+            ray.t_delta_(i) = resolution_ / std::abs(g_dir);
+        }
+        ray.has_prev_ = false;
+        ray.tsdf_prev_ = 0.0f;
+        ray.t_prev_ = 0.0;
+        return EnterUnit(ray);
+    }
+
+    /// Moves the ray to the next allocated unit along it that it has not
+    /// passed yet, returns false at the end of the ray.
+    bool EnterUnit(RayCastRay &ray) const {
+        while (ray.t_ < ray.t_end_) {
+            const Eigen::Vector3d &t_next = ray.t_next_;
+            ray.axis_ = t_next(0) < t_next(1)
+                                ? (t_next(0) < t_next(2) ? 0 : 2)
+                                : (t_next(1) < t_next(2) ? 1 : 2);
+            ray.t_exit_ = std::min(t_next(ray.axis_), ray.t_end_);
+            const ScalableTSDFVolume::VolumeUnit *unit =
+                    sampler_.FindVolumeUnit(ray.index_);
+            if (unit != nullptr && ray.t_ < ray.t_exit_) {
+                ray.units_.Reset(unit->volume_.get());
+                ray.local_origin_ =
+                        g_origin_ - ray.index_.cast<double>() * resolution_;
+                SetSkip(ray, unit->has_surface_);
+                ray.t_ = SkipTo(ray, ray.t_);
+                sampler_.Prefetch(ray.units_.units_[0],
+                                  ray.local_origin_ + ray.t_ * ray.g_dir_);
+                return true;
+            }
+            if (unit == nullptr) {
+                ray.t_ = std::max(ray.t_, ray.t_exit_);
+                ray.has_prev_ = false;
+            }
+            ray.index_(ray.axis_) += ray.index_step_(ray.axis_);
+            ray.t_next_(ray.axis_) += ray.t_delta_(ray.axis_);
+        }
+        return false;
+    }
+
+    /// Sets the samples of the ray that the unit it entered lets it skip.
+    /// Without surface in the unit, the TSDF in the cells whose 8 voxels lie
+    /// in the unit is positive or unobserved. The ray skips them up to one
+    /// voxel before it reaches the last voxel layer of the unit, whose cells
+    /// reach into the next units, so that the step there is taken from a
+    /// sample near the layer.
+    void SetSkip(RayCastRay &ray, bool has_surface) const {
+        ray.t_skip_ = 0.0;
+        ray.t_resume_ = 0.0;
+        if (has_surface) {
+            return;
+        }
+        // The cells within the unit are those with all coordinates below
+        // resolution_ - 1.
+        const double last = resolution_ - 1;
+        double t_begin = ray.t_, t_end = ray.t_exit_;
+        for (int i = 0; i < 3; i++) {
+            double g_dir = ray.g_dir_(i);
+            double t = (last - ray.local_origin_(i)) / g_dir;
+            if (g_dir > 0.0) {
+                t_end = std::min(t_end, t);
+            } else if (g_dir < 0.0) {
+                t_begin = std::max(t_begin, t);
+            } else if (ray.local_origin_(i) >= last) {
+                return;
+            }
+        }
+        ray.t_skip_ = t_begin;
+        ray.t_resume_ = t_end - ray.voxel_step_;
+    }
+
+    /// Returns the depth of the next sample at or after `t`.
+    static double SkipTo(const RayCastRay &ray, double t) {
+        return t >= ray.t_skip_ && t < ray.t_resume_ ? ray.t_resume_ : t;
+    }
+
+    /// Takes one sample along the ray, returns false once the ray is done.
+    bool Step(RayCastRay &ray) const {
+        float tsdf;
+        const Eigen::Vector3d local = ray.local_origin_ + ray.t_ * ray.g_dir_;
+        if (!sampler_.Sample(ray.index_, ray.units_, local, tsdf)) {
+            ray.t_ += ray.voxel_step_;
+            ray.has_prev_ = false;
+        } else if (ray.has_prev_ && ray.tsdf_prev_ > 0.0f && tsdf <= 0.0f) {
+            double t_hit = ray.t_prev_ + (ray.t_ - ray.t_prev_) *
+                                                 ray.tsdf_prev_ /
+                                                 (ray.tsdf_prev_ - tsdf);
+            WriteHit(ray, ray.local_origin_ + t_hit * ray.g_dir_,
+                     t_hit * ray.dir_camera_);
+            return false;
+        } else if (ray.has_prev_ && ray.tsdf_prev_ < 0.0f && tsdf > 0.0f) {
+            // Back side of a surface.
+            return false;
+        } else {
+            ray.t_prev_ = ray.t_;
+            ray.tsdf_prev_ = tsdf;
+            ray.has_prev_ = true;
+            ray.t_ += std::max(ray.voxel_step_, tsdf * ray.trunc_step_);
+        }
+        ray.t_ = SkipTo(ray, ray.t_);
+        if (ray.t_ >= ray.t_exit_) {
+            ray.index_(ray.axis_) += ray.index_step_(ray.axis_);
+            ray.t_next_(ray.axis_) += ray.t_delta_(ray.axis_);
+            return EnterUnit(ray);
+        }
+        sampler_.Prefetch(ray.units_.units_[0],
+                          ray.local_origin_ + ray.t_ * ray.g_dir_);
+        return true;
+    }
+
+    /// Writes the hit of the ray at the grid coordinates `local` relative to
+    /// its unit, and at `vertex` in the camera.
+    void WriteHit(RayCastRay &ray,
+                  const Eigen::Vector3d &local,
+                  const Eigen::Vector3d &vertex) const {
+        // Central differences of the TSDF, which is zero at the hit, or one
+        // sided differences next to unobserved voxels.
+        Eigen::Vector3f normal;
+        for (int i = 0; i < 3; i++) {
+            Eigen::Vector3d l0 = local, l1 = local;
+            l0(i) -= 1.0;
+            l1(i) += 1.0;
+            float f0, f1;
+            bool has_f0 = sampler_.Sample(ray.index_, ray.units_, l0, f0);
+            bool has_f1 = sampler_.Sample(ray.index_, ray.units_, l1, f1);
+            if (has_f0 && has_f1) {
+                normal(i) = 0.5f * (f1 - f0);
+            } else if (has_f0 || has_f1) {
+                normal(i) = has_f1 ? f1 : -f0;
+            } else {
+                return;
+            }
+        }
+        if (normal.squaredNorm() == 0.0f) {
+            return;
+        }
+        normal = normal_rotation_ * normal.normalized();
+        const int u = ray.u_, v = ray.v_;
+        for (int i = 0; i < 3; i++) {
+            *vertex_map_.PointerAt<float>(u, v, i) = float(vertex(i));
+            *normal_map_.PointerAt<float>(u, v, i) = normal(i);
+        }
+        float tsdf;
+        Eigen::Vector3f color;
+        if (has_color_ &&
+            sampler_.Sample(ray.index_, ray.units_, local, tsdf, &color)) {
+            for (int i = 0; i < 3; i++) {
+                *color_map_.PointerAt<float>(u, v, i) = color(i) * color_scale_;
+            }
+        }
+    }
+
+    const VolumeUnitSampler sampler_;
+    const int resolution_;
+    const double voxel_length_;
+    const double sdf_trunc_;
+    const double fx_, fy_, cx_, cy_;
+    const double depth_min_, depth_max_;
+    const Eigen::Vector3d min_bound_, max_bound_;
+    Eigen::Matrix3d rotation_;
+    Eigen::Vector3d origin_;
+    /// Camera center in the grid coordinates.
+    Eigen::Vector3d g_origin_;
+    Eigen::Matrix3f normal_rotation_;
+    bool has_color_;
+    float color_scale_;
+    geometry::Image &vertex_map_;
+    geometry::Image &normal_map_;
+    geometry::Image &color_map_;
+};
+
+}  // unnamed namespace
+
 ScalableTSDFVolume::ScalableTSDFVolume(double voxel_length,
                                        double sdf_trunc,
                                        TSDFVolumeColorType color_type,
@@ -48,7 +567,14 @@ ScalableTSDFVolume::ScalableTSDFVolume(double voxel_length,
 
 ScalableTSDFVolume::~ScalableTSDFVolume() {}
 
-void ScalableTSDFVolume::Reset() { volume_units_.clear(); }
+void ScalableTSDFVolume::Reset() {
+    for (int block : dirty_volume_units_) {
+        volume_units_.GetBlock(block).dirty_ = false;
+    }
+    dirty_volume_units_.clear();
+    removed_volume_units_.clear();
+    volume_units_.Reset();
+}
 
 void ScalableTSDFVolume::Integrate(
         const geometry::RGBDImage &image,
@@ -73,36 +599,93 @@ void ScalableTSDFVolume::Integrate(
         utility::LogError(
                 "[ScalableTSDFVolume::Integrate] Unsupported image format.");
     }
-    auto depth2cameradistance =
-            geometry::Image::CreateDepthToCameraDistanceMultiplierFloatImage(
-                    intrinsic);
+    const geometry::Image &depth2cameradistance =
+            GetDepthToCameraDistanceMultiplier(intrinsic);
     auto pointcloud = geometry::PointCloud::CreateFromDepthImage(
             image.depth_, intrinsic, extrinsic, 1000.0, 1000.0,
             depth_sampling_stride_);
-    std::unordered_set<Eigen::Vector3i,
-                       utility::hash_eigen::hash<Eigen::Vector3i>>
-            touched_volume_units_;
-    for (const auto &point : pointcloud->points_) {
-        auto min_bound = LocateVolumeUnit(
-                point - Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        auto max_bound = LocateVolumeUnit(
-                point + Eigen::Vector3d(sdf_trunc_, sdf_trunc_, sdf_trunc_));
-        for (auto x = min_bound(0); x <= max_bound(0); x++) {
-            for (auto y = min_bound(1); y <= max_bound(1); y++) {
-                for (auto z = min_bound(2); z <= max_bound(2); z++) {
-                    auto loc = Eigen::Vector3i(x, y, z);
-                    if (touched_volume_units_.find(loc) ==
-                        touched_volume_units_.end()) {
-                        touched_volume_units_.insert(loc);
-                        auto volume = OpenVolumeUnit(Eigen::Vector3i(x, y, z));
-                        volume->IntegrateWithDepthToCameraDistanceMultiplier(
-                                image, intrinsic, extrinsic,
-                                *depth2cameradistance);
+
+    // Collects the volume units within sdf_trunc_ of the points in parallel,
+    // every thread removes its own duplicates before the lists are merged.
+    const Eigen::Vector3d trunc(sdf_trunc_, sdf_trunc_, sdf_trunc_);
+    const auto less = [](const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+        return std::tie(a(0), a(1), a(2)) < std::tie(b(0), b(1), b(2));
+    };
+    std::vector<Eigen::Vector3i> touched_volume_units;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+    {
+        std::unordered_set<Eigen::Vector3i,
+                           utility::hash_eigen::hash<Eigen::Vector3i>>
+                touched_volume_units_private;
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int i = 0; i < (int)pointcloud->points_.size(); i++) {
+            const Eigen::Vector3d &point = pointcloud->points_[i];
+            auto min_bound = LocateVolumeUnit(point - trunc);
+            auto max_bound = LocateVolumeUnit(point + trunc);
+            for (auto x = min_bound(0); x <= max_bound(0); x++) {
+                for (auto y = min_bound(1); y <= max_bound(1); y++) {
+                    for (auto z = min_bound(2); z <= max_bound(2); z++) {
+                        touched_volume_units_private.insert(
+                                Eigen::Vector3i(x, y, z));
                     }
                 }
             }
         }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        touched_volume_units.insert(touched_volume_units.end(),
+                                    touched_volume_units_private.begin(),
+                                    touched_volume_units_private.end());
+    }
+    std::sort(touched_volume_units.begin(), touched_volume_units.end(), less);
+    touched_volume_units.erase(
+            std::unique(touched_volume_units.begin(),
+                        touched_volume_units.end()),
+            touched_volume_units.end());
+
+    // The keys are inserted in sorted order, so that the order of the units
+    // does not depend on the threads. The new units are initialized in the
+    // parallel loop.
+    int num_units = (int)touched_volume_units.size();
+    volume_units_.Reserve(num_units);
+    std::vector<int> blocks(num_units);
+    std::vector<char> inserted(num_units);
+    for (int i = 0; i < num_units; i++) {
+        bool is_new;
+        blocks[i] = volume_units_.Insert(touched_volume_units[i], is_new);
+        inserted[i] = is_new;
+        if (blocks[i] >= 0) {
+            MarkVolumeUnitDirty(blocks[i]);
+        }
+    }
+
+    // Every unit is integrated by a single thread. The voxel loop of
+    // UniformTSDFVolume is parallel too, nesting is disabled meanwhile.
+#ifdef _OPENMP
+    int max_active_levels = omp_get_max_active_levels();
+    omp_set_max_active_levels(1);
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int i = 0; i < num_units; i++) {
+        if (blocks[i] < 0) {
+            continue;
+        }
+        VolumeUnit &unit = volume_units_.GetBlock(blocks[i]);
+        if (inserted[i]) {
+            InitializeVolumeUnit(unit, touched_volume_units[i]);
+        }
+        unit.volume_->IntegrateWithDepthToCameraDistanceMultiplier(
+                image, intrinsic, extrinsic, depth2cameradistance);
+        unit.has_surface_ = HasSurface(*unit.volume_);
     }
+#ifdef _OPENMP
+    omp_set_max_active_levels(max_active_levels);
+#endif
 }
 
 std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
@@ -111,9 +694,9 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
     float w0, w1, f0, f1;
     Eigen::Vector3f c0, c1;
     for (const auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
+        if (unit.volume_) {
+            const auto &volume0 = *unit.volume_;
+            const auto &index0 = unit.index_;
             for (int x = 0; x < volume0.resolution_; x++) {
                 for (int y = 0; y < volume0.resolution_; y++) {
                     for (int z = 0; z < volume0.resolution_; z++) {
@@ -151,13 +734,14 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
                                 } else {
                                     idx1(i) -= volume0.resolution_;
                                     index1(i) += 1;
-                                    auto unit_itr = volume_units_.find(index1);
-                                    if (unit_itr == volume_units_.end()) {
+                                    int block1 = volume_units_.Find(index1);
+                                    if (block1 < 0) {
                                         w1 = 0.0f;
                                         f1 = 0.0f;
                                     } else {
                                         const auto &volume1 =
-                                                *unit_itr->second.volume_;
+                                                *volume_units_.GetBlock(block1)
+                                                         .volume_;
                                         w1 = volume1.voxels_[volume1.IndexOf(
                                                                      idx1)]
                                                      .weight_;
@@ -209,178 +793,299 @@ std::shared_ptr<geometry::PointCloud> ScalableTSDFVolume::ExtractPointCloud() {
 
 std::shared_ptr<geometry::TriangleMesh>
 ScalableTSDFVolume::ExtractTriangleMesh() {
-    // implementation of marching cubes, based on
-    // http://paulbourke.net/geometry/polygonise/
-    auto mesh = std::make_shared<geometry::TriangleMesh>();
-    double half_voxel_length = voxel_length_ * 0.5;
-    std::unordered_map<
-            Eigen::Vector4i, int, utility::hash_eigen::hash<Eigen::Vector4i>,
-            std::equal_to<Eigen::Vector4i>,
-            Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
-            edgeindex_to_vertexindex;
-    int edge_to_index[12];
-    for (const auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            const auto &volume0 = *unit.second.volume_;
-            const auto &index0 = unit.second.index_;
-            for (int x = 0; x < volume0.resolution_; x++) {
-                for (int y = 0; y < volume0.resolution_; y++) {
-                    for (int z = 0; z < volume0.resolution_; z++) {
-                        Eigen::Vector3i idx0(x, y, z);
-                        int cube_index = 0;
-                        float w[8];
-                        float f[8];
-                        Eigen::Vector3d c[8];
-                        for (int i = 0; i < 8; i++) {
-                            Eigen::Vector3i index1 = index0;
-                            Eigen::Vector3i idx1 = idx0 + shift[i];
-                            if (idx1(0) < volume_unit_resolution_ &&
-                                idx1(1) < volume_unit_resolution_ &&
-                                idx1(2) < volume_unit_resolution_) {
-                                w[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .weight_;
-                                f[i] = volume0.voxels_[volume0.IndexOf(idx1)]
-                                               .tsdf_;
-                                if (color_type_ == TSDFVolumeColorType::RGB8)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>() /
-                                           255.0;
-                                else if (color_type_ ==
-                                         TSDFVolumeColorType::Gray32)
-                                    c[i] = volume0.voxels_[volume0.IndexOf(
-                                                                   idx1)]
-                                                   .color_.cast<double>();
-                            } else {
-                                for (int j = 0; j < 3; j++) {
-                                    if (idx1(j) >= volume_unit_resolution_) {
-                                        idx1(j) -= volume_unit_resolution_;
-                                        index1(j) += 1;
-                                    }
-                                }
-                                auto unit_itr1 = volume_units_.find(index1);
-                                if (unit_itr1 == volume_units_.end()) {
-                                    w[i] = 0.0f;
-                                    f[i] = 0.0f;
-                                } else {
-                                    const auto &volume1 =
-                                            *unit_itr1->second.volume_;
-                                    w[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .weight_;
-                                    f[i] = volume1.voxels_[volume1.IndexOf(
-                                                                   idx1)]
-                                                   .tsdf_;
-                                    if (color_type_ ==
-                                        TSDFVolumeColorType::RGB8)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>() /
-                                               255.0;
-                                    else if (color_type_ ==
-                                             TSDFVolumeColorType::Gray32)
-                                        c[i] = volume1.voxels_[volume1.IndexOf(
-                                                                       idx1)]
-                                                       .color_.cast<double>();
-                                }
-                            }
-                            if (w[i] == 0.0f) {
-                                cube_index = 0;
-                                break;
-                            } else {
-                                if (f[i] < 0.0f) {
-                                    cube_index |= (1 << i);
-                                }
-                            }
-                        }
-                        if (cube_index == 0 || cube_index == 255) {
-                            continue;
-                        }
-                        for (int i = 0; i < 12; i++) {
-                            if (edge_table[cube_index] & (1 << i)) {
-                                Eigen::Vector4i edge_index =
-                                        Eigen::Vector4i(index0(0), index0(1),
-                                                        index0(2), 0) *
-                                                volume_unit_resolution_ +
-                                        Eigen::Vector4i(x, y, z, 0) +
-                                        edge_shift[i];
-                                if (edgeindex_to_vertexindex.find(edge_index) ==
-                                    edgeindex_to_vertexindex.end()) {
-                                    edge_to_index[i] =
-                                            (int)mesh->vertices_.size();
-                                    edgeindex_to_vertexindex[edge_index] =
-                                            (int)mesh->vertices_.size();
-                                    Eigen::Vector3d pt(
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(0),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(1),
-                                            half_voxel_length +
-                                                    voxel_length_ *
-                                                            edge_index(2));
-                                    double f0 = std::abs(
-                                            (double)f[edge_to_vert[i][0]]);
-                                    double f1 = std::abs(
-                                            (double)f[edge_to_vert[i][1]]);
-                                    pt(edge_index(3)) +=
-                                            f0 * voxel_length_ / (f0 + f1);
-                                    mesh->vertices_.push_back(pt);
-                                    if (color_type_ !=
-                                        TSDFVolumeColorType::NoColor) {
-                                        const auto &c0 = c[edge_to_vert[i][0]];
-                                        const auto &c1 = c[edge_to_vert[i][1]];
-                                        mesh->vertex_colors_.push_back(
-                                                (f1 * c0 + f0 * c1) /
-                                                (f0 + f1));
-                                    }
-                                } else {
-                                    edge_to_index[i] = edgeindex_to_vertexindex
-                                            [edge_index];
-                                }
-                            }
-                        }
-                        for (int i = 0; tri_table[cube_index][i] != -1;
-                             i += 3) {
-                            mesh->triangles_.push_back(Eigen::Vector3i(
-                                    edge_to_index[tri_table[cube_index][i]],
-                                    edge_to_index[tri_table[cube_index][i + 2]],
-                                    edge_to_index[tri_table[cube_index]
-                                                           [i + 1]]));
-                        }
-                    }
-                }
-            }
-        }
+    // Every volume unit is a block of the parallel marching cubes.
+    std::vector<int> units(volume_units_.Size());
+    for (int i = 0; i < volume_units_.Size(); i++) {
+        units[i] = i;
     }
-    return mesh;
+    auto blocks = CreateMarchingCubesBlocks(units);
+    return ExtractTriangleMeshFromBlocks(blocks, volume_unit_resolution_,
+                                         voxel_length_, color_type_);
 }
 
 std::shared_ptr<geometry::PointCloud>
 ScalableTSDFVolume::ExtractVoxelPointCloud() {
     auto voxel = std::make_shared<geometry::PointCloud>();
     for (auto &unit : volume_units_) {
-        if (unit.second.volume_) {
-            auto v = unit.second.volume_->ExtractVoxelPointCloud();
+        if (unit.volume_) {
+            auto v = unit.volume_->ExtractVoxelPointCloud();
             *voxel += *v;
         }
     }
     return voxel;
 }
 
+std::vector<ScalableTSDFVolume::MeshPatch>
+ScalableTSDFVolume::ExtractTriangleMeshPatches() {
+    // Removed units that were not opened again get an empty patch.
+    std::vector<Eigen::Vector3i> removed;
+    for (const auto &index : removed_volume_units_) {
+        if (volume_units_.Find(index) < 0) {
+            removed.push_back(index);
+        }
+    }
+    removed_volume_units_.clear();
+    auto less = [](const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+        return std::lexicographical_compare(a.data(), a.data() + 3, b.data(),
+                                            b.data() + 3);
+    };
+    std::sort(removed.begin(), removed.end(), less);
+    removed.erase(std::unique(removed.begin(), removed.end()), removed.end());
+
+    // The units around the dirty and the removed ones are meshed too, their
+    // cubes and normals reach into these units. The dirty_ flags mark the
+    // listed units.
+    std::vector<int> units = dirty_volume_units_;
+    auto add_neighbors = [&](const Eigen::Vector3i &index) {
+        for (int j = 0; j < 27; j++) {
+            int neighbor = volume_units_.Find(
+                    index + Eigen::Vector3i(j % 3 - 1, (j / 3) % 3 - 1,
+                                            j / 9 - 1));
+            if (neighbor >= 0 && !volume_units_.GetBlock(neighbor).dirty_) {
+                volume_units_.GetBlock(neighbor).dirty_ = true;
+                units.push_back(neighbor);
+            }
+        }
+    };
+    for (int block : dirty_volume_units_) {
+        add_neighbors(volume_units_.GetBlock(block).index_);
+    }
+    for (const auto &index : removed) {
+        add_neighbors(index);
+    }
+    for (int block : units) {
+        volume_units_.GetBlock(block).dirty_ = false;
+    }
+    dirty_volume_units_.clear();
+    units.erase(std::remove_if(units.begin(), units.end(),
+                               [this](int block) {
+                                   return !volume_units_.GetBlock(block)
+                                                   .volume_;
+                               }),
+                units.end());
+
+    auto blocks = CreateMarchingCubesBlocks(units);
+    auto meshes = ExtractTriangleMeshPatchesFromBlocks(
+            blocks, (int)units.size(), volume_unit_resolution_, voxel_length_,
+            color_type_);
+    std::vector<MeshPatch> patches(units.size() + removed.size());
+    for (size_t i = 0; i < units.size(); i++) {
+        patches[i].index_ = volume_units_.GetBlock(units[i]).index_;
+        patches[i].mesh_ = meshes[i];
+    }
+    for (size_t i = 0; i < removed.size(); i++) {
+        patches[units.size() + i].index_ = removed[i];
+        patches[units.size() + i].mesh_ =
+                std::make_shared<geometry::TriangleMesh>();
+    }
+    return patches;
+}
+
 std::shared_ptr<UniformTSDFVolume> ScalableTSDFVolume::OpenVolumeUnit(
         const Eigen::Vector3i &index) {
-    auto &unit = volume_units_[index];
-    if (!unit.volume_) {
-        unit.volume_.reset(new UniformTSDFVolume(
-                volume_unit_length_, volume_unit_resolution_, sdf_trunc_,
-                color_type_, index.cast<double>() * volume_unit_length_));
-        unit.index_ = index;
+    volume_units_.Reserve(1);
+    bool inserted;
+    int block = volume_units_.Insert(index, inserted);
+    if (block < 0) {
+        utility::LogError(
+                "[ScalableTSDFVolume] Volume unit index out of range.");
+    }
+    auto &unit = volume_units_.GetBlock(block);
+    if (inserted) {
+        InitializeVolumeUnit(unit, index);
     }
+    MarkVolumeUnitDirty(block);
+    unit.has_surface_ = true;
     return unit.volume_;
 }
 
+void ScalableTSDFVolume::RemoveVolumeUnits(
+        const std::vector<Eigen::Vector3i> &indices) {
+    // Erasing moves units between blocks, the dirty units are listed again
+    // by index afterwards.
+    std::vector<Eigen::Vector3i> dirty_indices;
+    for (int block : dirty_volume_units_) {
+        dirty_indices.push_back(volume_units_.GetKey(block));
+    }
+    for (const auto &index : indices) {
+        int block = volume_units_.Erase(index);
+        if (block >= 0) {
+            VolumeUnit &unit = volume_units_.GetBlock(volume_units_.Size());
+            unit.volume_.reset();
+            unit.dirty_ = false;
+            removed_volume_units_.push_back(index);
+        }
+    }
+    dirty_volume_units_.clear();
+    for (const auto &index : dirty_indices) {
+        int block = volume_units_.Find(index);
+        if (block >= 0) {
+            dirty_volume_units_.push_back(block);
+        }
+    }
+}
+
+std::tuple<std::shared_ptr<geometry::Image>,
+           std::shared_ptr<geometry::Image>,
+           std::shared_ptr<geometry::Image>>
+ScalableTSDFVolume::RayCast(const camera::PinholeCameraIntrinsic &intrinsic,
+                            const Eigen::Matrix4d &extrinsic,
+                            double depth_min /* = 0.1*/,
+                            double depth_max /* = 3.0*/) const {
+    const int width = intrinsic.width_, height = intrinsic.height_;
+    auto vertex_map = std::make_shared<geometry::Image>();
+    auto normal_map = std::make_shared<geometry::Image>();
+    auto color_map = std::make_shared<geometry::Image>();
+    vertex_map->Prepare(width, height, 3, 4);
+    normal_map->Prepare(width, height, 3, 4);
+    if (color_type_ != TSDFVolumeColorType::NoColor) {
+        color_map->Prepare(width, height, 3, 4);
+    }
+    const double fx = intrinsic.GetFocalLength().first;
+    const double fy = intrinsic.GetFocalLength().second;
+    const double cx = intrinsic.GetPrincipalPoint().first;
+    const double cy = intrinsic.GetPrincipalPoint().second;
+
+    // Bounding box of the units intersecting the view frustum, tested with
+    // their bounding spheres against the planes of the frustum.
+    const Eigen::Vector3d planes[4] = {
+            Eigen::Vector3d(1.0, 0.0, cx / fx).normalized(),
+            Eigen::Vector3d(-1.0, 0.0, (width - cx) / fx).normalized(),
+            Eigen::Vector3d(0.0, 1.0, cy / fy).normalized(),
+            Eigen::Vector3d(0.0, -1.0, (height - cy) / fy).normalized()};
+    const double radius = 0.5 * std::sqrt(3.0) * volume_unit_length_;
+    Eigen::Vector3i min_index = Eigen::Vector3i::Constant(
+            std::numeric_limits<int>::max());
+    Eigen::Vector3i max_index = Eigen::Vector3i::Constant(
+            std::numeric_limits<int>::min());
+    for (int block = 0; block < volume_units_.Size(); block++) {
+        const Eigen::Vector3i &index = volume_units_.GetKey(block);
+        if (!volume_units_.GetBlock(block).volume_) {
+            continue;
+        }
+        Eigen::Vector3d center =
+                (index.cast<double>() + Eigen::Vector3d::Constant(0.5)) *
+                volume_unit_length_;
+        Eigen::Vector3d c = extrinsic.block<3, 3>(0, 0) * center +
+                            extrinsic.block<3, 1>(0, 3);
+        bool visible =
+                c(2) + radius >= depth_min && c(2) - radius <= depth_max;
+        for (int i = 0; i < 4 && visible; i++) {
+            visible = planes[i].dot(c) >= -radius;
+        }
+        if (visible) {
+            min_index = min_index.cwiseMin(index);
+            max_index = max_index.cwiseMax(index);
+        }
+    }
+    if (min_index(0) > max_index(0)) {
+        return std::make_tuple(vertex_map, normal_map, color_map);
+    }
+    const Eigen::Vector3d min_bound =
+            min_index.cast<double>() * volume_unit_length_;
+    const Eigen::Vector3d max_bound =
+            (max_index + Eigen::Vector3i::Ones()).cast<double>() *
+            volume_unit_length_;
+
+    TSDFRayCaster caster(*this, intrinsic, extrinsic, depth_min, depth_max,
+                         min_bound, max_bound, *vertex_map, *normal_map,
+                         *color_map);
+    const int tile_size = 16;
+    const int tiles_x = (width + tile_size - 1) / tile_size;
+    const int tiles_y = (height + tile_size - 1) / tile_size;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic)
+#endif
+    for (int tile = 0; tile < tiles_x * tiles_y; tile++) {
+        int u0 = (tile % tiles_x) * tile_size;
+        int v0 = (tile / tiles_x) * tile_size;
+        caster.CastTile(u0, v0, std::min(u0 + tile_size, width),
+                        std::min(v0 + tile_size, height));
+    }
+    return std::make_tuple(vertex_map, normal_map, color_map);
+}
+
+void ScalableTSDFVolume::MarkVolumeUnitDirty(int block) {
+    VolumeUnit &unit = volume_units_.GetBlock(block);
+    if (!unit.dirty_) {
+        unit.dirty_ = true;
+        dirty_volume_units_.push_back(block);
+    }
+}
+
+std::vector<TSDFVolumeBlock> ScalableTSDFVolume::CreateMarchingCubesBlocks(
+        const std::vector<int> &blocks) const {
+    std::vector<TSDFVolumeBlock> mc_blocks;
+    std::unordered_map<int, int> unit_to_block;
+    unit_to_block.reserve(blocks.size());
+    auto AddBlock = [&](int unit_block) {
+        auto it = unit_to_block.find(unit_block);
+        if (it != unit_to_block.end()) {
+            return it->second;
+        }
+        const VolumeUnit &unit = volume_units_.GetBlock(unit_block);
+        if (!unit.volume_) {
+            return -1;
+        }
+        TSDFVolumeBlock mc_block;
+        mc_block.volume_ = unit.volume_.get();
+        mc_block.size_ = Eigen::Vector3i::Constant(volume_unit_resolution_);
+        mc_block.neighbors_.fill(-1);
+        mc_block.neighbors_[13] = (int)mc_blocks.size();
+        unit_to_block[unit_block] = (int)mc_blocks.size();
+        mc_blocks.push_back(mc_block);
+        return mc_block.neighbors_[13];
+    };
+    for (int unit_block : blocks) {
+        AddBlock(unit_block);
+    }
+    for (size_t i = 0; i < blocks.size(); i++) {
+        auto it = unit_to_block.find(blocks[i]);
+        if (it == unit_to_block.end()) {
+            continue;
+        }
+        const int mc_block = it->second;
+        const Eigen::Vector3i &index = volume_units_.GetBlock(blocks[i]).index_;
+        std::array<int, 27> neighbors;
+        for (int j = 0; j < 27; j++) {
+            int unit_block = volume_units_.Find(
+                    index + Eigen::Vector3i(j % 3 - 1, (j / 3) % 3 - 1,
+                                            j / 9 - 1));
+            neighbors[j] = unit_block < 0 ? -1 : AddBlock(unit_block);
+        }
+        mc_blocks[mc_block].neighbors_ = neighbors;
+    }
+    return mc_blocks;
+}
+
+void ScalableTSDFVolume::InitializeVolumeUnit(VolumeUnit &unit,
+                                              const Eigen::Vector3i &index) {
+    Eigen::Vector3d origin = index.cast<double>() * volume_unit_length_;
+    if (unit.volume_ && unit.volume_.use_count() == 1) {
+        unit.volume_->Reset();
+        unit.volume_->origin_ = origin;
+    } else {
+        unit.volume_.reset(new UniformTSDFVolume(volume_unit_length_,
+                                                 volume_unit_resolution_,
+                                                 sdf_trunc_, color_type_,
+                                                 origin));
+    }
+    unit.index_ = index;
+}
+
+const geometry::Image &ScalableTSDFVolume::GetDepthToCameraDistanceMultiplier(
+        const camera::PinholeCameraIntrinsic &intrinsic) {
+    if (!depth_to_camera_distance_multiplier_ ||
+        cached_intrinsic_.width_ != intrinsic.width_ ||
+        cached_intrinsic_.height_ != intrinsic.height_ ||
+        cached_intrinsic_.intrinsic_matrix_ != intrinsic.intrinsic_matrix_) {
+        depth_to_camera_distance_multiplier_ = geometry::Image::
+                CreateDepthToCameraDistanceMultiplierFloatImage(intrinsic);
+        cached_intrinsic_ = intrinsic;
+    }
+    return *depth_to_camera_distance_multiplier_;
+}
+
 Eigen::Vector3d ScalableTSDFVolume::GetNormalAt(const Eigen::Vector3d &p) {
     Eigen::Vector3d n;
     const double half_gap = 0.99 * voxel_length_;
@@ -398,11 +1103,11 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
     Eigen::Vector3d p_locate =
             p - Eigen::Vector3d(0.5, 0.5, 0.5) * voxel_length_;
     Eigen::Vector3i index0 = LocateVolumeUnit(p_locate);
-    auto unit_itr = volume_units_.find(index0);
-    if (unit_itr == volume_units_.end()) {
+    int block0 = volume_units_.Find(index0);
+    if (block0 < 0) {
         return 0.0;
     }
-    const auto &volume0 = *unit_itr->second.volume_;
+    const auto &volume0 = *volume_units_.GetBlock(block0).volume_;
     Eigen::Vector3i idx0;
     Eigen::Vector3d p_grid =
             (p_locate - index0.cast<double>() * volume_unit_length_) /
@@ -429,11 +1134,11 @@ double ScalableTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
                     index1(j) += 1;
                 }
             }
-            auto unit_itr1 = volume_units_.find(index1);
-            if (unit_itr1 == volume_units_.end()) {
+            int block1 = volume_units_.Find(index1);
+            if (block1 < 0) {
                 f[i] = 0.0f;
             } else {
-                const auto &volume1 = *unit_itr1->second.volume_;
+                const auto &volume1 = *volume_units_.GetBlock(block1).volume_;
                 f[i] = volume1.voxels_[volume1.IndexOf(idx1)].tsdf_;
             }
         }
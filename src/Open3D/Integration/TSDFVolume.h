@@ -46,6 +46,20 @@ enum class TSDFVolumeColorType {
     Gray32 = 2,
 };
 
+/// \enum TSDFVolumeStorageType
+///
+/// Enum class for the voxel storage of UniformTSDFVolume.
+enum class TSDFVolumeStorageType {
+    /// One geometry::TSDFVoxel per voxel, about 48 bytes.
+    Voxel = 0,
+    /// Arrays of float TSDF values and weights and of 8 bit RGB or float
+    /// intensities, 8 to 12 bytes per voxel.
+    Float32 = 1,
+    /// Arrays of 16 bit TSDF values and weights and of 8 bit RGB or float
+    /// intensities, 4 to 8 bytes per voxel.
+    Int16 = 2,
+};
+
 /// \class TSDFVolume
 ///
 /// \brief Base class of the Truncated Signed Distance Function (TSDF) volume.
@@ -26,12 +26,13 @@
 
 #include "Open3D/Integration/UniformTSDFVolume.h"
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
 #include <thread>
-#include <unordered_map>
 
 #include "Open3D/Geometry/VoxelGrid.h"
-#include "Open3D/Integration/MarchingCubesConst.h"
+#include "Open3D/Integration/MarchingCubes.h"
 #include "Open3D/Utility/Helper.h"
 
 namespace open3d {
@@ -42,18 +43,49 @@ UniformTSDFVolume::UniformTSDFVolume(
         int resolution,
         double sdf_trunc,
         TSDFVolumeColorType color_type,
-        const Eigen::Vector3d &origin /* = Eigen::Vector3d::Zero()*/)
+        const Eigen::Vector3d &origin /* = Eigen::Vector3d::Zero()*/,
+        TSDFVolumeStorageType storage_type /* = TSDFVolumeStorageType::Voxel*/)
     : TSDFVolume(length / (double)resolution, sdf_trunc, color_type),
+      storage_type_(storage_type),
       origin_(origin),
       length_(length),
       resolution_(resolution),
       voxel_num_(resolution * resolution * resolution) {
-    voxels_.resize(voxel_num_);
+    Reset();
 }
 
 UniformTSDFVolume::~UniformTSDFVolume() {}
 
-void UniformTSDFVolume::Reset() { voxels_.clear(); }
+void UniformTSDFVolume::Reset() {
+    // The storage is zeroed rather than released, the volume stays usable.
+    size_t n = size_t(voxel_num_);
+    switch (storage_type_) {
+        case TSDFVolumeStorageType::Float32:
+            tsdf_.assign(n, 0.0f);
+            weight_.assign(n, 0.0f);
+            break;
+        case TSDFVolumeStorageType::Int16:
+            tsdf_int16_.assign(n, 0);
+            weight_uint16_.assign(n, 0);
+            break;
+        default:
+            voxels_.assign(n, geometry::TSDFVoxel());
+            return;
+    }
+    if (color_type_ == TSDFVolumeColorType::RGB8) {
+        color_rgb8_.assign(3 * n, 0);
+    } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+        color_gray32_.assign(n, 0.0f);
+    }
+}
+
+size_t UniformTSDFVolume::GetStorageSize() const {
+    return voxels_.size() * sizeof(geometry::TSDFVoxel) +
+           (tsdf_.size() + weight_.size() + color_gray32_.size()) *
+                   sizeof(float) +
+           tsdf_int16_.size() * sizeof(int16_t) +
+           weight_uint16_.size() * sizeof(uint16_t) + color_rgb8_.size();
+}
 
 void UniformTSDFVolume::Integrate(
         const geometry::RGBDImage &image,
@@ -95,9 +127,9 @@ std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
         for (int y = 1; y < resolution_ - 1; y++) {
             for (int z = 1; z < resolution_ - 1; z++) {
                 Eigen::Vector3i idx0(x, y, z);
-                float w0 = voxels_[IndexOf(idx0)].weight_;
-                float f0 = voxels_[IndexOf(idx0)].tsdf_;
-                const Eigen::Vector3d &c0 = voxels_[IndexOf(idx0)].color_;
+                int ind0 = IndexOf(idx0);
+                float w0 = GetWeight(ind0);
+                float f0 = GetTSDF(ind0);
 
                 if (!(w0 != 0.0f && f0 < 0.98f && f0 >= -0.98f)) {
                     continue;
@@ -111,10 +143,9 @@ std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
                     Eigen::Vector3i idx1 = idx0;
                     idx1(i) += 1;
                     if (idx1(i) < resolution_ - 1) {
-                        float w1 = voxels_[IndexOf(idx1)].weight_;
-                        float f1 = voxels_[IndexOf(idx1)].tsdf_;
-                        const Eigen::Vector3d &c1 =
-                                voxels_[IndexOf(idx1)].color_;
+                        int ind1 = IndexOf(idx1);
+                        float w1 = GetWeight(ind1);
+                        float f1 = GetTSDF(ind1);
                         if (w1 != 0.0f && f1 < 0.98f && f1 >= -0.98f &&
                             f0 * f1 < 0) {
                             float r0 = std::fabs(f0);
@@ -122,6 +153,11 @@ std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
                             Eigen::Vector3d p = p0;
                             p(i) = (p0(i) * r1 + p1(i) * r0) / (r0 + r1);
                             pointcloud->points_.push_back(p + origin_);
+                            Eigen::Vector3d c0, c1;
+                            if (color_type_ != TSDFVolumeColorType::NoColor) {
+                                c0 = GetColor(ind0);
+                                c1 = GetColor(ind1);
+                            }
                             if (color_type_ == TSDFVolumeColorType::RGB8) {
                                 pointcloud->colors_.push_back(
                                         ((c0 * r1 + c1 * r0) / (r0 + r1) /
@@ -146,97 +182,47 @@ std::shared_ptr<geometry::PointCloud> UniformTSDFVolume::ExtractPointCloud() {
 
 std::shared_ptr<geometry::TriangleMesh>
 UniformTSDFVolume::ExtractTriangleMesh() {
-    // implementation of marching cubes, based on
-    // http://paulbourke.net/geometry/polygonise/
-    auto mesh = std::make_shared<geometry::TriangleMesh>();
-    double half_voxel_length = voxel_length_ * 0.5;
-    // Map of "edge_index = (x, y, z, 0) + edge_shift" to "global vertex index"
-    std::unordered_map<
-            Eigen::Vector4i, int, utility::hash_eigen::hash<Eigen::Vector4i>,
-            std::equal_to<Eigen::Vector4i>,
-            Eigen::aligned_allocator<std::pair<const Eigen::Vector4i, int>>>
-            edgeindex_to_vertexindex;
-    int edge_to_index[12];
-    for (int x = 0; x < resolution_ - 1; x++) {
-        for (int y = 0; y < resolution_ - 1; y++) {
-            for (int z = 0; z < resolution_ - 1; z++) {
-                int cube_index = 0;
-                float f[8];
-                Eigen::Vector3d c[8];
-                for (int i = 0; i < 8; i++) {
-                    Eigen::Vector3i idx = Eigen::Vector3i(x, y, z) + shift[i];
-
-                    if (voxels_[IndexOf(idx)].weight_ == 0.0f) {
-                        cube_index = 0;
-                        break;
-                    } else {
-                        f[i] = voxels_[IndexOf(idx)].tsdf_;
-                        if (f[i] < 0.0f) {
-                            cube_index |= (1 << i);
-                        }
-                        if (color_type_ == TSDFVolumeColorType::RGB8) {
-                            c[i] = voxels_[IndexOf(idx)].color_.cast<double>() /
-                                   255.0;
-                        } else if (color_type_ == TSDFVolumeColorType::Gray32) {
-                            c[i] = voxels_[IndexOf(idx)].color_.cast<double>();
-                        }
-                    }
-                }
-                if (cube_index == 0 || cube_index == 255) {
-                    continue;
-                }
-                for (int i = 0; i < 12; i++) {
-                    if (edge_table[cube_index] & (1 << i)) {
-                        Eigen::Vector4i edge_index =
-                                Eigen::Vector4i(x, y, z, 0) + edge_shift[i];
-                        if (edgeindex_to_vertexindex.find(edge_index) ==
-                            edgeindex_to_vertexindex.end()) {
-                            edge_to_index[i] = (int)mesh->vertices_.size();
-                            edgeindex_to_vertexindex[edge_index] =
-                                    (int)mesh->vertices_.size();
-                            Eigen::Vector3d pt(
-                                    half_voxel_length +
-                                            voxel_length_ * edge_index(0),
-                                    half_voxel_length +
-                                            voxel_length_ * edge_index(1),
-                                    half_voxel_length +
-                                            voxel_length_ * edge_index(2));
-                            double f0 = std::abs((double)f[edge_to_vert[i][0]]);
-                            double f1 = std::abs((double)f[edge_to_vert[i][1]]);
-                            pt(edge_index(3)) += f0 * voxel_length_ / (f0 + f1);
-                            mesh->vertices_.push_back(pt + origin_);
-                            if (color_type_ != TSDFVolumeColorType::NoColor) {
-                                const auto &c0 = c[edge_to_vert[i][0]];
-                                const auto &c1 = c[edge_to_vert[i][1]];
-                                mesh->vertex_colors_.push_back(
-                                        (f1 * c0 + f0 * c1) / (f0 + f1));
-                            }
-                        } else {
-                            edge_to_index[i] =
-                                    edgeindex_to_vertexindex.find(edge_index)
-                                            ->second;
-                        }
-                    }
-                }
-                for (int i = 0; tri_table[cube_index][i] != -1; i += 3) {
-                    mesh->triangles_.push_back(Eigen::Vector3i(
-                            edge_to_index[tri_table[cube_index][i]],
-                            edge_to_index[tri_table[cube_index][i + 2]],
-                            edge_to_index[tri_table[cube_index][i + 1]]));
+    // Split the grid into blocks of MARCHING_CUBES_BLOCK_RESOLUTION^3 voxels
+    // meshed in parallel, the last blocks along an axis may be smaller.
+    const int block_resolution = MARCHING_CUBES_BLOCK_RESOLUTION;
+    const int num_blocks_per_axis =
+            (resolution_ + block_resolution - 1) / block_resolution;
+    std::vector<TSDFVolumeBlock> blocks(num_blocks_per_axis *
+                                        num_blocks_per_axis *
+                                        num_blocks_per_axis);
+    auto BlockIndexOf = [num_blocks_per_axis](const Eigen::Vector3i &b) {
+        return (b(2) * num_blocks_per_axis + b(1)) * num_blocks_per_axis +
+               b(0);
+    };
+    for (int bz = 0; bz < num_blocks_per_axis; bz++) {
+        for (int by = 0; by < num_blocks_per_axis; by++) {
+            for (int bx = 0; bx < num_blocks_per_axis; bx++) {
+                Eigen::Vector3i b(bx, by, bz);
+                TSDFVolumeBlock &block = blocks[BlockIndexOf(b)];
+                block.volume_ = this;
+                block.offset_ = b * block_resolution;
+                block.size_ = (block.offset_.array() + block_resolution)
+                                      .min(resolution_) -
+                              block.offset_.array();
+                for (int i = 0; i < 27; i++) {
+                    Eigen::Vector3i n = b + Eigen::Vector3i(i % 3 - 1,
+                                                            (i / 3) % 3 - 1,
+                                                            i / 9 - 1);
+                    bool inside = (n.array() >= 0).all() &&
+                                  (n.array() < num_blocks_per_axis).all();
+                    block.neighbors_[i] = inside ? BlockIndexOf(n) : -1;
                 }
             }
         }
     }
-    return mesh;
+    return ExtractTriangleMeshFromBlocks(blocks, block_resolution,
+                                         voxel_length_, color_type_);
 }
 
 std::shared_ptr<geometry::PointCloud>
 UniformTSDFVolume::ExtractVoxelPointCloud() const {
     auto voxel = std::make_shared<geometry::PointCloud>();
     double half_voxel_length = voxel_length_ * 0.5;
-    // const float *p_tsdf = (const float *)tsdf_.data();
-    // const float *p_weight = (const float *)weight_.data();
-    // const float *p_color = (const float *)color_.data();
     for (int x = 0; x < resolution_; x++) {
         for (int y = 0; y < resolution_; y++) {
             for (int z = 0; z < resolution_; z++) {
@@ -244,11 +230,11 @@ UniformTSDFVolume::ExtractVoxelPointCloud() const {
                                    half_voxel_length + voxel_length_ * y,
                                    half_voxel_length + voxel_length_ * z);
                 int ind = IndexOf(x, y, z);
-                if (voxels_[ind].weight_ != 0.0f &&
-                    voxels_[ind].tsdf_ < 0.98f &&
-                    voxels_[ind].tsdf_ >= -0.98f) {
+                const float w = GetWeight(ind);
+                const float f = GetTSDF(ind);
+                if (w != 0.0f && f < 0.98f && f >= -0.98f) {
                     voxel->points_.push_back(pt + origin_);
-                    double c = (voxels_[ind].tsdf_ + 1.0) * 0.5;
+                    double c = (f + 1.0) * 0.5;
                     voxel->colors_.push_back(Eigen::Vector3d(c, c, c));
                 }
             }
@@ -267,8 +253,8 @@ std::shared_ptr<geometry::VoxelGrid> UniformTSDFVolume::ExtractVoxelGrid()
         for (int y = 0; y < resolution_; y++) {
             for (int z = 0; z < resolution_; z++) {
                 const int ind = IndexOf(x, y, z);
-                const float w = voxels_[ind].weight_;
-                const float f = voxels_[ind].tsdf_;
+                const float w = GetWeight(ind);
+                const float f = GetTSDF(ind);
                 if (w != 0.0f && f < 0.98f && f >= -0.98f) {
                     double c = (f + 1.0) * 0.5;
                     Eigen::Vector3d color = Eigen::Vector3d(c, c, c);
@@ -346,35 +332,64 @@ void UniformTSDFVolume::IntegrateWithDepthToCameraDistanceMultiplier(
                 if (sdf > -sdf_trunc_f) {
                     // integrate
                     float tsdf = std::min(1.0f, sdf * sdf_trunc_inv_f);
-                    voxels_[v_ind].tsdf_ =
-                            (voxels_[v_ind].tsdf_ * voxels_[v_ind].weight_ +
-                             tsdf) /
-                            (voxels_[v_ind].weight_ + 1.0f);
-                    if (color_type_ == TSDFVolumeColorType::RGB8) {
-                        const uint8_t *rgb =
-                                image.color_.PointerAt<uint8_t>(u, v, 0);
-                        Eigen::Vector3d rgb_f(rgb[0], rgb[1], rgb[2]);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_ *
-                                         voxels_[v_ind].weight_ +
-                                 rgb_f) /
-                                (voxels_[v_ind].weight_ + 1.0f);
-                    } else if (color_type_ == TSDFVolumeColorType::Gray32) {
-                        const float *intensity =
-                                image.color_.PointerAt<float>(u, v, 0);
-                        voxels_[v_ind].color_ =
-                                (voxels_[v_ind].color_.array() *
-                                         voxels_[v_ind].weight_ +
-                                 (*intensity)) /
-                                (voxels_[v_ind].weight_ + 1.0f);
-                    }
-                    voxels_[v_ind].weight_ += 1.0f;
+                    UpdateVoxel(v_ind, tsdf, image.color_, u, v);
                 }
             }
         }
     }
 }
 
+void UniformTSDFVolume::UpdateVoxel(int index,
+                                    float tsdf,
+                                    const geometry::Image &color,
+                                    int u,
+                                    int v) {
+    if (storage_type_ == TSDFVolumeStorageType::Voxel) {
+        geometry::TSDFVoxel &voxel = voxels_[index];
+        voxel.tsdf_ = (voxel.tsdf_ * voxel.weight_ + tsdf) /
+                      (voxel.weight_ + 1.0f);
+        if (color_type_ == TSDFVolumeColorType::RGB8) {
+            const uint8_t *rgb = color.PointerAt<uint8_t>(u, v, 0);
+            Eigen::Vector3d rgb_f(rgb[0], rgb[1], rgb[2]);
+            voxel.color_ = (voxel.color_ * voxel.weight_ + rgb_f) /
+                           (voxel.weight_ + 1.0f);
+        } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+            const float *intensity = color.PointerAt<float>(u, v, 0);
+            voxel.color_ = (voxel.color_.array() * voxel.weight_ +
+                            (*intensity)) /
+                           (voxel.weight_ + 1.0f);
+        }
+        voxel.weight_ += 1.0f;
+        return;
+    }
+
+    const float weight = GetWeight(index);
+    const float inv_weight = 1.0f / (weight + 1.0f);
+    if (storage_type_ == TSDFVolumeStorageType::Float32) {
+        tsdf_[index] = (tsdf_[index] * weight + tsdf) * inv_weight;
+        weight_[index] = weight + 1.0f;
+    } else {
+        float tsdf_avg = (GetTSDF(index) * weight + tsdf) * inv_weight;
+        tsdf_int16_[index] = int16_t(std::lround(tsdf_avg * 32767.0f));
+        // The weight saturates, the average then keeps adapting slowly.
+        if (weight_uint16_[index] < 65535) {
+            weight_uint16_[index]++;
+        }
+    }
+    if (color_type_ == TSDFVolumeColorType::RGB8) {
+        const uint8_t *rgb = color.PointerAt<uint8_t>(u, v, 0);
+        uint8_t *rgb_avg = &color_rgb8_[3 * index];
+        for (int i = 0; i < 3; i++) {
+            rgb_avg[i] = uint8_t(std::lround((rgb_avg[i] * weight + rgb[i]) *
+                                             inv_weight));
+        }
+    } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+        const float *intensity = color.PointerAt<float>(u, v, 0);
+        color_gray32_[index] =
+                (color_gray32_[index] * weight + (*intensity)) * inv_weight;
+    }
+}
+
 Eigen::Vector3d UniformTSDFVolume::GetNormalAt(const Eigen::Vector3d &p) {
     Eigen::Vector3d n;
     const double half_gap = 0.99 * voxel_length_;
@@ -398,21 +413,21 @@ double UniformTSDFVolume::GetTSDFAt(const Eigen::Vector3d &p) {
 
     double tsdf = 0;
     tsdf += (1 - r(0)) * (1 - r(1)) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 0, 0))].tsdf_;
+            GetTSDF(IndexOf(idx + Eigen::Vector3i(0, 0, 0)));
     tsdf += (1 - r(0)) * (1 - r(1)) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 0, 1))].tsdf_;
+            GetTSDF(IndexOf(idx + Eigen::Vector3i(0, 0, 1)));
     tsdf += (1 - r(0)) * r(1) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 1, 0))].tsdf_;
+            GetTSDF(IndexOf(idx + Eigen::Vector3i(0, 1, 0)));
     tsdf += (1 - r(0)) * r(1) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(0, 1, 1))].tsdf_;
+            GetTSDF(IndexOf(idx + Eigen::Vector3i(0, 1, 1)));
     tsdf += r(0) * (1 - r(1)) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 0, 0))].tsdf_;
+            GetTSDF(IndexOf(idx + Eigen::Vector3i(1, 0, 0)));
     tsdf += r(0) * (1 - r(1)) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 0, 1))].tsdf_;
+            GetTSDF(IndexOf(idx + Eigen::Vector3i(1, 0, 1)));
     tsdf += r(0) * r(1) * (1 - r(2)) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 1, 0))].tsdf_;
+            GetTSDF(IndexOf(idx + Eigen::Vector3i(1, 1, 0)));
     tsdf += r(0) * r(1) * r(2) *
-            voxels_[IndexOf(idx + Eigen::Vector3i(1, 1, 1))].tsdf_;
+            GetTSDF(IndexOf(idx + Eigen::Vector3i(1, 1, 1)));
     return tsdf;
 }
 
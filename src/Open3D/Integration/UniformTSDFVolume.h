@@ -26,6 +26,9 @@
 
 #pragma once
 
+#include <cstdint>
+#include <vector>
+
 #include "Open3D/Geometry/VoxelGrid.h"
 #include "Open3D/Integration/TSDFVolume.h"
 
@@ -54,13 +57,19 @@ namespace integration {
 ///
 /// \brief UniformTSDFVolume implements the classic TSDF volume with uniform
 /// voxel grid (Curless and Levoy 1996).
+///
+/// The voxels are stored in `voxels_` or, with a compact storage type, in
+/// structure of arrays buffers indexed by IndexOf. The accessors GetTSDF,
+/// GetWeight and GetColor read any storage type.
 class UniformTSDFVolume : public TSDFVolume {
 public:
     UniformTSDFVolume(double length,
                       int resolution,
                       double sdf_trunc,
                       TSDFVolumeColorType color_type,
-                      const Eigen::Vector3d &origin = Eigen::Vector3d::Zero());
+                      const Eigen::Vector3d &origin = Eigen::Vector3d::Zero(),
+                      TSDFVolumeStorageType storage_type =
+                              TSDFVolumeStorageType::Voxel);
     ~UniformTSDFVolume() override;
 
 public:
@@ -92,8 +101,64 @@ public:
         return IndexOf(xyz(0), xyz(1), xyz(2));
     }
 
+    /// Returns the TSDF value of the voxel at `index`, in [-1, 1].
+    inline float GetTSDF(int index) const {
+        switch (storage_type_) {
+            case TSDFVolumeStorageType::Float32:
+                return tsdf_[index];
+            case TSDFVolumeStorageType::Int16:
+                return tsdf_int16_[index] * (1.0f / 32767.0f);
+            default:
+                return voxels_[index].tsdf_;
+        }
+    }
+
+    /// Returns the integration weight of the voxel at `index`.
+    inline float GetWeight(int index) const {
+        switch (storage_type_) {
+            case TSDFVolumeStorageType::Float32:
+                return weight_[index];
+            case TSDFVolumeStorageType::Int16:
+                return float(weight_uint16_[index]);
+            default:
+                return voxels_[index].weight_;
+        }
+    }
+
+    /// Returns the color of the voxel at `index`, in [0, 255] for RGB8 and as
+    /// intensity for Gray32.
+    inline Eigen::Vector3d GetColor(int index) const {
+        if (storage_type_ == TSDFVolumeStorageType::Voxel) {
+            return voxels_[index].color_;
+        } else if (color_type_ == TSDFVolumeColorType::RGB8) {
+            const uint8_t *rgb = &color_rgb8_[3 * index];
+            return Eigen::Vector3d(rgb[0], rgb[1], rgb[2]);
+        } else if (color_type_ == TSDFVolumeColorType::Gray32) {
+            return Eigen::Vector3d::Constant(color_gray32_[index]);
+        }
+        return Eigen::Vector3d::Zero();
+    }
+
+    /// Returns the number of bytes used by the voxel storage.
+    size_t GetStorageSize() const;
+
 public:
+    /// Voxels of the Voxel storage type, empty otherwise.
     std::vector<geometry::TSDFVoxel> voxels_;
+    /// TSDF values of the Float32 storage type.
+    std::vector<float> tsdf_;
+    /// Weights of the Float32 storage type.
+    std::vector<float> weight_;
+    /// TSDF values of the Int16 storage type, scaled by 32767.
+    std::vector<int16_t> tsdf_int16_;
+    /// Weights of the Int16 storage type, saturating at 65535.
+    std::vector<uint16_t> weight_uint16_;
+    /// Colors of the compact storage types with RGB8 color, three per voxel.
+    std::vector<uint8_t> color_rgb8_;
+    /// Intensities of the compact storage types with Gray32 color.
+    std::vector<float> color_gray32_;
+    /// Storage type of the voxels, fixed at construction.
+    TSDFVolumeStorageType storage_type_;
     Eigen::Vector3d origin_;
     /// Total length, where voxel_length = length / resolution.
     double length_;
@@ -104,6 +169,14 @@ public:
     int voxel_num_;
 
 private:
+    /// Integrates a TSDF value, and the color of pixel (u, v), into the voxel
+    /// at `index`.
+    void UpdateVoxel(int index,
+                     float tsdf,
+                     const geometry::Image &color,
+                     int u,
+                     int v);
+
     Eigen::Vector3d GetNormalAt(const Eigen::Vector3d &p);
 
     double GetTSDFAt(const Eigen::Vector3d &p);
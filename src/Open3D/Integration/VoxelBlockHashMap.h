@@ -0,0 +1,290 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+namespace open3d {
+namespace integration {
+
+/// \class VoxelBlockHashMap
+///
+/// \brief Open addressing hash map from voxel block coordinates to the blocks
+/// of a contiguous block pool, the CPU counterpart of HashTableCuda and
+/// MemoryHeapCuda.
+///
+/// The coordinates are packed into 21 bits each and stored in a linear
+/// probing table that is kept at most half full. Blocks are handed out from
+/// the pool in insertion order, so that the blocks in use are always
+/// [begin(), end()). Reset() clears the table but keeps the pool, the values
+/// of the released blocks are handed out again by the following insertions.
+template <typename Value>
+class VoxelBlockHashMap {
+public:
+    VoxelBlockHashMap() : size_(0) { table_.resize(16); }
+    VoxelBlockHashMap(const VoxelBlockHashMap<Value> &other)
+        : table_(other.table_),
+          blocks_(other.blocks_),
+          block_keys_(other.block_keys_),
+          size_(other.size_.load()) {}
+    VoxelBlockHashMap<Value> &operator=(const VoxelBlockHashMap<Value> &other) {
+        table_ = other.table_;
+        blocks_ = other.blocks_;
+        block_keys_ = other.block_keys_;
+        size_ = other.size_.load();
+        return *this;
+    }
+
+public:
+    /// Number of blocks in use.
+    int Size() const { return size_; }
+    bool Empty() const { return size_ == 0; }
+    /// Number of blocks in the pool, including the released ones.
+    int Capacity() const { return int(blocks_.size()); }
+
+    /// Makes room for `count` more blocks. Not thread safe, must be called
+    /// before the insertions it makes room for.
+    void Reserve(int count) {
+        int required = size_ + count;
+        if (required > int(blocks_.size())) {
+            int capacity = std::max(required, 2 * int(blocks_.size()));
+            blocks_.resize(capacity);
+            block_keys_.resize(capacity);
+        }
+        if (2 * size_t(required) > table_.size()) {
+            size_t table_size = table_.size();
+            while (table_size < 4 * size_t(required)) {
+                table_size *= 2;
+            }
+            Rehash(table_size);
+        }
+    }
+
+    /// Returns the block of `key`, inserting it first if needed. `inserted`
+    /// tells whether the key was new, in which case the value of the block is
+    /// either default constructed or left over from before Reset(). Returns
+    /// -1 for coordinates out of [-2^20, 2^20).
+    ///
+    /// Concurrent calls are safe as long as Reserve() made room for all of the
+    /// keys they insert.
+    int Insert(const Eigen::Vector3i &key, bool &inserted) {
+        inserted = false;
+        uint64_t packed;
+        if (!PackKey(key, packed)) {
+            return -1;
+        }
+        const size_t mask = table_.size() - 1;
+        for (size_t i = Hash(packed) & mask;; i = (i + 1) & mask) {
+            Entry &entry = table_[i];
+            uint64_t current = entry.key_.load(std::memory_order_acquire);
+            if (current == EMPTY_KEY &&
+                entry.key_.compare_exchange_strong(current, packed,
+                                                   std::memory_order_acq_rel)) {
+                int block = size_.fetch_add(1);
+                block_keys_[block] = key;
+                entry.block_.store(block, std::memory_order_release);
+                inserted = true;
+                return block;
+            }
+            // On failure compare_exchange_strong loaded the winning key.
+            if (current == packed) {
+                int block;
+                while ((block = entry.block_.load(std::memory_order_acquire)) <
+                       0) {
+                    std::this_thread::yield();
+                }
+                return block;
+            }
+        }
+    }
+
+    /// Returns the block of `key`, or -1 if the key is absent. Must not run
+    /// concurrently with Insert().
+    int Find(const Eigen::Vector3i &key) const {
+        uint64_t packed;
+        if (!PackKey(key, packed)) {
+            return -1;
+        }
+        const size_t mask = table_.size() - 1;
+        for (size_t i = Hash(packed) & mask;; i = (i + 1) & mask) {
+            const Entry &entry = table_[i];
+            uint64_t current = entry.key_.load(std::memory_order_relaxed);
+            if (current == packed) {
+                return entry.block_.load(std::memory_order_relaxed);
+            } else if (current == EMPTY_KEY) {
+                return -1;
+            }
+        }
+    }
+
+    /// Removes `key`, returns its block or -1 if the key is absent. The last
+    /// block in use is moved into the block of `key`, whose value goes to the
+    /// released end of the pool. Not thread safe.
+    int Erase(const Eigen::Vector3i &key) {
+        uint64_t packed;
+        if (!PackKey(key, packed)) {
+            return -1;
+        }
+        const size_t mask = table_.size() - 1;
+        size_t i = Hash(packed) & mask;
+        while (table_[i].key_ != packed) {
+            if (table_[i].key_ == EMPTY_KEY) {
+                return -1;
+            }
+            i = (i + 1) & mask;
+        }
+        const int block = table_[i].block_;
+        const int last = size_ - 1;
+        if (block != last) {
+            std::swap(blocks_[block], blocks_[last]);
+            block_keys_[block] = block_keys_[last];
+            uint64_t last_packed;
+            PackKey(block_keys_[last], last_packed);
+            size_t j = Hash(last_packed) & mask;
+            while (table_[j].key_ != last_packed) {
+                j = (j + 1) & mask;
+            }
+            table_[j].block_ = block;
+        }
+        block_keys_[last] = key;
+        size_--;
+        // Backward shift deletion, moves the following entries of the probe
+        // sequence into the hole unless that would put them before their
+        // home slot.
+        for (size_t j = (i + 1) & mask; table_[j].key_ != EMPTY_KEY;
+             j = (j + 1) & mask) {
+            size_t home = Hash(table_[j].key_) & mask;
+            if (((j - home) & mask) >= ((j - i) & mask)) {
+                table_[i] = table_[j];
+                i = j;
+            }
+        }
+        table_[i].Clear();
+        return block;
+    }
+
+    /// Removes all keys, the blocks stay allocated for the next insertions.
+    void Reset() {
+        for (auto &entry : table_) {
+            entry.Clear();
+        }
+        size_ = 0;
+    }
+
+    Value &GetBlock(int block) { return blocks_[block]; }
+    const Value &GetBlock(int block) const { return blocks_[block]; }
+    const Eigen::Vector3i &GetKey(int block) const {
+        return block_keys_[block];
+    }
+
+    typename std::vector<Value>::iterator begin() { return blocks_.begin(); }
+    typename std::vector<Value>::iterator end() {
+        return blocks_.begin() + size_;
+    }
+    typename std::vector<Value>::const_iterator begin() const {
+        return blocks_.begin();
+    }
+    typename std::vector<Value>::const_iterator end() const {
+        return blocks_.begin() + size_;
+    }
+
+    /// Packs the coordinates into 21 bits each, returns false if they are out
+    /// of [-2^20, 2^20).
+    static bool PackKey(const Eigen::Vector3i &key, uint64_t &packed) {
+        const int64_t bound = int64_t(1) << 20;
+        packed = 0;
+        for (int i = 0; i < 3; i++) {
+            if (key(i) < -bound || key(i) >= bound) {
+                return false;
+            }
+            packed |= uint64_t(key(i) + bound) << (21 * i);
+        }
+        return true;
+    }
+
+private:
+    /// Packed keys use 63 bits, so that all ones marks an empty entry.
+    static const uint64_t EMPTY_KEY = ~uint64_t(0);
+
+    struct Entry {
+        Entry() : key_(EMPTY_KEY), block_(-1) {}
+        Entry(const Entry &other)
+            : key_(other.key_.load()), block_(other.block_.load()) {}
+        Entry &operator=(const Entry &other) {
+            key_ = other.key_.load();
+            block_ = other.block_.load();
+            return *this;
+        }
+        void Clear() {
+            key_ = EMPTY_KEY;
+            block_ = -1;
+        }
+
+        std::atomic<uint64_t> key_;
+        std::atomic<int> block_;
+    };
+
+    /// Finalizer of MurmurHash3, mixes all bits of the packed key.
+    static size_t Hash(uint64_t packed) {
+        packed ^= packed >> 33;
+        packed *= 0xff51afd7ed558ccdULL;
+        packed ^= packed >> 33;
+        packed *= 0xc4ceb9fe1a85ec53ULL;
+        packed ^= packed >> 33;
+        return size_t(packed);
+    }
+
+    void Rehash(size_t table_size) {
+        table_.assign(table_size, Entry());
+        const size_t mask = table_size - 1;
+        for (int block = 0; block < size_; block++) {
+            uint64_t packed;
+            PackKey(block_keys_[block], packed);
+            size_t i = Hash(packed) & mask;
+            while (table_[i].key_ != EMPTY_KEY) {
+                i = (i + 1) & mask;
+            }
+            table_[i].key_ = packed;
+            table_[i].block_ = block;
+        }
+    }
+
+private:
+    std::vector<Entry> table_;
+    std::vector<Value> blocks_;
+    std::vector<Eigen::Vector3i> block_keys_;
+    std::atomic<int> size_;
+};
+
+}  // namespace integration
+}  // namespace open3d
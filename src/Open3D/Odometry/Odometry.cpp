@@ -27,7 +27,9 @@
 #include "Open3D/Odometry/Odometry.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
 #include <memory>
+#include <vector>
 
 #include "Open3D/Geometry/Image.h"
 #include "Open3D/Geometry/RGBDImage.h"
@@ -40,80 +42,47 @@ namespace open3d {
 namespace {
 using namespace odometry;
 
-std::tuple<std::shared_ptr<geometry::Image>, std::shared_ptr<geometry::Image>>
-InitializeCorrespondenceMap(int width, int height) {
-    // initialization: filling with any (u,v) to (-1,-1)
-    auto correspondence_map = std::make_shared<geometry::Image>();
-    auto depth_buffer = std::make_shared<geometry::Image>();
-    correspondence_map->Prepare(width, height, 2, 4);
-    depth_buffer->Prepare(width, height, 1, 4);
-    for (int v = 0; v < correspondence_map->height_; v++) {
-        for (int u = 0; u < correspondence_map->width_; u++) {
-            *correspondence_map->PointerAt<int>(u, v, 0) = -1;
-            *correspondence_map->PointerAt<int>(u, v, 1) = -1;
-            *depth_buffer->PointerAt<float>(u, v, 0) = -1.0f;
-        }
-    }
-    return std::make_tuple(correspondence_map, depth_buffer);
-}
-
-inline void AddElementToCorrespondenceMap(geometry::Image &correspondence_map,
-                                          geometry::Image &depth_buffer,
-                                          int u_s,
-                                          int v_s,
-                                          int u_t,
-                                          int v_t,
-                                          float transformed_d_t) {
-    int exist_u_t, exist_v_t;
-    double exist_d_t;
-    exist_u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-    exist_v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-    if (exist_u_t != -1 && exist_v_t != -1) {
-        exist_d_t = *depth_buffer.PointerAt<float>(u_s, v_s);
-        if (transformed_d_t <
-            exist_d_t) {  // update nearer point as correspondence
-            *correspondence_map.PointerAt<int>(u_s, v_s, 0) = u_t;
-            *correspondence_map.PointerAt<int>(u_s, v_s, 1) = v_t;
-            *depth_buffer.PointerAt<float>(u_s, v_s) = transformed_d_t;
-        }
-    } else {  // register correspondence
-        *correspondence_map.PointerAt<int>(u_s, v_s, 0) = u_t;
-        *correspondence_map.PointerAt<int>(u_s, v_s, 1) = v_t;
-        *depth_buffer.PointerAt<float>(u_s, v_s) = transformed_d_t;
-    }
-}
-
-void MergeCorrespondenceMaps(geometry::Image &correspondence_map,
-                             geometry::Image &depth_buffer,
-                             geometry::Image &correspondence_map_part,
-                             geometry::Image &depth_buffer_part) {
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map_part.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map_part.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                float transformed_d_t =
-                        *depth_buffer_part.PointerAt<float>(u_s, v_s);
-                AddElementToCorrespondenceMap(correspondence_map, depth_buffer,
-                                              u_s, v_s, u_t, v_t,
-                                              transformed_d_t);
+/// Number of source image rows whose correspondences are searched together.
+/// The correspondences of a band stay in cache until they are consumed.
+static const int CORRESPONDENCE_BAND_ROWS = 8;
+
+/// Appends the correspondences of the source pixels in the rows
+/// [v_begin, v_end) to `correspondence`, in row-major order. A source pixel
+/// is projected to a single target pixel, so the pixels are independent.
+void AppendCorrespondenceInRows(const Eigen::Matrix3d &KRK_inv,
+                                const Eigen::Vector3d &Kt,
+                                const geometry::Image &depth_s,
+                                const geometry::Image &depth_t,
+                                const OdometryOption &option,
+                                int v_begin,
+                                int v_end,
+                                CorrespondenceSetPixelWise &correspondence) {
+    const float *data_s = depth_s.PointerAt<float>(0, 0);
+    const float *data_t = depth_t.PointerAt<float>(0, 0);
+    for (int v_s = v_begin; v_s < v_end; v_s++) {
+        const float *row_s = data_s + v_s * depth_s.width_;
+        const Eigen::Vector3d uv_row =
+                KRK_inv.col(1) * double(v_s) + KRK_inv.col(2);
+        for (int u_s = 0; u_s < depth_s.width_; u_s++) {
+            double d_s = row_s[u_s];
+            if (std::isnan(d_s)) {
+                continue;
             }
-        }
-    }
-}
-
-int CountCorrespondence(const geometry::Image &correspondence_map) {
-    int correspondence_count = 0;
-    for (int v_s = 0; v_s < correspondence_map.height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map.width_; u_s++) {
-            int u_t = *correspondence_map.PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map.PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                correspondence_count++;
+            Eigen::Vector3d uv_in_s =
+                    d_s * (KRK_inv.col(0) * double(u_s) + uv_row) + Kt;
+            double transformed_d_s = uv_in_s(2);
+            int u_t = (int)(uv_in_s(0) / transformed_d_s + 0.5);
+            int v_t = (int)(uv_in_s(1) / transformed_d_s + 0.5);
+            if (u_t >= 0 && u_t < depth_t.width_ && v_t >= 0 &&
+                v_t < depth_t.height_) {
+                double d_t = data_t[v_t * depth_t.width_ + u_t];
+                if (!std::isnan(d_t) && std::abs(transformed_d_s - d_t) <=
+                                                option.max_depth_diff_) {
+                    correspondence.emplace_back(u_s, v_s, u_t, v_t);
+                }
             }
         }
     }
-    return correspondence_count;
 }
 
 std::shared_ptr<CorrespondenceSetPixelWise> ComputeCorrespondence(
@@ -128,79 +97,37 @@ std::shared_ptr<CorrespondenceSetPixelWise> ComputeCorrespondence(
     const Eigen::Matrix3d KRK_inv = K * R * K_inv;
     Eigen::Vector3d Kt = K * extrinsic.block<3, 1>(0, 3);
 
-    std::shared_ptr<geometry::Image> correspondence_map;
-    std::shared_ptr<geometry::Image> depth_buffer;
-    std::tie(correspondence_map, depth_buffer) =
-            InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
-
-#ifdef _OPENMP
-#pragma omp parallel
-    {
-#endif
-        std::shared_ptr<geometry::Image> correspondence_map_private;
-        std::shared_ptr<geometry::Image> depth_buffer_private;
-        std::tie(correspondence_map_private, depth_buffer_private) =
-                InitializeCorrespondenceMap(depth_t.width_, depth_t.height_);
-#ifdef _OPENMP
-#pragma omp for nowait
-#endif
-        for (int v_s = 0; v_s < depth_s.height_; v_s++) {
-            for (int u_s = 0; u_s < depth_s.width_; u_s++) {
-                double d_s = *depth_s.PointerAt<float>(u_s, v_s);
-                if (!std::isnan(d_s)) {
-                    Eigen::Vector3d uv_in_s =
-                            d_s * KRK_inv * Eigen::Vector3d(u_s, v_s, 1.0) + Kt;
-                    double transformed_d_s = uv_in_s(2);
-                    int u_t = (int)(uv_in_s(0) / transformed_d_s + 0.5);
-                    int v_t = (int)(uv_in_s(1) / transformed_d_s + 0.5);
-                    if (u_t >= 0 && u_t < depth_t.width_ && v_t >= 0 &&
-                        v_t < depth_t.height_) {
-                        double d_t = *depth_t.PointerAt<float>(u_t, v_t);
-                        if (!std::isnan(d_t) &&
-                            std::abs(transformed_d_s - d_t) <=
-                                    option.max_depth_diff_) {
-                            AddElementToCorrespondenceMap(
-                                    *correspondence_map_private,
-                                    *depth_buffer_private, u_s, v_s, u_t, v_t,
-                                    (float)d_s);
-                        }
-                    }
-                }
-            }
-        }
+    // The bands are searched in parallel and concatenated in order.
+    const int num_bands =
+            (depth_s.height_ + CORRESPONDENCE_BAND_ROWS - 1) /
+            CORRESPONDENCE_BAND_ROWS;
+    std::vector<CorrespondenceSetPixelWise> band_correspondence(num_bands);
 #ifdef _OPENMP
-#pragma omp critical
-        {
-#endif
-            MergeCorrespondenceMaps(*correspondence_map, *depth_buffer,
-                                    *correspondence_map_private,
-                                    *depth_buffer_private);
-#ifdef _OPENMP
-        }  //    omp critical
-    }      //    omp parallel
+#pragma omp parallel for schedule(dynamic)
 #endif
+    for (int band = 0; band < num_bands; band++) {
+        int v_begin = band * CORRESPONDENCE_BAND_ROWS;
+        int v_end = std::min(v_begin + CORRESPONDENCE_BAND_ROWS,
+                             depth_s.height_);
+        AppendCorrespondenceInRows(KRK_inv, Kt, depth_s, depth_t, option,
+                                   v_begin, v_end, band_correspondence[band]);
+    }
 
     auto correspondence = std::make_shared<CorrespondenceSetPixelWise>();
-    int correspondence_count = CountCorrespondence(*correspondence_map);
-    correspondence->resize(correspondence_count);
-    int cnt = 0;
-    for (int v_s = 0; v_s < correspondence_map->height_; v_s++) {
-        for (int u_s = 0; u_s < correspondence_map->width_; u_s++) {
-            int u_t = *correspondence_map->PointerAt<int>(u_s, v_s, 0);
-            int v_t = *correspondence_map->PointerAt<int>(u_s, v_s, 1);
-            if (u_t != -1 && v_t != -1) {
-                Eigen::Vector4i pixel_correspondence(u_s, v_s, u_t, v_t);
-                (*correspondence)[cnt] = pixel_correspondence;
-                cnt++;
-            }
-        }
+    size_t correspondence_count = 0;
+    for (const auto &band : band_correspondence) {
+        correspondence_count += band.size();
+    }
+    correspondence->reserve(correspondence_count);
+    for (const auto &band : band_correspondence) {
+        correspondence->insert(correspondence->end(), band.begin(), band.end());
     }
     return correspondence;
 }
 
-std::shared_ptr<geometry::Image> ConvertDepthImageToXYZImage(
-        const geometry::Image &depth, const Eigen::Matrix3d &intrinsic_matrix) {
-    auto image_xyz = std::make_shared<geometry::Image>();
+void ConvertDepthImageToXYZImage(const geometry::Image &depth,
+                                 const Eigen::Matrix3d &intrinsic_matrix,
+                                 geometry::Image &image_xyz) {
     if (depth.num_of_channels_ != 1 || depth.bytes_per_channel_ != 4) {
         utility::LogError(
                 "[ConvertDepthImageToXYZImage] Unsupported image format.");
@@ -209,20 +136,38 @@ std::shared_ptr<geometry::Image> ConvertDepthImageToXYZImage(
     const double inv_fy = 1.0 / intrinsic_matrix(1, 1);
     const double ox = intrinsic_matrix(0, 2);
     const double oy = intrinsic_matrix(1, 2);
-    image_xyz->Prepare(depth.width_, depth.height_, 3, 4);
-
-    for (int y = 0; y < image_xyz->height_; y++) {
-        for (int x = 0; x < image_xyz->width_; x++) {
-            float *px = image_xyz->PointerAt<float>(x, y, 0);
-            float *py = image_xyz->PointerAt<float>(x, y, 1);
-            float *pz = image_xyz->PointerAt<float>(x, y, 2);
-            float z = *depth.PointerAt<float>(x, y);
-            *px = (float)((x - ox) * z * inv_fx);
-            *py = (float)((y - oy) * z * inv_fy);
-            *pz = z;
+    image_xyz.Prepare(depth.width_, depth.height_, 3, 4);
+
+    const float *data_depth = depth.PointerAt<float>(0, 0);
+    float *data_xyz = image_xyz.PointerAt<float>(0, 0, 0);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int y = 0; y < image_xyz.height_; y++) {
+        const float *row_depth = data_depth + y * depth.width_;
+        float *row_xyz = data_xyz + 3 * y * image_xyz.width_;
+        for (int x = 0; x < image_xyz.width_; x++) {
+            float z = row_depth[x];
+            row_xyz[3 * x] = (float)((x - ox) * z * inv_fx);
+            row_xyz[3 * x + 1] = (float)((y - oy) * z * inv_fy);
+            row_xyz[3 * x + 2] = z;
+        }
+    }
+}
+
+void CreateXYZImagePyramid(
+        const geometry::RGBDImagePyramid &pyramid,
+        const std::vector<Eigen::Matrix3d> &pyramid_camera_matrix,
+        geometry::ImagePyramid &xyz_pyramid) {
+    xyz_pyramid.resize(pyramid.size());
+    for (size_t level = 0; level < pyramid.size(); level++) {
+        if (!xyz_pyramid[level]) {
+            xyz_pyramid[level] = std::make_shared<geometry::Image>();
         }
+        ConvertDepthImageToXYZImage(pyramid[level]->depth_,
+                                    pyramid_camera_matrix[level],
+                                    *xyz_pyramid[level]);
     }
-    return image_xyz;
 }
 
 std::vector<Eigen::Matrix3d> CreateCameraMatrixPyramid(
@@ -247,62 +192,65 @@ Eigen::Matrix6d CreateInformationMatrix(
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
         const geometry::Image &depth_s,
         const geometry::Image &depth_t,
+        const geometry::Image &xyz_t,
         const OdometryOption &option) {
     auto correspondence =
             ComputeCorrespondence(pinhole_camera_intrinsic.intrinsic_matrix_,
                                   extrinsic, depth_s, depth_t, option);
 
-    auto xyz_t = ConvertDepthImageToXYZImage(
-            depth_t, pinhole_camera_intrinsic.intrinsic_matrix_);
-
     // write q^*
     // see http://redwood-data.org/indoor/registration.html
     // note: I comes first and q_skew is scaled by factor 2.
-    Eigen::Matrix6d GTG = Eigen::Matrix6d::Identity();
+    // The three rows of a point p form G = [-[p]x | I], so the sum of the
+    // G^T G only depends on the sum of the points and of their outer products.
+    Eigen::Vector3d sum_p = Eigen::Vector3d::Zero();
+    Eigen::Matrix3d sum_ppT = Eigen::Matrix3d::Zero();
 #ifdef _OPENMP
 #pragma omp parallel
     {
 #endif
-        Eigen::Matrix6d GTG_private = Eigen::Matrix6d::Identity();
-        Eigen::Vector6d G_r_private = Eigen::Vector6d::Zero();
+        Eigen::Vector3d sum_p_private = Eigen::Vector3d::Zero();
+        Eigen::Matrix3d sum_ppT_private = Eigen::Matrix3d::Zero();
 #ifdef _OPENMP
 #pragma omp for nowait
 #endif
         for (int row = 0; row < int(correspondence->size()); row++) {
             int u_t = (*correspondence)[row](2);
             int v_t = (*correspondence)[row](3);
-            double x = *xyz_t->PointerAt<float>(u_t, v_t, 0);
-            double y = *xyz_t->PointerAt<float>(u_t, v_t, 1);
-            double z = *xyz_t->PointerAt<float>(u_t, v_t, 2);
-            G_r_private.setZero();
-            G_r_private(1) = z;
-            G_r_private(2) = -y;
-            G_r_private(3) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-            G_r_private.setZero();
-            G_r_private(0) = -z;
-            G_r_private(2) = x;
-            G_r_private(4) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
-            G_r_private.setZero();
-            G_r_private(0) = y;
-            G_r_private(1) = -x;
-            G_r_private(5) = 1.0;
-            GTG_private.noalias() += G_r_private * G_r_private.transpose();
+            const float *xyz = xyz_t.PointerAt<float>(u_t, v_t, 0);
+            const Eigen::Vector3d p(xyz[0], xyz[1], xyz[2]);
+            sum_p_private += p;
+            sum_ppT_private.noalias() += p * p.transpose();
         }
 #ifdef _OPENMP
 #pragma omp critical
 #endif
-        { GTG += GTG_private; }
+        {
+            sum_p += sum_p_private;
+            sum_ppT += sum_ppT_private;
+        }
 #ifdef _OPENMP
     }
 #endif
+    Eigen::Matrix3d sum_p_skew;
+    sum_p_skew << 0.0, -sum_p(2), sum_p(1), sum_p(2), 0.0, -sum_p(0),
+            -sum_p(1), sum_p(0), 0.0;
+    // [p]x^T [p]x = |p|^2 I - p p^T.
+    Eigen::Matrix6d GTG = Eigen::Matrix6d::Identity();
+    GTG.block<3, 3>(0, 0) +=
+            sum_ppT.trace() * Eigen::Matrix3d::Identity() - sum_ppT;
+    GTG.block<3, 3>(0, 3) = sum_p_skew;
+    GTG.block<3, 3>(3, 0) = sum_p_skew.transpose();
+    GTG.block<3, 3>(3, 3) +=
+            double(correspondence->size()) * Eigen::Matrix3d::Identity();
     return GTG;
 }
 
-void NormalizeIntensity(geometry::Image &image_s,
-                        geometry::Image &image_t,
-                        CorrespondenceSetPixelWise &correspondence) {
+/// Returns the mean intensities of the corresponding pixels of the images.
+std::tuple<double, double> ComputeMeanIntensity(
+        const geometry::Image &image_s,
+        const geometry::Image &image_t,
+        const CorrespondenceSetPixelWise &correspondence) {
     if (image_s.width_ != image_t.width_ ||
         image_s.height_ != image_t.height_) {
         utility::LogError(
@@ -320,14 +268,17 @@ void NormalizeIntensity(geometry::Image &image_s,
     }
     mean_s /= (double)correspondence.size();
     mean_t /= (double)correspondence.size();
-    image_s.LinearTransform(0.5 / mean_s, 0.0);
-    image_t.LinearTransform(0.5 / mean_t, 0.0);
+    return std::make_tuple(mean_s, mean_t);
 }
 
-inline std::shared_ptr<geometry::RGBDImage> PackRGBDImage(
-        const geometry::Image &color, const geometry::Image &depth) {
-    return std::make_shared<geometry::RGBDImage>(
-            geometry::RGBDImage(color, depth));
+void NormalizeIntensity(geometry::Image &image_s,
+                        geometry::Image &image_t,
+                        CorrespondenceSetPixelWise &correspondence) {
+    double mean_s, mean_t;
+    std::tie(mean_s, mean_t) =
+            ComputeMeanIntensity(image_s, image_t, correspondence);
+    image_s.LinearTransform(0.5 / mean_s, 0.0);
+    image_t.LinearTransform(0.5 / mean_t, 0.0);
 }
 
 std::shared_ptr<geometry::Image> PreprocessDepth(
@@ -390,6 +341,22 @@ inline bool CheckRGBDImagePair(const geometry::RGBDImage &source,
     return false;
 }
 
+/// Converts the color of `image` to a float intensity image and smoothes the
+/// intensity and the preprocessed depth into `output`.
+void PreprocessRGBDImage(const geometry::RGBDImage &image,
+                         const OdometryOption &option,
+                         geometry::RGBDImage &output) {
+    if (IsColorImageRGB(image.color_)) {
+        image.color_.CreateFloatImage()->Filter(
+                geometry::Image::FilterType::Gaussian3, output.color_);
+    } else {
+        image.color_.Filter(geometry::Image::FilterType::Gaussian3,
+                            output.color_);
+    }
+    PreprocessDepth(image.depth_, option)
+            ->Filter(geometry::Image::FilterType::Gaussian3, output.depth_);
+}
+
 std::tuple<std::shared_ptr<geometry::RGBDImage>,
            std::shared_ptr<geometry::RGBDImage>>
 InitializeRGBDOdometry(
@@ -398,33 +365,16 @@ InitializeRGBDOdometry(
         const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
         const Eigen::Matrix4d &odo_init,
         const OdometryOption &option) {
-    std::shared_ptr<geometry::Image> source_color, target_color;
-    if (IsColorImageRGB(source.color_) && IsColorImageRGB(target.color_)) {
-        source_color = source.color_.CreateFloatImage();
-        target_color = target.color_.CreateFloatImage();
-    } else {
-        source_color = std::make_shared<geometry::Image>(source.color_);
-        target_color = std::make_shared<geometry::Image>(target.color_);
-    }
-
-    auto source_gray =
-            source_color->Filter(geometry::Image::FilterType::Gaussian3);
-    auto target_gray =
-            target_color->Filter(geometry::Image::FilterType::Gaussian3);
-    auto source_depth_preprocessed = PreprocessDepth(source.depth_, option);
-    auto target_depth_preprocessed = PreprocessDepth(target.depth_, option);
-    auto source_depth = source_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
-    auto target_depth = target_depth_preprocessed->Filter(
-            geometry::Image::FilterType::Gaussian3);
+    auto source_out = std::make_shared<geometry::RGBDImage>();
+    auto target_out = std::make_shared<geometry::RGBDImage>();
+    PreprocessRGBDImage(source, option, *source_out);
+    PreprocessRGBDImage(target, option, *target_out);
 
     auto correspondence = ComputeCorrespondence(
-            pinhole_camera_intrinsic.intrinsic_matrix_, odo_init, *source_depth,
-            *target_depth, option);
-    NormalizeIntensity(*source_gray, *target_gray, *correspondence);
-
-    auto source_out = PackRGBDImage(*source_gray, *source_depth);
-    auto target_out = PackRGBDImage(*target_gray, *target_depth);
+            pinhole_camera_intrinsic.intrinsic_matrix_, odo_init,
+            source_out->depth_, target_out->depth_, option);
+    NormalizeIntensity(source_out->color_, target_out->color_,
+                       *correspondence);
     return std::make_tuple(source_out, target_out);
 }
 
@@ -440,26 +390,70 @@ std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
         const OdometryOption &option) {
-    auto correspondence = ComputeCorrespondence(
-            intrinsic, extrinsic_initial, source.depth_, target.depth_, option);
-    int corresps_count = (int)correspondence->size();
+    const Eigen::Matrix3d K_inv = intrinsic.inverse();
+    const Eigen::Matrix3d R = extrinsic_initial.block<3, 3>(0, 0);
+    const Eigen::Matrix3d KRK_inv = intrinsic * R * K_inv;
+    const Eigen::Vector3d Kt = intrinsic * extrinsic_initial.block<3, 1>(0, 3);
 
-    auto f_lambda =
-            [&](int i,
-                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
-                std::vector<double> &r) {
+    // The correspondences of a band of rows are linearized right after they
+    // are found, so every pixel is visited once per iteration.
+    utility::LogDebug("Iter : {:d}, Level : {:d}, ", iter, level);
+    const int num_bands =
+            (source.depth_.height_ + CORRESPONDENCE_BAND_ROWS - 1) /
+            CORRESPONDENCE_BAND_ROWS;
+    Eigen::Matrix6d JTJ = Eigen::Matrix6d::Zero();
+    Eigen::Vector6d JTr = Eigen::Vector6d::Zero();
+    double r2 = 0.0;
+    int corresps_count = 0;
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        Eigen::Matrix6d JTJ_private = Eigen::Matrix6d::Zero();
+        Eigen::Vector6d JTr_private = Eigen::Vector6d::Zero();
+        double r2_private = 0.0;
+        int corresps_count_private = 0;
+        CorrespondenceSetPixelWise correspondence;
+        std::vector<Eigen::Vector6d, utility::Vector6d_allocator> J_r;
+        std::vector<double> r;
+#ifdef _OPENMP
+#pragma omp for nowait schedule(dynamic)
+#endif
+        for (int band = 0; band < num_bands; band++) {
+            int v_begin = band * CORRESPONDENCE_BAND_ROWS;
+            int v_end = std::min(v_begin + CORRESPONDENCE_BAND_ROWS,
+                                 source.depth_.height_);
+            correspondence.clear();
+            AppendCorrespondenceInRows(KRK_inv, Kt, source.depth_,
+                                       target.depth_, option, v_begin, v_end,
+                                       correspondence);
+            for (int i = 0; i < (int)correspondence.size(); i++) {
                 jacobian_method.ComputeJacobianAndResidual(
                         i, J_r, r, source, target, source_xyz, target_dx,
                         target_dy, intrinsic, extrinsic_initial,
-                        *correspondence);
-            };
-    utility::LogDebug("Iter : {:d}, Level : {:d}, ", iter, level);
-    Eigen::Matrix6d JTJ;
-    Eigen::Vector6d JTr;
-    double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    f_lambda, corresps_count);
+                        correspondence);
+                for (int j = 0; j < (int)r.size(); j++) {
+                    JTJ_private.noalias() += J_r[j] * J_r[j].transpose();
+                    JTr_private.noalias() += J_r[j] * r[j];
+                    r2_private += r[j] * r[j];
+                }
+            }
+            corresps_count_private += (int)correspondence.size();
+        }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            JTJ += JTJ_private;
+            JTr += JTr_private;
+            r2 += r2_private;
+            corresps_count += corresps_count_private;
+#ifdef _OPENMP
+        }
+    }
+#endif
+    utility::LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                      r2 / (double)corresps_count, corresps_count);
 
     bool is_success;
     Eigen::Matrix4d extrinsic;
@@ -473,53 +467,36 @@ std::tuple<bool, Eigen::Matrix4d> DoSingleIteration(
     }
 }
 
+/// Runs the iterations of every pyramid level, from the coarsest level on.
+/// Only the pyramids used by the Jacobians are passed: the intensities and
+/// XYZ images of the source and the gradients of the target.
 std::tuple<bool, Eigen::Matrix4d> ComputeMultiscale(
-        const geometry::RGBDImage &source,
-        const geometry::RGBDImage &target,
-        const camera::PinholeCameraIntrinsic &pinhole_camera_intrinsic,
+        const geometry::RGBDImagePyramid &source_pyramid,
+        const geometry::ImagePyramid &source_xyz_pyramid,
+        const geometry::RGBDImagePyramid &target_pyramid,
+        const geometry::RGBDImagePyramid &target_pyramid_dx,
+        const geometry::RGBDImagePyramid &target_pyramid_dy,
+        const std::vector<Eigen::Matrix3d> &pyramid_camera_matrix,
         const Eigen::Matrix4d &extrinsic_initial,
         const RGBDOdometryJacobian &jacobian_method,
         const OdometryOption &option) {
-    std::vector<int> iter_counts = option.iteration_number_per_pyramid_level_;
+    const std::vector<int> &iter_counts =
+            option.iteration_number_per_pyramid_level_;
     int num_levels = (int)iter_counts.size();
 
-    auto source_pyramid = source.CreatePyramid(num_levels);
-    auto target_pyramid = target.CreatePyramid(num_levels);
-    auto target_pyramid_dx = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dx);
-    auto target_pyramid_dy = geometry::RGBDImage::FilterPyramid(
-            target_pyramid, geometry::Image::FilterType::Sobel3Dy);
-
     Eigen::Matrix4d result_odo = extrinsic_initial.isZero()
                                          ? Eigen::Matrix4d::Identity()
                                          : extrinsic_initial;
 
-    std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
-            CreateCameraMatrixPyramid(pinhole_camera_intrinsic,
-                                      (int)iter_counts.size());
-
     for (int level = num_levels - 1; level >= 0; level--) {
-        const Eigen::Matrix3d level_camera_matrix =
-                pyramid_camera_matrix[level];
-
-        auto source_xyz_level = ConvertDepthImageToXYZImage(
-                source_pyramid[level]->depth_, level_camera_matrix);
-        auto source_level = PackRGBDImage(source_pyramid[level]->color_,
-                                          source_pyramid[level]->depth_);
-        auto target_level = PackRGBDImage(target_pyramid[level]->color_,
-                                          target_pyramid[level]->depth_);
-        auto target_dx_level = PackRGBDImage(target_pyramid_dx[level]->color_,
-                                             target_pyramid_dx[level]->depth_);
-        auto target_dy_level = PackRGBDImage(target_pyramid_dy[level]->color_,
-                                             target_pyramid_dy[level]->depth_);
-
         for (int iter = 0; iter < iter_counts[num_levels - level - 1]; iter++) {
             Eigen::Matrix4d curr_odo;
             bool is_success;
             std::tie(is_success, curr_odo) = DoSingleIteration(
-                    iter, level, *source_level, *target_level,
-                    *source_xyz_level, *target_dx_level, *target_dy_level,
-                    level_camera_matrix, result_odo, jacobian_method, option);
+                    iter, level, *source_pyramid[level], *target_pyramid[level],
+                    *source_xyz_pyramid[level], *target_pyramid_dx[level],
+                    *target_pyramid_dy[level], pyramid_camera_matrix[level],
+                    result_odo, jacobian_method, option);
             result_odo = curr_odo * result_odo;
 
             if (!is_success) {
@@ -555,17 +532,39 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
     std::tie(source_processed, target_processed) = InitializeRGBDOdometry(
             source, target, pinhole_camera_intrinsic, odo_init, option);
 
+    int num_levels = (int)option.iteration_number_per_pyramid_level_.size();
+    std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
+            CreateCameraMatrixPyramid(pinhole_camera_intrinsic, num_levels);
+    geometry::RGBDImagePyramid source_pyramid, target_pyramid;
+    geometry::RGBDImagePyramid target_pyramid_dx, target_pyramid_dy;
+    geometry::ImagePyramid source_xyz_pyramid;
+    source_processed->CreatePyramid(num_levels, true, false, source_pyramid);
+    target_processed->CreatePyramid(num_levels, true, false, target_pyramid);
+    geometry::RGBDImage::FilterPyramid(target_pyramid,
+                                       geometry::Image::FilterType::Sobel3Dx,
+                                       target_pyramid_dx);
+    geometry::RGBDImage::FilterPyramid(target_pyramid,
+                                       geometry::Image::FilterType::Sobel3Dy,
+                                       target_pyramid_dy);
+    CreateXYZImagePyramid(source_pyramid, pyramid_camera_matrix,
+                          source_xyz_pyramid);
+
     Eigen::Matrix4d extrinsic;
     bool is_success;
     std::tie(is_success, extrinsic) = ComputeMultiscale(
-            *source_processed, *target_processed, pinhole_camera_intrinsic,
+            source_pyramid, source_xyz_pyramid, target_pyramid,
+            target_pyramid_dx, target_pyramid_dy, pyramid_camera_matrix,
             odo_init, jacobian_method, option);
 
     if (is_success) {
         Eigen::Matrix4d trans_output = extrinsic;
+        geometry::Image target_xyz;
+        ConvertDepthImageToXYZImage(target_processed->depth_,
+                                    pinhole_camera_intrinsic.intrinsic_matrix_,
+                                    target_xyz);
         Eigen::MatrixXd info_output = CreateInformationMatrix(
                 extrinsic, pinhole_camera_intrinsic, source_processed->depth_,
-                target_processed->depth_, option);
+                target_processed->depth_, target_xyz, option);
         return std::make_tuple(true, trans_output, info_output);
     } else {
         return std::make_tuple(false, Eigen::Matrix4d::Identity(),
@@ -573,5 +572,110 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
     }
 }
 
+std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> RGBDOdometryTracker::Track(
+        const geometry::RGBDImage &frame,
+        const Eigen::Matrix4d &odo_init /*= Eigen::Matrix4d::Identity()*/,
+        const RGBDOdometryJacobian &jacobian_method
+        /*=RGBDOdometryJacobianFromHybridTerm*/) {
+    if (!CheckRGBDImagePair(frame, frame)) {
+        utility::LogWarning(
+                "[RGBDOdometryTracker] Unsupported RGBD image format.");
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero());
+    }
+    if (has_previous_frame_) {
+        const geometry::Image &previous_depth =
+                previous_.pyramid_[0]->depth_;
+        if (!CheckImagePair(previous_depth, frame.depth_) ||
+            previous_.pyramid_.size() !=
+                    option_.iteration_number_per_pyramid_level_.size()) {
+            utility::LogWarning(
+                    "[RGBDOdometryTracker] Frame differs from the previous "
+                    "frame, starting a new sequence.");
+            has_previous_frame_ = false;
+        }
+    }
+
+    PrepareFrame(frame, current_);
+    std::swap(previous_, current_);
+    if (!has_previous_frame_) {
+        has_previous_frame_ = true;
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Zero());
+    }
+    // From here on `previous_` holds the new frame, the target of the pair.
+    Frame &source = current_;
+    Frame &target = previous_;
+    const geometry::RGBDImage &source_level = *source.pyramid_[0];
+    const geometry::RGBDImage &target_level = *target.pyramid_[0];
+
+    // Same normalization as ComputeRGBDOdometry: the mean intensities of the
+    // unscaled images are taken over the correspondences of odo_init.
+    auto correspondence = ComputeCorrespondence(
+            pinhole_camera_intrinsic_.intrinsic_matrix_, odo_init,
+            source_level.depth_, target_level.depth_, option_);
+    if (correspondence->empty()) {
+        utility::LogWarning("[RGBDOdometryTracker] No correspondence.");
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Identity());
+    }
+    double mean_s, mean_t;
+    std::tie(mean_s, mean_t) = ComputeMeanIntensity(
+            source_level.color_, target_level.color_, *correspondence);
+    SetIntensityScale(source, 0.5 * source.intensity_scale_ / mean_s);
+    SetIntensityScale(target, 0.5 * target.intensity_scale_ / mean_t);
+
+    int num_levels = (int)option_.iteration_number_per_pyramid_level_.size();
+    std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
+            CreateCameraMatrixPyramid(pinhole_camera_intrinsic_, num_levels);
+    Eigen::Matrix4d extrinsic;
+    bool is_success;
+    std::tie(is_success, extrinsic) = ComputeMultiscale(
+            source.pyramid_, source.xyz_pyramid_, target.pyramid_,
+            target.pyramid_dx_, target.pyramid_dy_, pyramid_camera_matrix,
+            odo_init, jacobian_method, option_);
+
+    if (is_success) {
+        Eigen::Matrix6d info_output = CreateInformationMatrix(
+                extrinsic, pinhole_camera_intrinsic_, source_level.depth_,
+                target_level.depth_, *target.xyz_pyramid_[0], option_);
+        return std::make_tuple(true, extrinsic, info_output);
+    } else {
+        return std::make_tuple(false, Eigen::Matrix4d::Identity(),
+                               Eigen::Matrix6d::Identity());
+    }
+}
+
+void RGBDOdometryTracker::PrepareFrame(const geometry::RGBDImage &rgbd,
+                                       Frame &frame) {
+    int num_levels = (int)option_.iteration_number_per_pyramid_level_.size();
+    std::vector<Eigen::Matrix3d> pyramid_camera_matrix =
+            CreateCameraMatrixPyramid(pinhole_camera_intrinsic_, num_levels);
+    PreprocessRGBDImage(rgbd, option_, processed_);
+    processed_.CreatePyramid(num_levels, true, false, frame.pyramid_);
+    geometry::RGBDImage::FilterPyramid(frame.pyramid_,
+                                       geometry::Image::FilterType::Sobel3Dx,
+                                       frame.pyramid_dx_);
+    geometry::RGBDImage::FilterPyramid(frame.pyramid_,
+                                       geometry::Image::FilterType::Sobel3Dy,
+                                       frame.pyramid_dy_);
+    CreateXYZImagePyramid(frame.pyramid_, pyramid_camera_matrix,
+                          frame.xyz_pyramid_);
+    frame.intensity_scale_ = 1.0;
+}
+
+void RGBDOdometryTracker::SetIntensityScale(Frame &frame,
+                                            double intensity_scale) const {
+    // The pyramid and the gradients are linear in the intensities, so they
+    // are rescaled instead of being computed again.
+    double scale = intensity_scale / frame.intensity_scale_;
+    for (size_t level = 0; level < frame.pyramid_.size(); level++) {
+        frame.pyramid_[level]->color_.LinearTransform(scale, 0.0);
+        frame.pyramid_dx_[level]->color_.LinearTransform(scale, 0.0);
+        frame.pyramid_dy_[level]->color_.LinearTransform(scale, 0.0);
+    }
+    frame.intensity_scale_ = intensity_scale;
+}
+
 }  // namespace odometry
 }  // namespace open3d
@@ -32,6 +32,7 @@
 #include <vector>
 
 #include "Open3D/Camera/PinholeCameraIntrinsic.h"
+#include "Open3D/Geometry/RGBDImage.h"
 #include "Open3D/Odometry/OdometryOption.h"
 #include "Open3D/Odometry/RGBDOdometryJacobian.h"
 #include "Open3D/Utility/Console.h"
@@ -39,10 +40,6 @@
 
 namespace open3d {
 
-namespace geometry {
-class RGBDImage;
-}
-
 namespace odometry {
 
 /// \brief Function to estimate 6D rigid motion from two RGBD image pairs.
@@ -64,5 +61,83 @@ std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> ComputeRGBDOdometry(
                 RGBDOdometryJacobianFromHybridTerm(),
         const OdometryOption &option = OdometryOption());
 
+/// \class RGBDOdometryTracker
+///
+/// \brief Estimates the motion between consecutive frames of an RGBD stream.
+///
+/// Gives the same results as ComputeRGBDOdometry on every pair of consecutive
+/// frames, up to rounding. The pyramids, gradients and XYZ images of a frame
+/// are computed once and kept, so that a frame is preprocessed as the target
+/// of one call and reused as the source of the next one. The intensities are
+/// normalized per pair as in ComputeRGBDOdometry, by rescaling the kept
+/// images in place. Only the preprocessing of a frame is saved: the
+/// Gauss-Newton iterations, which take most of the time, depend on the pair.
+class RGBDOdometryTracker {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param pinhole_camera_intrinsic Camera intrinsic parameters.
+    /// \param option Odometry hyper parameteres.
+    RGBDOdometryTracker(const camera::PinholeCameraIntrinsic
+                                &pinhole_camera_intrinsic =
+                                        camera::PinholeCameraIntrinsic(),
+                        const OdometryOption &option = OdometryOption())
+        : pinhole_camera_intrinsic_(pinhole_camera_intrinsic),
+          option_(option) {}
+    ~RGBDOdometryTracker() {}
+
+public:
+    /// \brief Estimates the motion from the previous frame to `frame`, as
+    /// ComputeRGBDOdometry(previous frame, frame) would, and keeps `frame` as
+    /// the previous frame of the next call.
+    ///
+    /// The first frame, and a frame whose size differs from the previous one,
+    /// only start a new sequence and return false. Frames are kept even if
+    /// the estimation fails, so that tracking resumes from them.
+    /// \param frame The RGBD image of the new frame.
+    /// \param odo_init Initial 4x4 motion matrix estimation.
+    /// \param jacobian_method The odometry Jacobian method to use.
+    /// \return is_success, 4x4 motion matrix, 6x6 information matrix.
+    std::tuple<bool, Eigen::Matrix4d, Eigen::Matrix6d> Track(
+            const geometry::RGBDImage &frame,
+            const Eigen::Matrix4d &odo_init = Eigen::Matrix4d::Identity(),
+            const RGBDOdometryJacobian &jacobian_method =
+                    RGBDOdometryJacobianFromHybridTerm());
+
+    /// Forgets the previous frame, the next frame starts a new sequence.
+    void Reset() { has_previous_frame_ = false; }
+
+    /// Returns true if a frame is kept for the next call of Track.
+    bool HasPreviousFrame() const { return has_previous_frame_; }
+
+public:
+    /// Camera intrinsic parameters. Call Reset() after changing them.
+    camera::PinholeCameraIntrinsic pinhole_camera_intrinsic_;
+    /// Odometry hyper parameters. Call Reset() after changing them.
+    OdometryOption option_;
+
+protected:
+    /// Pyramids of a preprocessed frame. The intensities of `pyramid_`,
+    /// `pyramid_dx_` and `pyramid_dy_` are scaled by `intensity_scale_`.
+    struct Frame {
+        geometry::RGBDImagePyramid pyramid_;
+        geometry::RGBDImagePyramid pyramid_dx_;
+        geometry::RGBDImagePyramid pyramid_dy_;
+        geometry::ImagePyramid xyz_pyramid_;
+        double intensity_scale_ = 1.0;
+    };
+
+    /// Preprocesses `rgbd` into `frame`, reusing the images of `frame`.
+    void PrepareFrame(const geometry::RGBDImage &rgbd, Frame &frame);
+    /// Rescales the intensities of `frame` to `intensity_scale`.
+    void SetIntensityScale(Frame &frame, double intensity_scale) const;
+
+    Frame previous_;
+    Frame current_;
+    bool has_previous_frame_ = false;
+    /// Preprocessed level 0 of the current frame.
+    geometry::RGBDImage processed_;
+};
+
 }  // namespace odometry
 }  // namespace open3d
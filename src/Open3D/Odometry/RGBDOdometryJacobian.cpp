@@ -37,6 +37,21 @@ namespace {
 const double SOBEL_SCALE = 0.125;
 const double LAMBDA_HYBRID_DEPTH = 0.968;
 
+/// Returns the value of a single-channel float image at (u, v). Unlike
+/// Image::PointerAt, which is compiled in Image.cpp, this is inlined in the
+/// per-correspondence functions below.
+inline float FloatAt(const geometry::Image &image, int u, int v) {
+    return reinterpret_cast<const float *>(
+            image.data_.data())[v * image.width_ + u];
+}
+
+/// Returns the point of a 3-channel float XYZ image at (u, v).
+inline Eigen::Vector3d PointAt(const geometry::Image &image, int u, int v) {
+    const float *xyz = reinterpret_cast<const float *>(image.data_.data()) +
+                       3 * (v * image.width_ + u);
+    return Eigen::Vector3d(xyz[0], xyz[1], xyz[2]);
+}
+
 }  // unnamed namespace
 
 namespace odometry {
@@ -59,13 +74,11 @@ void RGBDOdometryJacobianFromColorTerm::ComputeJacobianAndResidual(
     int v_s = corresps[row](1);
     int u_t = corresps[row](2);
     int v_t = corresps[row](3);
-    double diff = *target.color_.PointerAt<float>(u_t, v_t) -
-                  *source.color_.PointerAt<float>(u_s, v_s);
-    double dIdx = SOBEL_SCALE * (*target_dx.color_.PointerAt<float>(u_t, v_t));
-    double dIdy = SOBEL_SCALE * (*target_dy.color_.PointerAt<float>(u_t, v_t));
-    Eigen::Vector3d p3d_mat(*source_xyz.PointerAt<float>(u_s, v_s, 0),
-                            *source_xyz.PointerAt<float>(u_s, v_s, 1),
-                            *source_xyz.PointerAt<float>(u_s, v_s, 2));
+    double diff = FloatAt(target.color_, u_t, v_t) -
+                  FloatAt(source.color_, u_s, v_s);
+    double dIdx = SOBEL_SCALE * FloatAt(target_dx.color_, u_t, v_t);
+    double dIdy = SOBEL_SCALE * FloatAt(target_dy.color_, u_t, v_t);
+    Eigen::Vector3d p3d_mat = PointAt(source_xyz, u_s, v_s);
     Eigen::Vector3d p3d_trans = R * p3d_mat + t;
     double invz = 1. / p3d_trans(2);
     double c0 = dIdx * intrinsic(0, 0) * invz;
@@ -108,20 +121,18 @@ void RGBDOdometryJacobianFromHybridTerm::ComputeJacobianAndResidual(
     int v_s = corresps[row](1);
     int u_t = corresps[row](2);
     int v_t = corresps[row](3);
-    double diff_photo = (*target.color_.PointerAt<float>(u_t, v_t) -
-                         *source.color_.PointerAt<float>(u_s, v_s));
-    double dIdx = SOBEL_SCALE * (*target_dx.color_.PointerAt<float>(u_t, v_t));
-    double dIdy = SOBEL_SCALE * (*target_dy.color_.PointerAt<float>(u_t, v_t));
-    double dDdx = SOBEL_SCALE * (*target_dx.depth_.PointerAt<float>(u_t, v_t));
-    double dDdy = SOBEL_SCALE * (*target_dy.depth_.PointerAt<float>(u_t, v_t));
+    double diff_photo = (FloatAt(target.color_, u_t, v_t) -
+                         FloatAt(source.color_, u_s, v_s));
+    double dIdx = SOBEL_SCALE * FloatAt(target_dx.color_, u_t, v_t);
+    double dIdy = SOBEL_SCALE * FloatAt(target_dy.color_, u_t, v_t);
+    double dDdx = SOBEL_SCALE * FloatAt(target_dx.depth_, u_t, v_t);
+    double dDdy = SOBEL_SCALE * FloatAt(target_dy.depth_, u_t, v_t);
     if (std::isnan(dDdx)) dDdx = 0;
     if (std::isnan(dDdy)) dDdy = 0;
-    Eigen::Vector3d p3d_mat(*source_xyz.PointerAt<float>(u_s, v_s, 0),
-                            *source_xyz.PointerAt<float>(u_s, v_s, 1),
-                            *source_xyz.PointerAt<float>(u_s, v_s, 2));
+    Eigen::Vector3d p3d_mat = PointAt(source_xyz, u_s, v_s);
     Eigen::Vector3d p3d_trans = R * p3d_mat + t;
 
-    double diff_geo = *target.depth_.PointerAt<float>(u_t, v_t) - p3d_trans(2);
+    double diff_geo = FloatAt(target.depth_, u_t, v_t) - p3d_trans(2);
     double invz = 1. / p3d_trans(2);
     double c0 = dIdx * fx * invz;
     double c1 = dIdy * fy * invz;
@@ -27,10 +27,9 @@
 #include "Open3D/Registration/ColoredICP.h"
 
 #include <Eigen/Dense>
-#include <iostream>
+#include <cmath>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
-#include "Open3D/Geometry/KDTreeSearchParam.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Eigen.h"
@@ -40,226 +39,385 @@ namespace open3d {
 namespace {
 using namespace registration;
 
-class PointCloudForColoredICP : public geometry::PointCloud {
-public:
-    std::vector<Eigen::Vector3d> color_gradient_;
-};
-
-class TransformationEstimationForColoredICP : public TransformationEstimation {
-public:
-    TransformationEstimationType GetTransformationEstimationType()
-            const override {
-        return type_;
-    };
-    TransformationEstimationForColoredICP(double lambda_geometric = 0.968)
-        : lambda_geometric_(lambda_geometric) {
-        if (lambda_geometric_ < 0 || lambda_geometric_ > 1.0)
-            lambda_geometric_ = 0.968;
-    }
-    ~TransformationEstimationForColoredICP() override {}
-
-public:
-    double ComputeRMSE(const geometry::PointCloud &source,
-                       const geometry::PointCloud &target,
-                       const CorrespondenceSet &corres) const override;
-    Eigen::Matrix4d ComputeTransformation(
-            const geometry::PointCloud &source,
-            const geometry::PointCloud &target,
-            const CorrespondenceSet &corres) const override;
+/// Number of rows of a ColoredICPBlock, two per correspondence.
+const int block_rows = 256;
+/// Number of partial sums a block is reduced into, so that the reductions
+/// vectorize without reordering the additions of a single sum.
+const int block_lanes = 8;
 
-public:
-    double lambda_geometric_;
+double GetIntensity(const Eigen::Vector3d &color) {
+    return (color(0) + color(1) + color(2)) / 3.0;
+}
 
-private:
-    const TransformationEstimationType type_ =
-            TransformationEstimationType::ColoredICP;
+/// Source points of RegistrationColoredICP in single precision, relative to
+/// origin_, with their intensities.
+struct ColoredICPSource {
+    Eigen::Vector3d origin_ = Eigen::Vector3d::Zero();
+    std::vector<float> x_, y_, z_;
+    std::vector<float> intensity_;
 };
 
-std::shared_ptr<PointCloudForColoredICP> InitializePointCloudForColoredICP(
-        const geometry::PointCloud &target,
-        const geometry::KDTreeSearchParamHybrid &search_param) {
-    utility::LogDebug("InitializePointCloudForColoredICP");
-
-    geometry::KDTreeFlann tree;
-    tree.SetGeometry(target);
-
-    auto output = std::make_shared<PointCloudForColoredICP>();
-    output->colors_ = target.colors_;
-    output->normals_ = target.normals_;
-    output->points_ = target.points_;
-
-    size_t n_points = output->points_.size();
-    output->color_gradient_.resize(n_points, Eigen::Vector3d::Zero());
+/// Jacobians, residuals and weights of the geometric and photometric rows of a
+/// batch of correspondences, in structure of arrays form.
+struct ColoredICPBlock {
+    float J_[6][block_rows];
+    float r_[block_rows];
+    float w_[block_rows];
+    int size_ = 0;
+};
 
-    for (size_t k = 0; k < n_points; k++) {
-        const Eigen::Vector3d &vt = output->points_[k];
-        const Eigen::Vector3d &nt = output->normals_[k];
-        double it = (output->colors_[k](0) + output->colors_[k](1) +
-                     output->colors_[k](2)) /
-                    3.0;
+/// Sums over the correspondences found by one pass of RegistrationColoredICP.
+struct ColoredICPPassSums {
+    int count_ = 0;
+    double error2_ = 0.0;
+    Eigen::Matrix6d JTJ_ = Eigen::Matrix6d::Zero();
+    Eigen::Vector6d JTr_ = Eigen::Vector6d::Zero();
+
+    void Add(const ColoredICPPassSums &other) {
+        count_ += other.count_;
+        error2_ += other.error2_;
+        JTJ_ += other.JTJ_;
+        JTr_ += other.JTr_;
+    }
 
-        std::vector<int> point_idx;
-        std::vector<double> point_squared_distance;
+    /// Adds the rows of `block` to the upper triangle of JTJ_ and to JTr_, and
+    /// empties the block.
+    void Accumulate(ColoredICPBlock &block) {
+        int size = (block.size_ + block_lanes - 1) / block_lanes * block_lanes;
+        for (int k = block.size_; k < size; k++) {
+            block.w_[k] = 0.0f;
+            block.r_[k] = 0.0f;
+            for (int a = 0; a < 6; a++) {
+                block.J_[a][k] = 0.0f;
+            }
+        }
+        float wJ[block_rows];
+        for (int a = 0; a < 6; a++) {
+            for (int k = 0; k < size; k++) {
+                wJ[k] = block.w_[k] * block.J_[a][k];
+            }
+            for (int b = a; b < 6; b++) {
+                float sum[block_lanes] = {};
+                for (int k = 0; k < size; k += block_lanes) {
+                    for (int l = 0; l < block_lanes; l++) {
+                        sum[l] += wJ[k + l] * block.J_[b][k + l];
+                    }
+                }
+                for (int l = 0; l < block_lanes; l++) {
+                    JTJ_(a, b) += sum[l];
+                }
+            }
+            float sum[block_lanes] = {};
+            for (int k = 0; k < size; k += block_lanes) {
+                for (int l = 0; l < block_lanes; l++) {
+                    sum[l] += wJ[k + l] * block.r_[k + l];
+                }
+            }
+            for (int l = 0; l < block_lanes; l++) {
+                JTr_(a) += sum[l];
+            }
+        }
+        block.size_ = 0;
+    }
+};
 
-        if (tree.SearchHybrid(vt, search_param.radius_, search_param.max_nn_,
-                              point_idx, point_squared_distance) >= 4) {
-            // approximate image gradient of vt's tangential plane
-            size_t nn = point_idx.size();
-            Eigen::MatrixXd A(nn, 3);
-            Eigen::MatrixXd b(nn, 1);
-            A.setZero();
-            b.setZero();
-            for (size_t i = 1; i < nn; i++) {
-                int P_adj_idx = point_idx[i];
-                Eigen::Vector3d vt_adj = output->points_[P_adj_idx];
-                Eigen::Vector3d vt_proj = vt_adj - (vt_adj - vt).dot(nt) * nt;
-                double it_adj = (output->colors_[P_adj_idx](0) +
-                                 output->colors_[P_adj_idx](1) +
-                                 output->colors_[P_adj_idx](2)) /
-                                3.0;
-                A(i - 1, 0) = (vt_proj(0) - vt(0));
-                A(i - 1, 1) = (vt_proj(1) - vt(1));
-                A(i - 1, 2) = (vt_proj(2) - vt(2));
-                b(i - 1, 0) = (it_adj - it);
+/// Finds the correspondence of every source point under transformation and
+/// accumulates the normal equations of the geometric and photometric residuals
+/// in a single parallel pass. The Jacobians are taken in the local frame of the
+/// target.
+ColoredICPPassSums ComputeColoredICPPass(const ColoredICPSource &source,
+                                         const ColoredICPTarget &target,
+                                         float max_distance2,
+                                         const Eigen::Matrix4d &transformation,
+                                         double lambda_geometric,
+                                         const RobustKernel &kernel,
+                                         std::vector<int> &correspondences) {
+    const ICPTarget &tree = target.icp_target_;
+    const Eigen::Matrix3d R = transformation.block<3, 3>(0, 0);
+    const Eigen::Matrix3f R_local = R.cast<float>();
+    const Eigen::Vector3f t_local =
+            (R * source.origin_ + transformation.block<3, 1>(0, 3) -
+             tree.origin_)
+                    .cast<float>();
+    const float sqrt_lambda_geometric = float(std::sqrt(lambda_geometric));
+    const float sqrt_lambda_photometric =
+            float(std::sqrt(1.0 - lambda_geometric));
+    ColoredICPPassSums sums;
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        ColoredICPPassSums sums_private;
+        ColoredICPBlock block;
+#ifdef _OPENMP
+#pragma omp for schedule(static) nowait
+#endif
+        for (int i = 0; i < (int)source.x_.size(); i++) {
+            Eigen::Vector3f vs =
+                    R_local * Eigen::Vector3f(source.x_[i], source.y_[i],
+                                              source.z_[i]) +
+                    t_local;
+            float distance2 = max_distance2;
+            int j = tree.SearchNearest(vs, distance2);
+            correspondences[i] = j;
+            if (j < 0) {
+                continue;
             }
-            // adds orthogonal constraint
-            A(nn - 1, 0) = (nn - 1) * nt(0);
-            A(nn - 1, 1) = (nn - 1) * nt(1);
-            A(nn - 1, 2) = (nn - 1) * nt(2);
-            b(nn - 1, 0) = 0;
-            // solving linear equation
-            bool is_success;
-            Eigen::MatrixXd x;
-            std::tie(is_success, x) = utility::SolveLinearSystemPSD(
-                    A.transpose() * A, A.transpose() * b);
-            if (is_success) {
-                output->color_gradient_[k] = x;
+            sums_private.count_++;
+            sums_private.error2_ += distance2;
+            const Eigen::Vector3f vt(tree.x_[j], tree.y_[j], tree.z_[j]);
+            const Eigen::Vector3f nt(tree.nx_[j], tree.ny_[j], tree.nz_[j]);
+            const Eigen::Vector3f dit(target.gx_[j], target.gy_[j],
+                                      target.gz_[j]);
+            float d = (vs - vt).dot(nt);
+
+            int k = block.size_;
+            const Eigen::Vector3f vs_x_nt = vs.cross(nt);
+            for (int a = 0; a < 3; a++) {
+                block.J_[a][k] = sqrt_lambda_geometric * vs_x_nt(a);
+                block.J_[a + 3][k] = sqrt_lambda_geometric * nt(a);
+            }
+            block.r_[k] = sqrt_lambda_geometric * d;
+            block.w_[k] = float(kernel.Weight(block.r_[k]));
+
+            // Projects vs into the tangent plane of vt, the gradient of the
+            // intensity along the plane is -M * dit with M = I - nt * nt^T.
+            const Eigen::Vector3f vs_proj = vs - d * nt;
+            float is0_proj = dit.dot(vs_proj - vt) + target.intensity_[j];
+            const Eigen::Vector3f ditM = dit.dot(nt) * nt - dit;
+            const Eigen::Vector3f vs_x_ditM = vs.cross(ditM);
+            k++;
+            for (int a = 0; a < 3; a++) {
+                block.J_[a][k] = sqrt_lambda_photometric * vs_x_ditM(a);
+                block.J_[a + 3][k] = sqrt_lambda_photometric * ditM(a);
+            }
+            block.r_[k] =
+                    sqrt_lambda_photometric * (source.intensity_[i] - is0_proj);
+            block.w_[k] = float(kernel.Weight(block.r_[k]));
+            block.size_ += 2;
+            if (block.size_ == block_rows) {
+                sums_private.Accumulate(block);
             }
         }
+        sums_private.Accumulate(block);
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        sums.Add(sums_private);
+#ifdef _OPENMP
     }
-    return output;
+#endif
+    sums.JTJ_.triangularView<Eigen::StrictlyLower>() =
+            sums.JTJ_.transpose().triangularView<Eigen::StrictlyLower>();
+    return sums;
 }
 
-Eigen::Matrix4d TransformationEstimationForColoredICP::ComputeTransformation(
-        const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
-        const CorrespondenceSet &corres) const {
-    if (corres.empty() || target.HasNormals() == false ||
-        target.HasColors() == false || source.HasColors() == false)
-        return Eigen::Matrix4d::Identity();
-
-    double sqrt_lambda_geometric = sqrt(lambda_geometric_);
-    double lambda_photometric = 1.0 - lambda_geometric_;
-    double sqrt_lambda_photometric = sqrt(lambda_photometric);
-
-    const auto &target_c = (const PointCloudForColoredICP &)target;
-
-    auto compute_jacobian_and_residual =
-            [&](int i,
-                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
-                std::vector<double> &r) {
-                size_t cs = corres[i][0];
-                size_t ct = corres[i][1];
-                const Eigen::Vector3d &vs = source.points_[cs];
-                const Eigen::Vector3d &vt = target.points_[ct];
-                const Eigen::Vector3d &nt = target.normals_[ct];
-
-                J_r.resize(2);
-                r.resize(2);
-
-                J_r[0].block<3, 1>(0, 0) = sqrt_lambda_geometric * vs.cross(nt);
-                J_r[0].block<3, 1>(3, 0) = sqrt_lambda_geometric * nt;
-                r[0] = sqrt_lambda_geometric * (vs - vt).dot(nt);
-
-                // project vs into vt's tangential plane
-                Eigen::Vector3d vs_proj = vs - (vs - vt).dot(nt) * nt;
-                double is = (source.colors_[cs](0) + source.colors_[cs](1) +
-                             source.colors_[cs](2)) /
-                            3.0;
-                double it = (target.colors_[ct](0) + target.colors_[ct](1) +
-                             target.colors_[ct](2)) /
-                            3.0;
-                const Eigen::Vector3d &dit = target_c.color_gradient_[ct];
-                double is0_proj = (dit.dot(vs_proj - vt)) + it;
-
-                const Eigen::Matrix3d M =
-                        (Eigen::Matrix3d() << 1.0 - nt(0) * nt(0),
-                         -nt(0) * nt(1), -nt(0) * nt(2), -nt(0) * nt(1),
-                         1.0 - nt(1) * nt(1), -nt(1) * nt(2), -nt(0) * nt(2),
-                         -nt(1) * nt(2), 1.0 - nt(2) * nt(2))
-                                .finished();
+}  // unnamed namespace
 
-                const Eigen::Vector3d &ditM = -dit.transpose() * M;
-                J_r[1].block<3, 1>(0, 0) =
-                        sqrt_lambda_photometric * vs.cross(ditM);
-                J_r[1].block<3, 1>(3, 0) = sqrt_lambda_photometric * ditM;
-                r[1] = sqrt_lambda_photometric * (is - is0_proj);
-            };
+namespace registration {
 
-    Eigen::Matrix6d JTJ;
-    Eigen::Vector6d JTr;
-    double r2;
-    std::tie(JTJ, JTr, r2) =
-            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
-                    compute_jacobian_and_residual, (int)corres.size());
+ColoredICPTarget::ColoredICPTarget(const geometry::PointCloud &target,
+                                   double gradient_radius,
+                                   int gradient_max_nn /* = 30*/) {
+    SetPointCloud(target, gradient_radius, gradient_max_nn);
+}
 
-    bool is_success;
-    Eigen::Matrix4d extrinsic;
-    std::tie(is_success, extrinsic) =
-            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
+bool ColoredICPTarget::SetPointCloud(const geometry::PointCloud &target,
+                                     double gradient_radius,
+                                     int gradient_max_nn /* = 30*/) {
+    intensity_.clear();
+    gx_.clear();
+    gy_.clear();
+    gz_.clear();
+    if (target.HasPoints() && (!target.HasNormals() || !target.HasColors())) {
+        utility::LogWarning(
+                "[ColoredICPTarget] Target point cloud requires normals and "
+                "colors.");
+        icp_target_ = ICPTarget();
+        return false;
+    }
+    if (!icp_target_.SetPointCloud(target)) {
+        return false;
+    }
 
-    return is_success ? extrinsic : Eigen::Matrix4d::Identity();
+    int num_points = (int)target.points_.size();
+    std::vector<double> intensity(num_points);
+    for (int i = 0; i < num_points; i++) {
+        intensity[i] = GetIntensity(target.colors_[i]);
+    }
+    intensity_.resize(num_points);
+    gx_.resize(num_points);
+    gy_.resize(num_points);
+    gz_.resize(num_points);
+    geometry::KDTreeFlann kdtree(target);
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        std::vector<int> indices;
+        std::vector<double> distance2;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int k = 0; k < num_points; k++) {
+            // The buffers follow the order of the search tree.
+            int i = icp_target_.indices_[k];
+            const Eigen::Vector3d &vt = target.points_[i];
+            const Eigen::Vector3d &nt = target.normals_[i];
+            Eigen::Vector3d gradient = Eigen::Vector3d::Zero();
+            int nn = kdtree.SearchHybrid(vt, gradient_radius, gradient_max_nn,
+                                         indices, distance2);
+            if (nn >= 4) {
+                // Least squares fit of the intensity differences to the
+                // neighbors projected on the tangent plane of vt, the first
+                // neighbor is vt itself. The normal equations are accumulated
+                // directly, with the orthogonality to nt as the last row.
+                Eigen::Matrix3d ATA = Eigen::Matrix3d::Zero();
+                Eigen::Vector3d ATb = Eigen::Vector3d::Zero();
+                for (int m = 1; m < nn; m++) {
+                    const Eigen::Vector3d &vt_adj = target.points_[indices[m]];
+                    Eigen::Vector3d a =
+                            (vt_adj - vt) - (vt_adj - vt).dot(nt) * nt;
+                    ATA.noalias() += a * a.transpose();
+                    ATb += a * (intensity[indices[m]] - intensity[i]);
+                }
+                ATA.noalias() += double(nn - 1) * (nn - 1) * nt *
+                                 nt.transpose();
+                gradient = ATA.ldlt().solve(ATb);
+            }
+            intensity_[k] = float(intensity[i]);
+            gx_[k] = float(gradient(0));
+            gy_[k] = float(gradient(1));
+            gz_[k] = float(gradient(2));
+        }
+#ifdef _OPENMP
+    }
+#endif
+    return true;
 }
 
-double TransformationEstimationForColoredICP::ComputeRMSE(
+RegistrationResult RegistrationColoredICP(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
-        const CorrespondenceSet &corres) const {
-    double sqrt_lambda_geometric = sqrt(lambda_geometric_);
-    double lambda_photometric = 1.0 - lambda_geometric_;
-    double sqrt_lambda_photometric = sqrt(lambda_photometric);
-    const auto &target_c = (const PointCloudForColoredICP &)target;
-
-    double residual = 0.0;
-    for (size_t i = 0; i < corres.size(); i++) {
-        size_t cs = corres[i][0];
-        size_t ct = corres[i][1];
-        const Eigen::Vector3d &vs = source.points_[cs];
-        const Eigen::Vector3d &vt = target.points_[ct];
-        const Eigen::Vector3d &nt = target.normals_[ct];
-        Eigen::Vector3d vs_proj = vs - (vs - vt).dot(nt) * nt;
-        double is = (source.colors_[cs](0) + source.colors_[cs](1) +
-                     source.colors_[cs](2)) /
-                    3.0;
-        double it = (target.colors_[ct](0) + target.colors_[ct](1) +
-                     target.colors_[ct](2)) /
-                    3.0;
-        const Eigen::Vector3d &dit = target_c.color_gradient_[ct];
-        double is0_proj = (dit.dot(vs_proj - vt)) + it;
-        double residual_geometric = sqrt_lambda_geometric * (vs - vt).dot(nt);
-        double residual_photometric = sqrt_lambda_photometric * (is - is0_proj);
-        residual += residual_geometric * residual_geometric +
-                    residual_photometric * residual_photometric;
+        double max_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const ICPConvergenceCriteria &criteria /* = ICPConvergenceCriteria()*/,
+        double lambda_geometric /* = 0.968*/,
+        std::shared_ptr<RobustKernel> kernel
+        /* = std::make_shared<L2Loss>()*/) {
+    if (max_distance <= 0.0) {
+        utility::LogError("Invalid max_correspondence_distance.");
     }
-    return residual;
-};
-
-}  // unnamed namespace
-
-namespace registration {
+    if (!target.HasNormals() || !target.HasColors()) {
+        utility::LogError(
+                "RegistrationColoredICP requires normals and colors of the "
+                "target point cloud.");
+    }
+    ColoredICPTarget target_c(target, max_distance * 2.0, 30);
+    return RegistrationColoredICP(source, target_c, max_distance, init,
+                                  criteria, lambda_geometric,
+                                  std::move(kernel));
+}
 
 RegistrationResult RegistrationColoredICP(
         const geometry::PointCloud &source,
-        const geometry::PointCloud &target,
+        const ColoredICPTarget &target,
         double max_distance,
         const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
         const ICPConvergenceCriteria &criteria /* = ICPConvergenceCriteria()*/,
-        double lambda_geometric /* = 0.968*/) {
-    auto target_c = InitializePointCloudForColoredICP(
-            target, geometry::KDTreeSearchParamHybrid(max_distance * 2.0, 30));
-    return RegistrationICP(
-            source, *target_c, max_distance, init,
-            TransformationEstimationForColoredICP(lambda_geometric), criteria);
+        double lambda_geometric /* = 0.968*/,
+        std::shared_ptr<RobustKernel> kernel
+        /* = std::make_shared<L2Loss>()*/) {
+    if (max_distance <= 0.0) {
+        utility::LogError("Invalid max_correspondence_distance.");
+    }
+    if (!source.HasColors() && source.HasPoints()) {
+        utility::LogError(
+                "RegistrationColoredICP requires colors of the source point "
+                "cloud.");
+    }
+    if (!kernel) {
+        utility::LogError("Invalid robust kernel of the estimation.");
+    }
+    if (lambda_geometric < 0.0 || lambda_geometric > 1.0) {
+        lambda_geometric = 0.968;
+    }
+
+    int num_points = (int)source.points_.size();
+    ColoredICPSource source_local;
+    if (num_points > 0) {
+        source_local.origin_ =
+                0.5 * (source.GetMinBound() + source.GetMaxBound());
+    }
+    source_local.x_.resize(num_points);
+    source_local.y_.resize(num_points);
+    source_local.z_.resize(num_points);
+    source_local.intensity_.resize(num_points);
+    for (int i = 0; i < num_points; i++) {
+        Eigen::Vector3d point = source.points_[i] - source_local.origin_;
+        source_local.x_[i] = float(point(0));
+        source_local.y_[i] = float(point(1));
+        source_local.z_[i] = float(point(2));
+        source_local.intensity_[i] = float(GetIntensity(source.colors_[i]));
+    }
+    float max_distance2 = float(max_distance * max_distance);
+    std::vector<int> correspondences(num_points, -1);
+    const Eigen::Vector3d &origin = target.icp_target_.origin_;
+
+    auto get_result = [&](const Eigen::Matrix4d &transformation,
+                          const ColoredICPPassSums &sums) {
+        RegistrationResult result(transformation);
+        if (sums.count_ > 0) {
+            result.fitness_ = (double)sums.count_ / (double)num_points;
+            result.inlier_rmse_ = std::sqrt(sums.error2_ / sums.count_);
+        }
+        return result;
+    };
+
+    Eigen::Matrix4d transformation = init;
+    ColoredICPPassSums sums = ComputeColoredICPPass(
+            source_local, target, max_distance2, transformation,
+            lambda_geometric, *kernel, correspondences);
+    RegistrationResult result = get_result(transformation, sums);
+    for (int i = 0; i < criteria.max_iteration_; i++) {
+        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
+                          result.fitness_, result.inlier_rmse_);
+        Eigen::Matrix4d update = Eigen::Matrix4d::Identity();
+        if (sums.count_ > 0) {
+            bool is_success;
+            Eigen::Matrix4d extrinsic;
+            std::tie(is_success, extrinsic) =
+                    utility::SolveJacobianSystemAndObtainExtrinsicMatrix(
+                            sums.JTJ_, sums.JTr_);
+            if (is_success) {
+                // The update is estimated in the local frame of the target.
+                update = extrinsic;
+                update.block<3, 1>(0, 3) +=
+                        origin - update.block<3, 3>(0, 0) * origin;
+            }
+        }
+        transformation = update * transformation;
+        RegistrationResult backup = result;
+        sums = ComputeColoredICPPass(source_local, target, max_distance2,
+                                     transformation, lambda_geometric, *kernel,
+                                     correspondences);
+        result = get_result(transformation, sums);
+        if (std::abs(backup.fitness_ - result.fitness_) <
+                    criteria.relative_fitness_ &&
+            std::abs(backup.inlier_rmse_ - result.inlier_rmse_) <
+                    criteria.relative_rmse_) {
+            break;
+        }
+    }
+
+    result.correspondence_set_.reserve(sums.count_);
+    for (int i = 0; i < num_points; i++) {
+        if (correspondences[i] >= 0) {
+            result.correspondence_set_.push_back(Eigen::Vector2i(
+                    i, target.icp_target_.indices_[correspondences[i]]));
+        }
+    }
+    return result;
 }
 
 }  // namespace registration
@@ -27,7 +27,10 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <memory>
+#include <vector>
 
+#include "Open3D/Registration/ICPTarget.h"
 #include "Open3D/Registration/Registration.h"
 
 namespace open3d {
@@ -39,6 +42,49 @@ class PointCloud;
 namespace registration {
 class RegistrationResult;
 
+/// \class ColoredICPTarget
+///
+/// \brief Target point cloud prepared for repeated Colored ICP registration.
+///
+/// Holds the ICPTarget of the point cloud with the intensity and the color
+/// gradient of every point, in the order of its search tree. The gradients are
+/// estimated once, so a ColoredICPTarget can be reused for many sources or
+/// for repeated registrations against the same level of a multi-scale loop.
+class ColoredICPTarget {
+public:
+    /// \brief Default Constructor.
+    ColoredICPTarget() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param target The point cloud to register against, with normals and
+    /// colors.
+    /// \param gradient_radius Radius of the neighborhoods the color gradients
+    /// are estimated on.
+    /// \param gradient_max_nn Maximum number of neighbors of the gradient
+    /// estimation.
+    ColoredICPTarget(const geometry::PointCloud &target,
+                     double gradient_radius,
+                     int gradient_max_nn = 30);
+    ~ColoredICPTarget() {}
+
+public:
+    /// Builds the search tree and estimates the color gradients of the point
+    /// cloud.
+    bool SetPointCloud(const geometry::PointCloud &target,
+                       double gradient_radius,
+                       int gradient_max_nn = 30);
+    /// Returns `true` if the target contains no points.
+    bool IsEmpty() const { return icp_target_.IsEmpty(); }
+
+public:
+    /// Search tree, points and normals of the target.
+    ICPTarget icp_target_;
+    /// Intensity of every point, the mean of its color channels.
+    std::vector<float> intensity_;
+    /// Color gradient of every point on its tangent plane.
+    std::vector<float> gx_, gy_, gz_;
+};
+
 /// \brief Function for Colored ICP registration.
 ///
 /// This is implementation of following paper
@@ -51,14 +97,30 @@ class RegistrationResult;
 /// \param init Initial transformation estimation.
 /// Default value: array([[1., 0., 0., 0.], [0., 1., 0., 0.], [0., 0., 1., 0.],
 /// [0., 0., 0., 1.]]). \param criteria  Convergence criteria. \param
-/// lambda_geometric  lambda_geometric value.
+/// lambda_geometric  lambda_geometric value. \param kernel Robust kernel
+/// weighting the geometric and photometric residuals.
 RegistrationResult RegistrationColoredICP(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
         double max_distance,
         const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
-        double lambda_geometric = 0.968);
+        double lambda_geometric = 0.968,
+        std::shared_ptr<RobustKernel> kernel = std::make_shared<L2Loss>());
+
+/// \brief Function for Colored ICP registration against a prepared target.
+///
+/// Same as above without the preparation of the target, the color gradients
+/// of `target` are used as they were estimated. The normal equations are
+/// accumulated in single precision in the local frame of the target.
+RegistrationResult RegistrationColoredICP(
+        const geometry::PointCloud &source,
+        const ColoredICPTarget &target,
+        double max_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria(),
+        double lambda_geometric = 0.968,
+        std::shared_ptr<RobustKernel> kernel = std::make_shared<L2Loss>());
 
 }  // namespace registration
 }  // namespace open3d
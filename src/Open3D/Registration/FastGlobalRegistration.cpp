@@ -26,9 +26,9 @@
 
 #include "Open3D/Registration/FastGlobalRegistration.h"
 
-#include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/FeatureIndex.h"
 #include "Open3D/Registration/Registration.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Helper.h"
@@ -40,7 +40,8 @@ using namespace registration;
 
 std::vector<std::pair<int, int>> AdvancedMatching(
         const std::vector<geometry::PointCloud>& point_cloud_vec,
-        const std::vector<Feature>& features_vec,
+        const std::vector<const Feature*>& features_vec,
+        const std::vector<const FeatureIndex*>& indices_vec,
         const FastGlobalRegistrationOption& option) {
     // STEP 0) Swap source and target if necessary
     int fi = 0, fj = 1;
@@ -57,27 +58,31 @@ std::vector<std::pair<int, int>> AdvancedMatching(
     // STEP 1) Initial matching
     int nPti = int(point_cloud_vec[fi].points_.size());
     int nPtj = int(point_cloud_vec[fj].points_.size());
-    geometry::KDTreeFlann feature_tree_i(features_vec[fi]);
-    geometry::KDTreeFlann feature_tree_j(features_vec[fj]);
-    std::vector<int> corresK;
-    std::vector<double> dis;
+    // The nearest neighbors are searched in batches, first for every feature
+    // of fj and then for the distinct features of fi that were found.
+    const FeatureIndex& feature_index_i = *indices_vec[fi];
+    const FeatureIndex& feature_index_j = *indices_vec[fj];
     std::vector<std::pair<int, int>> corres;
     std::vector<std::pair<int, int>> corres_ij;
     std::vector<std::pair<int, int>> corres_ji;
     std::vector<int> i_to_j(nPti, -1);
+    std::vector<int> j_to_i = feature_index_i.SearchNearest(*features_vec[fj]);
+    std::vector<int> query_i;
+    std::vector<bool> queried_i(nPti, false);
     for (int j = 0; j < nPtj; j++) {
-        feature_tree_i.SearchKNN(Eigen::VectorXd(features_vec[fj].data_.col(j)),
-                                 1, corresK, dis);
-        int i = corresK[0];
-        if (i_to_j[i] == -1) {
-            feature_tree_j.SearchKNN(
-                    Eigen::VectorXd(features_vec[fi].data_.col(i)), 1, corresK,
-                    dis);
-            int ij = corresK[0];
-            i_to_j[i] = ij;
+        int i = j_to_i[j];
+        if (i < 0) continue;
+        if (!queried_i[i]) {
+            queried_i[i] = true;
+            query_i.push_back(i);
         }
         corres_ji.push_back(std::pair<int, int>(i, j));
     }
+    std::vector<int> nearest_j =
+            feature_index_j.SearchNearest(*features_vec[fi], query_i);
+    for (size_t k = 0; k < query_i.size(); k++) {
+        i_to_j[query_i[k]] = nearest_j[k];
+    }
     for (int i = 0; i < nPti; i++) {
         if (i_to_j[i] != -1)
             corres_ij.push_back(std::pair<int, int>(i, i_to_j[i]));
@@ -340,22 +345,41 @@ RegistrationResult FastGlobalRegistration(
         const Feature& target_feature,
         const FastGlobalRegistrationOption& option /* =
         FastGlobalRegistrationOption()*/) {
+    FeatureIndex source_index(source_feature, 4,
+                              option.maximum_feature_checks_);
+    FeatureIndex target_index(target_feature, 4,
+                              option.maximum_feature_checks_);
+    return FastGlobalRegistration(source, target, source_feature, source_index,
+                                  target_feature, target_index, option);
+}
+
+RegistrationResult FastGlobalRegistration(
+        const geometry::PointCloud& source,
+        const geometry::PointCloud& target,
+        const Feature& source_feature,
+        const FeatureIndex& source_index,
+        const Feature& target_feature,
+        const FeatureIndex& target_index,
+        const FastGlobalRegistrationOption& option /* =
+        FastGlobalRegistrationOption()*/) {
     std::vector<geometry::PointCloud> point_cloud_vec;
     geometry::PointCloud source_orig = source;
     geometry::PointCloud target_orig = target;
     point_cloud_vec.push_back(source);
     point_cloud_vec.push_back(target);
 
-    std::vector<Feature> features_vec;
-    features_vec.push_back(source_feature);
-    features_vec.push_back(target_feature);
+    std::vector<const Feature*> features_vec = {&source_feature,
+                                                &target_feature};
+    std::vector<const FeatureIndex*> indices_vec = {&source_index,
+                                                    &target_index};
 
     double scale_global, scale_start;
     std::vector<Eigen::Vector3d> pcd_mean_vec;
     std::tie(pcd_mean_vec, scale_global, scale_start) =
             NormalizePointCloud(point_cloud_vec, option);
     std::vector<std::pair<int, int>> corres;
-    corres = AdvancedMatching(point_cloud_vec, features_vec, option);
+    corres = AdvancedMatching(point_cloud_vec, features_vec, indices_vec,
+                              option);
     Eigen::Matrix4d transformation;
     transformation = OptimizePairwiseRegistration(point_cloud_vec, corres,
                                                   scale_global, option);
@@ -40,6 +40,7 @@ class PointCloud;
 namespace registration {
 
 class Feature;
+class FeatureIndex;
 class RegistrationResult;
 
 /// \class FastGlobalRegistrationOption
@@ -60,20 +61,24 @@ public:
     /// \param iteration_number Maximum number of iterations.
     /// \param tuple_scale Similarity measure used for tuples of feature points.
     /// \param maximum_tuple_count Maximum numer of tuples.
+    /// \param maximum_feature_checks Maximum number of features compared by
+    /// a feature search, or -1 for exact feature matching.
     FastGlobalRegistrationOption(double division_factor = 1.4,
                                  bool use_absolute_scale = false,
                                  bool decrease_mu = true,
                                  double maximum_correspondence_distance = 0.025,
                                  int iteration_number = 64,
                                  double tuple_scale = 0.95,
-                                 int maximum_tuple_count = 1000)
+                                 int maximum_tuple_count = 1000,
+                                 int maximum_feature_checks = -1)
         : division_factor_(division_factor),
           use_absolute_scale_(use_absolute_scale),
           decrease_mu_(decrease_mu),
           maximum_correspondence_distance_(maximum_correspondence_distance),
           iteration_number_(iteration_number),
           tuple_scale_(tuple_scale),
-          maximum_tuple_count_(maximum_tuple_count) {}
+          maximum_tuple_count_(maximum_tuple_count),
+          maximum_feature_checks_(maximum_feature_checks) {}
     ~FastGlobalRegistrationOption() {}
 
 public:
@@ -94,6 +99,9 @@ public:
     double tuple_scale_;
     /// Maximum number of tuples..
     int maximum_tuple_count_;
+    /// Maximum number of features compared by a feature search, see
+    /// FeatureIndex. -1 matches the features exactly.
+    int maximum_feature_checks_;
 };
 
 RegistrationResult FastGlobalRegistration(
@@ -104,5 +112,21 @@ RegistrationResult FastGlobalRegistration(
         const FastGlobalRegistrationOption &option =
                 FastGlobalRegistrationOption());
 
+/// \brief Fast Global Registration with prebuilt feature indexes.
+///
+/// Same as above, but the nearest feature searches use `source_index` and
+/// `target_index`, so that the indexes of a fragment can be shared by all
+/// the pairs it belongs to. `maximum_feature_checks_` of the option is
+/// ignored in favor of the settings of the indexes.
+RegistrationResult FastGlobalRegistration(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const Feature &source_feature,
+        const FeatureIndex &source_index,
+        const Feature &target_feature,
+        const FeatureIndex &target_index,
+        const FastGlobalRegistrationOption &option =
+                FastGlobalRegistrationOption());
+
 }  // namespace registration
 }  // namespace open3d
@@ -27,6 +27,11 @@
 #include "Open3D/Registration/Feature.h"
 
 #include <Eigen/Dense>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <utility>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
@@ -37,128 +42,485 @@ namespace open3d {
 namespace {
 using namespace registration;
 
-Eigen::Vector4d ComputePairFeatures(const Eigen::Vector3d &p1,
-                                    const Eigen::Vector3d &n1,
-                                    const Eigen::Vector3d &p2,
-                                    const Eigen::Vector3d &n2) {
-    Eigen::Vector4d result;
-    Eigen::Vector3d dp2p1 = p2 - p1;
-    result(3) = dp2p1.norm();
-    if (result(3) == 0.0) {
-        return Eigen::Vector4d::Zero();
-    }
-    auto n1_copy = n1;
-    auto n2_copy = n2;
-    double angle1 = n1_copy.dot(dp2p1) / result(3);
-    double angle2 = n2_copy.dot(dp2p1) / result(3);
-    if (acos(fabs(angle1)) > acos(fabs(angle2))) {
-        n1_copy = n2;
-        n2_copy = n1;
-        dp2p1 *= -1.0;
-        result(2) = -angle2;
-    } else {
-        result(2) = angle1;
-    }
-    auto v = dp2p1.cross(n1_copy);
-    double v_norm = v.norm();
-    if (v_norm == 0.0) {
-        return Eigen::Vector4d::Zero();
-    }
-    v /= v_norm;
-    auto w = n1_copy.cross(v);
-    result(1) = v.dot(n2_copy);
-    result(0) = atan2(w.dot(n2_copy), n1_copy.dot(n2_copy));
-    return result;
-}
+/// Dimension of SPFH and FPFH features, three histograms of 11 bins.
+const int FPFH_DIMENSION = 33;
 
-std::shared_ptr<Feature> ComputeSPFHFeature(
-        const geometry::PointCloud &input,
-        const geometry::KDTreeFlann &kdtree,
-        const geometry::KDTreeSearchParam &search_param) {
-    auto feature = std::make_shared<Feature>();
-    feature->Resize(33, (int)input.points_.size());
+/// Number of points whose FPFH features are computed at a time, which bounds
+/// the number of neighbor lists held.
+const int FPFH_CHUNK_SIZE = 1 << 16;
+
+/// Neighbors of the points points_[0] to points_[Size() - 1], stored one list
+/// after the other. The neighbors of point points_[l] are
+/// indices_[offsets_[l]] to indices_[offsets_[l + 1] - 1], the first of them
+/// is the point itself.
+struct NeighborLists {
+    int Size() const { return (int)points_.size(); }
+
+    std::vector<int> points_;
+    std::vector<size_t> offsets_;
+    std::vector<int> indices_;
+};
+
+/// Searches the neighbors of the given points of input.
+NeighborLists SearchNeighbors(const geometry::KDTreeFlann &kdtree,
+                              const geometry::PointCloud &input,
+                              const geometry::KDTreeSearchParam &search_param,
+                              std::vector<int> points) {
+    const int block_size = 1024;
+    int num_points = (int)points.size();
+    int num_blocks = (num_points + block_size - 1) / block_size;
+    // Every block of points collects its lists separately, the lists are
+    // concatenated once their sizes are known.
+    std::vector<std::vector<int>> block_indices(num_blocks);
+    NeighborLists neighbors;
+    neighbors.points_ = std::move(points);
+    neighbors.offsets_.resize(num_points + 1, 0);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
-        const auto &normal = input.normals_[i];
+    for (int b = 0; b < num_blocks; b++) {
         std::vector<int> indices;
         std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
-            // only compute SPFH feature when a point has neighbors
-            double hist_incr = 100.0 / (double)(indices.size() - 1);
-            for (size_t k = 1; k < indices.size(); k++) {
-                // skip the point itself, compute histogram
-                auto pf = ComputePairFeatures(point, normal,
-                                              input.points_[indices[k]],
-                                              input.normals_[indices[k]]);
-                int h_index = (int)(floor(11 * (pf(0) + M_PI) / (2.0 * M_PI)));
+        int block_end = std::min(num_points, (b + 1) * block_size);
+        for (int l = b * block_size; l < block_end; l++) {
+            int k = kdtree.Search(input.points_[neighbors.points_[l]],
+                                  search_param, indices, distance2);
+            k = std::max(0, std::min(k, (int)indices.size()));
+            neighbors.offsets_[l + 1] = k;
+            block_indices[b].insert(block_indices[b].end(), indices.begin(),
+                                    indices.begin() + k);
+        }
+    }
+    std::partial_sum(neighbors.offsets_.begin(), neighbors.offsets_.end(),
+                     neighbors.offsets_.begin());
+    neighbors.indices_.resize(neighbors.offsets_[num_points]);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int b = 0; b < num_blocks; b++) {
+        std::copy(block_indices[b].begin(), block_indices[b].end(),
+                  neighbors.indices_.begin() +
+                          neighbors.offsets_[b * block_size]);
+        std::vector<int>().swap(block_indices[b]);
+    }
+    return neighbors;
+}
+
+/// Returns the points of input sorted along a Morton curve over its bounding
+/// box, so that the points of a chunk are close to each other and share most
+/// of their neighbors.
+std::vector<int> SortPointsSpatially(const geometry::PointCloud &input) {
+    int num_points = (int)input.points_.size();
+    Eigen::Vector3d min_bound = input.GetMinBound();
+    Eigen::Vector3d extent = input.GetMaxBound() - min_bound;
+    double scale = 1023.0 / std::max(extent.maxCoeff(), 1e-12);
+    std::vector<std::pair<uint32_t, int>> keys(num_points);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_points; i++) {
+        Eigen::Vector3d cell = (input.points_[i] - min_bound) * scale;
+        uint32_t key = 0;
+        for (int b = 9; b >= 0; b--) {
+            for (int a = 0; a < 3; a++) {
+                key = (key << 1) | ((uint32_t(cell(a)) >> b) & 1);
+            }
+        }
+        keys[i] = std::make_pair(key, i);
+    }
+    std::sort(keys.begin(), keys.end());
+    std::vector<int> order(num_points);
+    for (int i = 0; i < num_points; i++) {
+        order[i] = keys[i].second;
+    }
+    return order;
+}
+
+/// Pair features of a point and its neighbors in structure of arrays form.
+/// The neighbors are stored relative to the point.
+template <typename T>
+struct PairFeatureBuffer {
+    void Resize(int n) {
+        for (auto *v : {&dx_, &dy_, &dz_, &nx_, &ny_, &nz_, &f0y_, &f0x_, &f1_,
+                        &f2_}) {
+            v->resize(n);
+        }
+    }
+    std::vector<T> dx_, dy_, dz_, nx_, ny_, nz_;
+    /// f0 is atan2(f0y_, f0x_), the other features are stored directly.
+    std::vector<T> f0y_, f0x_, f1_, f2_;
+};
+
+/// Computes the pair features of a point with normal n1 and its n neighbors
+/// in buffer, see ComputePairFeatures of PCL. The loop is branch free so that
+/// it vectorizes, pairs that have no features get zero features.
+template <typename T>
+void ComputePairFeatures(const Eigen::Matrix<T, 3, 1> &n1,
+                         int n,
+                         PairFeatureBuffer<T> &buffer) {
+    const T *dx = buffer.dx_.data();
+    const T *dy = buffer.dy_.data();
+    const T *dz = buffer.dz_.data();
+    const T *nx = buffer.nx_.data();
+    const T *ny = buffer.ny_.data();
+    const T *nz = buffer.nz_.data();
+    T *f0y = buffer.f0y_.data();
+    T *f0x = buffer.f0x_.data();
+    T *f1 = buffer.f1_.data();
+    T *f2 = buffer.f2_.data();
+    const T n1x = n1(0), n1y = n1(1), n1z = n1(2);
+    for (int k = 0; k < n; k++) {
+        T len = std::sqrt(dx[k] * dx[k] + dy[k] * dy[k] + dz[k] * dz[k]);
+        T angle1 = (n1x * dx[k] + n1y * dy[k] + n1z * dz[k]) / len;
+        T angle2 = (nx[k] * dx[k] + ny[k] * dy[k] + nz[k] * dz[k]) / len;
+        // Same as acos(|angle1|) > acos(|angle2|), which is false for NaN.
+        bool swap = std::abs(angle1) < std::abs(angle2) &&
+                    std::abs(angle2) <= T(1);
+        T sign = swap ? T(-1) : T(1);
+        T ex = sign * dx[k], ey = sign * dy[k], ez = sign * dz[k];
+        T m1x = swap ? nx[k] : n1x, m1y = swap ? ny[k] : n1y,
+          m1z = swap ? nz[k] : n1z;
+        T m2x = swap ? n1x : nx[k], m2y = swap ? n1y : ny[k],
+          m2z = swap ? n1z : nz[k];
+        T vx = ey * m1z - ez * m1y;
+        T vy = ez * m1x - ex * m1z;
+        T vz = ex * m1y - ey * m1x;
+        T v_norm = std::sqrt(vx * vx + vy * vy + vz * vz);
+        vx /= v_norm;
+        vy /= v_norm;
+        vz /= v_norm;
+        T wx = m1y * vz - m1z * vy;
+        T wy = m1z * vx - m1x * vz;
+        T wz = m1x * vy - m1y * vx;
+        bool valid = len > T(0) && v_norm > T(0);
+        f0y[k] = valid ? wx * m2x + wy * m2y + wz * m2z : T(0);
+        f0x[k] = valid ? m1x * m2x + m1y * m2y + m1z * m2z : T(1);
+        f1[k] = valid ? vx * m2x + vy * m2y + vz * m2z : T(0);
+        f2[k] = valid ? (swap ? -angle2 : angle1) : T(0);
+    }
+}
+
+/// Computes the SPFH features of the points in neighbors that are not done
+/// yet into spfh, which holds the features of all points and is zero
+/// initialized, and marks them done.
+template <typename T>
+void ComputeSPFHFeature(const std::vector<Eigen::Matrix<T, 3, 1>> &points,
+                        const std::vector<Eigen::Matrix<T, 3, 1>> &normals,
+                        const NeighborLists &neighbors,
+                        std::vector<T> &spfh,
+                        std::vector<char> &done) {
+    const T pi = T(M_PI);
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        PairFeatureBuffer<T> buffer;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int l = 0; l < neighbors.Size(); l++) {
+            int i = neighbors.points_[l];
+            size_t begin = neighbors.offsets_[l];
+            size_t end = neighbors.offsets_[l + 1];
+            if (done[i]) {
+                continue;
+            }
+            done[i] = 1;
+            // only compute SPFH feature when a point has neighbors, skip the
+            // point itself
+            if (end - begin <= 1) {
+                continue;
+            }
+            int n = int(end - begin - 1);
+            buffer.Resize(n);
+            const Eigen::Matrix<T, 3, 1> &point = points[i];
+            for (int k = 0; k < n; k++) {
+                int j = neighbors.indices_[begin + 1 + k];
+                buffer.dx_[k] = points[j](0) - point(0);
+                buffer.dy_[k] = points[j](1) - point(1);
+                buffer.dz_[k] = points[j](2) - point(2);
+                buffer.nx_[k] = normals[j](0);
+                buffer.ny_[k] = normals[j](1);
+                buffer.nz_[k] = normals[j](2);
+            }
+            ComputePairFeatures(normals[i], n, buffer);
+            T hist_incr = T(100) / T(n);
+            T *histogram = &spfh[size_t(i) * FPFH_DIMENSION];
+            for (int k = 0; k < n; k++) {
+                T f0 = std::atan2(buffer.f0y_[k], buffer.f0x_[k]);
+                int h_index = (int)(std::floor(11 * (f0 + pi) / (2 * pi)));
                 if (h_index < 0) h_index = 0;
                 if (h_index >= 11) h_index = 10;
-                feature->data_(h_index, i) += hist_incr;
-                h_index = (int)(floor(11 * (pf(1) + 1.0) * 0.5));
+                histogram[h_index] += hist_incr;
+                h_index = (int)(std::floor(11 * (buffer.f1_[k] + 1) * T(0.5)));
                 if (h_index < 0) h_index = 0;
                 if (h_index >= 11) h_index = 10;
-                feature->data_(h_index + 11, i) += hist_incr;
-                h_index = (int)(floor(11 * (pf(2) + 1.0) * 0.5));
+                histogram[h_index + 11] += hist_incr;
+                h_index = (int)(std::floor(11 * (buffer.f2_[k] + 1) * T(0.5)));
                 if (h_index < 0) h_index = 0;
                 if (h_index >= 11) h_index = 10;
-                feature->data_(h_index + 22, i) += hist_incr;
+                histogram[h_index + 22] += hist_incr;
             }
         }
+#ifdef _OPENMP
     }
-    return feature;
+#endif
+}
+
+/// Combines the SPFH features of the neighbors of every point in neighbors
+/// into its FPFH feature, which is handed to store(i, histogram).
+template <typename T, typename StoreFunction>
+void ComputeFPFHFeature(const std::vector<Eigen::Matrix<T, 3, 1>> &points,
+                        const NeighborLists &neighbors,
+                        const std::vector<T> &spfh,
+                        StoreFunction store) {
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int l = 0; l < neighbors.Size(); l++) {
+        int i = neighbors.points_[l];
+        T histogram[FPFH_DIMENSION] = {};
+        size_t begin = neighbors.offsets_[l];
+        size_t end = neighbors.offsets_[l + 1];
+        if (end - begin > 1) {
+            for (size_t k = begin + 1; k < end; k++) {
+                // skip the point itself
+                int j = neighbors.indices_[k];
+                T dist = (points[j] - points[i]).squaredNorm();
+                if (dist == T(0)) continue;
+                const T *spfh_j = &spfh[size_t(j) * FPFH_DIMENSION];
+                for (int d = 0; d < FPFH_DIMENSION; d++) {
+                    histogram[d] += spfh_j[d] / dist;
+                }
+            }
+            T sum[3] = {T(0), T(0), T(0)};
+            for (int d = 0; d < FPFH_DIMENSION; d++) {
+                sum[d / 11] += histogram[d];
+            }
+            for (int t = 0; t < 3; t++) {
+                if (sum[t] != T(0)) sum[t] = T(100) / sum[t];
+            }
+            const T *spfh_i = &spfh[size_t(i) * FPFH_DIMENSION];
+            for (int d = 0; d < FPFH_DIMENSION; d++) {
+                // The commented line is the fpfh function in the paper.
+                // But according to PCL implementation, it is skipped.
+                // Our initial test shows that the full fpfh function in the
+                // paper seems to be better than PCL implementation. Further
+                // test required.
+                histogram[d] = histogram[d] * sum[d / 11] + spfh_i[d];
+            }
+        }
+        store(i, histogram);
+    }
+}
+
+/// Computes the FPFH features of input from points and normals, which are
+/// input converted to T, and hands them to store(i, histogram).
+///
+/// The points are processed in spatially sorted chunks. The neighbors of a
+/// chunk are searched once and serve both passes, the neighbors of the
+/// points that are not done yet are searched as well for their SPFH
+/// features. Every point is searched once for its own chunk, plus at most
+/// once as the neighbor of an earlier chunk.
+template <typename T, typename StoreFunction>
+void ComputeFPFHFeatureInChunks(
+        const geometry::PointCloud &input,
+        const std::vector<Eigen::Matrix<T, 3, 1>> &points,
+        const std::vector<Eigen::Matrix<T, 3, 1>> &normals,
+        const geometry::KDTreeSearchParam &search_param,
+        StoreFunction store) {
+    int num_points = (int)input.points_.size();
+    std::vector<int> order;
+    if (num_points > FPFH_CHUNK_SIZE) {
+        order = SortPointsSpatially(input);
+    } else {
+        order.resize(num_points);
+        std::iota(order.begin(), order.end(), 0);
+    }
+    geometry::KDTreeFlann kdtree(input);
+    std::vector<T> spfh(size_t(num_points) * FPFH_DIMENSION, T(0));
+    std::vector<char> done(num_points, 0);
+    // First point of the last chunk that searched a point, so that a chunk
+    // searches every point once.
+    std::vector<int> chunk_of(num_points, -1);
+    for (int begin = 0; begin < num_points; begin += FPFH_CHUNK_SIZE) {
+        int end = std::min(num_points, begin + FPFH_CHUNK_SIZE);
+        for (int l = begin; l < end; l++) {
+            chunk_of[order[l]] = begin;
+        }
+        NeighborLists neighbors = SearchNeighbors(
+                kdtree, input, search_param,
+                std::vector<int>(order.begin() + begin, order.begin() + end));
+        std::vector<int> outer_points;
+        for (int j : neighbors.indices_) {
+            if (!done[j] && chunk_of[j] != begin) {
+                chunk_of[j] = begin;
+                outer_points.push_back(j);
+            }
+        }
+        ComputeSPFHFeature(points, normals, neighbors, spfh, done);
+        if (!outer_points.empty()) {
+            NeighborLists outer_neighbors = SearchNeighbors(
+                    kdtree, input, search_param, std::move(outer_points));
+            ComputeSPFHFeature(points, normals, outer_neighbors, spfh, done);
+        }
+        ComputeFPFHFeature(points, neighbors, spfh, store);
+    }
+}
+
+/// Converts to IEEE 754 half precision, rounding to nearest even.
+uint16_t FloatToHalf(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    uint32_t sign = (bits >> 16) & 0x8000;
+    uint32_t abs_bits = bits & 0x7fffffff;
+    if (abs_bits >= 0x7f800000) {
+        // infinity or NaN
+        return uint16_t(sign | 0x7c00 | (abs_bits > 0x7f800000 ? 0x200 : 0));
+    }
+    if (abs_bits >= 0x477ff000) {
+        // rounds to infinity
+        return uint16_t(sign | 0x7c00);
+    }
+    if (abs_bits < 0x38800000) {
+        // subnormal, in units of 2^-24
+        float units = std::nearbyint(std::abs(value) * 16777216.0f);
+        return uint16_t(sign | uint32_t(units));
+    }
+    uint32_t half = ((abs_bits >> 23) - 112) << 10 | ((abs_bits >> 13) & 0x3ff);
+    uint32_t rest = abs_bits & 0x1fff;
+    if (rest > 0x1000 || (rest == 0x1000 && (half & 1))) {
+        half++;
+    }
+    return uint16_t(sign | half);
+}
+
+float HalfToFloat(uint16_t half) {
+    uint32_t sign = uint32_t(half & 0x8000) << 16;
+    uint32_t exponent = (half >> 10) & 0x1f;
+    uint32_t mantissa = half & 0x3ff;
+    if (exponent == 0) {
+        float value = std::ldexp(float(mantissa), -24);
+        return sign ? -value : value;
+    }
+    uint32_t bits = sign | (mantissa << 13);
+    if (exponent == 0x1f) {
+        bits |= 0x7f800000;
+    } else {
+        bits |= (exponent + 112) << 23;
+    }
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
 }
 
 }  // unnamed namespace
 
 namespace registration {
+
+void CompactFeature::Resize(int dim,
+                            int n,
+                            Precision precision /* = Precision::Float32*/) {
+    precision_ = precision;
+    dimension_ = dim;
+    num_ = n;
+    size_t size = size_t(dim) * size_t(n);
+    if (precision_ == Precision::Float16) {
+        data_float16_.assign(size, 0);
+        std::vector<float>().swap(data_float32_);
+    } else {
+        data_float32_.assign(size, 0.0f);
+        std::vector<uint16_t>().swap(data_float16_);
+    }
+}
+
+float CompactFeature::GetValue(int row, int col) const {
+    size_t index = size_t(col) * dimension_ + row;
+    if (precision_ == Precision::Float16) {
+        return HalfToFloat(data_float16_[index]);
+    }
+    return data_float32_[index];
+}
+
+void CompactFeature::SetFeature(int col, const float *values) {
+    size_t offset = size_t(col) * dimension_;
+    if (precision_ == Precision::Float16) {
+        for (int d = 0; d < dimension_; d++) {
+            data_float16_[offset + d] = FloatToHalf(values[d]);
+        }
+    } else {
+        std::copy(values, values + dimension_,
+                  data_float32_.begin() + offset);
+    }
+}
+
+std::shared_ptr<Feature> CompactFeature::ToFeature() const {
+    auto feature = std::make_shared<Feature>();
+    feature->Resize(dimension_, num_);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < num_; i++) {
+        for (int d = 0; d < dimension_; d++) {
+            feature->data_(d, i) = GetValue(d, i);
+        }
+    }
+    return feature;
+}
+
 std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::PointCloud &input,
         const geometry::KDTreeSearchParam
                 &search_param /* = geometry::KDTreeSearchParamKNN()*/) {
     auto feature = std::make_shared<Feature>();
-    feature->Resize(33, (int)input.points_.size());
+    feature->Resize(FPFH_DIMENSION, (int)input.points_.size());
     if (input.HasNormals() == false) {
         utility::LogError(
                 "[ComputeFPFHFeature] Failed because input point cloud has no "
                 "normal.");
     }
-    geometry::KDTreeFlann kdtree(input);
-    auto spfh = ComputeSPFHFeature(input, kdtree, search_param);
+    ComputeFPFHFeatureInChunks(input, input.points_, input.normals_,
+                               search_param,
+                               [&](int i, const double *histogram) {
+                                   std::copy(histogram,
+                                             histogram + FPFH_DIMENSION,
+                                             feature->data_.col(i).data());
+                               });
+    return feature;
+}
+
+std::shared_ptr<CompactFeature> ComputeFPFHFeatureCompact(
+        const geometry::PointCloud &input,
+        const geometry::KDTreeSearchParam
+                &search_param /* = geometry::KDTreeSearchParamKNN()*/,
+        CompactFeature::Precision precision
+        /* = CompactFeature::Precision::Float32*/) {
+    auto feature = std::make_shared<CompactFeature>();
+    feature->Resize(FPFH_DIMENSION, (int)input.points_.size(), precision);
+    if (input.HasNormals() == false) {
+        utility::LogError(
+                "[ComputeFPFHFeatureCompact] Failed because input point cloud "
+                "has no normal.");
+    }
+    // Single precision points, relative to the center of the point cloud.
+    int num_points = (int)input.points_.size();
+    Eigen::Vector3d center = Eigen::Vector3d::Zero();
+    if (num_points > 0) {
+        center = 0.5 * (input.GetMinBound() + input.GetMaxBound());
+    }
+    std::vector<Eigen::Vector3f> points(num_points);
+    std::vector<Eigen::Vector3f> normals(num_points);
 #ifdef _OPENMP
 #pragma omp parallel for schedule(static)
 #endif
-    for (int i = 0; i < (int)input.points_.size(); i++) {
-        const auto &point = input.points_[i];
-        std::vector<int> indices;
-        std::vector<double> distance2;
-        if (kdtree.Search(point, search_param, indices, distance2) > 1) {
-            double sum[3] = {0.0, 0.0, 0.0};
-            for (size_t k = 1; k < indices.size(); k++) {
-                // skip the point itself
-                double dist = distance2[k];
-                if (dist == 0.0) continue;
-                for (int j = 0; j < 33; j++) {
-                    double val = spfh->data_(j, indices[k]) / dist;
-                    sum[j / 11] += val;
-                    feature->data_(j, i) += val;
-                }
-            }
-            for (int j = 0; j < 3; j++)
-                if (sum[j] != 0.0) sum[j] = 100.0 / sum[j];
-            for (int j = 0; j < 33; j++) {
-                feature->data_(j, i) *= sum[j / 11];
-                // The commented line is the fpfh function in the paper.
-                // But according to PCL implementation, it is skipped.
-                // Our initial test shows that the full fpfh function in the
-                // paper seems to be better than PCL implementation. Further
-                // test required.
-                feature->data_(j, i) += spfh->data_(j, i);
-            }
-        }
+    for (int i = 0; i < num_points; i++) {
+        points[i] = (input.points_[i] - center).cast<float>();
+        normals[i] = input.normals_[i].cast<float>();
     }
+    ComputeFPFHFeatureInChunks(input, points, normals, search_param,
+                               [&](int i, const float *histogram) {
+                                   feature->SetFeature(i, histogram);
+                               });
     return feature;
 }
 
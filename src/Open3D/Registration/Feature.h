@@ -27,6 +27,7 @@
 #pragma once
 
 #include <Eigen/Core>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -63,8 +64,61 @@ public:
     Eigen::MatrixXd data_;
 };
 
+/// \class CompactFeature
+///
+/// \brief Class to store features in single or half precision.
+///
+/// The features of a point are stored next to each other, point after point,
+/// in one contiguous buffer. Compared to Feature, single precision halves and
+/// half precision quarters the memory of the features.
+class CompactFeature {
+public:
+    /// Precision of the stored features.
+    enum class Precision {
+        /// IEEE 754 single precision.
+        Float32 = 0,
+        /// IEEE 754 half precision.
+        Float16 = 1,
+    };
+
+public:
+    /// Resize feature data buffer to `dim x n` and set it to zero.
+    ///
+    /// \param dim Feature dimension per point.
+    /// \param n Number of points.
+    /// \param precision Precision of the stored features.
+    void Resize(int dim, int n, Precision precision = Precision::Float32);
+    /// Returns feature dimensions per point.
+    size_t Dimension() const { return dimension_; }
+    /// Returns number of points.
+    size_t Num() const { return num_; }
+    /// Returns the \p row-th value of the feature of point \p col.
+    float GetValue(int row, int col) const;
+    /// Stores the feature of point \p col, \p values holds Dimension()
+    /// values.
+    void SetFeature(int col, const float *values);
+    /// Returns the features in double precision.
+    std::shared_ptr<Feature> ToFeature() const;
+
+public:
+    /// Precision of the stored features.
+    Precision precision_ = Precision::Float32;
+    /// Feature dimension per point.
+    int dimension_ = 0;
+    /// Number of points.
+    int num_ = 0;
+    /// Features in single precision, used if precision_ is Float32.
+    std::vector<float> data_float32_;
+    /// Bits of the features in half precision, used if precision_ is Float16.
+    std::vector<uint16_t> data_float16_;
+};
+
 /// Function to compute FPFH feature for a point cloud.
 ///
+/// The points are processed in spatially sorted chunks of 65536 points. The
+/// neighbors of a chunk are searched once and reused by the SPFH and the FPFH
+/// pass, only the lists of one chunk are held at a time.
+///
 /// \param input The Input point cloud.
 /// \param search_param KDTree KNN search parameter.
 std::shared_ptr<Feature> ComputeFPFHFeature(
@@ -72,5 +126,21 @@ std::shared_ptr<Feature> ComputeFPFHFeature(
         const geometry::KDTreeSearchParam &search_param =
                 geometry::KDTreeSearchParamKNN());
 
+/// Function to compute FPFH feature for a point cloud in reduced precision.
+///
+/// Points, normals and the intermediate SPFH histograms are processed in
+/// single precision, the resulting histograms are stored with \p precision.
+/// The neighbors are searched in chunks as in ComputeFPFHFeature.
+///
+/// \param input The Input point cloud.
+/// \param search_param KDTree KNN search parameter.
+/// \param precision Precision of the stored features.
+std::shared_ptr<CompactFeature> ComputeFPFHFeatureCompact(
+        const geometry::PointCloud &input,
+        const geometry::KDTreeSearchParam &search_param =
+                geometry::KDTreeSearchParamKNN(),
+        CompactFeature::Precision precision =
+                CompactFeature::Precision::Float32);
+
 }  // namespace registration
 }  // namespace open3d
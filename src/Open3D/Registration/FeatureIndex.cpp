@@ -0,0 +1,461 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "Open3D/Registration/FeatureIndex.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace registration {
+
+namespace {
+
+/// Maximum number of features in a leaf of the search trees.
+const int leaf_size = 16;
+
+/// Number of features sampled to estimate the spread of a node.
+const int sample_size = 64;
+
+/// Number of dimensions of largest spread a randomized tree splits along.
+const int random_dims = 5;
+
+float ComputeDistance2(const float *a, const float *b, int dimension) {
+    float distance2 = 0.0f;
+    for (int d = 0; d < dimension; d++) {
+        float diff = a[d] - b[d];
+        distance2 += diff * diff;
+    }
+    return distance2;
+}
+
+}  // unnamed namespace
+
+/// Per thread state of the searches. The results are positions in `data_`,
+/// written to the output arrays of the query.
+struct FeatureIndex::SearchBuffer {
+    /// Branch not taken during a descent, with a lower bound of its distance.
+    struct Branch {
+        float min_distance2_;
+        int tree_;
+        int node_;
+    };
+
+    /// Order of the min-heap of branches.
+    static bool Farther(const Branch &a, const Branch &b) {
+        return a.min_distance2_ > b.min_distance2_;
+    }
+
+    /// Returns the distance a feature has to beat to enter the results.
+    float WorstDistance2() const {
+        return count_ < knn_ ? std::numeric_limits<float>::infinity()
+                             : distance2_[knn_ - 1];
+    }
+
+    /// Inserts a feature into the sorted results.
+    void Add(int position, float distance2) {
+        if (count_ == knn_ && distance2 >= distance2_[knn_ - 1]) {
+            return;
+        }
+        int k = count_ < knn_ ? count_++ : knn_ - 1;
+        while (k > 0 && distance2_[k - 1] > distance2) {
+            distance2_[k] = distance2_[k - 1];
+            indices_[k] = indices_[k - 1];
+            k--;
+        }
+        distance2_[k] = distance2;
+        indices_[k] = position;
+    }
+
+    std::vector<float> query_;
+    /// Distance of the query to the box of the visited node, per dimension.
+    std::vector<float> offset_;
+    int knn_ = 0;
+    int count_ = 0;
+    int *indices_ = nullptr;
+    float *distance2_ = nullptr;
+    /// Min-heap of the branches not taken.
+    std::vector<Branch> branches_;
+    /// Search in which a feature was last compared, features are compared
+    /// only once even if several trees lead to them.
+    std::vector<int> visited_;
+    int stamp_ = 0;
+    int checks_ = 0;
+};
+
+FeatureIndex::FeatureIndex(const Feature &feature,
+                           int num_trees /* = 4*/,
+                           int max_checks /* = -1*/)
+    : num_trees_(num_trees), max_checks_(max_checks) {
+    SetFeature(feature);
+}
+
+bool FeatureIndex::SetFeature(const Feature &feature) {
+    std::vector<float> data(feature.data_.size());
+    const double *values = feature.data_.data();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)data.size(); i++) {
+        data[i] = float(values[i]);
+    }
+    return SetRawData(std::move(data), feature.Dimension());
+}
+
+bool FeatureIndex::SetFeature(const CompactFeature &feature) {
+    if (feature.precision_ == CompactFeature::Precision::Float32) {
+        std::vector<float> data = feature.data_float32_;
+        return SetRawData(std::move(data), feature.Dimension());
+    }
+    int dimension = (int)feature.Dimension();
+    std::vector<float> data(feature.data_float16_.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int i = 0; i < (int)feature.Num(); i++) {
+        for (int d = 0; d < dimension; d++) {
+            data[size_t(i) * dimension + d] = feature.GetValue(d, i);
+        }
+    }
+    return SetRawData(std::move(data), feature.Dimension());
+}
+
+int FeatureIndex::SearchKNN(const Feature &query,
+                            int knn,
+                            std::vector<int> &indices,
+                            std::vector<float> &distance2) const {
+    std::vector<int> columns(query.Num());
+    std::iota(columns.begin(), columns.end(), 0);
+    SearchColumns(query, columns, knn, indices, distance2);
+    return (int)columns.size();
+}
+
+std::vector<int> FeatureIndex::SearchNearest(
+        const Feature &query, const std::vector<int> &columns) const {
+    std::vector<int> indices;
+    std::vector<float> distance2;
+    SearchColumns(query, columns, 1, indices, distance2);
+    return indices;
+}
+
+std::vector<int> FeatureIndex::SearchNearest(const Feature &query) const {
+    std::vector<int> indices;
+    std::vector<float> distance2;
+    SearchKNN(query, 1, indices, distance2);
+    return indices;
+}
+
+bool FeatureIndex::SetRawData(std::vector<float> &&data, size_t dimension) {
+    trees_.clear();
+    indices_.clear();
+    data_.clear();
+    dimension_ = dimension;
+    dataset_size_ = dimension == 0 ? 0 : data.size() / dimension;
+    if (dimension_ == 0 || dataset_size_ == 0) {
+        utility::LogWarning(
+                "[FeatureIndex::SetRawData] Failed due to no data.");
+        return false;
+    }
+    int num_points = (int)dataset_size_;
+    int num_trees = max_checks_ < 0 ? 1 : std::max(num_trees_, 1);
+    trees_.resize(num_trees);
+    for (auto &tree : trees_) {
+        tree.order_.resize(num_points);
+        std::iota(tree.order_.begin(), tree.order_.end(), 0);
+        tree.nodes_.reserve(4 * (num_points / leaf_size + 1));
+    }
+    data_ = std::move(data);
+
+    // The features are stored in the order of the first tree, so that its
+    // leaves are contiguous in memory.
+    std::mt19937 engine(0);
+    BuildNode(trees_[0], 0, num_points, num_trees > 1, engine);
+    std::vector<float> sorted_data(data_.size());
+    for (int k = 0; k < num_points; k++) {
+        std::copy_n(data_.begin() + size_t(trees_[0].order_[k]) * dimension_,
+                    dimension_, sorted_data.begin() + size_t(k) * dimension_);
+    }
+    data_ = std::move(sorted_data);
+    indices_ = trees_[0].order_;
+    std::iota(trees_[0].order_.begin(), trees_[0].order_.end(), 0);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int t = 1; t < num_trees; t++) {
+        std::mt19937 tree_engine(t);
+        BuildNode(trees_[t], 0, num_points, true, tree_engine);
+    }
+    return true;
+}
+
+int FeatureIndex::BuildNode(Tree &tree,
+                            int begin,
+                            int end,
+                            bool randomized,
+                            std::mt19937 &engine) const {
+    int node = (int)tree.nodes_.size();
+    tree.nodes_.push_back(Node{0.0f, -1, -1, begin, end});
+    if (end - begin <= leaf_size) {
+        return node;
+    }
+
+    // Estimate the variance of every dimension from a sample of the features,
+    // and split at the median of one of the dimensions of largest variance.
+    int dimension = (int)dimension_;
+    int step = std::max(1, (end - begin) / sample_size);
+    std::vector<double> sum(dimension, 0.0), sum2(dimension, 0.0);
+    int count = 0;
+    for (int k = begin; k < end; k += step) {
+        const float *values = &data_[size_t(tree.order_[k]) * dimension_];
+        for (int d = 0; d < dimension; d++) {
+            sum[d] += values[d];
+            sum2[d] += double(values[d]) * values[d];
+        }
+        count++;
+    }
+    std::vector<double> variance(dimension);
+    for (int d = 0; d < dimension; d++) {
+        variance[d] = sum2[d] / count - (sum[d] / count) * (sum[d] / count);
+    }
+    int num_candidates = randomized ? std::min(random_dims, dimension) : 1;
+    std::vector<int> dims(dimension);
+    std::iota(dims.begin(), dims.end(), 0);
+    std::partial_sort(dims.begin(), dims.begin() + num_candidates, dims.end(),
+                      [&](int a, int b) { return variance[a] > variance[b]; });
+    int dim = dims[std::uniform_int_distribution<int>(0, num_candidates - 1)(
+            engine)];
+
+    int middle = begin + (end - begin) / 2;
+    std::nth_element(tree.order_.begin() + begin, tree.order_.begin() + middle,
+                     tree.order_.begin() + end, [&](int a, int b) {
+                         return data_[size_t(a) * dimension_ + dim] <
+                                data_[size_t(b) * dimension_ + dim];
+                     });
+    tree.nodes_[node].split_ =
+            data_[size_t(tree.order_[middle]) * dimension_ + dim];
+    tree.nodes_[node].dim_ = dim;
+    BuildNode(tree, begin, middle, randomized, engine);
+    int right = BuildNode(tree, middle, end, randomized, engine);
+    tree.nodes_[node].right_ = right;
+    return node;
+}
+
+void FeatureIndex::SearchColumns(const Feature &query,
+                                 const std::vector<int> &columns,
+                                 int knn,
+                                 std::vector<int> &indices,
+                                 std::vector<float> &distance2) const {
+    int num_queries = (int)columns.size();
+    indices.assign(size_t(num_queries) * std::max(knn, 0), -1);
+    distance2.assign(indices.size(), std::numeric_limits<float>::infinity());
+    if (trees_.empty() || knn <= 0 || query.Dimension() != dimension_) {
+        if (num_queries > 0) {
+            utility::LogWarning(
+                    "[FeatureIndex::SearchKNN] Failed due to no data or "
+                    "dimension mismatch.");
+        }
+        return;
+    }
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        SearchBuffer buffer;
+        buffer.query_.resize(dimension_);
+        buffer.offset_.assign(dimension_, 0.0f);
+        if (max_checks_ >= 0) {
+            buffer.visited_.assign(dataset_size_, -1);
+        }
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (int i = 0; i < num_queries; i++) {
+            const double *values = query.data_.col(columns[i]).data();
+            for (size_t d = 0; d < dimension_; d++) {
+                buffer.query_[d] = float(values[d]);
+            }
+            buffer.knn_ = knn;
+            buffer.count_ = 0;
+            buffer.indices_ = &indices[size_t(i) * knn];
+            buffer.distance2_ = &distance2[size_t(i) * knn];
+            if (max_checks_ < 0) {
+                SearchExact(0, 0.0f, buffer);
+            } else {
+                SearchApproximate(buffer);
+            }
+            for (int k = 0; k < buffer.count_; k++) {
+                buffer.indices_[k] = indices_[buffer.indices_[k]];
+            }
+        }
+#ifdef _OPENMP
+    }
+#endif
+}
+
+void FeatureIndex::SearchExact(int node,
+                               float min_distance2,
+                               SearchBuffer &buffer) const {
+    const Node &n = trees_[0].nodes_[node];
+    if (n.dim_ < 0) {
+        // The first tree stores its leaves contiguously.
+        for (int k = n.begin_; k < n.end_; k++) {
+            buffer.Add(k, ComputeDistance2(&data_[size_t(k) * dimension_],
+                                           buffer.query_.data(),
+                                           (int)dimension_));
+        }
+        return;
+    }
+
+    // Visit the side of the query first. The other side is only visited if
+    // its box, whose distance is tracked per dimension in offset_, is closer
+    // than the results found so far.
+    float diff = buffer.query_[n.dim_] - n.split_;
+    int near_child = diff < 0.0f ? node + 1 : n.right_;
+    int far_child = diff < 0.0f ? n.right_ : node + 1;
+    SearchExact(near_child, min_distance2, buffer);
+    float old_offset = buffer.offset_[n.dim_];
+    float far_distance2 =
+            min_distance2 + diff * diff - old_offset * old_offset;
+    if (far_distance2 < buffer.WorstDistance2()) {
+        buffer.offset_[n.dim_] = diff;
+        SearchExact(far_child, far_distance2, buffer);
+        buffer.offset_[n.dim_] = old_offset;
+    }
+}
+
+void FeatureIndex::SearchApproximate(SearchBuffer &buffer) const {
+    buffer.stamp_++;
+    buffer.checks_ = 0;
+    buffer.branches_.clear();
+    for (int t = 0; t < (int)trees_.size(); t++) {
+        DescendTree(t, 0, 0.0f, buffer);
+    }
+    // Best bin first: continue with the closest branch not taken until the
+    // number of checks is used up.
+    while (!buffer.branches_.empty()) {
+        std::pop_heap(buffer.branches_.begin(), buffer.branches_.end(),
+                      SearchBuffer::Farther);
+        SearchBuffer::Branch branch = buffer.branches_.back();
+        buffer.branches_.pop_back();
+        if ((buffer.checks_ >= max_checks_ && buffer.count_ == buffer.knn_) ||
+            branch.min_distance2_ >= buffer.WorstDistance2()) {
+            break;
+        }
+        DescendTree(branch.tree_, branch.node_, branch.min_distance2_, buffer);
+    }
+}
+
+void FeatureIndex::DescendTree(int tree,
+                               int node,
+                               float min_distance2,
+                               SearchBuffer &buffer) const {
+    const Tree &t = trees_[tree];
+    while (t.nodes_[node].dim_ >= 0) {
+        const Node &n = t.nodes_[node];
+        float diff = buffer.query_[n.dim_] - n.split_;
+        int near_child = diff < 0.0f ? node + 1 : n.right_;
+        int far_child = diff < 0.0f ? n.right_ : node + 1;
+        // As in FLANN, the bound adds the distances to all splits on the way,
+        // which may count a dimension twice.
+        float far_distance2 = min_distance2 + diff * diff;
+        if (far_distance2 < buffer.WorstDistance2()) {
+            buffer.branches_.push_back(
+                    SearchBuffer::Branch{far_distance2, tree, far_child});
+            std::push_heap(buffer.branches_.begin(), buffer.branches_.end(),
+                           SearchBuffer::Farther);
+        }
+        node = near_child;
+    }
+    const Node &leaf = t.nodes_[node];
+    for (int k = leaf.begin_; k < leaf.end_; k++) {
+        int position = t.order_[k];
+        if (buffer.visited_[position] == buffer.stamp_) {
+            continue;
+        }
+        buffer.visited_[position] = buffer.stamp_;
+        buffer.checks_++;
+        buffer.Add(position,
+                   ComputeDistance2(&data_[size_t(position) * dimension_],
+                                    buffer.query_.data(), (int)dimension_));
+    }
+}
+
+CorrespondenceSet MatchFeatures(const Feature &source_feature,
+                                const Feature &target_feature,
+                                bool mutual_filter /* = false*/,
+                                int max_checks /* = -1*/) {
+    FeatureIndex target_index(target_feature, 4, max_checks);
+    FeatureIndex source_index(4, max_checks);
+    if (mutual_filter) {
+        source_index.SetFeature(source_feature);
+    }
+    return MatchFeatures(source_feature, source_index, target_feature,
+                         target_index, mutual_filter);
+}
+
+CorrespondenceSet MatchFeatures(const Feature &source_feature,
+                                const FeatureIndex &source_index,
+                                const Feature &target_feature,
+                                const FeatureIndex &target_index,
+                                bool mutual_filter /* = false*/) {
+    std::vector<int> source_to_target =
+            target_index.SearchNearest(source_feature);
+    std::vector<int> target_to_source;
+    if (mutual_filter) {
+        // Only the targets matched by some source are searched back.
+        std::vector<int> targets;
+        std::vector<bool> is_target(target_feature.Num(), false);
+        for (int j : source_to_target) {
+            if (j >= 0 && !is_target[j]) {
+                is_target[j] = true;
+                targets.push_back(j);
+            }
+        }
+        std::vector<int> nearest =
+                source_index.SearchNearest(target_feature, targets);
+        target_to_source.resize(target_feature.Num(), -1);
+        for (size_t k = 0; k < targets.size(); k++) {
+            target_to_source[targets[k]] = nearest[k];
+        }
+    }
+    CorrespondenceSet corres;
+    corres.reserve(source_to_target.size());
+    for (int i = 0; i < (int)source_to_target.size(); i++) {
+        int j = source_to_target[i];
+        if (j >= 0 && (!mutual_filter || target_to_source[j] == i)) {
+            corres.push_back(Eigen::Vector2i(i, j));
+        }
+    }
+    return corres;
+}
+
+}  // namespace registration
+}  // namespace open3d
@@ -0,0 +1,189 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/TransformationEstimation.h"
+
+namespace open3d {
+namespace registration {
+
+/// \class FeatureIndex
+///
+/// \brief Nearest neighbor index of high dimensional features.
+///
+/// The features are stored in single precision. With a negative
+/// `max_checks_` the index is a single KD-tree and searches are exact.
+/// Otherwise it is a forest of `num_trees_` randomized KD-trees (Silpa-Anan
+/// and Hartley, "Optimised KD-trees for fast image descriptor matching",
+/// 2008) that are searched best bin first, and a search stops after comparing
+/// `max_checks_` features, trading recall for speed.
+class FeatureIndex {
+public:
+    /// \brief Default Constructor.
+    ///
+    /// \param num_trees Number of randomized KD-trees.
+    /// \param max_checks Maximum number of features compared by a search, or
+    /// -1 for exact searches.
+    FeatureIndex(int num_trees = 4, int max_checks = -1)
+        : num_trees_(num_trees), max_checks_(max_checks) {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param feature Features from which the index is constructed.
+    /// \param num_trees Number of randomized KD-trees.
+    /// \param max_checks Maximum number of features compared by a search, or
+    /// -1 for exact searches.
+    FeatureIndex(const Feature &feature,
+                 int num_trees = 4,
+                 int max_checks = -1);
+    ~FeatureIndex() {}
+
+public:
+    /// Builds the index of the features.
+    bool SetFeature(const Feature &feature);
+    /// Builds the index of single or half precision features.
+    bool SetFeature(const CompactFeature &feature);
+    /// Returns the number of indexed features.
+    int Num() const { return (int)dataset_size_; }
+    /// \brief Finds the `knn` nearest indexed features of every column of
+    /// `query`, in parallel.
+    ///
+    /// The neighbors of query `i` are stored in `indices[i * knn]` to
+    /// `indices[i * knn + knn - 1]`, nearest first, unused entries are -1.
+    /// \return The number of queries.
+    int SearchKNN(const Feature &query,
+                  int knn,
+                  std::vector<int> &indices,
+                  std::vector<float> &distance2) const;
+    /// \brief Finds the nearest indexed feature of the columns `columns` of
+    /// `query`, in parallel.
+    ///
+    /// \return The index of the nearest feature of every column, or -1.
+    std::vector<int> SearchNearest(const Feature &query,
+                                   const std::vector<int> &columns) const;
+    /// \brief Finds the nearest indexed feature of every column of `query`, in
+    /// parallel.
+    ///
+    /// \return The index of the nearest feature of every column, or -1.
+    std::vector<int> SearchNearest(const Feature &query) const;
+
+public:
+    /// Number of randomized KD-trees, used when the index is built.
+    int num_trees_;
+    /// Maximum number of features compared by a search, or -1 for exact
+    /// searches. Changing it between exact and approximate searches requires
+    /// to build the index again.
+    int max_checks_;
+
+protected:
+    /// Inner nodes split at `split_` along `dim_`, their left child follows
+    /// them and the right child is stored in `right_`. Leaves have a negative
+    /// `dim_` and hold the features in [`begin_`, `end_`) of the tree order.
+    struct Node {
+        float split_;
+        int dim_;
+        int right_;
+        int begin_;
+        int end_;
+    };
+
+    /// A KD-tree over the positions of the features in `data_`.
+    struct Tree {
+        std::vector<Node> nodes_;
+        std::vector<int> order_;
+    };
+
+    struct SearchBuffer;
+
+    bool SetRawData(std::vector<float> &&data, size_t dimension);
+    int BuildNode(Tree &tree,
+                  int begin,
+                  int end,
+                  bool randomized,
+                  std::mt19937 &engine) const;
+    /// Runs `knn` searches for the columns `columns` of `query`.
+    void SearchColumns(const Feature &query,
+                       const std::vector<int> &columns,
+                       int knn,
+                       std::vector<int> &indices,
+                       std::vector<float> &distance2) const;
+    void SearchExact(int node, float min_distance2, SearchBuffer &buffer) const;
+    void SearchApproximate(SearchBuffer &buffer) const;
+    void DescendTree(int tree,
+                     int node,
+                     float min_distance2,
+                     SearchBuffer &buffer) const;
+
+    /// Features in the order of the first tree, `dimension_` values each.
+    std::vector<float> data_;
+    /// Column of every feature of `data_` in the indexed Feature.
+    std::vector<int> indices_;
+    std::vector<Tree> trees_;
+    size_t dimension_ = 0;
+    size_t dataset_size_ = 0;
+};
+
+/// \brief Function to match features by nearest neighbor search.
+///
+/// Every source feature is matched to its nearest target feature. With
+/// `mutual_filter`, only pairs that are also the nearest source feature of
+/// their target feature are kept.
+///
+/// \param source_feature Source point cloud feature.
+/// \param target_feature Target point cloud feature.
+/// \param mutual_filter Keep mutual nearest neighbors only.
+/// \param max_checks Maximum number of features compared by a search, or -1
+/// for exact searches.
+/// \return Pairs of source and target indices.
+CorrespondenceSet MatchFeatures(const Feature &source_feature,
+                                const Feature &target_feature,
+                                bool mutual_filter = false,
+                                int max_checks = -1);
+
+/// \brief Function to match features with prebuilt indexes.
+///
+/// \param source_feature Source point cloud feature.
+/// \param source_index Index of `source_feature`, only searched with
+/// `mutual_filter`.
+/// \param target_feature Target point cloud feature.
+/// \param target_index Index of `target_feature`.
+/// \param mutual_filter Keep mutual nearest neighbors only.
+/// \return Pairs of source and target indices.
+CorrespondenceSet MatchFeatures(const Feature &source_feature,
+                                const FeatureIndex &source_index,
+                                const Feature &target_feature,
+                                const FeatureIndex &target_index,
+                                bool mutual_filter = false);
+
+}  // namespace registration
+}  // namespace open3d
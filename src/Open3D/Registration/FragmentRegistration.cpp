@@ -0,0 +1,272 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "Open3D/Registration/FragmentRegistration.h"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
+#include <memory>
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/CorrespondenceChecker.h"
+#include "Open3D/Registration/FastGlobalRegistration.h"
+#include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/FeatureIndex.h"
+#include "Open3D/Registration/ICPTarget.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+
+namespace {
+using namespace registration;
+
+/// Precomputation of a fragment shared by all the pairs it belongs to.
+struct PreparedFragment {
+    std::shared_ptr<geometry::PointCloud> pcd_;
+    std::shared_ptr<Feature> feature_;
+    FeatureIndex feature_index_;
+    geometry::KDTreeFlann kdtree_;
+    ICPTarget icp_target_;
+};
+
+/// Registration of a pair, `success_` is false for rejected loop closures.
+struct PairResult {
+    bool success_ = false;
+    Eigen::Matrix4d transformation_ = Eigen::Matrix4d::Identity();
+    Eigen::Matrix6d information_ = Eigen::Matrix6d::Zero();
+};
+
+#ifdef _OPENMP
+/// Limits the number of active nested parallel regions while in scope, and
+/// restores the previous limit on destruction, also when an error is thrown.
+class MaxActiveLevelsGuard {
+public:
+    MaxActiveLevelsGuard(int max_active_levels)
+        : previous_max_active_levels_(omp_get_max_active_levels()) {
+        omp_set_max_active_levels(max_active_levels);
+    }
+    ~MaxActiveLevelsGuard() {
+        omp_set_max_active_levels(previous_max_active_levels_);
+    }
+    MaxActiveLevelsGuard(const MaxActiveLevelsGuard &) = delete;
+    MaxActiveLevelsGuard &operator=(const MaxActiveLevelsGuard &) = delete;
+
+private:
+    int previous_max_active_levels_;
+};
+#endif
+
+void PrepareFragment(const geometry::PointCloud &fragment,
+                     bool need_feature,
+                     bool need_kdtree,
+                     bool need_icp_target,
+                     const FragmentRegistrationOption &option,
+                     PreparedFragment &prepared) {
+    double voxel_size = option.voxel_size_;
+    prepared.pcd_ = fragment.VoxelDownSample(voxel_size);
+    prepared.pcd_->EstimateNormals(
+            geometry::KDTreeSearchParamHybrid(voxel_size * 2.0, 30));
+    if (need_feature) {
+        prepared.feature_ = ComputeFPFHFeature(
+                *prepared.pcd_,
+                geometry::KDTreeSearchParamHybrid(voxel_size * 5.0, 100));
+        prepared.feature_index_.max_checks_ = option.maximum_feature_checks_;
+        prepared.feature_index_.SetFeature(*prepared.feature_);
+    }
+    if (need_kdtree) {
+        prepared.kdtree_.SetGeometry(*prepared.pcd_);
+    }
+    if (need_icp_target) {
+        prepared.icp_target_.SetPointCloud(*prepared.pcd_);
+    }
+}
+
+PairResult RegisterPair(const PreparedFragment &source,
+                        const PreparedFragment &target,
+                        const FragmentPair &pair,
+                        const FragmentRegistrationOption &option) {
+    PairResult pair_result;
+    double distance = option.voxel_size_ * 1.4;
+    Eigen::Matrix4d init = pair.init_;
+    if (pair.uncertain_) {
+        RegistrationResult result;
+        if (option.global_registration_ == GlobalRegistrationMethod::RANSAC) {
+            CorrespondenceSet matches = MatchFeatures(
+                    *source.feature_, source.feature_index_, *target.feature_,
+                    target.feature_index_);
+            CorrespondenceCheckerBasedOnEdgeLength edge_length_checker(0.9);
+            CorrespondenceCheckerBasedOnDistance distance_checker(distance);
+            result = RegistrationRANSACBasedOnFeatureMatches(
+                    *source.pcd_, *target.pcd_, target.kdtree_, matches,
+                    distance, TransformationEstimationPointToPoint(false), 4,
+                    {edge_length_checker, distance_checker},
+                    option.ransac_criteria_);
+        } else {
+            FastGlobalRegistrationOption fgr_option;
+            fgr_option.maximum_correspondence_distance_ = distance;
+            result = FastGlobalRegistration(
+                    *source.pcd_, *target.pcd_, *source.feature_,
+                    source.feature_index_, *target.feature_,
+                    target.feature_index_, fgr_option);
+        }
+        if (result.transformation_.isIdentity()) {
+            return pair_result;
+        }
+        init = result.transformation_;
+    }
+    RegistrationResult result = RegistrationICP(
+            *source.pcd_, target.icp_target_, distance, init,
+            TransformationEstimationPointToPlane(), option.icp_criteria_);
+    pair_result.transformation_ = result.transformation_;
+    pair_result.information_ = GetInformationMatrixFromCorrespondences(
+            *target.pcd_, result.correspondence_set_);
+    if (pair.uncertain_) {
+        // The last diagonal entry counts the correspondences.
+        double overlap = pair_result.information_(5, 5) /
+                         std::min(source.pcd_->points_.size(),
+                                  target.pcd_->points_.size());
+        if (overlap < option.minimum_overlap_) {
+            return pair_result;
+        }
+    }
+    pair_result.success_ = true;
+    return pair_result;
+}
+
+}  // unnamed namespace
+
+namespace registration {
+
+PoseGraph RegisterFragmentPairs(
+        const std::vector<geometry::PointCloud> &fragments,
+        const std::vector<FragmentPair> &pairs,
+        const FragmentRegistrationOption &option
+        /* = FragmentRegistrationOption()*/) {
+    if (option.voxel_size_ <= 0.0) {
+        utility::LogError("Invalid voxel_size.");
+    }
+    int num_fragments = (int)fragments.size();
+    int num_pairs = (int)pairs.size();
+    std::vector<bool> need_feature(num_fragments, false);
+    std::vector<bool> need_kdtree(num_fragments, false);
+    std::vector<bool> need_icp_target(num_fragments, false);
+    for (const auto &pair : pairs) {
+        if (pair.source_id_ < 0 || pair.source_id_ >= num_fragments ||
+            pair.target_id_ < 0 || pair.target_id_ >= num_fragments) {
+            utility::LogError("Invalid fragment pair ({:d}, {:d}).",
+                              pair.source_id_, pair.target_id_);
+        }
+        if (pair.uncertain_) {
+            need_feature[pair.source_id_] = true;
+            need_feature[pair.target_id_] = true;
+            if (option.global_registration_ ==
+                GlobalRegistrationMethod::RANSAC) {
+                need_kdtree[pair.target_id_] = true;
+            }
+        }
+        need_icp_target[pair.target_id_] = true;
+    }
+
+    // Fragments and pairs are distributed over the threads only when there
+    // are enough of them to occupy every thread, the parallel regions nested
+    // in the preprocessing and the registration then run single threaded.
+    // Otherwise the loops are serial and the nested regions are parallel.
+#ifdef _OPENMP
+    int max_threads = omp_get_max_threads();
+#else
+    int max_threads = 1;
+#endif
+    std::vector<PreparedFragment> prepared(num_fragments);
+    std::vector<PairResult> results(num_pairs);
+    {
+#ifdef _OPENMP
+        MaxActiveLevelsGuard max_active_levels_guard(1);
+#pragma omp parallel for schedule(dynamic) if (num_fragments >= max_threads)
+#endif
+        for (int i = 0; i < num_fragments; i++) {
+            PrepareFragment(fragments[i], need_feature[i], need_kdtree[i],
+                            need_icp_target[i], option, prepared[i]);
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) if (num_pairs >= max_threads)
+#endif
+        for (int k = 0; k < num_pairs; k++) {
+            const FragmentPair &pair = pairs[k];
+            results[k] = RegisterPair(prepared[pair.source_id_],
+                                      prepared[pair.target_id_], pair, option);
+        }
+    }
+    utility::LogDebug("Registered {:d} fragment pairs with {:d} threads.",
+                      num_pairs, max_threads);
+
+    PoseGraph pose_graph;
+    pose_graph.nodes_.resize(num_fragments);
+    for (int k = 0; k < num_pairs; k++) {
+        if (!results[k].success_) {
+            continue;
+        }
+        pose_graph.edges_.push_back(PoseGraphEdge(
+                pairs[k].source_id_, pairs[k].target_id_,
+                results[k].transformation_, results[k].information_,
+                pairs[k].uncertain_));
+    }
+
+    // The pose of the target of an edge is the pose of its source times the
+    // inverse of the transformation, propagated from fragment 0.
+    std::vector<bool> reached(num_fragments, false);
+    if (num_fragments > 0) {
+        reached[0] = true;
+    }
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (const auto &edge : pose_graph.edges_) {
+            if (edge.uncertain_) {
+                continue;
+            }
+            int s = edge.source_node_id_;
+            int t = edge.target_node_id_;
+            if (reached[s] && !reached[t]) {
+                pose_graph.nodes_[t].pose_ = pose_graph.nodes_[s].pose_ *
+                                             edge.transformation_.inverse();
+                reached[t] = changed = true;
+            } else if (reached[t] && !reached[s]) {
+                pose_graph.nodes_[s].pose_ =
+                        pose_graph.nodes_[t].pose_ * edge.transformation_;
+                reached[s] = changed = true;
+            }
+        }
+    }
+    return pose_graph;
+}
+
+}  // namespace registration
+}  // namespace open3d
@@ -0,0 +1,161 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+#include "Open3D/Registration/PoseGraph.h"
+#include "Open3D/Registration/Registration.h"
+#include "Open3D/Utility/Eigen.h"
+
+namespace open3d {
+
+namespace geometry {
+class PointCloud;
+}
+
+namespace registration {
+
+/// \class FragmentPair
+///
+/// \brief Pair of fragments to be registered by RegisterFragmentPairs.
+class FragmentPair {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param source_id Index of the source fragment.
+    /// \param target_id Index of the target fragment.
+    /// \param uncertain Set to `true` for loop closures, which are globally
+    /// registered before the refinement, and to `false` for odometry pairs,
+    /// which are refined from `init`.
+    /// \param init Initial transformation of odometry pairs.
+    FragmentPair(int source_id = -1,
+                 int target_id = -1,
+                 bool uncertain = true,
+                 const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity())
+        : source_id_(source_id),
+          target_id_(target_id),
+          uncertain_(uncertain),
+          init_(init) {}
+    ~FragmentPair() {}
+
+public:
+    /// Index of the source fragment.
+    int source_id_;
+    /// Index of the target fragment.
+    int target_id_;
+    /// Whether the pair is a loop closure.
+    bool uncertain_;
+    /// Initial transformation of odometry pairs.
+    Eigen::Matrix4d_u init_;
+};
+
+/// \enum GlobalRegistrationMethod
+///
+/// \brief Global registration used for the loop closures of
+/// RegisterFragmentPairs.
+enum class GlobalRegistrationMethod {
+    RANSAC = 0,
+    FastGlobalRegistration = 1,
+};
+
+/// \class FragmentRegistrationOption
+///
+/// \brief Options for RegisterFragmentPairs.
+class FragmentRegistrationOption {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param voxel_size Voxel size the fragments are downsampled with. The
+    /// normal and feature radii are 2 and 5 times, the correspondence distance
+    /// 1.4 times the voxel size.
+    /// \param global_registration Global registration of loop closures.
+    /// \param ransac_criteria Convergence criteria of RANSAC.
+    /// \param maximum_feature_checks Maximum number of features compared by a
+    /// feature search, see FeatureIndex. -1 matches the features exactly.
+    /// \param icp_criteria Convergence criteria of the ICP refinement.
+    /// \param minimum_overlap Loop closures whose refined correspondences
+    /// cover less than this ratio of the smaller fragment are dropped.
+    FragmentRegistrationOption(
+            double voxel_size = 0.05,
+            GlobalRegistrationMethod global_registration =
+                    GlobalRegistrationMethod::RANSAC,
+            const RANSACConvergenceCriteria &ransac_criteria =
+                    RANSACConvergenceCriteria(4000000, 500),
+            int maximum_feature_checks = -1,
+            const ICPConvergenceCriteria &icp_criteria =
+                    ICPConvergenceCriteria(1e-6, 1e-6, 50),
+            double minimum_overlap = 0.3)
+        : voxel_size_(voxel_size),
+          global_registration_(global_registration),
+          ransac_criteria_(ransac_criteria),
+          maximum_feature_checks_(maximum_feature_checks),
+          icp_criteria_(icp_criteria),
+          minimum_overlap_(minimum_overlap) {}
+    ~FragmentRegistrationOption() {}
+
+public:
+    /// Voxel size the fragments are downsampled with.
+    double voxel_size_;
+    /// Global registration of loop closures.
+    GlobalRegistrationMethod global_registration_;
+    /// Convergence criteria of RANSAC.
+    RANSACConvergenceCriteria ransac_criteria_;
+    /// Maximum number of features compared by a feature search.
+    int maximum_feature_checks_;
+    /// Convergence criteria of the ICP refinement.
+    ICPConvergenceCriteria icp_criteria_;
+    /// Minimum overlap ratio of loop closures.
+    double minimum_overlap_;
+};
+
+/// \brief Function to register many pairs of fragments into a pose graph.
+///
+/// Every fragment is downsampled and gets its normals, FPFH feature, feature
+/// index and ICP target computed once, however many pairs it belongs to. The
+/// pairs are then processed concurrently: loop closures are globally
+/// registered, every pair is refined by point to plane ICP and the information
+/// matrix is computed from the refined correspondences. When enough pairs are
+/// available to occupy all threads, each pair runs single threaded instead of
+/// nesting parallel regions.
+///
+/// \param fragments The fragments.
+/// \param pairs The pairs of fragments to register.
+/// \param option Registration options.
+/// \return A pose graph with a node per fragment and an edge per registered
+/// pair. Failed loop closures are left out. The poses are chained along the
+/// odometry pairs, fragments not reached from fragment 0 keep the identity.
+PoseGraph RegisterFragmentPairs(
+        const std::vector<geometry::PointCloud> &fragments,
+        const std::vector<FragmentPair> &pairs,
+        const FragmentRegistrationOption &option =
+                FragmentRegistrationOption());
+
+}  // namespace registration
+}  // namespace open3d
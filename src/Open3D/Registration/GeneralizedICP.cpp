@@ -0,0 +1,131 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/GeneralizedICP.h"
+
+#include <Eigen/Eigenvalues>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Eigen.h"
+
+namespace open3d {
+namespace registration {
+
+Eigen::Matrix3d
+TransformationEstimationForGeneralizedICP::ComputeInformationSqrt(
+        const Eigen::Vector3d &ns, const Eigen::Vector3d &nt) const {
+    Eigen::Matrix3d covariance =
+            2.0 * Eigen::Matrix3d::Identity() -
+            (1.0 - epsilon_) * (ns * ns.transpose() + nt * nt.transpose());
+    Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver;
+    solver.computeDirect(covariance);
+    return solver.operatorInverseSqrt();
+}
+
+double TransformationEstimationForGeneralizedICP::ComputeRMSE(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres) const {
+    if (corres.empty() || !source.HasNormals() || !target.HasNormals()) {
+        return 0.0;
+    }
+    double err = 0.0;
+    for (const auto &c : corres) {
+        const Eigen::Matrix3d W = ComputeInformationSqrt(source.normals_[c[0]],
+                                                         target.normals_[c[1]]);
+        err += (W * (source.points_[c[0]] - target.points_[c[1]]))
+                       .squaredNorm();
+    }
+    return std::sqrt(err / (double)corres.size());
+}
+
+Eigen::Matrix4d
+TransformationEstimationForGeneralizedICP::ComputeTransformation(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const CorrespondenceSet &corres) const {
+    if (corres.empty() || !source.HasNormals() || !target.HasNormals()) {
+        return Eigen::Matrix4d::Identity();
+    }
+
+    auto compute_jacobian_and_residual =
+            [&](int i,
+                std::vector<Eigen::Vector6d, utility::Vector6d_allocator> &J_r,
+                std::vector<double> &r, std::vector<double> &w) {
+                const Eigen::Vector3d &vs = source.points_[corres[i][0]];
+                const Eigen::Vector3d &vt = target.points_[corres[i][1]];
+                const Eigen::Matrix3d W =
+                        ComputeInformationSqrt(source.normals_[corres[i][0]],
+                                               target.normals_[corres[i][1]]);
+                // d(R vs + t) / d(omega, t) = [-[vs]x, I].
+                Eigen::Matrix3d vs_skew;
+                vs_skew << 0.0, -vs(2), vs(1), vs(2), 0.0, -vs(0), -vs(1),
+                        vs(0), 0.0;
+                Eigen::Matrix<double, 3, 6> J;
+                J.block<3, 3>(0, 0) = -W * vs_skew;
+                J.block<3, 3>(0, 3) = W;
+                const Eigen::Vector3d residual = W * (vs - vt);
+
+                J_r.resize(3);
+                r.resize(3);
+                w.resize(3);
+                for (int k = 0; k < 3; k++) {
+                    J_r[k] = J.row(k).transpose();
+                    r[k] = residual(k);
+                    w[k] = kernel_->Weight(r[k]);
+                }
+            };
+
+    Eigen::Matrix6d JTJ;
+    Eigen::Vector6d JTr;
+    double r2;
+    std::tie(JTJ, JTr, r2) =
+            utility::ComputeJTJandJTr<Eigen::Matrix6d, Eigen::Vector6d>(
+                    compute_jacobian_and_residual, (int)corres.size());
+
+    bool is_success;
+    Eigen::Matrix4d extrinsic;
+    std::tie(is_success, extrinsic) =
+            utility::SolveJacobianSystemAndObtainExtrinsicMatrix(JTJ, JTr);
+
+    return is_success ? extrinsic : Eigen::Matrix4d::Identity();
+}
+
+RegistrationResult RegistrationGeneralizedICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimationForGeneralizedICP &estimation
+        /* = TransformationEstimationForGeneralizedICP()*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    return RegistrationICP(source, target, max_correspondence_distance, init,
+                           estimation, criteria);
+}
+
+}  // namespace registration
+}  // namespace open3d
@@ -0,0 +1,119 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+
+#include "Open3D/Registration/Registration.h"
+#include "Open3D/Registration/RobustKernel.h"
+#include "Open3D/Registration/TransformationEstimation.h"
+
+namespace open3d {
+
+namespace geometry {
+class PointCloud;
+}
+
+namespace registration {
+
+class RegistrationResult;
+
+/// \class TransformationEstimationForGeneralizedICP
+///
+/// Class to estimate a transformation for Generalized ICP, following
+/// A. Segal, D. Haehnel, S. Thrun, Generalized-ICP, RSS 2009.
+///
+/// Every point is modelled as a sample of its local plane, with the covariance
+/// C = I - (1 - epsilon) n n^T given by its normal n. A correspondence has the
+/// residual (C_s + C_t)^{-1/2} (v_s - v_t), which combines point to plane
+/// distances along both normals with a small point to point term.
+class TransformationEstimationForGeneralizedICP
+    : public TransformationEstimation {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param epsilon Variance of a point along its normal, relative to the
+    /// variance in its tangent plane.
+    /// \param kernel Robust kernel weighting the residuals.
+    explicit TransformationEstimationForGeneralizedICP(
+            double epsilon = 1e-3,
+            std::shared_ptr<RobustKernel> kernel = std::make_shared<L2Loss>())
+        : epsilon_(epsilon), kernel_(std::move(kernel)) {}
+    ~TransformationEstimationForGeneralizedICP() override {}
+
+public:
+    TransformationEstimationType GetTransformationEstimationType()
+            const override {
+        return type_;
+    };
+    double ComputeRMSE(const geometry::PointCloud &source,
+                       const geometry::PointCloud &target,
+                       const CorrespondenceSet &corres) const override;
+    Eigen::Matrix4d ComputeTransformation(
+            const geometry::PointCloud &source,
+            const geometry::PointCloud &target,
+            const CorrespondenceSet &corres) const override;
+    /// Returns (C_s + C_t)^{-1/2}, which maps the difference of a source and a
+    /// target point to their residual, for the normals of the points.
+    Eigen::Matrix3d ComputeInformationSqrt(const Eigen::Vector3d &ns,
+                                           const Eigen::Vector3d &nt) const;
+
+public:
+    /// Variance of a point along its normal.
+    double epsilon_;
+    /// Robust kernel of the estimation.
+    std::shared_ptr<RobustKernel> kernel_;
+
+private:
+    const TransformationEstimationType type_ =
+            TransformationEstimationType::GeneralizedICP;
+};
+
+/// \brief Function for Generalized ICP registration.
+///
+/// Both point clouds require normals, which define the covariances of their
+/// points.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param init Initial transformation estimation.
+/// \param estimation The Generalized ICP estimation.
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationGeneralizedICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimationForGeneralizedICP &estimation =
+                TransformationEstimationForGeneralizedICP(),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
+}  // namespace registration
+}  // namespace open3d
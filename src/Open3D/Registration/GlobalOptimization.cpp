@@ -28,6 +28,8 @@
 
 #include <Eigen/Dense>
 #include <Eigen/Sparse>
+#include <algorithm>
+#include <numeric>
 #include <tuple>
 #include <vector>
 
@@ -139,18 +141,104 @@ std::tuple<Eigen::Matrix6d, Eigen::Matrix6d> GetJacobian(
     return std::make_tuple(std::move(Js), std::move(Jt));
 }
 
+/// Nodes and edges of a PoseGraph taking part in an optimization. Nodes
+/// without a variable are held fixed and only the edges touching at least one
+/// variable are evaluated. The batch methods optimize all nodes and edges.
+struct PoseGraphSubset {
+    /// Variable index of every node, -1 for fixed nodes.
+    std::vector<int> node_variable_;
+    /// Node id of every variable.
+    std::vector<int> variable_node_;
+    /// Ids of the evaluated edges, zeta is stored in this order.
+    std::vector<int> edges_;
+    /// Variable nodes constrained by a prior, which stands for the edges of
+    /// marginalized nodes. Empty for the batch methods.
+    std::vector<int> prior_nodes_;
+    /// Poses of prior_nodes_ at which the prior was linearized.
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> prior_poses_;
+    /// The prior adds d^T H d - 2 b^T d to the residual, where d stacks the
+    /// displacements of prior_nodes_ from prior_poses_.
+    Eigen::MatrixXd prior_H_;
+    Eigen::VectorXd prior_b_;
+};
+
+/// Nodes marginalized into the prior of a PoseGraphSubset. Their linearized
+/// update is delta_ - gain_ * d, with d the displacement of the prior nodes.
+struct PoseGraphMarginalization {
+    std::vector<int> nodes_;
+    Eigen::VectorXd delta_;
+    Eigen::MatrixXd gain_;
+};
+
+PoseGraphSubset CreateFullPoseGraphSubset(const PoseGraph &pose_graph) {
+    PoseGraphSubset subset;
+    subset.node_variable_.resize(pose_graph.nodes_.size());
+    std::iota(subset.node_variable_.begin(), subset.node_variable_.end(), 0);
+    subset.variable_node_ = subset.node_variable_;
+    subset.edges_.resize(pose_graph.edges_.size());
+    std::iota(subset.edges_.begin(), subset.edges_.end(), 0);
+    return subset;
+}
+
+/// Subset optimizing the nodes from first_node on, except fixed_node.
+PoseGraphSubset CreateTrailingPoseGraphSubset(const PoseGraph &pose_graph,
+                                              int first_node,
+                                              int fixed_node) {
+    PoseGraphSubset subset;
+    int n_nodes = (int)pose_graph.nodes_.size();
+    int n_edges = (int)pose_graph.edges_.size();
+    subset.node_variable_.assign(n_nodes, -1);
+    for (int iter_node = std::max(first_node, 0); iter_node < n_nodes;
+         iter_node++) {
+        if (iter_node == fixed_node) continue;
+        subset.node_variable_[iter_node] = (int)subset.variable_node_.size();
+        subset.variable_node_.push_back(iter_node);
+    }
+    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+        if (subset.node_variable_[t.source_node_id_] >= 0 ||
+            subset.node_variable_[t.target_node_id_] >= 0) {
+            subset.edges_.push_back(iter_edge);
+        }
+    }
+    return subset;
+}
+
+/// Function to compute the displacements d of the prior nodes of subset, such
+/// that the pose of every prior node is exp(d_i) times its prior pose.
+Eigen::VectorXd ComputePriorDisplacement(const PoseGraph &pose_graph,
+                                         const PoseGraphSubset &subset) {
+    int n_prior = (int)subset.prior_nodes_.size();
+    Eigen::VectorXd d(n_prior * 6);
+    for (int i = 0; i < n_prior; i++) {
+        d.block<6, 1>(i * 6, 0) = utility::TransformMatrix4dToVector6d(
+                pose_graph.nodes_[subset.prior_nodes_[i]].pose_ *
+                subset.prior_poses_[i].inverse());
+    }
+    return d;
+}
+
+/// Function to compute the residual of the prior of subset.
+double ComputePriorResidual(const PoseGraph &pose_graph,
+                            const PoseGraphSubset &subset) {
+    if (subset.prior_nodes_.empty()) return 0.0;
+    Eigen::VectorXd d = ComputePriorDisplacement(pose_graph, subset);
+    return d.dot(subset.prior_H_ * d - 2.0 * subset.prior_b_);
+}
+
 /// Function to update line_process value defined in [Choi et al 2015]
 /// See Eq (2). temp2 value in this function is derived from dE/dl = 0
 int UpdateConfidence(PoseGraph &pose_graph,
+                     const std::vector<int> &edges,
                      const Eigen::VectorXd &zeta,
                      const double line_process_weight,
                      const GlobalOptimizationOption &option) {
-    int n_edges = (int)pose_graph.edges_.size();
+    int n_edges = (int)edges.size();
     int valid_edges_num = 0;
-    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
-        PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+    for (int k = 0; k < n_edges; k++) {
+        PoseGraphEdge &t = pose_graph.edges_[edges[k]];
         if (t.uncertain_) {
-            Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
+            Eigen::Vector6d e = zeta.block<6, 1>(k * 6, 0);
             double residual_square = e.transpose() * t.information_ * e;
             double temp = line_process_weight /
                           (line_process_weight + residual_square);
@@ -164,15 +252,16 @@ int UpdateConfidence(PoseGraph &pose_graph,
 
 /// Function to compute residual defined in [Choi et al 2015] See Eq (9).
 double ComputeResidual(const PoseGraph &pose_graph,
+                       const std::vector<int> &edges,
                        const Eigen::VectorXd &zeta,
                        const double line_process_weight,
                        const GlobalOptimizationOption &option) {
-    int n_edges = (int)pose_graph.edges_.size();
+    int n_edges = (int)edges.size();
     double residual = 0.0;
-    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
-        const PoseGraphEdge &te = pose_graph.edges_[iter_edge];
+    for (int k = 0; k < n_edges; k++) {
+        const PoseGraphEdge &te = pose_graph.edges_[edges[k]];
         double line_process_iter = te.confidence_;
-        Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
+        Eigen::Vector6d e = zeta.block<6, 1>(k * 6, 0);
         residual += line_process_iter * e.transpose() * te.information_ * e +
                     line_process_weight * pow(sqrt(line_process_iter) - 1, 2.0);
     }
@@ -180,18 +269,176 @@ double ComputeResidual(const PoseGraph &pose_graph,
 }
 
 /// Function to compute residual defined in [Choi et al 2015] See Eq (6).
-Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
-    int n_edges = (int)pose_graph.edges_.size();
+Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph,
+                            const std::vector<int> &edges) {
+    int n_edges = (int)edges.size();
     Eigen::VectorXd output(n_edges * 6);
-    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+    for (int k = 0; k < n_edges; k++) {
         Eigen::Matrix4d X_inv, Ts, Tt_inv;
-        std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
+        std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, edges[k]);
         Eigen::Vector6d e = GetMisalignmentVector(X_inv, Ts, Tt_inv);
-        output.block<6, 1>(iter_edge * 6, 0) = e;
+        output.block<6, 1>(k * 6, 0) = e;
     }
     return output;
 }
 
+/// Block-sparse Gauss-Newton system H delta = b of a PoseGraph. H has a 6x6
+/// block for every variable and for every pair of variables connected by an
+/// edge, so its sparsity pattern only depends on the edges of the graph: the
+/// pattern and the symbolic factorization are computed once and reused by all
+/// iterations, only the values of H are updated. Edges to fixed nodes only
+/// contribute to the diagonal block of their variable, the prior of the subset
+/// couples all of its nodes.
+class PoseGraphLinearSystem {
+public:
+    PoseGraphLinearSystem(const PoseGraph &pose_graph,
+                          const PoseGraphSubset &subset);
+
+    /// Function to fill H and b for the current poses and confidences.
+    void Compute(const PoseGraph &pose_graph, const Eigen::VectorXd &zeta);
+
+    /// Function to return the symmetric matrix H.
+    Eigen::SparseMatrix<double> GetMatrix() const {
+        return H_.selfadjointView<Eigen::Lower>();
+    }
+
+    /// Function to solve (H + lambda * I) delta = b.
+    std::tuple<bool, Eigen::VectorXd> Solve(double lambda = 0.0);
+
+    const Eigen::VectorXd &GetRightTerm() const { return b_; }
+    Eigen::VectorXd GetDiagonal() const { return H_.diagonal(); }
+
+private:
+    const PoseGraphSubset &subset_;
+    /// Lower triangle of H, stored column-major. Every block column j holds
+    /// the diagonal block (j, j) followed by the blocks (i, j), i > j, of the
+    /// neighbors of variable j in ascending order.
+    Eigen::SparseMatrix<double> H_;
+    Eigen::SparseMatrix<double> H_LM_;
+    Eigen::VectorXd b_;
+    /// Positions in subset_.edges_ of the edges incident to every variable,
+    /// in compressed row format.
+    std::vector<int> variable_edges_begin_;
+    std::vector<int> variable_edges_;
+    /// Position of the off-diagonal block of every edge in the block column of
+    /// its smaller variable.
+    std::vector<int> edge_block_;
+    /// Position of the block (i, j) of the prior nodes in the block column of
+    /// the smaller variable, stored at i * n_prior + j.
+    std::vector<int> prior_block_;
+    /// Index of the diagonal entries of H in its value array.
+    std::vector<int> diagonal_index_;
+    Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>,
+                          Eigen::Lower,
+                          Eigen::AMDOrdering<int>>
+            solver_;
+};
+
+PoseGraphLinearSystem::PoseGraphLinearSystem(const PoseGraph &pose_graph,
+                                             const PoseGraphSubset &subset)
+    : subset_(subset) {
+    int n_variables = (int)subset.variable_node_.size();
+    int n_edges = (int)subset.edges_.size();
+    auto GetVariables = [&](int k) {
+        const PoseGraphEdge &t = pose_graph.edges_[subset.edges_[k]];
+        return std::make_pair(subset.node_variable_[t.source_node_id_],
+                              subset.node_variable_[t.target_node_id_]);
+    };
+
+    variable_edges_begin_.assign(n_variables + 1, 0);
+    for (int k = 0; k < n_edges; k++) {
+        int vs, vt;
+        std::tie(vs, vt) = GetVariables(k);
+        if (vs >= 0) variable_edges_begin_[vs + 1]++;
+        if (vt >= 0 && vt != vs) variable_edges_begin_[vt + 1]++;
+    }
+    for (int v = 0; v < n_variables; v++) {
+        variable_edges_begin_[v + 1] += variable_edges_begin_[v];
+    }
+    variable_edges_.resize(variable_edges_begin_[n_variables]);
+    std::vector<int> fill(variable_edges_begin_.begin(),
+                          variable_edges_begin_.end() - 1);
+    for (int k = 0; k < n_edges; k++) {
+        int vs, vt;
+        std::tie(vs, vt) = GetVariables(k);
+        if (vs >= 0) variable_edges_[fill[vs]++] = k;
+        if (vt >= 0 && vt != vs) variable_edges_[fill[vt]++] = k;
+    }
+
+    // Distinct larger neighbors of every variable, several edges between the
+    // same two variables share one block.
+    std::vector<std::vector<int>> lower_neighbors(n_variables);
+    for (int k = 0; k < n_edges; k++) {
+        int vs, vt;
+        std::tie(vs, vt) = GetVariables(k);
+        if (vs >= 0 && vt >= 0 && vs != vt) {
+            lower_neighbors[std::min(vs, vt)].push_back(std::max(vs, vt));
+        }
+    }
+    int n_prior = (int)subset.prior_nodes_.size();
+    for (int i = 0; i < n_prior; i++) {
+        for (int j = 0; j < i; j++) {
+            int vi = subset.node_variable_[subset.prior_nodes_[i]];
+            int vj = subset.node_variable_[subset.prior_nodes_[j]];
+            lower_neighbors[std::min(vi, vj)].push_back(std::max(vi, vj));
+        }
+    }
+    for (auto &neighbors : lower_neighbors) {
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()),
+                        neighbors.end());
+    }
+    auto GetBlock = [&](int vi, int vj) {
+        if (vi == vj) return 0;
+        const std::vector<int> &neighbors = lower_neighbors[std::min(vi, vj)];
+        return 1 + int(std::lower_bound(neighbors.begin(), neighbors.end(),
+                                        std::max(vi, vj)) -
+                       neighbors.begin());
+    };
+    edge_block_.assign(n_edges, 0);
+    for (int k = 0; k < n_edges; k++) {
+        int vs, vt;
+        std::tie(vs, vt) = GetVariables(k);
+        if (vs < 0 || vt < 0) continue;
+        edge_block_[k] = GetBlock(vs, vt);
+    }
+    prior_block_.resize(n_prior * n_prior);
+    for (int i = 0; i < n_prior; i++) {
+        for (int j = 0; j < n_prior; j++) {
+            prior_block_[i * n_prior + j] =
+                    GetBlock(subset.node_variable_[subset.prior_nodes_[i]],
+                             subset.node_variable_[subset.prior_nodes_[j]]);
+        }
+    }
+
+    int n = n_variables * 6;
+    H_.resize(n, n);
+    Eigen::VectorXi nnz_per_column(n);
+    for (int j = 0; j < n_variables; j++) {
+        nnz_per_column.segment<6>(j * 6).setConstant(
+                6 * int(1 + lower_neighbors[j].size()));
+    }
+    H_.reserve(nnz_per_column);
+    diagonal_index_.resize(n);
+    for (int j = 0; j < n_variables; j++) {
+        for (int c = 0; c < 6; c++) {
+            int col = j * 6 + c;
+            for (int r = 0; r < 6; r++) {
+                H_.insert(j * 6 + r, col) = 0.0;
+            }
+            for (int i : lower_neighbors[j]) {
+                for (int r = 0; r < 6; r++) {
+                    H_.insert(i * 6 + r, col) = 0.0;
+                }
+            }
+            diagonal_index_[col] = H_.outerIndexPtr()[col] + c;
+        }
+    }
+    H_.makeCompressed();
+    b_.setZero(n);
+    solver_.analyzePattern(H_);
+}
+
 /// The information matrix used here is consistent with [Choi et al 2015].
 /// It is [-p_x | I]^T[-p_x | I]. \zeta is [\alpha \beta \gamma a b c]
 /// Another definition of information matrix used for [Kümmerle et al 2011] is
@@ -205,71 +452,170 @@ Eigen::VectorXd ComputeZeta(const PoseGraph &pose_graph) {
 ///
 /// This function focuses the case that every edge has two nodes (not hyper
 /// graph) so we have two Jacobian matrices from one constraint.
-std::tuple<Eigen::MatrixXd, Eigen::VectorXd> ComputeLinearSystem(
-        const PoseGraph &pose_graph, const Eigen::VectorXd &zeta) {
-    int n_nodes = (int)pose_graph.nodes_.size();
-    int n_edges = (int)pose_graph.edges_.size();
-    Eigen::MatrixXd H(n_nodes * 6, n_nodes * 6);
-    Eigen::VectorXd b(n_nodes * 6);
-    H.setZero();
-    b.setZero();
-
-    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+///
+/// The blocks of every edge are computed in parallel first. Every variable
+/// then gathers the blocks of its incident edges into its own block column of
+/// H and its own segment of b, so that no two threads write the same entry.
+void PoseGraphLinearSystem::Compute(const PoseGraph &pose_graph,
+                                    const Eigen::VectorXd &zeta) {
+    int n_variables = (int)subset_.variable_node_.size();
+    int n_edges = (int)subset_.edges_.size();
+    std::vector<Eigen::Matrix6d, utility::Matrix6d_allocator> H_ss(n_edges),
+            H_ts(n_edges), H_tt(n_edges);
+    std::vector<Eigen::Vector6d, utility::Vector6d_allocator> b_s(n_edges),
+            b_t(n_edges);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int k = 0; k < n_edges; k++) {
+        int iter_edge = subset_.edges_[k];
         const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
-        Eigen::Vector6d e = zeta.block<6, 1>(iter_edge * 6, 0);
+        Eigen::Vector6d e = zeta.block<6, 1>(k * 6, 0);
 
         Eigen::Matrix4d X_inv, Ts, Tt_inv;
         std::tie(X_inv, Ts, Tt_inv) = GetRelativePoses(pose_graph, iter_edge);
 
         Eigen::Matrix6d Js, Jt;
         std::tie(Js, Jt) = GetJacobian(X_inv, Ts, Tt_inv);
-        Eigen::Matrix6d JsT_Info = Js.transpose() * t.information_;
-        Eigen::Matrix6d JtT_Info = Jt.transpose() * t.information_;
-        Eigen::Vector6d eT_Info = e.transpose() * t.information_;
         double line_process_iter = t.confidence_;
+        Eigen::Matrix6d JsT_Info =
+                line_process_iter * Js.transpose() * t.information_;
+        Eigen::Matrix6d JtT_Info =
+                line_process_iter * Jt.transpose() * t.information_;
+
+        H_ss[k].noalias() = JsT_Info * Js;
+        H_ts[k].noalias() = JtT_Info * Js;
+        H_tt[k].noalias() = JtT_Info * Jt;
+        b_s[k].noalias() = -(JsT_Info * e);
+        b_t[k].noalias() = -(JtT_Info * e);
+    }
 
-        int id_i = t.source_node_id_ * 6;
-        int id_j = t.target_node_id_ * 6;
-        H.block<6, 6>(id_i, id_i).noalias() +=
-                line_process_iter * JsT_Info * Js;
-        H.block<6, 6>(id_i, id_j).noalias() +=
-                line_process_iter * JsT_Info * Jt;
-        H.block<6, 6>(id_j, id_i).noalias() +=
-                line_process_iter * JtT_Info * Js;
-        H.block<6, 6>(id_j, id_j).noalias() +=
-                line_process_iter * JtT_Info * Jt;
-        b.block<6, 1>(id_i, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Js;
-        b.block<6, 1>(id_j, 0).noalias() -=
-                line_process_iter * eT_Info.transpose() * Jt;
-    }
-    return std::make_tuple(std::move(H), std::move(b));
-}
-
-Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph) {
-    int n_nodes = (int)pose_graph.nodes_.size();
-    Eigen::VectorXd output(n_nodes * 6);
-    for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
+    double *values = H_.valuePtr();
+    const int *outer = H_.outerIndexPtr();
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (int j = 0; j < n_variables; j++) {
+        int column_size = outer[j * 6 + 1] - outer[j * 6];
+        Eigen::Map<Eigen::MatrixXd> H_j(values + outer[j * 6], column_size, 6);
+        H_j.setZero();
+        Eigen::Vector6d b_j = Eigen::Vector6d::Zero();
+        for (int l = variable_edges_begin_[j]; l < variable_edges_begin_[j + 1];
+             l++) {
+            int k = variable_edges_[l];
+            const PoseGraphEdge &t = pose_graph.edges_[subset_.edges_[k]];
+            int source = subset_.node_variable_[t.source_node_id_];
+            int target = subset_.node_variable_[t.target_node_id_];
+            if (source == j) {
+                H_j.block<6, 6>(0, 0) += H_ss[k];
+                b_j += b_s[k];
+            }
+            if (target == j) {
+                H_j.block<6, 6>(0, 0) += H_tt[k];
+                b_j += b_t[k];
+            }
+            if (source == target) {
+                H_j.block<6, 6>(0, 0) += H_ts[k] + H_ts[k].transpose();
+            } else if (source >= 0 && target >= 0 &&
+                       std::min(source, target) == j) {
+                // Block (max, min) of the lower triangle.
+                int row = edge_block_[k] * 6;
+                if (target > source) {
+                    H_j.block<6, 6>(row, 0) += H_ts[k];
+                } else {
+                    H_j.block<6, 6>(row, 0) += H_ts[k].transpose();
+                }
+            }
+        }
+        b_.block<6, 1>(j * 6, 0) = b_j;
+    }
+
+    // The prior is dense over its nodes, its gradient is b - H d.
+    int n_prior = (int)subset_.prior_nodes_.size();
+    if (n_prior == 0) return;
+    Eigen::VectorXd prior_b =
+            subset_.prior_b_ -
+            subset_.prior_H_ * ComputePriorDisplacement(pose_graph, subset_);
+    for (int i = 0; i < n_prior; i++) {
+        int vi = subset_.node_variable_[subset_.prior_nodes_[i]];
+        b_.block<6, 1>(vi * 6, 0) += prior_b.block<6, 1>(i * 6, 0);
+        for (int j = 0; j < n_prior; j++) {
+            int vj = subset_.node_variable_[subset_.prior_nodes_[j]];
+            if (vi < vj) continue;
+            // Block (vi, vj) of the lower triangle.
+            Eigen::Map<Eigen::MatrixXd> H_j(values + outer[vj * 6],
+                                            outer[vj * 6 + 1] - outer[vj * 6],
+                                            6);
+            H_j.block<6, 6>(prior_block_[i * n_prior + j] * 6, 0) +=
+                    subset_.prior_H_.block<6, 6>(i * 6, j * 6);
+        }
+    }
+}
+
+std::tuple<bool, Eigen::VectorXd> PoseGraphLinearSystem::Solve(
+        double lambda /* = 0.0*/) {
+    const Eigen::SparseMatrix<double> *A = &H_;
+    if (lambda != 0.0) {
+        H_LM_ = H_;
+        double *values = H_LM_.valuePtr();
+        for (int index : diagonal_index_) {
+            values[index] += lambda;
+        }
+        A = &H_LM_;
+    }
+    solver_.factorize(*A);
+    if (solver_.info() == Eigen::Success) {
+        Eigen::VectorXd x = solver_.solve(b_);
+        if (solver_.info() == Eigen::Success) {
+            return std::make_tuple(true, std::move(x));
+        }
+    }
+    utility::LogWarning(
+            "Sparse Cholesky factorization of the pose graph failed.");
+    return std::make_tuple(false, Eigen::VectorXd::Zero(b_.rows()));
+}
+
+Eigen::VectorXd UpdatePoseVector(const PoseGraph &pose_graph,
+                                 const PoseGraphSubset &subset) {
+    int n_variables = (int)subset.variable_node_.size();
+    Eigen::VectorXd output(n_variables * 6);
+    for (int v = 0; v < n_variables; v++) {
         Eigen::Vector6d output_iter = utility::TransformMatrix4dToVector6d(
-                pose_graph.nodes_[iter_node].pose_);
-        output.block<6, 1>(iter_node * 6, 0) = output_iter;
+                pose_graph.nodes_[subset.variable_node_[v]].pose_);
+        output.block<6, 1>(v * 6, 0) = output_iter;
     }
     return output;
 }
 
-std::shared_ptr<PoseGraph> UpdatePoseGraph(const PoseGraph &pose_graph,
-                                           const Eigen::VectorXd delta) {
-    std::shared_ptr<PoseGraph> pose_graph_updated =
-            std::make_shared<PoseGraph>();
-    *pose_graph_updated = pose_graph;
-    int n_nodes = (int)pose_graph.nodes_.size();
-    for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
-        Eigen::Vector6d delta_iter = delta.block<6, 1>(iter_node * 6, 0);
-        pose_graph_updated->nodes_[iter_node].pose_ =
-                utility::TransformVector6dToMatrix4d(delta_iter) *
-                pose_graph_updated->nodes_[iter_node].pose_;
+std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> GetPoses(
+        const PoseGraph &pose_graph, const PoseGraphSubset &subset) {
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    poses.reserve(subset.variable_node_.size());
+    for (int iter_node : subset.variable_node_) {
+        poses.push_back(pose_graph.nodes_[iter_node].pose_);
+    }
+    return poses;
+}
+
+void SetPoses(PoseGraph &pose_graph,
+              const PoseGraphSubset &subset,
+              const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                      &poses) {
+    for (size_t v = 0; v < subset.variable_node_.size(); v++) {
+        pose_graph.nodes_[subset.variable_node_[v]].pose_ = poses[v];
+    }
+}
+
+void UpdatePoseGraph(PoseGraph &pose_graph,
+                     const PoseGraphSubset &subset,
+                     const Eigen::VectorXd &delta) {
+    int n_variables = (int)subset.variable_node_.size();
+    for (int v = 0; v < n_variables; v++) {
+        Eigen::Vector6d delta_iter = delta.block<6, 1>(v * 6, 0);
+        PoseGraphNode &node = pose_graph.nodes_[subset.variable_node_[v]];
+        node.pose_ = utility::TransformVector6dToMatrix4d(delta_iter) *
+                     node.pose_;
     }
-    return pose_graph_updated;
 }
 
 bool CheckRightTerm(const Eigen::VectorXd &right_term,
@@ -460,105 +806,73 @@ bool ValidatePoseGraph(const PoseGraph &pose_graph) {
     return true;
 }
 
-}  // unnamed namespace
-
-namespace registration {
-std::shared_ptr<PoseGraph> CreatePoseGraphWithoutInvalidEdges(
-        const PoseGraph &pose_graph, const GlobalOptimizationOption &option) {
-    std::shared_ptr<PoseGraph> pose_graph_pruned =
-            std::make_shared<PoseGraph>();
-
-    int n_nodes = (int)pose_graph.nodes_.size();
-    for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
-        const PoseGraphNode &t = pose_graph.nodes_[iter_node];
-        pose_graph_pruned->nodes_.push_back(t);
-    }
-    int n_edges = (int)pose_graph.edges_.size();
-    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
-        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
-        if (t.uncertain_) {
-            if (t.confidence_ > option.edge_prune_threshold_) {
-                pose_graph_pruned->edges_.push_back(t);
-            }
-        } else {
-            pose_graph_pruned->edges_.push_back(t);
-        }
-    }
-    return pose_graph_pruned;
-}
-
-void GlobalOptimizationGaussNewton::OptimizePoseGraph(
-        PoseGraph &pose_graph,
-        const GlobalOptimizationConvergenceCriteria &criteria,
-        const GlobalOptimizationOption &option) const {
-    int n_nodes = (int)pose_graph.nodes_.size();
-    int n_edges = (int)pose_graph.edges_.size();
+/// Gauss-Newton optimization of the variables of subset, in place.
+void OptimizeGaussNewton(PoseGraph &pose_graph,
+                         const PoseGraphSubset &subset,
+                         const GlobalOptimizationConvergenceCriteria &criteria,
+                         const GlobalOptimizationOption &option) {
+    const std::vector<int> &edges = subset.edges_;
     double line_process_weight = ComputeLineProcessWeight(pose_graph, option);
-
-    utility::LogDebug(
-            "[GlobalOptimizationGaussNewton] Optimizing PoseGraph having {:d} "
-            "nodes and {:d} edges.",
-            n_nodes, n_edges);
     utility::LogDebug("Line process weight : {:f}", line_process_weight);
 
-    Eigen::VectorXd zeta = ComputeZeta(pose_graph);
+    Eigen::VectorXd zeta = ComputeZeta(pose_graph, edges);
     double current_residual, new_residual;
-    new_residual =
-            ComputeResidual(pose_graph, zeta, line_process_weight, option);
+    new_residual = ComputeResidual(pose_graph, edges, zeta,
+                                   line_process_weight, option);
+    new_residual += ComputePriorResidual(pose_graph, subset);
     current_residual = new_residual;
 
     int valid_edges_num;
-    valid_edges_num =
-            UpdateConfidence(pose_graph, zeta, line_process_weight, option);
+    valid_edges_num = UpdateConfidence(pose_graph, edges, zeta,
+                                       line_process_weight, option);
 
-    Eigen::MatrixXd H;
-    Eigen::VectorXd b;
-    Eigen::VectorXd x = UpdatePoseVector(pose_graph);
+    PoseGraphLinearSystem linear_system(pose_graph, subset);
+    const Eigen::VectorXd &b = linear_system.GetRightTerm();
+    Eigen::VectorXd x = UpdatePoseVector(pose_graph, subset);
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    linear_system.Compute(pose_graph, zeta);
 
     utility::LogDebug("[Initial     ] residual : {:e}", current_residual);
 
     bool stop = false;
     if (CheckRightTerm(b, criteria)) return;
 
-    utility::Timer timer_overall;
-    timer_overall.Start();
     int iter;
     for (iter = 0; !stop; iter++) {
         utility::Timer timer_iter;
         timer_iter.Start();
 
-        Eigen::VectorXd delta(H.cols());
+        Eigen::VectorXd delta;
         bool solver_success = false;
 
-        // Solve H_LM @ delta == b using a sparse solver
-        std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                H, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                /*check_det=*/false, /*check_psd=*/false);
+        // Solve H @ delta == b reusing the symbolic factorization of H
+        std::tie(solver_success, delta) = linear_system.Solve();
 
         stop = stop || CheckRelativeIncrement(delta, x, criteria);
         if (stop) {
             break;
         } else {
-            std::shared_ptr<PoseGraph> pose_graph_new =
-                    UpdatePoseGraph(pose_graph, delta);
+            auto poses = GetPoses(pose_graph, subset);
+            UpdatePoseGraph(pose_graph, subset, delta);
 
             Eigen::VectorXd zeta_new;
-            zeta_new = ComputeZeta(*pose_graph_new);
-            new_residual = ComputeResidual(pose_graph, zeta_new,
+            zeta_new = ComputeZeta(pose_graph, edges);
+            new_residual = ComputeResidual(pose_graph, edges, zeta_new,
                                            line_process_weight, option);
+            new_residual += ComputePriorResidual(pose_graph, subset);
             stop = stop || CheckRelativeResidualIncrement(
                                    current_residual, new_residual, criteria);
-            if (stop) break;
+            if (stop) {
+                SetPoses(pose_graph, subset, poses);
+                break;
+            }
             current_residual = new_residual;
 
             zeta = zeta_new;
-            pose_graph = *pose_graph_new;
-            x = UpdatePoseVector(pose_graph);
-            valid_edges_num = UpdateConfidence(pose_graph, zeta,
+            x = UpdatePoseVector(pose_graph, subset);
+            valid_edges_num = UpdateConfidence(pose_graph, edges, zeta,
                                                line_process_weight, option);
-            std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+            linear_system.Compute(pose_graph, zeta);
 
             stop = stop || CheckRightTerm(b, criteria);
             if (stop) break;
@@ -573,43 +887,35 @@ void GlobalOptimizationGaussNewton::OptimizePoseGraph(
         stop = stop || CheckResidual(current_residual, criteria) ||
                CheckMaxIteration(iter, criteria);
     }  // end for
-    timer_overall.Stop();
-    utility::LogDebug(
-            "[GlobalOptimizationGaussNewton] total time : {:.3f} sec.",
-            timer_overall.GetDuration() / 1000.0);
 }
 
-void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
+/// Levenberg-Marquardt optimization of the variables of subset, in place.
+void OptimizeLevenbergMarquardt(
         PoseGraph &pose_graph,
+        const PoseGraphSubset &subset,
         const GlobalOptimizationConvergenceCriteria &criteria,
-        const GlobalOptimizationOption &option) const {
-    int n_nodes = (int)pose_graph.nodes_.size();
-    int n_edges = (int)pose_graph.edges_.size();
+        const GlobalOptimizationOption &option) {
+    const std::vector<int> &edges = subset.edges_;
     double line_process_weight = ComputeLineProcessWeight(pose_graph, option);
-
-    utility::LogDebug(
-            "[GlobalOptimizationLM] Optimizing PoseGraph having {:d} nodes and "
-            "{:d} edges.",
-            n_nodes, n_edges);
     utility::LogDebug("Line process weight : {:f}", line_process_weight);
 
-    Eigen::VectorXd zeta = ComputeZeta(pose_graph);
+    Eigen::VectorXd zeta = ComputeZeta(pose_graph, edges);
     double current_residual, new_residual;
-    new_residual =
-            ComputeResidual(pose_graph, zeta, line_process_weight, option);
+    new_residual = ComputeResidual(pose_graph, edges, zeta,
+                                   line_process_weight, option);
+    new_residual += ComputePriorResidual(pose_graph, subset);
     current_residual = new_residual;
 
-    int valid_edges_num =
-            UpdateConfidence(pose_graph, zeta, line_process_weight, option);
+    int valid_edges_num = UpdateConfidence(pose_graph, edges, zeta,
+                                           line_process_weight, option);
 
-    Eigen::MatrixXd H_I = Eigen::MatrixXd::Identity(n_nodes * 6, n_nodes * 6);
-    Eigen::MatrixXd H;
-    Eigen::VectorXd b;
-    Eigen::VectorXd x = UpdatePoseVector(pose_graph);
+    PoseGraphLinearSystem linear_system(pose_graph, subset);
+    const Eigen::VectorXd &b = linear_system.GetRightTerm();
+    Eigen::VectorXd x = UpdatePoseVector(pose_graph, subset);
 
-    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+    linear_system.Compute(pose_graph, zeta);
 
-    Eigen::VectorXd H_diag = H.diagonal();
+    Eigen::VectorXd H_diag = linear_system.GetDiagonal();
     double tau = 1e-5;
     double current_lambda = tau * H_diag.maxCoeff();
     double ni = 2.0;
@@ -622,38 +928,39 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
     stop = stop || CheckRightTerm(b, criteria);
     if (stop) return;
 
-    utility::Timer timer_overall;
-    timer_overall.Start();
     for (int iter = 0; !stop; iter++) {
         utility::Timer timer_iter;
         timer_iter.Start();
         int lm_count = 0;
         do {
-            Eigen::MatrixXd H_LM = H + current_lambda * H_I;
-            Eigen::VectorXd delta(H_LM.cols());
+            Eigen::VectorXd delta;
             bool solver_success = false;
 
-            // Solve H_LM @ delta == b using a sparse solver
-            std::tie(solver_success, delta) = utility::SolveLinearSystemPSD(
-                    H_LM, b, /*prefer_sparse=*/true, /*check_symmetric=*/false,
-                    /*check_det=*/false, /*check_psd=*/false);
+            // Solve (H + lambda * I) @ delta == b reusing the symbolic
+            // factorization of H
+            std::tie(solver_success, delta) =
+                    linear_system.Solve(current_lambda);
 
             stop = stop || CheckRelativeIncrement(delta, x, criteria);
             if (!stop) {
-                std::shared_ptr<PoseGraph> pose_graph_new =
-                        UpdatePoseGraph(pose_graph, delta);
+                auto poses = GetPoses(pose_graph, subset);
+                UpdatePoseGraph(pose_graph, subset, delta);
 
                 Eigen::VectorXd zeta_new;
-                zeta_new = ComputeZeta(*pose_graph_new);
-                new_residual = ComputeResidual(pose_graph, zeta_new,
+                zeta_new = ComputeZeta(pose_graph, edges);
+                new_residual = ComputeResidual(pose_graph, edges, zeta_new,
                                                line_process_weight, option);
+                new_residual += ComputePriorResidual(pose_graph, subset);
                 rho = (current_residual - new_residual) /
                       (delta.dot(current_lambda * delta + b) + 1e-3);
                 if (rho > 0) {
                     stop = stop ||
                            CheckRelativeResidualIncrement(
                                    current_residual, new_residual, criteria);
-                    if (stop) break;
+                    if (stop) {
+                        SetPoses(pose_graph, subset, poses);
+                        break;
+                    }
                     double alpha = 1. - pow((2 * rho - 1), 3);
                     alpha = (std::min)(alpha, criteria.upper_scale_factor_);
                     double scaleFactor =
@@ -663,15 +970,16 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
                     current_residual = new_residual;
 
                     zeta = zeta_new;
-                    pose_graph = *pose_graph_new;
-                    x = UpdatePoseVector(pose_graph);
+                    x = UpdatePoseVector(pose_graph, subset);
                     valid_edges_num = UpdateConfidence(
-                            pose_graph, zeta, line_process_weight, option);
-                    std::tie(H, b) = ComputeLinearSystem(pose_graph, zeta);
+                            pose_graph, edges, zeta, line_process_weight,
+                            option);
+                    linear_system.Compute(pose_graph, zeta);
 
                     stop = stop || CheckRightTerm(b, criteria);
                     if (stop) break;
                 } else {
+                    SetPoses(pose_graph, subset, poses);
                     current_lambda *= ni;
                     ni *= 2;
                 }
@@ -691,6 +999,236 @@ void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
         stop = stop || CheckResidual(current_residual, criteria) ||
                CheckMaxIteration(iter, criteria);
     }  // end for
+}
+
+/// Largest number of prior nodes of a windowed update. The prior couples all
+/// of its nodes, so larger priors are slower to factorize than the sparse
+/// system of all nodes.
+const int MAX_PRIOR_NODES = 32;
+
+/// Subset optimizing the nodes from first_node on, except fixed_node, and the
+/// older nodes sharing an edge with them. The other older nodes are
+/// marginalized: the edges between older nodes are linearized at the current
+/// poses, and their Schur complement becomes the prior of the subset.
+/// Returns false if the prior has more than MAX_PRIOR_NODES nodes or if the
+/// marginalized nodes are not constrained.
+bool CreateWindowPoseGraphSubset(const PoseGraph &pose_graph,
+                                 int first_node,
+                                 int fixed_node,
+                                 PoseGraphSubset &subset,
+                                 PoseGraphMarginalization &marginalization) {
+    int n_nodes = (int)pose_graph.nodes_.size();
+    int n_edges = (int)pose_graph.edges_.size();
+    std::vector<bool> is_prior_node(first_node, false);
+    PoseGraphSubset old_subset;
+    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+        if (t.source_node_id_ < first_node && t.target_node_id_ < first_node) {
+            old_subset.edges_.push_back(iter_edge);
+            continue;
+        }
+        subset.edges_.push_back(iter_edge);
+        if (t.source_node_id_ < first_node) {
+            is_prior_node[t.source_node_id_] = true;
+        }
+        if (t.target_node_id_ < first_node) {
+            is_prior_node[t.target_node_id_] = true;
+        }
+    }
+
+    // Older nodes are variables of old_subset, either kept as prior nodes or
+    // marginalized.
+    subset.node_variable_.assign(n_nodes, -1);
+    old_subset.node_variable_.assign(n_nodes, -1);
+    std::vector<int> old_variable_index;
+    for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
+        if (iter_node == fixed_node) continue;
+        if (iter_node < first_node) {
+            old_subset.node_variable_[iter_node] =
+                    (int)old_subset.variable_node_.size();
+            old_subset.variable_node_.push_back(iter_node);
+            if (!is_prior_node[iter_node]) {
+                old_variable_index.push_back(
+                        (int)marginalization.nodes_.size());
+                marginalization.nodes_.push_back(iter_node);
+                continue;
+            }
+            old_variable_index.push_back((int)subset.prior_nodes_.size());
+            subset.prior_nodes_.push_back(iter_node);
+            subset.prior_poses_.push_back(pose_graph.nodes_[iter_node].pose_);
+        }
+        subset.node_variable_[iter_node] = (int)subset.variable_node_.size();
+        subset.variable_node_.push_back(iter_node);
+    }
+    if ((int)subset.prior_nodes_.size() > MAX_PRIOR_NODES) return false;
+    if (subset.prior_nodes_.empty()) {
+        // Only the fixed node is shared, the older nodes stay as they are.
+        marginalization = PoseGraphMarginalization();
+        return true;
+    }
+
+    PoseGraphLinearSystem old_system(pose_graph, old_subset);
+    old_system.Compute(pose_graph, ComputeZeta(pose_graph, old_subset.edges_));
+    Eigen::SparseMatrix<double> H = old_system.GetMatrix();
+    const Eigen::VectorXd &b = old_system.GetRightTerm();
+
+    // Split H and b into the marginalized (m) and prior (p) variables.
+    int n_m = (int)marginalization.nodes_.size() * 6;
+    int n_p = (int)subset.prior_nodes_.size() * 6;
+    auto IsPrior = [&](int row) {
+        return is_prior_node[old_subset.variable_node_[row / 6]];
+    };
+    auto GetIndex = [&](int row) {
+        return old_variable_index[row / 6] * 6 + row % 6;
+    };
+    std::vector<Eigen::Triplet<double>> H_mm_triplets;
+    Eigen::MatrixXd H_mp = Eigen::MatrixXd::Zero(n_m, n_p);
+    Eigen::MatrixXd H_pp = Eigen::MatrixXd::Zero(n_p, n_p);
+    Eigen::VectorXd b_m(n_m), b_p(n_p);
+    for (int col = 0; col < H.outerSize(); col++) {
+        for (Eigen::SparseMatrix<double>::InnerIterator it(H, col); it;
+             ++it) {
+            int row = (int)it.row();
+            if (!IsPrior(col)) {
+                if (!IsPrior(row)) {
+                    H_mm_triplets.emplace_back(GetIndex(row), GetIndex(col),
+                                               it.value());
+                }
+            } else if (IsPrior(row)) {
+                H_pp(GetIndex(row), GetIndex(col)) = it.value();
+            } else {
+                H_mp(GetIndex(row), GetIndex(col)) = it.value();
+            }
+        }
+    }
+    for (int row = 0; row < (int)b.rows(); row++) {
+        (IsPrior(row) ? b_p : b_m)(GetIndex(row)) = b(row);
+    }
+
+    marginalization.delta_.setZero(n_m);
+    marginalization.gain_.setZero(n_m, n_p);
+    if (n_m > 0) {
+        Eigen::SparseMatrix<double> H_mm(n_m, n_m);
+        H_mm.setFromTriplets(H_mm_triplets.begin(), H_mm_triplets.end());
+        Eigen::SimplicialLDLT<Eigen::SparseMatrix<double>, Eigen::Lower,
+                              Eigen::AMDOrdering<int>>
+                solver(H_mm);
+        if (solver.info() != Eigen::Success) return false;
+        marginalization.delta_ = solver.solve(b_m);
+        marginalization.gain_ = solver.solve(H_mp);
+        if (!marginalization.delta_.allFinite() ||
+            !marginalization.gain_.allFinite()) {
+            return false;
+        }
+    }
+    subset.prior_H_ = H_pp - H_mp.transpose() * marginalization.gain_;
+    subset.prior_b_ = b_p - marginalization.gain_.transpose() * b_m;
+    return true;
+}
+
+/// Function to apply the linearized update of the marginalized nodes for the
+/// current displacement of the prior nodes.
+void UpdateMarginalizedNodes(PoseGraph &pose_graph,
+                             const PoseGraphSubset &subset,
+                             const PoseGraphMarginalization &marginalization) {
+    if (marginalization.nodes_.empty()) return;
+    Eigen::VectorXd delta =
+            marginalization.delta_ -
+            marginalization.gain_ *
+                    ComputePriorDisplacement(pose_graph, subset);
+    for (size_t i = 0; i < marginalization.nodes_.size(); i++) {
+        PoseGraphNode &node = pose_graph.nodes_[marginalization.nodes_[i]];
+        node.pose_ = utility::TransformVector6dToMatrix4d(
+                             delta.block<6, 1>(i * 6, 0)) *
+                     node.pose_;
+    }
+}
+
+/// Function to remove the uncertain edges having
+/// confidence_ <= edge_prune_threshold_ from a list of edges.
+/// Returns the number of removed edges.
+int RemoveInvalidEdges(const PoseGraph &pose_graph,
+                       std::vector<int> &edges,
+                       const GlobalOptimizationOption &option) {
+    size_t n_edges = edges.size();
+    edges.erase(std::remove_if(edges.begin(), edges.end(),
+                               [&](int iter_edge) {
+                                   const PoseGraphEdge &t =
+                                           pose_graph.edges_[iter_edge];
+                                   return t.uncertain_ &&
+                                          t.confidence_ <=
+                                                  option.edge_prune_threshold_;
+                               }),
+                edges.end());
+    return int(n_edges - edges.size());
+}
+
+}  // unnamed namespace
+
+namespace registration {
+std::shared_ptr<PoseGraph> CreatePoseGraphWithoutInvalidEdges(
+        const PoseGraph &pose_graph, const GlobalOptimizationOption &option) {
+    std::shared_ptr<PoseGraph> pose_graph_pruned =
+            std::make_shared<PoseGraph>();
+
+    int n_nodes = (int)pose_graph.nodes_.size();
+    for (int iter_node = 0; iter_node < n_nodes; iter_node++) {
+        const PoseGraphNode &t = pose_graph.nodes_[iter_node];
+        pose_graph_pruned->nodes_.push_back(t);
+    }
+    int n_edges = (int)pose_graph.edges_.size();
+    for (int iter_edge = 0; iter_edge < n_edges; iter_edge++) {
+        const PoseGraphEdge &t = pose_graph.edges_[iter_edge];
+        if (t.uncertain_) {
+            if (t.confidence_ > option.edge_prune_threshold_) {
+                pose_graph_pruned->edges_.push_back(t);
+            }
+        } else {
+            pose_graph_pruned->edges_.push_back(t);
+        }
+    }
+    return pose_graph_pruned;
+}
+
+void GlobalOptimizationGaussNewton::OptimizePoseGraph(
+        PoseGraph &pose_graph,
+        const GlobalOptimizationConvergenceCriteria &criteria,
+        const GlobalOptimizationOption &option) const {
+    int n_nodes = (int)pose_graph.nodes_.size();
+    int n_edges = (int)pose_graph.edges_.size();
+
+    utility::LogDebug(
+            "[GlobalOptimizationGaussNewton] Optimizing PoseGraph having {:d} "
+            "nodes and {:d} edges.",
+            n_nodes, n_edges);
+
+    utility::Timer timer_overall;
+    timer_overall.Start();
+    OptimizeGaussNewton(pose_graph, CreateFullPoseGraphSubset(pose_graph),
+                        criteria, option);
+    timer_overall.Stop();
+    utility::LogDebug(
+            "[GlobalOptimizationGaussNewton] total time : {:.3f} sec.",
+            timer_overall.GetDuration() / 1000.0);
+}
+
+void GlobalOptimizationLevenbergMarquardt::OptimizePoseGraph(
+        PoseGraph &pose_graph,
+        const GlobalOptimizationConvergenceCriteria &criteria,
+        const GlobalOptimizationOption &option) const {
+    int n_nodes = (int)pose_graph.nodes_.size();
+    int n_edges = (int)pose_graph.edges_.size();
+
+    utility::LogDebug(
+            "[GlobalOptimizationLM] Optimizing PoseGraph having {:d} nodes and "
+            "{:d} edges.",
+            n_nodes, n_edges);
+
+    utility::Timer timer_overall;
+    timer_overall.Start();
+    OptimizeLevenbergMarquardt(pose_graph,
+                               CreateFullPoseGraphSubset(pose_graph), criteria,
+                               option);
     timer_overall.Stop();
     utility::LogDebug("[GlobalOptimizationLM] total time : {:.3f} sec.",
                       timer_overall.GetDuration() / 1000.0);
@@ -717,5 +1255,83 @@ void GlobalOptimization(PoseGraph &pose_graph,
     pose_graph = *pose_graph_pre_pruned_2;
 }
 
+IncrementalGlobalOptimization::IncrementalGlobalOptimization(
+        const GlobalOptimizationConvergenceCriteria &criteria
+        /* = GlobalOptimizationConvergenceCriteria() */,
+        const GlobalOptimizationOption &option
+        /* = GlobalOptimizationOption() */,
+        int window_size /* = 100 */)
+    : criteria_(criteria), option_(option), window_size_(window_size) {
+    if (window_size < 1) {
+        utility::LogError(
+                "[IncrementalGlobalOptimization] window_size must be "
+                "positive.");
+    }
+}
+
+int IncrementalGlobalOptimization::AddNode(const PoseGraphNode &node) {
+    int node_id = (int)pose_graph_.nodes_.size();
+    pose_graph_.nodes_.push_back(node);
+    if (first_modified_node_ < 0) first_modified_node_ = node_id;
+    return node_id;
+}
+
+void IncrementalGlobalOptimization::AddEdge(const PoseGraphEdge &edge) {
+    int n_nodes = (int)pose_graph_.nodes_.size();
+    if (edge.source_node_id_ < 0 || edge.source_node_id_ >= n_nodes ||
+        edge.target_node_id_ < 0 || edge.target_node_id_ >= n_nodes) {
+        utility::LogError(
+                "[IncrementalGlobalOptimization] Edge ({:d}, {:d}) references "
+                "an invalid node.",
+                edge.source_node_id_, edge.target_node_id_);
+    }
+    pose_graph_.edges_.push_back(edge);
+    int oldest_node = std::min(edge.source_node_id_, edge.target_node_id_);
+    if (first_modified_node_ < 0 || oldest_node < first_modified_node_) {
+        first_modified_node_ = oldest_node;
+    }
+}
+
+void IncrementalGlobalOptimization::Optimize() {
+    if (first_modified_node_ < 0) return;
+    int n_nodes = (int)pose_graph_.nodes_.size();
+    int fixed_node = 0;
+    if (option_.reference_node_ >= 0 && option_.reference_node_ < n_nodes) {
+        fixed_node = option_.reference_node_;
+    }
+    // Updates reaching before the window optimize the window and marginalize
+    // the older nodes instead of optimizing all nodes from the oldest one.
+    int window_begin = n_nodes - window_size_;
+    PoseGraphSubset subset;
+    PoseGraphMarginalization marginalization;
+    if (first_modified_node_ >= window_begin ||
+        !CreateWindowPoseGraphSubset(pose_graph_, window_begin, fixed_node,
+                                     subset, marginalization)) {
+        subset = CreateTrailingPoseGraphSubset(
+                pose_graph_, first_modified_node_, fixed_node);
+        marginalization = PoseGraphMarginalization();
+    }
+    if (!subset.variable_node_.empty()) {
+        utility::LogDebug(
+                "[IncrementalGlobalOptimization] Optimizing {:d} of {:d} nodes "
+                "and {:d} of {:d} edges, {:d} nodes marginalized.",
+                subset.variable_node_.size(), n_nodes, subset.edges_.size(),
+                pose_graph_.edges_.size(), marginalization.nodes_.size());
+        OptimizeLevenbergMarquardt(pose_graph_, subset, criteria_, option_);
+        // Optimize again without the edges rejected by the line process, as
+        // GlobalOptimization does with CreatePoseGraphWithoutInvalidEdges.
+        // The rejected edges stay in the graph and are evaluated again by the
+        // next update touching them, so that a loop closure rejected against
+        // the drifted odometry can be accepted once more loop closures agree
+        // with it.
+        if (RemoveInvalidEdges(pose_graph_, subset.edges_, option_) > 0) {
+            OptimizeLevenbergMarquardt(pose_graph_, subset, criteria_,
+                                       option_);
+        }
+        UpdateMarginalizedNodes(pose_graph_, subset, marginalization);
+    }
+    first_modified_node_ = -1;
+}
+
 }  // namespace registration
 }  // namespace open3d
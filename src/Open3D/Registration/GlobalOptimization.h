@@ -30,12 +30,11 @@
 
 #include "Open3D/Registration/GlobalOptimizationConvergenceCriteria.h"
 #include "Open3D/Registration/GlobalOptimizationMethod.h"
+#include "Open3D/Registration/PoseGraph.h"
 
 namespace open3d {
 namespace registration {
 
-class PoseGraph;
-
 /// Function to optimize a PoseGraph
 /// Reference:
 /// [Kümmerle et al 2011]
@@ -61,5 +60,72 @@ void GlobalOptimization(
 std::shared_ptr<PoseGraph> CreatePoseGraphWithoutInvalidEdges(
         const PoseGraph &pose_graph, const GlobalOptimizationOption &option);
 
+/// \class IncrementalGlobalOptimization
+///
+/// \brief Incremental pose graph optimization for nodes and edges that are
+/// added while the graph is being built, e.g. by an online reconstruction.
+///
+/// This is a windowed approximation of GlobalOptimization, not a smoother
+/// that keeps a factorization across updates. Optimize() relinearizes and
+/// solves, with Levenberg-Marquardt, the nodes from the oldest node touched by
+/// the nodes and edges added since the last call up to the newest node. If
+/// these are at most the newest window_size nodes, older nodes are held fixed
+/// at their current poses and are not marginalized, so their uncertainty is
+/// ignored. Adding odometry therefore only moves the last poses. An update
+/// reaching further back, such as a loop closure, only optimizes the newest
+/// window_size nodes and the older nodes sharing an edge with them. The other
+/// nodes are marginalized into a prior on those older nodes: the edges between
+/// older nodes are linearized once at the current poses, and the marginalized
+/// nodes receive the corresponding linear correction after the update. Such
+/// an update costs one sparse factorization over the older nodes instead of a
+/// full nonlinear solve, but it does not relinearize the older edges. The
+/// prior is dense, so if it would couple more than 32 older nodes, or if the
+/// marginalized nodes are not constrained by their edges, the update falls
+/// back to optimizing all nodes from the oldest one touched.
+/// The reference node (or the first node if option.reference_node_ is -1) is
+/// never moved. As in GlobalOptimization, uncertain edges are weighted by the
+/// line process of [Choi et al 2015], and every update is optimized a second
+/// time without the edges having confidence_ < option.edge_prune_threshold_.
+/// Rejected edges are kept in the graph and evaluated again by later updates;
+/// use CreatePoseGraphWithoutInvalidEdges() to remove them.
+class IncrementalGlobalOptimization {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param criteria Convergence criteria of every update.
+    /// \param option Global optimization options.
+    /// \param window_size Number of newest nodes optimized by the updates
+    /// that reach further back.
+    IncrementalGlobalOptimization(
+            const GlobalOptimizationConvergenceCriteria &criteria =
+                    GlobalOptimizationConvergenceCriteria(),
+            const GlobalOptimizationOption &option = GlobalOptimizationOption(),
+            int window_size = 100);
+    ~IncrementalGlobalOptimization() {}
+
+public:
+    /// \brief Adds a node to the graph and returns its id.
+    int AddNode(const PoseGraphNode &node);
+
+    /// \brief Adds an edge between two nodes of the graph.
+    void AddEdge(const PoseGraphEdge &edge);
+
+    /// \brief Optimizes the nodes affected by the nodes and edges added since
+    /// the last call.
+    void Optimize();
+
+    /// \brief Returns the optimized pose graph.
+    const PoseGraph &GetPoseGraph() const { return pose_graph_; }
+
+protected:
+    GlobalOptimizationConvergenceCriteria criteria_;
+    GlobalOptimizationOption option_;
+    /// Number of newest nodes optimized by the updates reaching further back.
+    int window_size_;
+    PoseGraph pose_graph_;
+    /// Oldest node touched since the last call of Optimize(), -1 if none.
+    int first_modified_node_ = -1;
+};
+
 }  // namespace registration
 }  // namespace open3d
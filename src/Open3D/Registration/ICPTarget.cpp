@@ -0,0 +1,181 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/ICPTarget.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace registration {
+
+namespace {
+
+/// Maximum number of points in a leaf of the search tree.
+const int leaf_size = 32;
+
+}  // unnamed namespace
+
+ICPTarget::ICPTarget(const geometry::PointCloud &target) {
+    SetPointCloud(target);
+}
+
+bool ICPTarget::SetPointCloud(const geometry::PointCloud &target) {
+    nodes_.clear();
+    x_.clear();
+    y_.clear();
+    z_.clear();
+    nx_.clear();
+    ny_.clear();
+    nz_.clear();
+    indices_.clear();
+    origin_.setZero();
+    if (!target.HasPoints()) {
+        utility::LogWarning("[ICPTarget] Target point cloud has no points.");
+        return false;
+    }
+
+    int num_points = (int)target.points_.size();
+    origin_ = 0.5 * (target.GetMinBound() + target.GetMaxBound());
+    std::vector<Eigen::Vector3f> points(num_points);
+    for (int i = 0; i < num_points; i++) {
+        points[i] = (target.points_[i] - origin_).cast<float>();
+    }
+    std::vector<int> order(num_points);
+    std::iota(order.begin(), order.end(), 0);
+    nodes_.reserve(4 * (num_points / leaf_size + 1));
+    BuildNode(0, num_points, order, points);
+
+    x_.resize(num_points);
+    y_.resize(num_points);
+    z_.resize(num_points);
+    for (int i = 0; i < num_points; i++) {
+        x_[i] = points[order[i]](0);
+        y_[i] = points[order[i]](1);
+        z_[i] = points[order[i]](2);
+    }
+    if (target.HasNormals()) {
+        nx_.resize(num_points);
+        ny_.resize(num_points);
+        nz_.resize(num_points);
+        for (int i = 0; i < num_points; i++) {
+            const Eigen::Vector3d &normal = target.normals_[order[i]];
+            nx_[i] = float(normal(0));
+            ny_[i] = float(normal(1));
+            nz_[i] = float(normal(2));
+        }
+    }
+    indices_ = std::move(order);
+    return true;
+}
+
+int ICPTarget::BuildNode(int begin,
+                         int end,
+                         std::vector<int> &order,
+                         const std::vector<Eigen::Vector3f> &points) {
+    int node = (int)nodes_.size();
+    nodes_.push_back(Node{0.0f, -1, -1, begin, end});
+    if (end - begin <= leaf_size) {
+        return node;
+    }
+
+    // Split at the median of the dimension with the largest extent.
+    Eigen::Vector3f min_bound = points[order[begin]];
+    Eigen::Vector3f max_bound = min_bound;
+    for (int i = begin + 1; i < end; i++) {
+        min_bound = min_bound.cwiseMin(points[order[i]]);
+        max_bound = max_bound.cwiseMax(points[order[i]]);
+    }
+    int dim;
+    (max_bound - min_bound).maxCoeff(&dim);
+    int middle = begin + (end - begin) / 2;
+    std::nth_element(order.begin() + begin, order.begin() + middle,
+                     order.begin() + end, [&](int a, int b) {
+                         return points[a](dim) < points[b](dim);
+                     });
+    nodes_[node].split_ = points[order[middle]](dim);
+    nodes_[node].dim_ = dim;
+    BuildNode(begin, middle, order, points);
+    int right = BuildNode(middle, end, order, points);
+    nodes_[node].right_ = right;
+    return node;
+}
+
+int ICPTarget::SearchNearest(const Eigen::Vector3f &query,
+                             float &distance2) const {
+    int nearest = -1;
+    if (nodes_.empty()) {
+        return nearest;
+    }
+    Eigen::Vector3f offset = Eigen::Vector3f::Zero();
+    SearchNode(0, query, 0.0f, offset, distance2, nearest);
+    return nearest;
+}
+
+void ICPTarget::SearchNode(int node,
+                           const Eigen::Vector3f &query,
+                           float min_distance2,
+                           Eigen::Vector3f &offset,
+                           float &distance2,
+                           int &nearest) const {
+    const Node &n = nodes_[node];
+    if (n.dim_ < 0) {
+        for (int i = n.begin_; i < n.end_; i++) {
+            float dx = x_[i] - query(0);
+            float dy = y_[i] - query(1);
+            float dz = z_[i] - query(2);
+            float d2 = dx * dx + dy * dy + dz * dz;
+            if (d2 < distance2) {
+                distance2 = d2;
+                nearest = i;
+            }
+        }
+        return;
+    }
+
+    // Visit the side of the query first. The other side is only visited if
+    // its box, whose distance is tracked per dimension in offset, is closer
+    // than the nearest point found so far.
+    float diff = query(n.dim_) - n.split_;
+    int near_child = diff < 0.0f ? node + 1 : n.right_;
+    int far_child = diff < 0.0f ? n.right_ : node + 1;
+    SearchNode(near_child, query, min_distance2, offset, distance2, nearest);
+    float old_offset = offset(n.dim_);
+    float far_distance2 =
+            min_distance2 + diff * diff - old_offset * old_offset;
+    if (far_distance2 < distance2) {
+        offset(n.dim_) = diff;
+        SearchNode(far_child, query, far_distance2, offset, distance2,
+                   nearest);
+        offset(n.dim_) = old_offset;
+    }
+}
+
+}  // namespace registration
+}  // namespace open3d
@@ -0,0 +1,109 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <vector>
+
+namespace open3d {
+
+namespace geometry {
+class PointCloud;
+}
+
+namespace registration {
+
+/// \class ICPTarget
+///
+/// \brief Target point cloud prepared for repeated ICP registration.
+///
+/// The points, and normals if present, are stored in single precision
+/// structure-of-arrays buffers, relative to the center of the bounding box and
+/// sorted into the leaves of a 3D KD-tree. RegistrationICP searches this tree
+/// directly, so an ICPTarget can be built once and reused for many sources.
+class ICPTarget {
+public:
+    /// \brief Default Constructor.
+    ICPTarget() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param target The point cloud to register against.
+    ICPTarget(const geometry::PointCloud &target);
+    ~ICPTarget() {}
+
+public:
+    /// Builds the buffers and the search tree of the point cloud.
+    bool SetPointCloud(const geometry::PointCloud &target);
+    /// Returns `true` if the target contains no points.
+    bool IsEmpty() const { return indices_.empty(); }
+    /// Returns `true` if the target has normals.
+    bool HasNormals() const { return !nx_.empty(); }
+    /// \brief Finds the point nearest to `query` in the local frame.
+    ///
+    /// Only points with a squared distance below `distance2` are considered.
+    /// \return The position of the point in the buffers, or -1 if there is
+    /// none, in which case `distance2` is unchanged.
+    int SearchNearest(const Eigen::Vector3f &query, float &distance2) const;
+
+public:
+    /// Origin of the local frame in the coordinates of the point cloud.
+    Eigen::Vector3d origin_ = Eigen::Vector3d::Zero();
+    /// Coordinates of the points in the local frame, in KD-tree order.
+    std::vector<float> x_, y_, z_;
+    /// Normals in KD-tree order, empty if the point cloud has none.
+    std::vector<float> nx_, ny_, nz_;
+    /// Index in the original point cloud of every point.
+    std::vector<int> indices_;
+
+protected:
+    /// Inner nodes split at `split_` along `dim_`, their left child follows
+    /// them and the right child is stored in `right_`. Leaves have a negative
+    /// `dim_` and hold the points in [`begin_`, `end_`).
+    struct Node {
+        float split_;
+        int dim_;
+        int right_;
+        int begin_;
+        int end_;
+    };
+
+    int BuildNode(int begin,
+                  int end,
+                  std::vector<int> &order,
+                  const std::vector<Eigen::Vector3f> &points);
+    void SearchNode(int node,
+                    const Eigen::Vector3f &query,
+                    float min_distance2,
+                    Eigen::Vector3f &offset,
+                    float &distance2,
+                    int &nearest) const;
+
+    std::vector<Node> nodes_;
+};
+
+}  // namespace registration
+}  // namespace open3d
@@ -0,0 +1,173 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/MultiScaleICP.h"
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Utility/Console.h"
+
+namespace open3d {
+namespace registration {
+
+namespace {
+
+/// Estimates the normals of a level downsampled with voxel_size, or of the
+/// full resolution cloud if it has none, and normalizes the normals averaged
+/// by the downsampling otherwise.
+void PrepareLevelNormals(geometry::PointCloud &pcd,
+                         double voxel_size,
+                         bool estimate_normals) {
+    // Normals given at full resolution are kept.
+    if (estimate_normals && voxel_size > 0.0) {
+        pcd.EstimateNormals(
+                geometry::KDTreeSearchParamHybrid(2.0 * voxel_size, 30));
+    } else if (estimate_normals && !pcd.HasNormals()) {
+        pcd.EstimateNormals(geometry::KDTreeSearchParamKNN(30));
+    } else if (pcd.HasNormals()) {
+        pcd.NormalizeNormals();
+    }
+}
+
+/// Returns true if the estimation needs the normals of the target.
+bool RequiresNormals(const TransformationEstimation &estimation) {
+    return estimation.GetTransformationEstimationType() ==
+                   TransformationEstimationType::PointToPlane ||
+           estimation.GetTransformationEstimationType() ==
+                   TransformationEstimationType::GeneralizedICP;
+}
+
+}  // unnamed namespace
+
+MultiScaleICPTarget::MultiScaleICPTarget(const geometry::PointCloud &target,
+                                         const std::vector<double> &voxel_sizes,
+                                         bool estimate_normals /* = true*/) {
+    SetPointCloud(target, voxel_sizes, estimate_normals);
+}
+
+void MultiScaleICPTarget::SetPointCloud(
+        const geometry::PointCloud &target,
+        const std::vector<double> &voxel_sizes,
+        bool estimate_normals /* = true*/) {
+    voxel_sizes_.clear();
+    point_clouds_.clear();
+    icp_targets_.clear();
+    for (double voxel_size : voxel_sizes) {
+        if (GetLevel(voxel_size) >= 0) {
+            continue;
+        }
+        std::shared_ptr<geometry::PointCloud> pcd;
+        if (voxel_size > 0.0) {
+            pcd = target.VoxelDownSample(voxel_size);
+        } else {
+            pcd = std::make_shared<geometry::PointCloud>(target);
+        }
+        PrepareLevelNormals(*pcd, voxel_size, estimate_normals);
+        voxel_sizes_.push_back(voxel_size);
+        point_clouds_.push_back(pcd);
+        icp_targets_.push_back(std::make_shared<ICPTarget>(*pcd));
+    }
+}
+
+int MultiScaleICPTarget::GetLevel(double voxel_size) const {
+    for (size_t i = 0; i < voxel_sizes_.size(); i++) {
+        if (voxel_sizes_[i] == voxel_size ||
+            (voxel_sizes_[i] <= 0.0 && voxel_size <= 0.0)) {
+            return int(i);
+        }
+    }
+    return -1;
+}
+
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const MultiScaleICPTarget &target,
+        const std::vector<MultiScaleICPLevel> &levels,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPlane()*/) {
+    if (levels.empty()) {
+        utility::LogError("RegistrationMultiScaleICP requires a level.");
+    }
+    std::vector<int> target_levels;
+    for (const auto &level : levels) {
+        int target_level = target.GetLevel(level.voxel_size_);
+        if (target_level < 0) {
+            utility::LogError(
+                    "MultiScaleICPTarget has no level with voxel size {}.",
+                    level.voxel_size_);
+        }
+        target_levels.push_back(target_level);
+    }
+
+    // Generalized ICP also needs the normals of the source.
+    bool estimate_source_normals =
+            estimation.GetTransformationEstimationType() ==
+            TransformationEstimationType::GeneralizedICP;
+    RegistrationResult result(init);
+    for (size_t i = 0; i < levels.size(); i++) {
+        const MultiScaleICPLevel &level = levels[i];
+        std::shared_ptr<geometry::PointCloud> source_level;
+        if (level.voxel_size_ > 0.0) {
+            source_level = source.VoxelDownSample(level.voxel_size_);
+            PrepareLevelNormals(*source_level, level.voxel_size_,
+                                estimate_source_normals);
+        } else if (estimate_source_normals && !source.HasNormals()) {
+            source_level = std::make_shared<geometry::PointCloud>(source);
+            PrepareLevelNormals(*source_level, 0.0, true);
+        }
+        result = RegistrationICP(source_level ? *source_level : source,
+                                 *target.icp_targets_[target_levels[i]],
+                                 level.max_correspondence_distance_,
+                                 result.transformation_, estimation,
+                                 level.criteria_);
+        utility::LogDebug(
+                "Multi-scale ICP level {:d} (voxel size {:.4f}): Fitness "
+                "{:.4f}, RMSE {:.4f}",
+                (int)i, level.voxel_size_, result.fitness_,
+                result.inlier_rmse_);
+    }
+    return result;
+}
+
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<MultiScaleICPLevel> &levels,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPlane()*/) {
+    std::vector<double> voxel_sizes;
+    for (const auto &level : levels) {
+        voxel_sizes.push_back(level.voxel_size_);
+    }
+    MultiScaleICPTarget target_pyramid(target, voxel_sizes,
+                                       RequiresNormals(estimation));
+    return RegistrationMultiScaleICP(source, target_pyramid, levels, init,
+                                     estimation);
+}
+
+}  // namespace registration
+}  // namespace open3d
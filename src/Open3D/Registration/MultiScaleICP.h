@@ -0,0 +1,161 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+#include <Eigen/Core>
+#include <memory>
+#include <vector>
+
+#include "Open3D/Registration/ICPTarget.h"
+#include "Open3D/Registration/Registration.h"
+
+namespace open3d {
+
+namespace geometry {
+class PointCloud;
+}
+
+namespace registration {
+
+/// \class MultiScaleICPLevel
+///
+/// \brief One level of the schedule of RegistrationMultiScaleICP.
+class MultiScaleICPLevel {
+public:
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param voxel_size Voxel size the point clouds are downsampled with,
+    /// non-positive values use the full resolution.
+    /// \param max_correspondence_distance Maximum correspondence points-pair
+    /// distance.
+    /// \param criteria Convergence criteria of the level.
+    MultiScaleICPLevel(
+            double voxel_size = 0.0,
+            double max_correspondence_distance = 0.0,
+            const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria())
+        : voxel_size_(voxel_size),
+          max_correspondence_distance_(max_correspondence_distance),
+          criteria_(criteria) {}
+    ~MultiScaleICPLevel() {}
+
+public:
+    /// Voxel size of the level, non-positive for the full resolution.
+    double voxel_size_;
+    /// Maximum correspondence points-pair distance.
+    double max_correspondence_distance_;
+    /// Convergence criteria of the level.
+    ICPConvergenceCriteria criteria_;
+};
+
+/// \class MultiScaleICPTarget
+///
+/// \brief Pyramid of a target point cloud for RegistrationMultiScaleICP.
+///
+/// Every level holds the downsampled point cloud, with normals if requested,
+/// and its ICPTarget. The pyramid does not depend on the source, so it can be
+/// built once and reused to register many sources against the same target.
+class MultiScaleICPTarget {
+public:
+    /// \brief Default Constructor.
+    MultiScaleICPTarget() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param target The target point cloud.
+    /// \param voxel_sizes Voxel sizes of the levels, non-positive values use
+    /// the full resolution.
+    /// \param estimate_normals Estimate the normals of every level, which
+    /// point to plane estimation requires. Normals of \p target are kept at
+    /// full resolution.
+    MultiScaleICPTarget(const geometry::PointCloud &target,
+                        const std::vector<double> &voxel_sizes,
+                        bool estimate_normals = true);
+    ~MultiScaleICPTarget() {}
+
+public:
+    /// Builds the levels of the pyramid, levels with equal voxel sizes are
+    /// only built once.
+    void SetPointCloud(const geometry::PointCloud &target,
+                       const std::vector<double> &voxel_sizes,
+                       bool estimate_normals = true);
+    /// Returns the index of the level with the given voxel size, or -1.
+    int GetLevel(double voxel_size) const;
+
+public:
+    /// Voxel size of every level.
+    std::vector<double> voxel_sizes_;
+    /// Downsampled point cloud of every level.
+    std::vector<std::shared_ptr<geometry::PointCloud>> point_clouds_;
+    /// Prepared ICP target of every level.
+    std::vector<std::shared_ptr<ICPTarget>> icp_targets_;
+};
+
+/// \brief Function for coarse to fine ICP registration.
+///
+/// Runs RegistrationICP on every level of the schedule in order, starting from
+/// the transformation of the previous level. The source is downsampled with
+/// the voxel size of the level, the target level is taken from \p target.
+/// The correspondences of the result refer to the point clouds of the last
+/// level. The normals of the downsampled source are normalized, and for
+/// Generalized ICP they are estimated like those of the target pyramid.
+///
+/// \param source The source point cloud.
+/// \param target The target pyramid, it must contain the voxel sizes of all
+/// levels.
+/// \param levels The schedule, usually from coarse to fine.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method, point to point, point to plane or
+/// Generalized ICP.
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const MultiScaleICPTarget &target,
+        const std::vector<MultiScaleICPLevel> &levels,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPlane());
+
+/// \brief Function for coarse to fine ICP registration.
+///
+/// Builds the target pyramid, with normals estimated on every level for point
+/// to plane and Generalized ICP estimation, and runs
+/// RegistrationMultiScaleICP.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param levels The schedule, usually from coarse to fine.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method, point to point, point to plane or
+/// Generalized ICP.
+RegistrationResult RegistrationMultiScaleICP(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const std::vector<MultiScaleICPLevel> &levels,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPlane());
+
+}  // namespace registration
+}  // namespace open3d
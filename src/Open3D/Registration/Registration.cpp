@@ -26,11 +26,16 @@
 
 #include "Open3D/Registration/Registration.h"
 
+#include <algorithm>
 #include <cstdlib>
+#include <numeric>
+#include <random>
 
 #include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/FeatureIndex.h"
+#include "Open3D/Registration/GeneralizedICP.h"
 #include "Open3D/Utility/Console.h"
 #include "Open3D/Utility/Helper.h"
 
@@ -107,9 +112,11 @@ RegistrationResult EvaluateRANSACBasedOnCorrespondence(
     double error2 = 0.0;
     int good = 0;
     double max_dis2 = max_correspondence_distance * max_correspondence_distance;
+    const Eigen::Matrix3d R = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = transformation.block<3, 1>(0, 3);
     for (const auto &c : corres) {
-        double dis2 =
-                (source.points_[c[0]] - target.points_[c[1]]).squaredNorm();
+        double dis2 = (R * source.points_[c[0]] + t - target.points_[c[1]])
+                              .squaredNorm();
         if (dis2 < max_dis2) {
             good++;
             error2 += dis2;
@@ -126,6 +133,222 @@ RegistrationResult EvaluateRANSACBasedOnCorrespondence(
     return result;
 }
 
+/// Function to score a RANSAC hypothesis without transforming a copy of the
+/// source: the points are transformed on the fly and visited in the given
+/// order. Returns false as soon as the inlier ratio of the visited points
+/// makes a final fitness of best_fitness unlikely, using the Hoeffding bound
+/// with a confidence of 1e-4. Correspondences are only stored on request.
+bool EvaluateRANSACHypothesis(const geometry::PointCloud &source,
+                              const geometry::KDTreeFlann &target_kdtree,
+                              const std::vector<int> &order,
+                              double max_correspondence_distance,
+                              const Eigen::Matrix4d &transformation,
+                              double best_fitness,
+                              bool keep_correspondences,
+                              RegistrationResult &result) {
+    const int check_interval = 64;
+    const double log_inverse_confidence = std::log(1e4);
+    const Eigen::Matrix3d R = transformation.block<3, 3>(0, 0);
+    const Eigen::Vector3d t = transformation.block<3, 1>(0, 3);
+    int n_points = (int)order.size();
+    std::vector<int> indices(1);
+    std::vector<double> dists(1);
+    int inliers = 0;
+    double error2 = 0.0;
+    result = RegistrationResult(transformation);
+    for (int k = 0; k < n_points; k++) {
+        int i = order[k];
+        if (target_kdtree.SearchHybrid(
+                    Eigen::Vector3d(R * source.points_[i] + t),
+                    max_correspondence_distance, 1, indices, dists) > 0) {
+            inliers++;
+            error2 += dists[0];
+            if (keep_correspondences) {
+                result.correspondence_set_.push_back(
+                        Eigen::Vector2i(i, indices[0]));
+            }
+        }
+        int visited = k + 1;
+        if (visited % check_interval == 0 && visited < n_points &&
+            double(inliers) / visited +
+                            std::sqrt(log_inverse_confidence /
+                                      (2.0 * visited)) <
+                    best_fitness) {
+            return false;
+        }
+    }
+    if (inliers > 0) {
+        result.fitness_ = (double)inliers / (double)n_points;
+        result.inlier_rmse_ = std::sqrt(error2 / (double)inliers);
+    }
+    return true;
+}
+
+/// Sums over the correspondences found by one pass of RegistrationICP. Point to
+/// plane and Generalized ICP estimation accumulate their normal equations,
+/// point to point estimation the moments of the corresponding points in the
+/// local frame of the target. All are weighted by the robust kernel of the
+/// estimation.
+struct ICPPassSums {
+    int count_ = 0;
+    double error2_ = 0.0;
+    double weight_sum_ = 0.0;
+    Eigen::Matrix6d JTJ_ = Eigen::Matrix6d::Zero();
+    Eigen::Vector6d JTr_ = Eigen::Vector6d::Zero();
+    Eigen::Vector3d source_sum_ = Eigen::Vector3d::Zero();
+    Eigen::Vector3d target_sum_ = Eigen::Vector3d::Zero();
+    Eigen::Matrix3d target_source_sum_ = Eigen::Matrix3d::Zero();
+    double source_norm2_sum_ = 0.0;
+
+    void Add(const ICPPassSums &other) {
+        count_ += other.count_;
+        error2_ += other.error2_;
+        weight_sum_ += other.weight_sum_;
+        JTJ_ += other.JTJ_;
+        JTr_ += other.JTr_;
+        source_sum_ += other.source_sum_;
+        target_sum_ += other.target_sum_;
+        target_source_sum_ += other.target_source_sum_;
+        source_norm2_sum_ += other.source_norm2_sum_;
+    }
+};
+
+/// Source points of RegistrationICP in single precision, relative to origin_,
+/// with normals for Generalized ICP.
+struct ICPSource {
+    Eigen::Vector3d origin_ = Eigen::Vector3d::Zero();
+    std::vector<float> x_, y_, z_;
+    std::vector<float> nx_, ny_, nz_;
+};
+
+/// Estimation of one pass of RegistrationICP with an ICPTarget.
+struct ICPPassEstimation {
+    TransformationEstimationType type_ =
+            TransformationEstimationType::PointToPoint;
+    const RobustKernel *kernel_ = nullptr;
+    const TransformationEstimationForGeneralizedICP *generalized_icp_ =
+            nullptr;
+};
+
+/// Finds the correspondence of every source point under transformation and
+/// accumulates the sums of the estimation in a single parallel pass.
+ICPPassSums ComputeICPPass(const ICPSource &source,
+                           const ICPTarget &target,
+                           float max_distance2,
+                           const Eigen::Matrix4d &transformation,
+                           const ICPPassEstimation &estimation,
+                           std::vector<int> &correspondences) {
+    // Maps source points to the local frame of the target.
+    const Eigen::Matrix3d R = transformation.block<3, 3>(0, 0);
+    const Eigen::Matrix3f R_local = R.cast<float>();
+    const Eigen::Vector3f t_local =
+            (R * source.origin_ + transformation.block<3, 1>(0, 3) -
+             target.origin_)
+                    .cast<float>();
+    const RobustKernel &kernel = *estimation.kernel_;
+    ICPPassSums sums;
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        ICPPassSums sums_private;
+#ifdef _OPENMP
+#pragma omp for schedule(static) nowait
+#endif
+        for (int i = 0; i < (int)source.x_.size(); i++) {
+            Eigen::Vector3f query =
+                    R_local * Eigen::Vector3f(source.x_[i], source.y_[i],
+                                              source.z_[i]) +
+                    t_local;
+            float distance2 = max_distance2;
+            int j = target.SearchNearest(query, distance2);
+            correspondences[i] = j;
+            if (j < 0) {
+                continue;
+            }
+            sums_private.count_++;
+            sums_private.error2_ += distance2;
+            const Eigen::Vector3d vs = query.cast<double>();
+            const Eigen::Vector3d vt(target.x_[j], target.y_[j], target.z_[j]);
+            if (estimation.type_ ==
+                TransformationEstimationType::PointToPlane) {
+                const Eigen::Vector3d nt(target.nx_[j], target.ny_[j],
+                                         target.nz_[j]);
+                double r = (vs - vt).dot(nt);
+                double w = kernel.Weight(r);
+                Eigen::Vector6d J_r;
+                J_r.block<3, 1>(0, 0) = (vs + target.origin_).cross(nt);
+                J_r.block<3, 1>(3, 0) = nt;
+                sums_private.JTJ_.noalias() += J_r * w * J_r.transpose();
+                sums_private.JTr_.noalias() += J_r * w * r;
+            } else if (estimation.type_ ==
+                       TransformationEstimationType::GeneralizedICP) {
+                const Eigen::Vector3d ns =
+                        (R_local * Eigen::Vector3f(source.nx_[i], source.ny_[i],
+                                                   source.nz_[i]))
+                                .cast<double>();
+                const Eigen::Vector3d nt(target.nx_[j], target.ny_[j],
+                                         target.nz_[j]);
+                const Eigen::Matrix3d W =
+                        estimation.generalized_icp_->ComputeInformationSqrt(ns,
+                                                                            nt);
+                const Eigen::Vector3d v = vs + target.origin_;
+                Eigen::Matrix3d v_skew;
+                v_skew << 0.0, -v(2), v(1), v(2), 0.0, -v(0), -v(1), v(0), 0.0;
+                Eigen::Matrix<double, 3, 6> J;
+                J.block<3, 3>(0, 0) = -W * v_skew;
+                J.block<3, 3>(0, 3) = W;
+                const Eigen::Vector3d r = W * (vs - vt);
+                for (int k = 0; k < 3; k++) {
+                    double w = kernel.Weight(r(k));
+                    sums_private.JTJ_.noalias() +=
+                            J.row(k).transpose() * w * J.row(k);
+                    sums_private.JTr_.noalias() +=
+                            J.row(k).transpose() * w * r(k);
+                }
+            } else {
+                double w = kernel.Weight(std::sqrt(double(distance2)));
+                sums_private.weight_sum_ += w;
+                sums_private.source_sum_ += w * vs;
+                sums_private.target_sum_ += w * vt;
+                sums_private.target_source_sum_.noalias() +=
+                        w * vt * vs.transpose();
+                sums_private.source_norm2_sum_ += w * vs.squaredNorm();
+            }
+        }
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+        sums.Add(sums_private);
+#ifdef _OPENMP
+    }
+#endif
+    return sums;
+}
+
+/// Closed form point to point alignment of the accumulated weighted moments,
+/// see utility::ComputeUmeyamaTransformation.
+Eigen::Matrix4d ComputePointToPointTransformation(const ICPPassSums &sums,
+                                                  const Eigen::Vector3d &origin,
+                                                  bool with_scaling) {
+    if (sums.weight_sum_ <= 0.0) {
+        return Eigen::Matrix4d::Identity();
+    }
+    double one_over_w = 1.0 / sums.weight_sum_;
+    Eigen::Vector3d source_mean = sums.source_sum_ * one_over_w;
+    Eigen::Vector3d target_mean = sums.target_sum_ * one_over_w;
+    Eigen::Matrix3d sigma = sums.target_source_sum_ * one_over_w -
+                            target_mean * source_mean.transpose();
+    double source_var =
+            sums.source_norm2_sum_ * one_over_w - source_mean.squaredNorm();
+    Eigen::Matrix4d transformation = utility::ComputeUmeyamaTransformation(
+            source_mean, target_mean, sigma, source_var, with_scaling);
+    // The moments are relative to origin, move the transformation back.
+    transformation.block<3, 1>(0, 3) +=
+            origin - transformation.block<3, 3>(0, 0) * origin;
+    return transformation;
+}
+
 }  // unnamed namespace
 
 namespace registration {
@@ -160,11 +383,14 @@ RegistrationResult RegistrationICP(
     if ((estimation.GetTransformationEstimationType() ==
                  TransformationEstimationType::PointToPlane ||
          estimation.GetTransformationEstimationType() ==
-                 TransformationEstimationType::ColoredICP) &&
+                 TransformationEstimationType::ColoredICP ||
+         estimation.GetTransformationEstimationType() ==
+                 TransformationEstimationType::GeneralizedICP) &&
         (!source.HasNormals() || !target.HasNormals())) {
         utility::LogError(
-                "TransformationEstimationPointToPlane and "
-                "TransformationEstimationColoredICP "
+                "TransformationEstimationPointToPlane, "
+                "TransformationEstimationColoredICP and "
+                "TransformationEstimationForGeneralizedICP "
                 "require pre-computed normal vectors.");
     }
 
@@ -199,6 +425,164 @@ RegistrationResult RegistrationICP(
     return result;
 }
 
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const ICPTarget &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init /* = Eigen::Matrix4d::Identity()*/,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        const ICPConvergenceCriteria
+                &criteria /* = ICPConvergenceCriteria()*/) {
+    if (max_correspondence_distance <= 0.0) {
+        utility::LogError("Invalid max_correspondence_distance.");
+    }
+    ICPPassEstimation pass_estimation;
+    pass_estimation.type_ = estimation.GetTransformationEstimationType();
+    bool with_scaling = false;
+    switch (pass_estimation.type_) {
+        case TransformationEstimationType::PointToPoint: {
+            const auto point_to_point =
+                    dynamic_cast<const TransformationEstimationPointToPoint *>(
+                            &estimation);
+            if (point_to_point == nullptr) {
+                break;
+            }
+            with_scaling = point_to_point->with_scaling_;
+            pass_estimation.kernel_ = point_to_point->kernel_.get();
+            break;
+        }
+        case TransformationEstimationType::PointToPlane: {
+            if (!target.HasNormals()) {
+                utility::LogError(
+                        "TransformationEstimationPointToPlane requires "
+                        "pre-computed normal vectors.");
+            }
+            const auto point_to_plane =
+                    dynamic_cast<const TransformationEstimationPointToPlane *>(
+                            &estimation);
+            if (point_to_plane == nullptr) {
+                break;
+            }
+            pass_estimation.kernel_ = point_to_plane->kernel_.get();
+            break;
+        }
+        case TransformationEstimationType::GeneralizedICP: {
+            if (!source.HasNormals() || !target.HasNormals()) {
+                utility::LogError(
+                        "TransformationEstimationForGeneralizedICP requires "
+                        "pre-computed normal vectors.");
+            }
+            const auto generalized_icp = dynamic_cast<
+                    const TransformationEstimationForGeneralizedICP *>(
+                    &estimation);
+            if (generalized_icp == nullptr) {
+                break;
+            }
+            pass_estimation.kernel_ = generalized_icp->kernel_.get();
+            pass_estimation.generalized_icp_ = generalized_icp;
+            break;
+        }
+        default:
+            break;
+    }
+    // Subclasses of other types, and estimations without a robust kernel,
+    // leave the kernel unset.
+    if (pass_estimation.kernel_ == nullptr) {
+        utility::LogError(
+                "RegistrationICP with an ICPTarget only supports point to "
+                "point, point to plane and Generalized ICP estimation with a "
+                "robust kernel.");
+    }
+
+    int num_points = (int)source.points_.size();
+    ICPSource source_local;
+    if (num_points > 0) {
+        source_local.origin_ =
+                0.5 * (source.GetMinBound() + source.GetMaxBound());
+    }
+    source_local.x_.resize(num_points);
+    source_local.y_.resize(num_points);
+    source_local.z_.resize(num_points);
+    for (int i = 0; i < num_points; i++) {
+        Eigen::Vector3d point = source.points_[i] - source_local.origin_;
+        source_local.x_[i] = float(point(0));
+        source_local.y_[i] = float(point(1));
+        source_local.z_[i] = float(point(2));
+    }
+    if (pass_estimation.type_ == TransformationEstimationType::GeneralizedICP) {
+        source_local.nx_.resize(num_points);
+        source_local.ny_.resize(num_points);
+        source_local.nz_.resize(num_points);
+        for (int i = 0; i < num_points; i++) {
+            source_local.nx_[i] = float(source.normals_[i](0));
+            source_local.ny_[i] = float(source.normals_[i](1));
+            source_local.nz_[i] = float(source.normals_[i](2));
+        }
+    }
+    float max_distance2 =
+            float(max_correspondence_distance * max_correspondence_distance);
+    std::vector<int> correspondences(num_points, -1);
+
+    auto get_result = [&](const Eigen::Matrix4d &transformation,
+                          const ICPPassSums &sums) {
+        RegistrationResult result(transformation);
+        if (sums.count_ > 0) {
+            result.fitness_ = (double)sums.count_ / (double)num_points;
+            result.inlier_rmse_ = std::sqrt(sums.error2_ / sums.count_);
+        }
+        return result;
+    };
+
+    Eigen::Matrix4d transformation = init;
+    ICPPassSums sums = ComputeICPPass(source_local, target, max_distance2,
+                                      transformation, pass_estimation,
+                                      correspondences);
+    RegistrationResult result = get_result(transformation, sums);
+    for (int i = 0; i < criteria.max_iteration_; i++) {
+        utility::LogDebug("ICP Iteration #{:d}: Fitness {:.4f}, RMSE {:.4f}", i,
+                          result.fitness_, result.inlier_rmse_);
+        Eigen::Matrix4d update = Eigen::Matrix4d::Identity();
+        if (pass_estimation.type_ !=
+            TransformationEstimationType::PointToPoint) {
+            if (sums.count_ > 0) {
+                bool is_success;
+                Eigen::Matrix4d extrinsic;
+                std::tie(is_success, extrinsic) =
+                        utility::SolveJacobianSystemAndObtainExtrinsicMatrix(
+                                sums.JTJ_, sums.JTr_);
+                if (is_success) {
+                    update = extrinsic;
+                }
+            }
+        } else {
+            update = ComputePointToPointTransformation(sums, target.origin_,
+                                                       with_scaling);
+        }
+        transformation = update * transformation;
+        RegistrationResult backup = result;
+        sums = ComputeICPPass(source_local, target, max_distance2,
+                              transformation, pass_estimation,
+                              correspondences);
+        result = get_result(transformation, sums);
+        if (std::abs(backup.fitness_ - result.fitness_) <
+                    criteria.relative_fitness_ &&
+            std::abs(backup.inlier_rmse_ - result.inlier_rmse_) <
+                    criteria.relative_rmse_) {
+            break;
+        }
+    }
+
+    result.correspondence_set_.reserve(sums.count_);
+    for (int i = 0; i < num_points; i++) {
+        if (correspondences[i] >= 0) {
+            result.correspondence_set_.push_back(
+                    Eigen::Vector2i(i, target.indices_[correspondences[i]]));
+        }
+    }
+    return result;
+}
+
 RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -226,10 +610,8 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
         }
         transformation =
                 estimation.ComputeTransformation(source, target, ransac_corres);
-        geometry::PointCloud pcd = source;
-        pcd.Transform(transformation);
         auto this_result = EvaluateRANSACBasedOnCorrespondence(
-                pcd, target, corres, max_correspondence_distance,
+                source, target, corres, max_correspondence_distance,
                 transformation);
         if (this_result.fitness_ > result.fitness_ ||
             (this_result.fitness_ == result.fitness_ &&
@@ -254,56 +636,82 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers /* = {}*/,
         const RANSACConvergenceCriteria &criteria
+        /* = RANSACConvergenceCriteria()*/,
+        bool mutual_filter /* = false*/,
+        int maximum_feature_checks /* = -1*/) {
+    if (ransac_n < 3 || max_correspondence_distance <= 0.0 ||
+        source.IsEmpty() || target.IsEmpty()) {
+        return RegistrationResult();
+    }
+
+    // The index is built once and shared read-only by all threads.
+    geometry::KDTreeFlann kdtree(target);
+
+    // Feature matches the hypotheses are sampled from.
+    CorrespondenceSet corres =
+            MatchFeatures(source_feature, target_feature, mutual_filter,
+                          maximum_feature_checks);
+    if (mutual_filter && (int)corres.size() < ransac_n) {
+        utility::LogDebug(
+                "Too few mutual feature matches ({:d}), using all matches.",
+                (int)corres.size());
+        corres = MatchFeatures(source_feature, target_feature, false,
+                               maximum_feature_checks);
+    }
+    return RegistrationRANSACBasedOnFeatureMatches(
+            source, target, kdtree, corres, max_correspondence_distance,
+            estimation, ransac_n, checkers, criteria);
+}
+
+RegistrationResult RegistrationRANSACBasedOnFeatureMatches(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        const CorrespondenceSet &corres,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation
+        /* = TransformationEstimationPointToPoint(false)*/,
+        int ransac_n /* = 4*/,
+        const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+                &checkers /* = {}*/,
+        const RANSACConvergenceCriteria &criteria
         /* = RANSACConvergenceCriteria()*/) {
-    if (ransac_n < 3 || max_correspondence_distance <= 0.0) {
+    if (ransac_n < 3 || max_correspondence_distance <= 0.0 ||
+        source.IsEmpty() || target.IsEmpty() ||
+        (int)corres.size() < ransac_n) {
         return RegistrationResult();
     }
+    int num_source = (int)source.points_.size();
+    int num_corres = (int)corres.size();
+
+    // Hypotheses are scored on the source points in a random order, so that
+    // the points visited before an early rejection are a random sample.
+    std::vector<int> evaluation_order(num_source);
+    std::iota(evaluation_order.begin(), evaluation_order.end(), 0);
+    std::shuffle(evaluation_order.begin(), evaluation_order.end(),
+                 std::mt19937(utility::UniformRandInt(0, 1 << 30)));
 
     RegistrationResult result;
     int total_validation = 0;
     bool finished_validation = false;
-    int num_similar_features = 1;
-    std::vector<std::vector<int>> similar_features(source.points_.size());
 
 #ifdef _OPENMP
 #pragma omp parallel
     {
 #endif
         CorrespondenceSet ransac_corres(ransac_n);
-        geometry::KDTreeFlann kdtree(target);
-        geometry::KDTreeFlann kdtree_feature(target_feature);
         RegistrationResult result_private;
+        RegistrationResult this_result;
 
 #ifdef _OPENMP
 #pragma omp for nowait
 #endif
         for (int itr = 0; itr < criteria.max_iteration_; itr++) {
             if (!finished_validation) {
-                std::vector<double> dists(num_similar_features);
                 Eigen::Matrix4d transformation;
                 for (int j = 0; j < ransac_n; j++) {
-                    int source_sample_id = utility::UniformRandInt(
-                            0, static_cast<int>(source.points_.size()) - 1);
-                    if (similar_features[source_sample_id].empty()) {
-                        std::vector<int> indices(num_similar_features);
-                        kdtree_feature.SearchKNN(
-                                Eigen::VectorXd(source_feature.data_.col(
-                                        source_sample_id)),
-                                num_similar_features, indices, dists);
-#ifdef _OPENMP
-#pragma omp critical
-#endif
-                        { similar_features[source_sample_id] = indices; }
-                    }
-                    ransac_corres[j](0) = source_sample_id;
-                    if (num_similar_features == 1)
-                        ransac_corres[j](1) =
-                                similar_features[source_sample_id][0];
-                    else {
-                        ransac_corres[j](1) = similar_features
-                                [source_sample_id][utility::UniformRandInt(
-                                        0, num_similar_features - 1)];
-                    }
+                    ransac_corres[j] = corres[utility::UniformRandInt(
+                            0, num_corres - 1)];
                 }
                 bool check = true;
                 for (const auto &checker : checkers) {
@@ -327,14 +735,14 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
                     }
                 }
                 if (check == false) continue;
-                geometry::PointCloud pcd = source;
-                pcd.Transform(transformation);
-                auto this_result = GetRegistrationResultAndCorrespondences(
-                        pcd, target, kdtree, max_correspondence_distance,
-                        transformation);
-                if (this_result.fitness_ > result_private.fitness_ ||
-                    (this_result.fitness_ == result_private.fitness_ &&
-                     this_result.inlier_rmse_ < result_private.inlier_rmse_)) {
+                if (EvaluateRANSACHypothesis(
+                            source, target_kdtree, evaluation_order,
+                            max_correspondence_distance, transformation,
+                            result_private.fitness_, false, this_result) &&
+                    (this_result.fitness_ > result_private.fitness_ ||
+                     (this_result.fitness_ == result_private.fitness_ &&
+                      this_result.inlier_rmse_ <
+                              result_private.inlier_rmse_))) {
                     result_private = this_result;
                 }
 #ifdef _OPENMP
@@ -360,6 +768,13 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
 #ifdef _OPENMP
     }
 #endif
+    // Correspondences are only gathered for the best hypothesis.
+    if (result.fitness_ > 0.0) {
+        std::iota(evaluation_order.begin(), evaluation_order.end(), 0);
+        EvaluateRANSACHypothesis(source, target_kdtree, evaluation_order,
+                                 max_correspondence_distance,
+                                 result.transformation_, 0.0, true, result);
+    }
     utility::LogDebug("total_validation : {:d}", total_validation);
     utility::LogDebug("RANSAC: Fitness {:e}, RMSE {:e}", result.fitness_,
                       result.inlier_rmse_);
@@ -380,7 +795,12 @@ Eigen::Matrix6d GetInformationMatrixFromPointClouds(
     result = GetRegistrationResultAndCorrespondences(
             pcd, target, target_kdtree, max_correspondence_distance,
             transformation);
+    return GetInformationMatrixFromCorrespondences(target,
+                                                   result.correspondence_set_);
+}
 
+Eigen::Matrix6d GetInformationMatrixFromCorrespondences(
+        const geometry::PointCloud &target, const CorrespondenceSet &corres) {
     // write q^*
     // see http://redwood-data.org/indoor/registration.html
     // note: I comes first in this implementation
@@ -394,8 +814,8 @@ Eigen::Matrix6d GetInformationMatrixFromPointClouds(
 #ifdef _OPENMP
 #pragma omp for nowait
 #endif
-        for (int c = 0; c < int(result.correspondence_set_.size()); c++) {
-            int t = result.correspondence_set_[c](1);
+        for (int c = 0; c < int(corres.size()); c++) {
+            int t = corres[c](1);
             double x = target.points_[t](0);
             double y = target.points_[t](1);
             double z = target.points_[t](2);
@@ -31,14 +31,16 @@
 #include <vector>
 
 #include "Open3D/Registration/CorrespondenceChecker.h"
+#include "Open3D/Registration/ICPTarget.h"
 #include "Open3D/Registration/TransformationEstimation.h"
 #include "Open3D/Utility/Eigen.h"
 
 namespace open3d {
 
 namespace geometry {
+class KDTreeFlann;
 class PointCloud;
-}
+}  // namespace geometry
 
 namespace registration {
 class Feature;
@@ -164,6 +166,32 @@ RegistrationResult RegistrationICP(
                 TransformationEstimationPointToPoint(false),
         const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
 
+/// \brief Functions for ICP registration against a prepared target.
+///
+/// Only point to point, point to plane and Generalized ICP estimation are
+/// supported. Each iteration makes a single parallel pass over the source
+/// points, which transforms them on the fly, searches their correspondences in
+/// \p target and accumulates the normal equations of the estimation. The
+/// points and the search are in single precision, relative to the centers of
+/// the point clouds, so this is faster but less precise than the overload
+/// taking a PointCloud target, which is the reference double precision path.
+///
+/// \param source The source point cloud.
+/// \param target The prepared target point cloud.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param init Initial transformation estimation.
+/// \param estimation Estimation method.
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationICP(
+        const geometry::PointCloud &source,
+        const ICPTarget &target,
+        double max_correspondence_distance,
+        const Eigen::Matrix4d &init = Eigen::Matrix4d::Identity(),
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        const ICPConvergenceCriteria &criteria = ICPConvergenceCriteria());
+
 /// \brief Function for global RANSAC registration based on a given set of
 /// correspondences.
 ///
@@ -193,6 +221,9 @@ RegistrationResult RegistrationRANSACBasedOnCorrespondence(
 /// \param max_correspondence_distance Maximum correspondence points-pair
 /// distance. \param ransac_n Fit ransac with `ransac_n` correspondences. \param
 /// checkers Correspondence checker. \param criteria Convergence criteria.
+/// \param mutual_filter Sample only mutual nearest feature matches.
+/// \param maximum_feature_checks Maximum number of features compared by a
+/// feature search, see FeatureIndex, or -1 for exact feature matching.
 RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const geometry::PointCloud &source,
         const geometry::PointCloud &target,
@@ -202,11 +233,52 @@ RegistrationResult RegistrationRANSACBasedOnFeatureMatching(
         const TransformationEstimation &estimation =
                 TransformationEstimationPointToPoint(false),
         int ransac_n = 4,
+        const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
+                &checkers = {},
+        const RANSACConvergenceCriteria &criteria = RANSACConvergenceCriteria(),
+        bool mutual_filter = false,
+        int maximum_feature_checks = -1);
+
+/// \brief Function for global RANSAC registration based on precomputed
+/// feature matches.
+///
+/// Same as RegistrationRANSACBasedOnFeatureMatching, with the feature matches
+/// and the search tree of the target given, so that they can be shared by
+/// several registrations.
+///
+/// \param source The source point cloud.
+/// \param target The target point cloud.
+/// \param target_kdtree Search tree of the target point cloud.
+/// \param matches Pairs of source and target points with similar features,
+/// see MatchFeatures.
+/// \param max_correspondence_distance Maximum correspondence points-pair
+/// distance.
+/// \param estimation Estimation method.
+/// \param ransac_n Fit ransac with `ransac_n` correspondences.
+/// \param checkers Correspondence checker.
+/// \param criteria Convergence criteria.
+RegistrationResult RegistrationRANSACBasedOnFeatureMatches(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const geometry::KDTreeFlann &target_kdtree,
+        const CorrespondenceSet &matches,
+        double max_correspondence_distance,
+        const TransformationEstimation &estimation =
+                TransformationEstimationPointToPoint(false),
+        int ransac_n = 4,
         const std::vector<std::reference_wrapper<const CorrespondenceChecker>>
                 &checkers = {},
         const RANSACConvergenceCriteria &criteria =
                 RANSACConvergenceCriteria());
 
+/// \brief Function for computing the information matrix of a set of
+/// correspondences.
+///
+/// \param target The target point cloud.
+/// \param corres Correspondence set between source and target point cloud.
+Eigen::Matrix6d GetInformationMatrixFromCorrespondences(
+        const geometry::PointCloud &target, const CorrespondenceSet &corres);
+
 /// \param source The source point cloud.
 /// \param target The target point cloud.
 /// \param max_correspondence_distance Maximum correspondence points-pair
@@ -0,0 +1,61 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/RobustKernel.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace open3d {
+namespace registration {
+
+double L2Loss::Weight(double residual) const { return 1.0; }
+
+double HuberLoss::Weight(double residual) const {
+    return k_ / std::max(k_, std::abs(residual));
+}
+
+double CauchyLoss::Weight(double residual) const {
+    double r = residual / k_;
+    return 1.0 / (1.0 + r * r);
+}
+
+double GMLoss::Weight(double residual) const {
+    double w = k_ / (k_ + residual * residual);
+    return w * w;
+}
+
+double TukeyLoss::Weight(double residual) const {
+    if (std::abs(residual) > k_) {
+        return 0.0;
+    }
+    double r = residual / k_;
+    double w = 1.0 - r * r;
+    return w * w;
+}
+
+}  // namespace registration
+}  // namespace open3d
@@ -0,0 +1,109 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#pragma once
+
+namespace open3d {
+namespace registration {
+
+/// \class RobustKernel
+///
+/// Base class of the robust kernels of the transformation estimations. The
+/// estimations solve their least squares problems with iteratively reweighted
+/// least squares, a residual r of loss rho(r) gets the weight rho'(r) / r.
+class RobustKernel {
+public:
+    virtual ~RobustKernel() {}
+    /// Returns the weight of residual.
+    virtual double Weight(double residual) const = 0;
+};
+
+/// \class L2Loss
+///
+/// Plain least squares, rho(r) = r^2 / 2.
+class L2Loss : public RobustKernel {
+public:
+    double Weight(double residual) const override;
+};
+
+/// \class HuberLoss
+///
+/// Huber loss, quadratic for |r| <= k and linear beyond.
+class HuberLoss : public RobustKernel {
+public:
+    /// \param k Scale parameter, residuals above k are down-weighted.
+    explicit HuberLoss(double k) : k_(k) {}
+    double Weight(double residual) const override;
+
+public:
+    /// Scale parameter.
+    double k_;
+};
+
+/// \class CauchyLoss
+///
+/// Cauchy loss, rho(r) = k^2 / 2 log(1 + (r / k)^2).
+class CauchyLoss : public RobustKernel {
+public:
+    /// \param k Scale parameter.
+    explicit CauchyLoss(double k) : k_(k) {}
+    double Weight(double residual) const override;
+
+public:
+    /// Scale parameter.
+    double k_;
+};
+
+/// \class GMLoss
+///
+/// Geman-McClure loss, rho(r) = k r^2 / 2 / (k + r^2).
+class GMLoss : public RobustKernel {
+public:
+    /// \param k Scale parameter, in units of squared residuals.
+    explicit GMLoss(double k) : k_(k) {}
+    double Weight(double residual) const override;
+
+public:
+    /// Scale parameter.
+    double k_;
+};
+
+/// \class TukeyLoss
+///
+/// Tukey biweight loss, residuals above k get a weight of zero.
+class TukeyLoss : public RobustKernel {
+public:
+    /// \param k Scale parameter, residuals above k are ignored.
+    explicit TukeyLoss(double k) : k_(k) {}
+    double Weight(double residual) const override;
+
+public:
+    /// Scale parameter.
+    double k_;
+};
+
+}  // namespace registration
+}  // namespace open3d
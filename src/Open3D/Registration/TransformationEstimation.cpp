@@ -51,13 +51,34 @@ Eigen::Matrix4d TransformationEstimationPointToPoint::ComputeTransformation(
         const geometry::PointCloud &target,
         const CorrespondenceSet &corres) const {
     if (corres.empty()) return Eigen::Matrix4d::Identity();
-    Eigen::MatrixXd source_mat(3, corres.size());
-    Eigen::MatrixXd target_mat(3, corres.size());
+    // Weighted Umeyama alignment, the weights are computed once from the
+    // current distances, which is one reweighting step of the estimation.
+    std::vector<double> weights(corres.size());
+    double weight_sum = 0.0;
+    Eigen::Vector3d source_mean = Eigen::Vector3d::Zero();
+    Eigen::Vector3d target_mean = Eigen::Vector3d::Zero();
     for (size_t i = 0; i < corres.size(); i++) {
-        source_mat.block<3, 1>(0, i) = source.points_[corres[i][0]];
-        target_mat.block<3, 1>(0, i) = target.points_[corres[i][1]];
+        const Eigen::Vector3d &vs = source.points_[corres[i][0]];
+        const Eigen::Vector3d &vt = target.points_[corres[i][1]];
+        weights[i] = kernel_->Weight((vs - vt).norm());
+        weight_sum += weights[i];
+        source_mean += weights[i] * vs;
+        target_mean += weights[i] * vt;
+    }
+    if (weight_sum <= 0.0) return Eigen::Matrix4d::Identity();
+    source_mean /= weight_sum;
+    target_mean /= weight_sum;
+    Eigen::Matrix3d covariance = Eigen::Matrix3d::Zero();
+    double source_variance = 0.0;
+    for (size_t i = 0; i < corres.size(); i++) {
+        Eigen::Vector3d ds = source.points_[corres[i][0]] - source_mean;
+        Eigen::Vector3d dt = target.points_[corres[i][1]] - target_mean;
+        covariance.noalias() += weights[i] * dt * ds.transpose();
+        source_variance += weights[i] * ds.squaredNorm();
     }
-    return Eigen::umeyama(source_mat, target_mat, with_scaling_);
+    return utility::ComputeUmeyamaTransformation(
+            source_mean, target_mean, covariance / weight_sum,
+            source_variance / weight_sum, with_scaling_);
 }
 
 double TransformationEstimationPointToPlane::ComputeRMSE(
@@ -82,11 +103,12 @@ Eigen::Matrix4d TransformationEstimationPointToPlane::ComputeTransformation(
         return Eigen::Matrix4d::Identity();
 
     auto compute_jacobian_and_residual = [&](int i, Eigen::Vector6d &J_r,
-                                             double &r) {
+                                             double &r, double &w) {
         const Eigen::Vector3d &vs = source.points_[corres[i][0]];
         const Eigen::Vector3d &vt = target.points_[corres[i][1]];
         const Eigen::Vector3d &nt = target.normals_[corres[i][1]];
         r = (vs - vt).dot(nt);
+        w = kernel_->Weight(r);
         J_r.block<3, 1>(0, 0) = vs.cross(nt);
         J_r.block<3, 1>(3, 0) = nt;
     };
@@ -31,6 +31,8 @@
 #include <string>
 #include <vector>
 
+#include "Open3D/Registration/RobustKernel.h"
+
 namespace open3d {
 
 namespace geometry {
@@ -46,6 +48,7 @@ enum class TransformationEstimationType {
     PointToPoint = 1,
     PointToPlane = 2,
     ColoredICP = 3,
+    GeneralizedICP = 4,
 };
 
 /// \class TransformationEstimation
@@ -92,8 +95,11 @@ public:
     ///
     /// \param with_scaling Set to True to estimate scaling, False to force
     /// scaling to be 1.
-    TransformationEstimationPointToPoint(bool with_scaling = false)
-        : with_scaling_(with_scaling) {}
+    /// \param kernel Robust kernel weighting the point distances.
+    TransformationEstimationPointToPoint(
+            bool with_scaling = false,
+            std::shared_ptr<RobustKernel> kernel = std::make_shared<L2Loss>())
+        : with_scaling_(with_scaling), kernel_(std::move(kernel)) {}
     ~TransformationEstimationPointToPoint() override {}
 
 public:
@@ -117,6 +123,9 @@ public:
     ///    [0   1]\n
     /// Sets 𝑐=1 if with_scaling is False.
     bool with_scaling_ = false;
+    /// Robust kernel of the estimation, the point distances are reweighted
+    /// with it and the closed form solution is weighted accordingly.
+    std::shared_ptr<RobustKernel> kernel_;
 
 private:
     const TransformationEstimationType type_ =
@@ -128,8 +137,12 @@ private:
 /// Class to estimate a transformation for point to plane distance.
 class TransformationEstimationPointToPlane : public TransformationEstimation {
 public:
-    /// \brief Default Constructor.
-    TransformationEstimationPointToPlane() {}
+    /// \brief Parameterized Constructor.
+    ///
+    /// \param kernel Robust kernel weighting the point to plane distances.
+    explicit TransformationEstimationPointToPlane(
+            std::shared_ptr<RobustKernel> kernel = std::make_shared<L2Loss>())
+        : kernel_(std::move(kernel)) {}
     ~TransformationEstimationPointToPlane() override {}
 
 public:
@@ -145,6 +158,11 @@ public:
             const geometry::PointCloud &target,
             const CorrespondenceSet &corres) const override;
 
+public:
+    /// Robust kernel of the estimation, the residuals of the Gauss-Newton
+    /// steps are reweighted with it.
+    std::shared_ptr<RobustKernel> kernel_;
+
 private:
     const TransformationEstimationType type_ =
             TransformationEstimationType::PointToPlane;
@@ -266,6 +266,109 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
     return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
 }
 
+template <typename MatType, typename VecType>
+std::tuple<MatType, VecType, double> ComputeJTJandJTr(
+        std::function<void(int, VecType &, double &, double &)> f,
+        int iteration_num,
+        bool verbose /*=true*/) {
+    MatType JTJ;
+    VecType JTr;
+    double r2_sum = 0.0;
+    JTJ.setZero();
+    JTr.setZero();
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        MatType JTJ_private;
+        VecType JTr_private;
+        double r2_sum_private = 0.0;
+        JTJ_private.setZero();
+        JTr_private.setZero();
+        VecType J_r;
+        double r, w;
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int i = 0; i < iteration_num; i++) {
+            f(i, J_r, r, w);
+            JTJ_private.noalias() += J_r * w * J_r.transpose();
+            JTr_private.noalias() += J_r * w * r;
+            r2_sum_private += r * r;
+        }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            JTJ += JTJ_private;
+            JTr += JTr_private;
+            r2_sum += r2_sum_private;
+#ifdef _OPENMP
+        }
+    }
+#endif
+    if (verbose) {
+        LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                 r2_sum / (double)iteration_num, iteration_num);
+    }
+    return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
+}
+
+template <typename MatType, typename VecType>
+std::tuple<MatType, VecType, double> ComputeJTJandJTr(
+        std::function<
+                void(int,
+                     std::vector<VecType, Eigen::aligned_allocator<VecType>> &,
+                     std::vector<double> &,
+                     std::vector<double> &)> f,
+        int iteration_num,
+        bool verbose /*=true*/) {
+    MatType JTJ;
+    VecType JTr;
+    double r2_sum = 0.0;
+    JTJ.setZero();
+    JTr.setZero();
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+#endif
+        MatType JTJ_private;
+        VecType JTr_private;
+        double r2_sum_private = 0.0;
+        JTJ_private.setZero();
+        JTr_private.setZero();
+        std::vector<double> r;
+        std::vector<double> w;
+        std::vector<VecType, Eigen::aligned_allocator<VecType>> J_r;
+#ifdef _OPENMP
+#pragma omp for nowait
+#endif
+        for (int i = 0; i < iteration_num; i++) {
+            f(i, J_r, r, w);
+            for (int j = 0; j < (int)r.size(); j++) {
+                JTJ_private.noalias() += J_r[j] * w[j] * J_r[j].transpose();
+                JTr_private.noalias() += J_r[j] * w[j] * r[j];
+                r2_sum_private += r[j] * r[j];
+            }
+        }
+#ifdef _OPENMP
+#pragma omp critical
+        {
+#endif
+            JTJ += JTJ_private;
+            JTr += JTr_private;
+            r2_sum += r2_sum_private;
+#ifdef _OPENMP
+        }
+    }
+#endif
+    if (verbose) {
+        LogDebug("Residual : {:.2e} (# of elements : {:d})",
+                 r2_sum / (double)iteration_num, iteration_num);
+    }
+    return std::make_tuple(std::move(JTJ), std::move(JTr), r2_sum);
+}
+
 // clang-format off
 template std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
         std::function<void(int, Eigen::Vector6d &, double &)> f,
@@ -276,8 +379,43 @@ template std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
                            std::vector<Eigen::Vector6d, Vector6d_allocator> &,
                            std::vector<double> &)> f,
         int iteration_num, bool verbose);
+
+template std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+        std::function<void(int, Eigen::Vector6d &, double &, double &)> f,
+        int iteration_num, bool verbose);
+
+template std::tuple<Eigen::Matrix6d, Eigen::Vector6d, double> ComputeJTJandJTr(
+        std::function<void(int,
+                           std::vector<Eigen::Vector6d, Vector6d_allocator> &,
+                           std::vector<double> &,
+                           std::vector<double> &)> f,
+        int iteration_num, bool verbose);
 // clang-format on
 
+Eigen::Matrix4d ComputeUmeyamaTransformation(
+        const Eigen::Vector3d &source_mean,
+        const Eigen::Vector3d &target_mean,
+        const Eigen::Matrix3d &covariance,
+        double source_variance,
+        bool with_scaling) {
+    Eigen::JacobiSVD<Eigen::Matrix3d> svd(
+            covariance, Eigen::ComputeFullU | Eigen::ComputeFullV);
+    Eigen::Vector3d S = Eigen::Vector3d::Ones();
+    if (svd.matrixU().determinant() * svd.matrixV().determinant() < 0) {
+        S(2) = -1;
+    }
+    Eigen::Matrix3d R =
+            svd.matrixU() * S.asDiagonal() * svd.matrixV().transpose();
+    double scale = 1.0;
+    if (with_scaling && source_variance > 0.0) {
+        scale = svd.singularValues().dot(S) / source_variance;
+    }
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) = scale * R;
+    transformation.block<3, 1>(0, 3) = target_mean - scale * R * source_mean;
+    return transformation;
+}
+
 Eigen::Matrix3d RotationMatrixX(double radians) {
     Eigen::Matrix3d rot;
     rot << 1, 0, 0, 0, std::cos(radians), -std::sin(radians), 0,
@@ -113,6 +113,51 @@ std::tuple<MatType, VecType, double> ComputeJTJandJTr(
         int iteration_num,
         bool verbose = true);
 
+/// Function to compute the weighted JTJ and JTr of an iteratively reweighted
+/// least squares problem.
+/// Input: function pointer f and total number of rows of Jacobian matrix
+/// Output: sum of w J^T J, sum of w J^T r, sum of r^2
+/// Note: f takes index of row, and outputs corresponding row vector, residual
+/// and weight.
+template <typename MatType, typename VecType>
+std::tuple<MatType, VecType, double> ComputeJTJandJTr(
+        std::function<void(int, VecType &, double &, double &)> f,
+        int iteration_num,
+        bool verbose = true);
+
+/// Function to compute the weighted JTJ and JTr of an iteratively reweighted
+/// least squares problem.
+/// Input: function pointer f and total number of rows of Jacobian matrix
+/// Output: sum of w J^T J, sum of w J^T r, sum of r^2
+/// Note: f takes index of row, and outputs corresponding residuals, row
+/// vectors and weights.
+template <typename MatType, typename VecType>
+std::tuple<MatType, VecType, double> ComputeJTJandJTr(
+        std::function<
+                void(int,
+                     std::vector<VecType, Eigen::aligned_allocator<VecType>> &,
+                     std::vector<double> &,
+                     std::vector<double> &)> f,
+        int iteration_num,
+        bool verbose = true);
+
+/// \brief Function to compute the transformation that best aligns weighted
+/// corresponding points in the least squares sense (Umeyama, PAMI 1991).
+///
+/// \param source_mean Weighted mean of the source points.
+/// \param target_mean Weighted mean of the target points.
+/// \param covariance Weighted cross-covariance of the points,
+/// sum w (t - target_mean) (s - source_mean)^T / sum w.
+/// \param source_variance Weighted variance of the source points,
+/// sum w |s - source_mean|^2 / sum w.
+/// \param with_scaling Set to true to estimate a scaling as well.
+Eigen::Matrix4d ComputeUmeyamaTransformation(
+        const Eigen::Vector3d &source_mean,
+        const Eigen::Vector3d &target_mean,
+        const Eigen::Matrix3d &covariance,
+        double source_variance,
+        bool with_scaling);
+
 Eigen::Matrix3d RotationMatrixX(double radians);
 Eigen::Matrix3d RotationMatrixY(double radians);
 Eigen::Matrix3d RotationMatrixZ(double radians);
@@ -32,8 +32,12 @@
 #include <unordered_set>
 
 #ifdef _WIN32
+// clang-format off
 #include <windows.h>
+#include <psapi.h>
+// clang-format on
 #else
+#include <sys/resource.h>
 #include <unistd.h>
 #endif  // _WIN32
 
@@ -106,6 +110,28 @@ void Sleep(int milliseconds) {
 #endif  // _WIN32
 }
 
+size_t GetPeakResidentSetSize() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters,
+                             sizeof(counters))) {
+        return size_t(counters.PeakWorkingSetSize);
+    }
+    return 0;
+#else
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0) {
+        return 0;
+    }
+#ifdef __APPLE__
+    return size_t(usage.ru_maxrss);
+#else
+    // ru_maxrss is reported in kilobytes on Linux.
+    return size_t(usage.ru_maxrss) * 1024;
+#endif  // __APPLE__
+#endif  // _WIN32
+}
+
 int UniformRandInt(const int min, const int max) {
     static thread_local std::mt19937 generator(std::random_device{}());
     std::uniform_int_distribution<int> distribution(min, max);
@@ -146,6 +146,10 @@ std::string ToLower(const std::string& s);
 
 void Sleep(int milliseconds);
 
+/// Returns the peak resident set size of the current process in bytes, or 0
+/// if it cannot be queried on this platform.
+size_t GetPeakResidentSetSize();
+
 /// Computes the quotient of x/y with rounding up
 inline int DivUp(int x, int y) {
     div_t tmp = std::div(x, y);
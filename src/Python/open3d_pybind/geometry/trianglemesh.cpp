@@ -356,7 +356,7 @@ void pybind_trianglemesh(py::module &m) {
                     "reconstruction is done by rolling a ball with a given "
                     "radius over the point cloud, whenever the ball touches "
                     "three points a triangle is created.",
-                    "pcd"_a, "radii"_a)
+                    "pcd"_a, "radii"_a, "parallel"_a = false)
             .def_static("create_from_point_cloud_poisson",
                         &geometry::TriangleMesh::CreateFromPointCloudPoisson,
                         "Function that computes a triangle mesh from a "
@@ -677,7 +677,14 @@ void pybind_trianglemesh(py::module &m) {
               "reconstructed. Has to contain normals."},
              {"radii",
               "The radii of the ball that are used for the surface "
-              "reconstruction."}});
+              "reconstruction."},
+             {"parallel",
+              "If true, slabs of the point cloud are reconstructed "
+              "concurrently and stitched together afterwards."}});
+    docstring::ClassMethodDocInject(
+            m, "TriangleMesh", "get_ball_pivoting_region_count",
+            {{"pcd", "PointCloud to reconstruct."},
+             {"radii", "The radii of the ball."}});
     docstring::ClassMethodDocInject(
             m, "TriangleMesh", "create_from_point_cloud_poisson",
             {{"pcd",
@@ -71,6 +71,20 @@ void pybind_integration_classes(py::module &m) {
             }),
             py::none(), py::none(), "");
 
+    // open3d.integration.TSDFVolumeStorageType
+    py::enum_<integration::TSDFVolumeStorageType> tsdf_volume_storage_type(
+            m, "TSDFVolumeStorageType", py::arithmetic());
+    tsdf_volume_storage_type
+            .value("Voxel", integration::TSDFVolumeStorageType::Voxel)
+            .value("Float32", integration::TSDFVolumeStorageType::Float32)
+            .value("Int16", integration::TSDFVolumeStorageType::Int16)
+            .export_values();
+    tsdf_volume_storage_type.attr("__doc__") = docstring::static_property(
+            py::cpp_function([](py::handle arg) -> std::string {
+                return "Enum class for TSDFVolumeStorageType.";
+            }),
+            py::none(), py::none(), "");
+
     // open3d.integration.TSDFVolume
     py::class_<integration::TSDFVolume, PyTSDFVolume<integration::TSDFVolume>>
             tsdfvolume(m, "TSDFVolume", R"(Base class of the Truncated
@@ -125,11 +139,14 @@ In SIGGRAPH, 1996)");
             uniform_tsdfvolume);
     uniform_tsdfvolume
             .def(py::init([](double length, int resolution, double sdf_trunc,
-                             integration::TSDFVolumeColorType color_type) {
+                             integration::TSDFVolumeColorType color_type,
+                             integration::TSDFVolumeStorageType storage_type) {
                      return new integration::UniformTSDFVolume(
-                             length, resolution, sdf_trunc, color_type);
+                             length, resolution, sdf_trunc, color_type,
+                             Eigen::Vector3d::Zero(), storage_type);
                  }),
-                 "length"_a, "resolution"_a, "sdf_trunc"_a, "color_type"_a)
+                 "length"_a, "resolution"_a, "sdf_trunc"_a, "color_type"_a,
+                 "storage_type"_a = integration::TSDFVolumeStorageType::Voxel)
             .def("__repr__",
                  [](const integration::UniformTSDFVolume &vol) {
                      return std::string("integration::UniformTSDFVolume ") +
@@ -151,7 +168,14 @@ In SIGGRAPH, 1996)");
             .def_readwrite("resolution",
                            &integration::UniformTSDFVolume::resolution_,
                            "Resolution over the total length, where "
-                           "``voxel_length = length / resolution``");
+                           "``voxel_length = length / resolution``")
+            .def_readonly("storage_type",
+                          &integration::UniformTSDFVolume::storage_type_,
+                          "integration.TSDFVolumeStorageType: Storage type of "
+                          "the voxels.")
+            .def("get_storage_size",
+                 &integration::UniformTSDFVolume::GetStorageSize,
+                 "Returns the number of bytes used by the voxel storage.");
     docstring::ClassMethodDocInject(m, "UniformTSDFVolume",
                                     "extract_voxel_point_cloud");
 
@@ -205,9 +229,39 @@ In SIGGRAPH, 2013)");
             .def("extract_voxel_point_cloud",
                  &integration::ScalableTSDFVolume::ExtractVoxelPointCloud,
                  "Debug function to extract the voxel data into a point "
-                 "cloud.");
+                 "cloud.")
+            .def("extract_triangle_mesh_patches",
+                 [](integration::ScalableTSDFVolume &vol) {
+                     std::vector<std::pair<
+                             Eigen::Vector3i,
+                             std::shared_ptr<geometry::TriangleMesh>>>
+                             patches;
+                     for (auto &patch : vol.ExtractTriangleMeshPatches()) {
+                         patches.emplace_back(patch.index_, patch.mesh_);
+                     }
+                     return patches;
+                 },
+                 "Function to extract the meshes of the volume units changed "
+                 "since the previous call, as a list of (unit index, mesh) "
+                 "tuples replacing the patches of the same unit index. "
+                 "Removed units get an empty mesh.")
+            .def("ray_cast", &integration::ScalableTSDFVolume::RayCast,
+                 "Function to render the vertex, normal and color maps of the "
+                 "surface seen from a camera, in camera coordinates. Pixels "
+                 "without a surface have a zero vertex and normal. This is "
+                 "not fast enough for real-time use.",
+                 "intrinsic"_a, "extrinsic"_a, "depth_min"_a = 0.1,
+                 "depth_max"_a = 3.0);
     docstring::ClassMethodDocInject(m, "ScalableTSDFVolume",
                                     "extract_voxel_point_cloud");
+    docstring::ClassMethodDocInject(m, "ScalableTSDFVolume",
+                                    "extract_triangle_mesh_patches");
+    docstring::ClassMethodDocInject(
+            m, "ScalableTSDFVolume", "ray_cast",
+            {{"intrinsic", "Pinhole camera intrinsic parameters."},
+             {"extrinsic", "Extrinsic parameters of the camera."},
+             {"depth_min", "Depth at which the rays start."},
+             {"depth_max", "Depth at which the rays end."}});
 }
 
 void pybind_integration_methods(py::module &m) {
@@ -36,6 +36,7 @@
 #include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
 #include "Open3D/IO/ClassIO/PointCloudIO.h"
 #include "Open3D/IO/ClassIO/PoseGraphIO.h"
+#include "Open3D/IO/ClassIO/TSDFVolumeIO.h"
 #include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "Open3D/IO/ClassIO/VoxelGridIO.h"
 
@@ -82,6 +83,11 @@ static const std::unordered_map<std::string, std::string>
                 {"line_set", "The ``LineSet`` object for I/O"},
                 {"image", "The ``Image`` object for I/O"},
                 {"voxel_grid", "The ``VoxelGrid`` object for I/O"},
+                {"volume",
+                 "The ``UniformTSDFVolume`` or ``ScalableTSDFVolume`` object "
+                 "for I/O"},
+                {"bound",
+                 "The volume units intersecting this bounding box are read."},
                 {"trajectory",
                  "The ``PinholeCameraTrajectory`` object for I/O"},
                 {"intrinsic", "The ``PinholeCameraIntrinsic`` object for I/O"},
@@ -224,6 +230,28 @@ void pybind_class_io(py::module &m_io) {
     docstring::FunctionDocInject(m_io, "write_voxel_grid",
                                  map_shared_argument_docstrings);
 
+    // open3d::integration::TSDFVolume
+    m_io.def("read_tsdf_volume", &io::CreateTSDFVolumeFromFile,
+             "Function to read UniformTSDFVolume or ScalableTSDFVolume from "
+             "file",
+             "filename"_a);
+    docstring::FunctionDocInject(m_io, "read_tsdf_volume",
+                                 map_shared_argument_docstrings);
+
+    m_io.def("write_tsdf_volume", &io::WriteTSDFVolume,
+             "Function to write UniformTSDFVolume or ScalableTSDFVolume to "
+             "file",
+             "filename"_a, "volume"_a, "compressed"_a = true);
+    docstring::FunctionDocInject(m_io, "write_tsdf_volume",
+                                 map_shared_argument_docstrings);
+
+    m_io.def("read_tsdf_volume_units", &io::ReadTSDFVolumeUnits,
+             "Function to read the volume units of a ScalableTSDFVolume file "
+             "that intersect a bounding box into a ScalableTSDFVolume",
+             "filename"_a, "volume"_a, "bound"_a);
+    docstring::FunctionDocInject(m_io, "read_tsdf_volume_units",
+                                 map_shared_argument_docstrings);
+
     // open3d::camera
     m_io.def("read_pinhole_camera_intrinsic",
              [](const std::string &filename) {
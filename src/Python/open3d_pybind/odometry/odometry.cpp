@@ -178,6 +178,53 @@ Anonymous submission.)");
             [](const odometry::RGBDOdometryJacobianFromHybridTerm &te) {
                 return std::string("RGBDOdometryJacobianFromHybridTerm");
             });
+
+    // open3d.odometry.RGBDOdometryTracker
+    py::class_<odometry::RGBDOdometryTracker> tracker(
+            m, "RGBDOdometryTracker",
+            "Class that estimates the motion between consecutive frames of "
+            "an RGBD stream, with the same results as compute_rgbd_odometry "
+            "on every pair of consecutive frames. The pyramids of a frame are "
+            "computed once and reused as the source of the next frame.");
+    tracker.def(py::init<const camera::PinholeCameraIntrinsic &,
+                         const odometry::OdometryOption &>(),
+                "pinhole_camera_intrinsic"_a = camera::PinholeCameraIntrinsic(),
+                "option"_a = odometry::OdometryOption())
+            .def("track", &odometry::RGBDOdometryTracker::Track,
+                 "Function to estimate 6D rigid motion from the previous "
+                 "frame to the frame, which becomes the previous frame. The "
+                 "first frame returns is_success = False. Output: "
+                 "(is_success, 4x4 motion matrix, 6x6 information matrix).",
+                 "rgbd"_a, "odo_init"_a = Eigen::Matrix4d::Identity(),
+                 "jacobian"_a = odometry::RGBDOdometryJacobianFromHybridTerm())
+            .def("reset", &odometry::RGBDOdometryTracker::Reset,
+                 "Function to forget the previous frame.")
+            .def("has_previous_frame",
+                 &odometry::RGBDOdometryTracker::HasPreviousFrame,
+                 "Returns ``True`` if a frame is kept for the next call of "
+                 "track.")
+            .def_readwrite("pinhole_camera_intrinsic",
+                           &odometry::RGBDOdometryTracker::
+                                   pinhole_camera_intrinsic_,
+                           "camera.PinholeCameraIntrinsic: Camera intrinsic "
+                           "parameters. Call reset() after changing them.")
+            .def_readwrite("option", &odometry::RGBDOdometryTracker::option_,
+                           "odometry.OdometryOption: Odometry hyper "
+                           "parameters. Call reset() after changing them.")
+            .def("__repr__", [](const odometry::RGBDOdometryTracker &t) {
+                return std::string("odometry::RGBDOdometryTracker");
+            });
+    docstring::ClassMethodDocInject(
+            m, "RGBDOdometryTracker", "track",
+            {{"rgbd", "RGBD image of the new frame."},
+             {"odo_init", "Initial 4x4 motion matrix estimation."},
+             {"jacobian",
+              "The odometry Jacobian method to use. Can be "
+              "``odometry::RGBDOdometryJacobianFromHybridTerm()`` or "
+              "``odometry::RGBDOdometryJacobianFromColorTerm().``"}});
+    docstring::ClassMethodDocInject(m, "RGBDOdometryTracker", "reset");
+    docstring::ClassMethodDocInject(m, "RGBDOdometryTracker",
+                                    "has_previous_frame");
 }
 
 void pybind_odometry_methods(py::module &m) {
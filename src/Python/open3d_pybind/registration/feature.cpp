@@ -25,6 +25,7 @@
 // ----------------------------------------------------------------------------
 
 #include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/FeatureIndex.h"
 #include "Open3D/Geometry/PointCloud.h"
 
 #include "open3d_pybind/docstring.h"
@@ -60,6 +61,125 @@ void pybind_feature(py::module &m) {
     docstring::ClassMethodDocInject(m, "Feature", "resize",
                                     {{"dim", "Feature dimension per point."},
                                      {"n", "Number of points."}});
+
+    // open3d.registration.CompactFeature
+    py::class_<registration::CompactFeature,
+               std::shared_ptr<registration::CompactFeature>>
+            compact_feature(m, "CompactFeature",
+                            "Class to store features in single or half "
+                            "precision.");
+    py::enum_<registration::CompactFeature::Precision> precision(
+            compact_feature, "Precision", py::arithmetic());
+    precision
+            .value("Float32", registration::CompactFeature::Precision::Float32)
+            .value("Float16", registration::CompactFeature::Precision::Float16)
+            .export_values();
+    py::detail::bind_default_constructor<registration::CompactFeature>(
+            compact_feature);
+    py::detail::bind_copy_functions<registration::CompactFeature>(
+            compact_feature);
+    compact_feature
+            .def("resize", &registration::CompactFeature::Resize, "dim"_a,
+                 "n"_a,
+                 "precision"_a =
+                         registration::CompactFeature::Precision::Float32,
+                 "Resize feature data buffer to ``dim x n``.")
+            .def("dimension", &registration::CompactFeature::Dimension,
+                 "Returns feature dimensions per point.")
+            .def("num", &registration::CompactFeature::Num,
+                 "Returns number of points.")
+            .def("get_value", &registration::CompactFeature::GetValue,
+                 "Returns a value of the feature of a point.", "row"_a,
+                 "col"_a)
+            .def("to_feature", &registration::CompactFeature::ToFeature,
+                 "Returns the features in double precision.")
+            .def_readonly("precision",
+                          &registration::CompactFeature::precision_,
+                          "Precision of the stored features.")
+            .def("__repr__", [](const registration::CompactFeature &f) {
+                return std::string(
+                               "registration::CompactFeature class with "
+                               "dimension = ") +
+                       std::to_string(f.Dimension()) +
+                       std::string(" and num = ") + std::to_string(f.Num());
+            });
+    docstring::ClassMethodDocInject(m, "CompactFeature", "dimension");
+    docstring::ClassMethodDocInject(m, "CompactFeature", "num");
+    docstring::ClassMethodDocInject(m, "CompactFeature", "to_feature");
+    docstring::ClassMethodDocInject(
+            m, "CompactFeature", "get_value",
+            {{"row", "Index of the value in the feature."},
+             {"col", "Index of the point."}});
+    docstring::ClassMethodDocInject(
+            m, "CompactFeature", "resize",
+            {{"dim", "Feature dimension per point."},
+             {"n", "Number of points."},
+             {"precision", "Precision of the stored features."}});
+
+    // open3d.registration.FeatureIndex
+    py::class_<registration::FeatureIndex,
+               std::shared_ptr<registration::FeatureIndex>>
+            feature_index(m, "FeatureIndex",
+                          "Nearest neighbor index of high dimensional "
+                          "features, exact or a randomized KD-forest.");
+    feature_index
+            .def(py::init<int, int>(), "num_trees"_a = 4,
+                 "max_checks"_a = -1)
+            .def(py::init<const registration::Feature &, int, int>(),
+                 "feature"_a, "num_trees"_a = 4, "max_checks"_a = -1)
+            .def("set_feature",
+                 (bool (registration::FeatureIndex::*)(
+                         const registration::Feature &)) &
+                         registration::FeatureIndex::SetFeature,
+                 "Builds the index of the features.", "feature"_a)
+            .def("set_feature",
+                 (bool (registration::FeatureIndex::*)(
+                         const registration::CompactFeature &)) &
+                         registration::FeatureIndex::SetFeature,
+                 "Builds the index of single or half precision features.",
+                 "feature"_a)
+            .def("num", &registration::FeatureIndex::Num,
+                 "Returns the number of indexed features.")
+            .def(
+                    "search_knn",
+                    [](const registration::FeatureIndex &index,
+                       const registration::Feature &query, int knn) {
+                        std::vector<int> indices;
+                        std::vector<float> distance2;
+                        index.SearchKNN(query, knn, indices, distance2);
+                        return std::make_tuple(indices, distance2);
+                    },
+                    "Finds the ``knn`` nearest features of every query "
+                    "feature, ``knn`` entries per query.",
+                    "query"_a, "knn"_a)
+            .def(
+                    "search_nearest",
+                    [](const registration::FeatureIndex &index,
+                       const registration::Feature &query) {
+                        return index.SearchNearest(query);
+                    },
+                    "Finds the nearest feature of every query feature.",
+                    "query"_a)
+            .def_readonly("num_trees",
+                          &registration::FeatureIndex::num_trees_,
+                          "int: Number of randomized KD-trees.")
+            .def_readonly("max_checks",
+                          &registration::FeatureIndex::max_checks_,
+                          "int: Maximum number of features compared by a "
+                          "search, -1 for exact searches. Both are set when "
+                          "the index is constructed.")
+            .def("__repr__", [](const registration::FeatureIndex &index) {
+                return std::string(
+                               "registration::FeatureIndex with num = ") +
+                       std::to_string(index.Num());
+            });
+    docstring::ClassMethodDocInject(m, "FeatureIndex", "num");
+    docstring::ClassMethodDocInject(
+            m, "FeatureIndex", "search_knn",
+            {{"query", "Query features."},
+             {"knn", "Number of neighbors per query."}});
+    docstring::ClassMethodDocInject(m, "FeatureIndex", "search_nearest",
+                                    {{"query", "Query features."}});
 }
 
 void pybind_feature_methods(py::module &m) {
@@ -70,4 +190,43 @@ void pybind_feature_methods(py::module &m) {
             m, "compute_fpfh_feature",
             {{"input", "The Input point cloud."},
              {"search_param", "KDTree KNN search parameter."}});
+    m.def("compute_fpfh_feature_compact",
+          &registration::ComputeFPFHFeatureCompact,
+          "Function to compute FPFH feature for a point cloud in single or "
+          "half precision",
+          "input"_a, "search_param"_a,
+          "precision"_a = registration::CompactFeature::Precision::Float32);
+    docstring::FunctionDocInject(
+            m, "compute_fpfh_feature_compact",
+            {{"input", "The Input point cloud."},
+             {"search_param", "KDTree KNN search parameter."},
+             {"precision", "Precision of the stored features."}});
+    m.def("match_features",
+          (registration::CorrespondenceSet(*)(const registration::Feature &,
+                                              const registration::Feature &,
+                                              bool, int)) &
+                  registration::MatchFeatures,
+          "Function to match features by nearest neighbor search",
+          "source_feature"_a, "target_feature"_a, "mutual_filter"_a = false,
+          "max_checks"_a = -1);
+    m.def("match_features",
+          (registration::CorrespondenceSet(*)(
+                  const registration::Feature &,
+                  const registration::FeatureIndex &,
+                  const registration::Feature &,
+                  const registration::FeatureIndex &, bool)) &
+                  registration::MatchFeatures,
+          "Function to match features with prebuilt feature indexes",
+          "source_feature"_a, "source_index"_a, "target_feature"_a,
+          "target_index"_a, "mutual_filter"_a = false);
+    docstring::FunctionDocInject(
+            m, "match_features",
+            {{"source_feature", "Source point cloud feature."},
+             {"target_feature", "Target point cloud feature."},
+             {"source_index", "Feature index of ``source_feature``."},
+             {"target_index", "Feature index of ``target_feature``."},
+             {"mutual_filter", "Keep mutual nearest neighbors only."},
+             {"max_checks",
+              "Maximum number of features compared by a search, -1 for "
+              "exact searches."}});
 }
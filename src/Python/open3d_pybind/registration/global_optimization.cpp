@@ -362,6 +362,47 @@ void pybind_global_optimization(py::module &m) {
                             std::string("\n> reference_node : ") +
                             std::to_string(goo.reference_node_);
                  });
+
+    py::class_<registration::IncrementalGlobalOptimization> incremental(
+            m, "IncrementalGlobalOptimization",
+            "Incremental pose graph optimization for nodes and edges that are "
+            "added while the graph is being built. An update optimizes the "
+            "nodes from the oldest node touched by the new nodes and edges on "
+            "and holds older nodes fixed. An update reaching further back "
+            "than the newest window_size nodes only optimizes these and "
+            "marginalizes the older nodes into a linearized prior.");
+    incremental
+            .def(py::init<const registration::
+                                  GlobalOptimizationConvergenceCriteria &,
+                          const registration::GlobalOptimizationOption &,
+                          int>(),
+                 "criteria"_a =
+                         registration::GlobalOptimizationConvergenceCriteria(),
+                 "option"_a = registration::GlobalOptimizationOption(),
+                 "window_size"_a = 100)
+            .def("add_node",
+                 &registration::IncrementalGlobalOptimization::AddNode,
+                 "Adds a node to the graph and returns its id.", "node"_a)
+            .def("add_edge",
+                 &registration::IncrementalGlobalOptimization::AddEdge,
+                 "Adds an edge between two nodes of the graph.", "edge"_a)
+            .def("optimize",
+                 &registration::IncrementalGlobalOptimization::Optimize,
+                 "Optimizes the nodes affected by the nodes and edges added "
+                 "since the last call.")
+            .def_property_readonly(
+                    "pose_graph",
+                    &registration::IncrementalGlobalOptimization::GetPoseGraph,
+                    "``PoseGraph``: The optimized pose graph.")
+            .def("__repr__",
+                 [](const registration::IncrementalGlobalOptimization &io) {
+                     return std::string(
+                                    "IncrementalGlobalOptimization with ") +
+                            std::to_string(io.GetPoseGraph().nodes_.size()) +
+                            std::string(" nodes and ") +
+                            std::to_string(io.GetPoseGraph().edges_.size()) +
+                            std::string(" edges.");
+                 });
 }
 
 void pybind_global_optimization_methods(py::module &m) {
@@ -30,6 +30,11 @@
 #include "Open3D/Registration/CorrespondenceChecker.h"
 #include "Open3D/Registration/FastGlobalRegistration.h"
 #include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/FeatureIndex.h"
+#include "Open3D/Registration/FragmentRegistration.h"
+#include "Open3D/Registration/GeneralizedICP.h"
+#include "Open3D/Registration/MultiScaleICP.h"
+#include "Open3D/Registration/RobustKernel.h"
 #include "Open3D/Registration/TransformationEstimation.h"
 #include "Open3D/Utility/Console.h"
 
@@ -153,6 +158,78 @@ void pybind_registration_classes(py::module &m) {
                              c.max_iteration_, c.max_validation_);
                  });
 
+    // open3d.registration.RobustKernel
+    py::class_<registration::RobustKernel,
+               std::shared_ptr<registration::RobustKernel>>
+            rk(m, "RobustKernel",
+               "Base class of the robust kernels of the transformation "
+               "estimations, which reweight the residuals of their least "
+               "squares problems.");
+    rk.def("weight", &registration::RobustKernel::Weight, "residual"_a,
+           "Returns the weight of residual.");
+
+    // open3d.registration.L2Loss: RobustKernel
+    py::class_<registration::L2Loss, std::shared_ptr<registration::L2Loss>,
+               registration::RobustKernel>
+            l2(m, "L2Loss", "Plain least squares, every weight is one.");
+    l2.def(py::init<>())
+            .def("__repr__", [](const registration::L2Loss &rk) {
+                return std::string("registration::L2Loss");
+            });
+
+    // open3d.registration.HuberLoss: RobustKernel
+    py::class_<registration::HuberLoss,
+               std::shared_ptr<registration::HuberLoss>,
+               registration::RobustKernel>
+            huber(m, "HuberLoss",
+                  "Huber loss, quadratic for residuals up to k and linear "
+                  "beyond.");
+    huber.def(py::init<double>(), "k"_a)
+            .def_readwrite("k", &registration::HuberLoss::k_,
+                           "Scale parameter.")
+            .def("__repr__", [](const registration::HuberLoss &rk) {
+                return fmt::format("registration::HuberLoss with k={:e}",
+                                   rk.k_);
+            });
+
+    // open3d.registration.CauchyLoss: RobustKernel
+    py::class_<registration::CauchyLoss,
+               std::shared_ptr<registration::CauchyLoss>,
+               registration::RobustKernel>
+            cauchy(m, "CauchyLoss", "Cauchy loss.");
+    cauchy.def(py::init<double>(), "k"_a)
+            .def_readwrite("k", &registration::CauchyLoss::k_,
+                           "Scale parameter.")
+            .def("__repr__", [](const registration::CauchyLoss &rk) {
+                return fmt::format("registration::CauchyLoss with k={:e}",
+                                   rk.k_);
+            });
+
+    // open3d.registration.GMLoss: RobustKernel
+    py::class_<registration::GMLoss, std::shared_ptr<registration::GMLoss>,
+               registration::RobustKernel>
+            gm(m, "GMLoss",
+               "Geman-McClure loss, k is in units of squared residuals.");
+    gm.def(py::init<double>(), "k"_a)
+            .def_readwrite("k", &registration::GMLoss::k_, "Scale parameter.")
+            .def("__repr__", [](const registration::GMLoss &rk) {
+                return fmt::format("registration::GMLoss with k={:e}", rk.k_);
+            });
+
+    // open3d.registration.TukeyLoss: RobustKernel
+    py::class_<registration::TukeyLoss,
+               std::shared_ptr<registration::TukeyLoss>,
+               registration::RobustKernel>
+            tukey(m, "TukeyLoss",
+                  "Tukey biweight loss, residuals above k are ignored.");
+    tukey.def(py::init<double>(), "k"_a)
+            .def_readwrite("k", &registration::TukeyLoss::k_,
+                           "Scale parameter.")
+            .def("__repr__", [](const registration::TukeyLoss &rk) {
+                return fmt::format("registration::TukeyLoss with k={:e}",
+                                   rk.k_);
+            });
+
     // open3d.registration.TransformationEstimation
     py::class_<
             registration::TransformationEstimation,
@@ -194,11 +271,14 @@ void pybind_registration_classes(py::module &m) {
                    "distance.");
     py::detail::bind_copy_functions<
             registration::TransformationEstimationPointToPoint>(te_p2p);
-    te_p2p.def(py::init([](bool with_scaling) {
+    te_p2p.def(py::init([](bool with_scaling,
+                           std::shared_ptr<registration::RobustKernel> kernel) {
                    return new registration::
-                           TransformationEstimationPointToPoint(with_scaling);
+                           TransformationEstimationPointToPoint(with_scaling,
+                                                                kernel);
                }),
-               "with_scaling"_a = false)
+               "with_scaling"_a = false,
+               "kernel"_a = std::make_shared<registration::L2Loss>())
             .def("__repr__",
                  [](const registration::TransformationEstimationPointToPoint
                             &te) {
@@ -221,7 +301,12 @@ The homogeneous transformation is given by
 :math:`T = \begin{bmatrix} c\mathbf{R} & \mathbf{t} \\ \mathbf{0} & 1 \end{bmatrix}`
 
 Sets :math:`c = 1` if ``with_scaling`` is ``False``.
-)");
+)")
+            .def_readwrite(
+                    "kernel",
+                    &registration::TransformationEstimationPointToPoint::
+                            kernel_,
+                    "Robust kernel weighting the point distances.");
 
     // open3d.registration.TransformationEstimationPointToPlane:
     // TransformationEstimation
@@ -232,15 +317,64 @@ Sets :math:`c = 1` if ``with_scaling`` is ``False``.
             te_p2l(m, "TransformationEstimationPointToPlane",
                    "Class to estimate a transformation for point to plane "
                    "distance.");
-    py::detail::bind_default_constructor<
-            registration::TransformationEstimationPointToPlane>(te_p2l);
     py::detail::bind_copy_functions<
             registration::TransformationEstimationPointToPlane>(te_p2l);
-    te_p2l.def(
-            "__repr__",
-            [](const registration::TransformationEstimationPointToPlane &te) {
-                return std::string("TransformationEstimationPointToPlane");
-            });
+    te_p2l.def(py::init([](std::shared_ptr<registration::RobustKernel> kernel) {
+                   return new registration::
+                           TransformationEstimationPointToPlane(kernel);
+               }),
+               "kernel"_a = std::make_shared<registration::L2Loss>())
+            .def("__repr__",
+                 [](const registration::TransformationEstimationPointToPlane
+                            &te) {
+                     return std::string(
+                             "TransformationEstimationPointToPlane");
+                 })
+            .def_readwrite(
+                    "kernel",
+                    &registration::TransformationEstimationPointToPlane::
+                            kernel_,
+                    "Robust kernel weighting the point to plane distances.");
+
+    // open3d.registration.TransformationEstimationForGeneralizedICP:
+    // TransformationEstimation
+    py::class_<registration::TransformationEstimationForGeneralizedICP,
+               PyTransformationEstimation<
+                       registration::TransformationEstimationForGeneralizedICP>,
+               registration::TransformationEstimation>
+            te_gicp(m, "TransformationEstimationForGeneralizedICP",
+                    "Class to estimate a transformation for Generalized ICP, "
+                    "the covariances of the points are given by their "
+                    "normals.");
+    py::detail::bind_copy_functions<
+            registration::TransformationEstimationForGeneralizedICP>(te_gicp);
+    te_gicp.def(py::init([](double epsilon,
+                            std::shared_ptr<registration::RobustKernel>
+                                    kernel) {
+                    return new registration::
+                            TransformationEstimationForGeneralizedICP(epsilon,
+                                                                      kernel);
+                }),
+                "epsilon"_a = 1e-3,
+                "kernel"_a = std::make_shared<registration::L2Loss>())
+            .def("__repr__",
+                 [](const registration::
+                            TransformationEstimationForGeneralizedICP &te) {
+                     return fmt::format(
+                             "TransformationEstimationForGeneralizedICP with "
+                             "epsilon={:e}",
+                             te.epsilon_);
+                 })
+            .def_readwrite("epsilon",
+                           &registration::
+                                   TransformationEstimationForGeneralizedICP::
+                                           epsilon_,
+                           "Variance of a point along its normal.")
+            .def_readwrite("kernel",
+                           &registration::
+                                   TransformationEstimationForGeneralizedICP::
+                                           kernel_,
+                           "Robust kernel weighting the residuals.");
 
     // open3d.registration.CorrespondenceChecker
     py::class_<registration::CorrespondenceChecker,
@@ -385,17 +519,20 @@ must hold true for all edges.)");
                              bool decrease_mu,
                              double maximum_correspondence_distance,
                              int iteration_number, double tuple_scale,
-                             int maximum_tuple_count) {
+                             int maximum_tuple_count,
+                             int maximum_feature_checks) {
                      return new registration::FastGlobalRegistrationOption(
                              division_factor, use_absolute_scale, decrease_mu,
                              maximum_correspondence_distance, iteration_number,
-                             tuple_scale, maximum_tuple_count);
+                             tuple_scale, maximum_tuple_count,
+                             maximum_feature_checks);
                  }),
                  "division_factor"_a = 1.4, "use_absolute_scale"_a = false,
                  "decrease_mu"_a = false,
                  "maximum_correspondence_distance"_a = 0.025,
                  "iteration_number"_a = 64, "tuple_scale"_a = 0.95,
-                 "maximum_tuple_count"_a = 1000)
+                 "maximum_tuple_count"_a = 1000,
+                 "maximum_feature_checks"_a = -1)
             .def_readwrite(
                     "division_factor",
                     &registration::FastGlobalRegistrationOption::
@@ -429,6 +566,11 @@ must hold true for all edges.)");
                            &registration::FastGlobalRegistrationOption::
                                    maximum_tuple_count_,
                            "float: Maximum tuple numbers.")
+            .def_readwrite("maximum_feature_checks",
+                           &registration::FastGlobalRegistrationOption::
+                                   maximum_feature_checks_,
+                           "int: Maximum number of features compared by a "
+                           "feature search, -1 for exact feature matching.")
             .def("__repr__",
                  [](const registration::FastGlobalRegistrationOption &c) {
                      return fmt::format(
@@ -440,11 +582,210 @@ must hold true for all edges.)");
                              "\nmaximum_correspondence_distance={}"
                              "\niteration_number={}"
                              "\ntuple_scale={}"
-                             "\nmaximum_tuple_count={}",
+                             "\nmaximum_tuple_count={}"
+                             "\nmaximum_feature_checks={}",
                              c.division_factor_, c.use_absolute_scale_,
                              c.decrease_mu_, c.maximum_correspondence_distance_,
                              c.iteration_number_, c.tuple_scale_,
-                             c.maximum_tuple_count_);
+                             c.maximum_tuple_count_, c.maximum_feature_checks_);
+                 });
+
+    // open3d.registration.ICPTarget
+    py::class_<registration::ICPTarget> icp_target(
+            m, "ICPTarget",
+            "Target point cloud prepared for repeated ICP registration.");
+    icp_target.def(py::init<>())
+            .def(py::init<const geometry::PointCloud &>(), "target"_a)
+            .def("set_point_cloud", &registration::ICPTarget::SetPointCloud,
+                 "Builds the buffers and the search tree of the point cloud.",
+                 "target"_a)
+            .def("is_empty", &registration::ICPTarget::IsEmpty,
+                 "Returns ``True`` if the target contains no points.")
+            .def("has_normals", &registration::ICPTarget::HasNormals,
+                 "Returns ``True`` if the target has normals.")
+            .def("__repr__", [](const registration::ICPTarget &t) {
+                return fmt::format(
+                        "registration::ICPTarget with {:d} points{}",
+                        t.indices_.size(),
+                        t.HasNormals() ? " and normals" : "");
+            });
+
+    // open3d.registration.ColoredICPTarget
+    py::class_<registration::ColoredICPTarget> colored_icp_target(
+            m, "ColoredICPTarget",
+            "Target point cloud prepared for repeated Colored ICP "
+            "registration.");
+    colored_icp_target.def(py::init<>())
+            .def(py::init<const geometry::PointCloud &, double, int>(),
+                 "target"_a, "gradient_radius"_a, "gradient_max_nn"_a = 30)
+            .def("set_point_cloud",
+                 &registration::ColoredICPTarget::SetPointCloud,
+                 "Builds the search tree and estimates the color gradients "
+                 "of the point cloud.",
+                 "target"_a, "gradient_radius"_a, "gradient_max_nn"_a = 30)
+            .def("is_empty", &registration::ColoredICPTarget::IsEmpty,
+                 "Returns ``True`` if the target contains no points.")
+            .def("__repr__", [](const registration::ColoredICPTarget &t) {
+                return fmt::format(
+                        "registration::ColoredICPTarget with {:d} points",
+                        t.intensity_.size());
+            });
+
+    // open3d.registration.MultiScaleICPLevel
+    py::class_<registration::MultiScaleICPLevel> multi_scale_icp_level(
+            m, "MultiScaleICPLevel",
+            "One level of the schedule of registration_multi_scale_icp.");
+    py::detail::bind_copy_functions<registration::MultiScaleICPLevel>(
+            multi_scale_icp_level);
+    multi_scale_icp_level
+            .def(py::init<double, double,
+                          const registration::ICPConvergenceCriteria &>(),
+                 "voxel_size"_a = 0.0, "max_correspondence_distance"_a = 0.0,
+                 "criteria"_a = registration::ICPConvergenceCriteria())
+            .def_readwrite("voxel_size",
+                           &registration::MultiScaleICPLevel::voxel_size_,
+                           "Voxel size of the level, non-positive for the "
+                           "full resolution.")
+            .def_readwrite("max_correspondence_distance",
+                           &registration::MultiScaleICPLevel::
+                                   max_correspondence_distance_,
+                           "Maximum correspondence points-pair distance.")
+            .def_readwrite("criteria",
+                           &registration::MultiScaleICPLevel::criteria_,
+                           "Convergence criteria of the level.")
+            .def("__repr__", [](const registration::MultiScaleICPLevel &l) {
+                return fmt::format(
+                        "registration::MultiScaleICPLevel with "
+                        "voxel_size={}, max_correspondence_distance={}, "
+                        "and max_iteration={:d}",
+                        l.voxel_size_, l.max_correspondence_distance_,
+                        l.criteria_.max_iteration_);
+            });
+
+    // open3d.registration.MultiScaleICPTarget
+    py::class_<registration::MultiScaleICPTarget> multi_scale_icp_target(
+            m, "MultiScaleICPTarget",
+            "Pyramid of a target point cloud for "
+            "registration_multi_scale_icp.");
+    multi_scale_icp_target.def(py::init<>())
+            .def(py::init<const geometry::PointCloud &,
+                          const std::vector<double> &, bool>(),
+                 "target"_a, "voxel_sizes"_a, "estimate_normals"_a = true)
+            .def("set_point_cloud",
+                 &registration::MultiScaleICPTarget::SetPointCloud,
+                 "Builds the levels of the pyramid.", "target"_a,
+                 "voxel_sizes"_a, "estimate_normals"_a = true)
+            .def("get_level", &registration::MultiScaleICPTarget::GetLevel,
+                 "Returns the index of the level with the given voxel size, "
+                 "or -1.",
+                 "voxel_size"_a)
+            .def_readonly("voxel_sizes",
+                          &registration::MultiScaleICPTarget::voxel_sizes_,
+                          "Voxel size of every level.")
+            .def_readonly("point_clouds",
+                          &registration::MultiScaleICPTarget::point_clouds_,
+                          "Downsampled point cloud of every level.")
+            .def("__repr__", [](const registration::MultiScaleICPTarget &t) {
+                return fmt::format(
+                        "registration::MultiScaleICPTarget with {:d} levels",
+                        t.voxel_sizes_.size());
+            });
+
+    // open3d.registration.FragmentPair
+    py::class_<registration::FragmentPair> fragment_pair(
+            m, "FragmentPair",
+            "Pair of fragments to be registered by register_fragment_pairs.");
+    py::detail::bind_copy_functions<registration::FragmentPair>(fragment_pair);
+    fragment_pair
+            .def(py::init<int, int, bool, const Eigen::Matrix4d &>(),
+                 "source_id"_a = -1, "target_id"_a = -1, "uncertain"_a = true,
+                 "init"_a = Eigen::Matrix4d::Identity())
+            .def_readwrite("source_id",
+                           &registration::FragmentPair::source_id_,
+                           "int: Index of the source fragment.")
+            .def_readwrite("target_id",
+                           &registration::FragmentPair::target_id_,
+                           "int: Index of the target fragment.")
+            .def_readwrite("uncertain",
+                           &registration::FragmentPair::uncertain_,
+                           "bool: ``True`` for loop closures, which are "
+                           "globally registered, ``False`` for odometry "
+                           "pairs, which are refined from ``init``.")
+            .def_readwrite("init", &registration::FragmentPair::init_,
+                           "``4 x 4`` float64 numpy array: Initial "
+                           "transformation of odometry pairs.")
+            .def("__repr__", [](const registration::FragmentPair &p) {
+                return fmt::format(
+                        "registration::FragmentPair from {:d} to {:d}{}",
+                        p.source_id_, p.target_id_,
+                        p.uncertain_ ? " (loop closure)" : "");
+            });
+
+    // open3d.registration.GlobalRegistrationMethod
+    py::enum_<registration::GlobalRegistrationMethod>(
+            m, "GlobalRegistrationMethod",
+            "Global registration of the loop closures of "
+            "register_fragment_pairs.")
+            .value("RANSAC", registration::GlobalRegistrationMethod::RANSAC)
+            .value("FastGlobalRegistration",
+                   registration::GlobalRegistrationMethod::
+                           FastGlobalRegistration)
+            .export_values();
+
+    // open3d.registration.FragmentRegistrationOption
+    py::class_<registration::FragmentRegistrationOption>
+            fragment_registration_option(m, "FragmentRegistrationOption",
+                                         "Options for "
+                                         "register_fragment_pairs.");
+    py::detail::bind_copy_functions<registration::FragmentRegistrationOption>(
+            fragment_registration_option);
+    fragment_registration_option
+            .def(py::init<double, registration::GlobalRegistrationMethod,
+                          const registration::RANSACConvergenceCriteria &, int,
+                          const registration::ICPConvergenceCriteria &,
+                          double>(),
+                 "voxel_size"_a = 0.05,
+                 "global_registration"_a =
+                         registration::GlobalRegistrationMethod::RANSAC,
+                 "ransac_criteria"_a =
+                         registration::RANSACConvergenceCriteria(4000000, 500),
+                 "maximum_feature_checks"_a = -1,
+                 "icp_criteria"_a =
+                         registration::ICPConvergenceCriteria(1e-6, 1e-6, 50),
+                 "minimum_overlap"_a = 0.3)
+            .def_readwrite(
+                    "voxel_size",
+                    &registration::FragmentRegistrationOption::voxel_size_,
+                    "float: Voxel size the fragments are downsampled with.")
+            .def_readwrite("global_registration",
+                           &registration::FragmentRegistrationOption::
+                                   global_registration_,
+                           "Global registration of loop closures.")
+            .def_readwrite("ransac_criteria",
+                           &registration::FragmentRegistrationOption::
+                                   ransac_criteria_,
+                           "Convergence criteria of RANSAC.")
+            .def_readwrite("maximum_feature_checks",
+                           &registration::FragmentRegistrationOption::
+                                   maximum_feature_checks_,
+                           "int: Maximum number of features compared by a "
+                           "feature search, -1 for exact feature matching.")
+            .def_readwrite("icp_criteria",
+                           &registration::FragmentRegistrationOption::
+                                   icp_criteria_,
+                           "Convergence criteria of the ICP refinement.")
+            .def_readwrite("minimum_overlap",
+                           &registration::FragmentRegistrationOption::
+                                   minimum_overlap_,
+                           "float: Minimum overlap ratio of loop closures.")
+            .def("__repr__",
+                 [](const registration::FragmentRegistrationOption &o) {
+                     return fmt::format(
+                             "registration::FragmentRegistrationOption with "
+                             "voxel_size={}, maximum_feature_checks={:d}, "
+                             "and minimum_overlap={}",
+                             o.voxel_size_, o.maximum_feature_checks_,
+                             o.minimum_overlap_);
                  });
 
     // open3d.registration.RegistrationResult
@@ -502,14 +843,22 @@ static const std::unordered_map<std::string, std::string>
                  "(``registration::TransformationEstimationPointToPoint``, "
                  "``registration::TransformationEstimationPointToPlane``)"},
                 {"init", "Initial transformation estimation"},
+                {"kernel", "Robust kernel weighting the residuals"},
                 {"lambda_geometric", "lambda_geometric value"},
                 {"max_correspondence_distance",
                  "Maximum correspondence points-pair distance."},
+                {"maximum_feature_checks",
+                 "Maximum number of features compared by a feature "
+                 "search, -1 for exact feature matching."},
+                {"mutual_filter",
+                 "Sample only mutual nearest feature matches."},
                 {"option", "Registration option"},
                 {"ransac_n", "Fit ransac with ``ransac_n`` correspondences"},
                 {"source_feature", "Source point cloud feature."},
+                {"source_index", "Feature index of ``source_feature``."},
                 {"source", "The source point cloud."},
                 {"target_feature", "Target point cloud feature."},
+                {"target_index", "Feature index of ``target_feature``."},
                 {"target", "The target point cloud."},
                 {"transformation",
                  "The 4x4 transformation matrix to transform ``source`` to "
@@ -523,7 +872,13 @@ void pybind_registration_methods(py::module &m) {
     docstring::FunctionDocInject(m, "evaluate_registration",
                                  map_shared_argument_docstrings);
 
-    m.def("registration_icp", &registration::RegistrationICP,
+    m.def("registration_icp",
+          (registration::RegistrationResult(*)(
+                  const geometry::PointCloud &, const geometry::PointCloud &,
+                  double, const Eigen::Matrix4d &,
+                  const registration::TransformationEstimation &,
+                  const registration::ICPConvergenceCriteria &)) &
+                  registration::RegistrationICP,
           "Function for ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
@@ -532,15 +887,86 @@ void pybind_registration_methods(py::module &m) {
           "criteria"_a = registration::ICPConvergenceCriteria());
     docstring::FunctionDocInject(m, "registration_icp",
                                  map_shared_argument_docstrings);
+    m.def("registration_icp",
+          (registration::RegistrationResult(*)(
+                  const geometry::PointCloud &, const registration::ICPTarget &,
+                  double, const Eigen::Matrix4d &,
+                  const registration::TransformationEstimation &,
+                  const registration::ICPConvergenceCriteria &)) &
+                  registration::RegistrationICP,
+          "Function for ICP registration against a prepared target",
+          "source"_a, "target"_a, "max_correspondence_distance"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "estimation_method"_a =
+                  registration::TransformationEstimationPointToPoint(false),
+          "criteria"_a = registration::ICPConvergenceCriteria());
 
-    m.def("registration_colored_icp", &registration::RegistrationColoredICP,
+    m.def("registration_colored_icp",
+          (registration::RegistrationResult(*)(
+                  const geometry::PointCloud &, const geometry::PointCloud &,
+                  double, const Eigen::Matrix4d &,
+                  const registration::ICPConvergenceCriteria &, double,
+                  std::shared_ptr<registration::RobustKernel>)) &
+                  registration::RegistrationColoredICP,
           "Function for Colored ICP registration", "source"_a, "target"_a,
           "max_correspondence_distance"_a,
           "init"_a = Eigen::Matrix4d::Identity(),
           "criteria"_a = registration::ICPConvergenceCriteria(),
-          "lambda_geometric"_a = 0.968);
+          "lambda_geometric"_a = 0.968,
+          "kernel"_a = std::make_shared<registration::L2Loss>());
     docstring::FunctionDocInject(m, "registration_colored_icp",
                                  map_shared_argument_docstrings);
+    m.def("registration_colored_icp",
+          (registration::RegistrationResult(*)(
+                  const geometry::PointCloud &,
+                  const registration::ColoredICPTarget &, double,
+                  const Eigen::Matrix4d &,
+                  const registration::ICPConvergenceCriteria &, double,
+                  std::shared_ptr<registration::RobustKernel>)) &
+                  registration::RegistrationColoredICP,
+          "Function for Colored ICP registration against a prepared target",
+          "source"_a, "target"_a, "max_correspondence_distance"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "criteria"_a = registration::ICPConvergenceCriteria(),
+          "lambda_geometric"_a = 0.968,
+          "kernel"_a = std::make_shared<registration::L2Loss>());
+
+    m.def("registration_generalized_icp",
+          &registration::RegistrationGeneralizedICP,
+          "Function for Generalized ICP registration", "source"_a, "target"_a,
+          "max_correspondence_distance"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "estimation_method"_a =
+                  registration::TransformationEstimationForGeneralizedICP(),
+          "criteria"_a = registration::ICPConvergenceCriteria());
+    docstring::FunctionDocInject(m, "registration_generalized_icp",
+                                 map_shared_argument_docstrings);
+
+    m.def("registration_multi_scale_icp",
+          (registration::RegistrationResult(*)(
+                  const geometry::PointCloud &, const geometry::PointCloud &,
+                  const std::vector<registration::MultiScaleICPLevel> &,
+                  const Eigen::Matrix4d &,
+                  const registration::TransformationEstimation &)) &
+                  registration::RegistrationMultiScaleICP,
+          "Function for coarse to fine ICP registration", "source"_a,
+          "target"_a, "levels"_a, "init"_a = Eigen::Matrix4d::Identity(),
+          "estimation_method"_a =
+                  registration::TransformationEstimationPointToPlane());
+    m.def("registration_multi_scale_icp",
+          (registration::RegistrationResult(*)(
+                  const geometry::PointCloud &,
+                  const registration::MultiScaleICPTarget &,
+                  const std::vector<registration::MultiScaleICPLevel> &,
+                  const Eigen::Matrix4d &,
+                  const registration::TransformationEstimation &)) &
+                  registration::RegistrationMultiScaleICP,
+          "Function for coarse to fine ICP registration against a cached "
+          "target pyramid",
+          "source"_a, "target"_a, "levels"_a,
+          "init"_a = Eigen::Matrix4d::Identity(),
+          "estimation_method"_a =
+                  registration::TransformationEstimationPointToPlane());
 
     m.def("registration_ransac_based_on_correspondence",
           &registration::RegistrationRANSACBasedOnCorrespondence,
@@ -565,20 +991,50 @@ void pybind_registration_methods(py::module &m) {
           "ransac_n"_a = 4,
           "checkers"_a = std::vector<std::reference_wrapper<
                   const registration::CorrespondenceChecker>>(),
-          "criteria"_a = registration::RANSACConvergenceCriteria(100000, 100));
+          "criteria"_a = registration::RANSACConvergenceCriteria(100000, 100),
+          "mutual_filter"_a = false, "maximum_feature_checks"_a = -1);
     docstring::FunctionDocInject(
             m, "registration_ransac_based_on_feature_matching",
             map_shared_argument_docstrings);
 
     m.def("registration_fast_based_on_feature_matching",
-          &registration::FastGlobalRegistration,
+          (registration::RegistrationResult(*)(
+                  const geometry::PointCloud &, const geometry::PointCloud &,
+                  const registration::Feature &, const registration::Feature &,
+                  const registration::FastGlobalRegistrationOption &)) &
+                  registration::FastGlobalRegistration,
           "Function for fast global registration based on feature matching",
           "source"_a, "target"_a, "source_feature"_a, "target_feature"_a,
           "option"_a = registration::FastGlobalRegistrationOption());
+    m.def("registration_fast_based_on_feature_matching",
+          (registration::RegistrationResult(*)(
+                  const geometry::PointCloud &, const geometry::PointCloud &,
+                  const registration::Feature &,
+                  const registration::FeatureIndex &,
+                  const registration::Feature &,
+                  const registration::FeatureIndex &,
+                  const registration::FastGlobalRegistrationOption &)) &
+                  registration::FastGlobalRegistration,
+          "Function for fast global registration based on feature matching "
+          "with prebuilt feature indexes",
+          "source"_a, "target"_a, "source_feature"_a, "source_index"_a,
+          "target_feature"_a, "target_index"_a,
+          "option"_a = registration::FastGlobalRegistrationOption());
     docstring::FunctionDocInject(m,
                                  "registration_fast_based_on_feature_matching",
                                  map_shared_argument_docstrings);
 
+    m.def("register_fragment_pairs", &registration::RegisterFragmentPairs,
+          "Function to register many pairs of fragments into a pose graph, "
+          "sharing the preprocessing of every fragment between its pairs",
+          "fragments"_a, "pairs"_a,
+          "option"_a = registration::FragmentRegistrationOption());
+    docstring::FunctionDocInject(
+            m, "register_fragment_pairs",
+            {{"fragments", "The fragments."},
+             {"pairs", "The pairs of fragments to register."},
+             {"option", "Registration option"}});
+
     m.def("get_information_matrix_from_point_clouds",
           &registration::GetInformationMatrixFromPointClouds,
           "Function for computing information matrix from transformation "
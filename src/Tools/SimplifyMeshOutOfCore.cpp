@@ -0,0 +1,252 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Dense>
+#include <cstdint>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Open3D/Open3D.h"
+
+void PrintHelp() {
+    using namespace open3d;
+    PrintOpen3DVersion();
+    // clang-format off
+    utility::LogInfo("Usage:");
+    utility::LogInfo("    > SimplifyMeshOutOfCore source_file target_file voxel_size [options]");
+    utility::LogInfo("      Simplify a mesh that does not fit into memory by vertex clustering.");
+    utility::LogInfo("      The triangles of <source_file> (.ply, .obj or .stl) are streamed from");
+    utility::LogInfo("      disk, only one representative per occupied voxel is kept in memory,");
+    utility::LogInfo("      and the simplified mesh is written to <target_file>.");
+    utility::LogInfo("");
+    utility::LogInfo("Options (listed in the order of execution priority):");
+    utility::LogInfo("    --help, -h                : Print help information.");
+    utility::LogInfo("    --verbose n               : Set verbose level (0-4).");
+    utility::LogInfo("    --average                 : Place the cluster vertex at the average of the");
+    utility::LogInfo("                                clustered vertices instead of the minimizer of");
+    utility::LogInfo("                                their error quadric.");
+    utility::LogInfo("    --max_voxels n            : Abort if more than n voxels are occupied. Bounds");
+    utility::LogInfo("                                the memory used for the clusters (default: 1e8).");
+    // clang-format on
+}
+
+namespace {
+
+using namespace open3d;
+
+/// Per voxel accumulator of the triangles touching the voxel. Stores the error
+/// quadric of the incident triangle planes (Lindstrom, "Out-of-Core
+/// Simplification of Large Polygonal Models", 2000) and the sum of the corners
+/// that fell into the voxel.
+struct VoxelCluster {
+    int index_ = -1;
+    Eigen::Matrix3d A_ = Eigen::Matrix3d::Zero();
+    Eigen::Vector3d b_ = Eigen::Vector3d::Zero();
+    Eigen::Vector3d position_sum_ = Eigen::Vector3d::Zero();
+    double weight_ = 0;
+};
+
+/// Returns the coordinates of the voxel containing `vert`.
+Eigen::Matrix<int64_t, 3, 1> GetVoxelIndex(const Eigen::Vector3d &vert,
+                                           double voxel_size) {
+    return Eigen::Matrix<int64_t, 3, 1>(
+            int64_t(std::floor(vert(0) / voxel_size)),
+            int64_t(std::floor(vert(1) / voxel_size)),
+            int64_t(std::floor(vert(2) / voxel_size)));
+}
+
+/// Packs the voxel coordinates relative to `origin` into 21 bits each, so
+/// that meshes far from the coordinate origin only need to span less than
+/// 2^20 voxels around their first vertex.
+bool PackVoxelKey(const Eigen::Vector3d &vert,
+                  const Eigen::Matrix<int64_t, 3, 1> &origin,
+                  double voxel_size,
+                  uint64_t &key) {
+    const int64_t bound = int64_t(1) << 20;
+    const Eigen::Matrix<int64_t, 3, 1> voxel =
+            GetVoxelIndex(vert, voxel_size);
+    key = 0;
+    for (int i = 0; i < 3; i++) {
+        int64_t idx = voxel(i) - origin(i);
+        if (idx < -bound || idx >= bound) {
+            return false;
+        }
+        key |= uint64_t(idx + bound) << (21 * i);
+    }
+    return true;
+}
+
+}  // unnamed namespace
+
+int main(int argc, char **argv) {
+    using namespace open3d;
+
+    utility::SetVerbosityLevel(utility::VerbosityLevel::Debug);
+    if (argc <= 3 || utility::ProgramOptionExists(argc, argv, "--help") ||
+        utility::ProgramOptionExists(argc, argv, "-h")) {
+        PrintHelp();
+        return 0;
+    }
+    int verbose = utility::GetProgramOptionAsInt(argc, argv, "--verbose", 2);
+    utility::SetVerbosityLevel((utility::VerbosityLevel)verbose);
+    bool use_average = utility::ProgramOptionExists(argc, argv, "--average");
+    size_t max_voxels = size_t(utility::GetProgramOptionAsDouble(
+            argc, argv, "--max_voxels", 1e8));
+    double voxel_size = std::atof(argv[3]);
+    if (voxel_size <= 0.0) {
+        utility::LogWarning("voxel_size must be positive.");
+        return 1;
+    }
+
+    std::unordered_map<uint64_t, VoxelCluster> clusters;
+    // Output triangles are stored with their smallest cluster index first so
+    // that triangles collapsing to the same voxels are only written once.
+    std::unordered_set<Eigen::Vector3i,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            triangles;
+    size_t num_input_triangles = 0;
+    bool in_bounds = true;
+    // Voxel of the first streamed vertex, the keys are relative to it.
+    bool has_origin = false;
+    Eigen::Matrix<int64_t, 3, 1> origin;
+
+    auto AddTriangle = [&](const Eigen::Vector3d &v0, const Eigen::Vector3d &v1,
+                           const Eigen::Vector3d &v2) {
+        num_input_triangles++;
+        if (!has_origin) {
+            origin = GetVoxelIndex(v0, voxel_size);
+            has_origin = true;
+        }
+        const Eigen::Vector3d *verts[3] = {&v0, &v1, &v2};
+        uint64_t keys[3];
+        for (int i = 0; i < 3; i++) {
+            if (!PackVoxelKey(*verts[i], origin, voxel_size, keys[i])) {
+                in_bounds = false;
+                return;
+            }
+        }
+        // Area weighted plane quadric of the triangle.
+        Eigen::Vector3d n = (v1 - v0).cross(v2 - v0);
+        double area = 0.5 * n.norm();
+        Eigen::Matrix3d A = Eigen::Matrix3d::Zero();
+        Eigen::Vector3d b = Eigen::Vector3d::Zero();
+        if (area > 0) {
+            n.normalize();
+            double d = -n.dot(v0);
+            A = area * n * n.transpose();
+            b = area * d * n;
+        }
+        int cluster_idx[3];
+        for (int i = 0; i < 3; i++) {
+            VoxelCluster &cluster = clusters[keys[i]];
+            if (cluster.index_ < 0) {
+                cluster.index_ = int(clusters.size() - 1);
+            }
+            cluster.A_ += A;
+            cluster.b_ += b;
+            cluster.position_sum_ += *verts[i];
+            cluster.weight_ += 1;
+            cluster_idx[i] = cluster.index_;
+        }
+        if (cluster_idx[0] == cluster_idx[1] ||
+            cluster_idx[1] == cluster_idx[2] ||
+            cluster_idx[2] == cluster_idx[0]) {
+            return;
+        }
+        int first = 0;
+        if (cluster_idx[1] < cluster_idx[first]) first = 1;
+        if (cluster_idx[2] < cluster_idx[first]) first = 2;
+        triangles.insert(Eigen::Vector3i(cluster_idx[first],
+                                         cluster_idx[(first + 1) % 3],
+                                         cluster_idx[(first + 2) % 3]));
+    };
+
+    utility::Timer timer;
+    timer.Start();
+    // The reading stops as soon as the mesh cannot be simplified.
+    bool success = io::ReadTriangleMeshStreamed(
+            argv[1],
+            [&](const Eigen::Vector3d &v0, const Eigen::Vector3d &v1,
+                const Eigen::Vector3d &v2) {
+                AddTriangle(v0, v1, v2);
+                return in_bounds && clusters.size() <= max_voxels;
+            },
+            verbose >= int(utility::VerbosityLevel::Info));
+    if (!success) {
+        utility::LogWarning("Failed to read {}.", argv[1]);
+        return 1;
+    }
+    if (!in_bounds) {
+        utility::LogWarning(
+                "The mesh spans more than 2^20 voxels from its first vertex "
+                "along an axis, increase voxel_size.");
+        return 1;
+    }
+    if (clusters.size() > max_voxels) {
+        utility::LogWarning(
+                "More than {:d} voxels are occupied, increase voxel_size or "
+                "--max_voxels.",
+                max_voxels);
+        return 1;
+    }
+
+    geometry::TriangleMesh mesh;
+    mesh.vertices_.resize(clusters.size());
+    for (const auto &it : clusters) {
+        const VoxelCluster &cluster = it.second;
+        Eigen::Vector3d average = cluster.position_sum_ / cluster.weight_;
+        Eigen::Vector3d vertex = average;
+        Eigen::SelfAdjointEigenSolver<Eigen::Matrix3d> solver(cluster.A_);
+        const Eigen::Vector3d &eigenvalues = solver.eigenvalues();
+        if (!use_average && eigenvalues(0) > 1e-3 * eigenvalues(2)) {
+            vertex = -cluster.A_.ldlt().solve(cluster.b_);
+            // Fall back to the average if the quadric minimizer leaves the
+            // neighborhood of the voxel, e.g. for nearly planar clusters.
+            if ((vertex - average).norm() > voxel_size) {
+                vertex = average;
+            }
+        }
+        mesh.vertices_[cluster.index_] = vertex;
+    }
+    clusters.clear();
+    mesh.triangles_.assign(triangles.begin(), triangles.end());
+    triangles.clear();
+    mesh.ComputeVertexNormals();
+    timer.Stop();
+
+    if (!io::WriteTriangleMesh(argv[2], mesh)) {
+        utility::LogWarning("Failed to write {}.", argv[2]);
+        return 1;
+    }
+    utility::LogInfo(
+            "Simplified {:d} triangles to {:d} vertices and {:d} triangles in "
+            "{:.3f} sec.",
+            num_input_triangles, mesh.vertices_.size(), mesh.triangles_.size(),
+            timer.GetDuration() / 1000.0);
+    utility::LogInfo("Peak resident memory: {:.1f} MB.",
+                     utility::GetPeakResidentSetSize() / 1048576.0);
+    return 0;
+}
@@ -700,8 +700,8 @@ TEST(Image, Filter_Gaussian5) {
             61,  94,  205, 231, 230, 96,  109, 232, 15,  16,  218, 232, 2,
             118, 3,   233, 160, 185, 166, 232, 61,  94,  205, 232, 46,  125,
             35,  233, 60,  145, 12,  233, 110, 3,   165, 232, 122, 145, 23,
-            232, 223, 6,   26,  233, 23,  249, 119, 233, 159, 37,  94,  233,
-            234, 229, 13,  233, 99,  24,  143, 232, 41,  96,  205, 232, 206,
+            232, 223, 6,   26,  233, 24,  249, 119, 233, 159, 37,  94,  233,
+            234, 229, 13,  233, 99,  24,  143, 232, 40,  96,  205, 232, 206,
             73,  101, 233, 15,  186, 202, 233, 62,  231, 242, 233, 76,  236,
             159, 233, 35,  111, 205, 231, 102, 26,  76,  233, 255, 241, 44,
             234, 32,  174, 126, 234, 84,  234, 47,  234};
@@ -713,13 +713,13 @@ TEST(Image, Filter_Gaussian7) {
     // reference data used to validate the filtering of an image
     vector<uint8_t> ref = {
             71,  19,  68,  232, 29,  11,  169, 232, 178, 140, 214, 232, 35,
-            21,  214, 232, 245, 42,  147, 232, 66,  168, 175, 232, 125, 101,
+            21,  214, 232, 245, 42,  147, 232, 65,  168, 175, 232, 125, 101,
             5,   233, 242, 119, 15,  233, 60,  92,  246, 232, 131, 231, 154,
-            232, 226, 75,  240, 232, 83,  18,  69,  233, 128, 68,  108, 233,
-            67,  141, 98,  233, 63,  199, 27,  233, 108, 191, 244, 232, 122,
+            232, 226, 75,  240, 232, 84,  18,  69,  233, 128, 68,  108, 233,
+            67,  141, 98,  233, 63,  199, 27,  233, 107, 191, 244, 232, 122,
             49,  127, 233, 20,  166, 194, 233, 176, 46,  222, 233, 32,  207,
-            168, 233, 187, 237, 232, 232, 99,  40,  161, 233, 128, 206, 18,
-            234, 108, 135, 55,  234, 187, 97,  17,  234};
+            168, 233, 185, 237, 232, 232, 98,  40,  161, 233, 128, 206, 18,
+            234, 109, 135, 55,  234, 187, 97,  17,  234};
 
     TEST_Filter(ref, FilterType::Gaussian7);
 }
@@ -979,9 +979,9 @@ TEST(Image, FilterPyramid) {
     // reference data used to validate the filtering of an image
     vector<vector<uint8_t>> ref = {
             {110, 56,  130, 211, 17,  56,  2,   212, 198, 225, 181, 232,
-             173, 226, 53,  233, 84,  159, 65,  233, 105, 3,   154, 233,
+             173, 226, 53,  233, 84,  159, 65,  233, 106, 3,   154, 233,
              112, 151, 223, 86,  113, 151, 95,  87,  93,  130, 242, 231,
-             147, 137, 114, 232, 47,  173, 107, 233, 105, 3,   26,  234,
+             147, 137, 114, 232, 47,  173, 107, 233, 106, 3,   26,  234,
              224, 16,  192, 88,  171, 250, 111, 222, 215, 213, 65,  225,
              189, 203, 23,  226, 233, 196, 171, 233, 217, 210, 128, 234,
              47,  127, 9,   233, 201, 240, 161, 108, 7,   103, 35,  109,
@@ -990,9 +990,9 @@ TEST(Image, FilterPyramid) {
              36,  224, 35,  109, 54,  50,  114, 233, 29,  165, 53,  234,
              237, 126, 9,   233, 202, 240, 161, 108, 9,   103, 35,  109,
              37,  224, 163, 108, 141, 106, 43,  229, 234, 143, 0,   230},
-            {57,  48,  241, 106, 168, 116, 5,   107, 106, 200, 26,  106,
-             115, 252, 23,  108, 93,  29,  48,  108, 107, 19,  140, 107,
-             48,  19,  152, 108, 201, 182, 177, 108, 145, 200, 20,  108}};
+            {57,  48,  241, 106, 168, 116, 5,   107, 105, 200, 26,  106,
+             114, 252, 23,  108, 92,  29,  48,  108, 107, 19,  140, 107,
+             48,  19,  152, 108, 200, 182, 177, 108, 145, 200, 20,  108}};
 
     geometry::Image image;
 
@@ -1044,9 +1044,9 @@ TEST(Image, CreatePyramid) {
              157, 71,  200, 78,  113, 57,  47,  70,  141, 106, 43,  231,
              26,  32,  126, 193, 251, 238, 174, 97,  191, 94,  75,  59,
              149, 62,  38,  186, 31,  202, 41,  189, 19,  242, 13,  132},
-            {236, 42,  166, 86,  32, 227, 181, 232, 31, 44,  169, 233,
-             203, 221, 160, 107, 20, 87,  117, 108, 78, 122, 78,  234,
-             177, 76,  113, 108, 85, 1,   56,  109, 21, 221, 114, 233}};
+            {236, 42,  166, 86,  32,  227, 181, 232, 32,  44,  169, 233,
+             203, 221, 160, 107, 20,  87,  117, 108, 78,  122, 78,  234,
+             177, 76,  113, 108, 85,  1,   56,  109, 21,  221, 114, 233}};
 
     geometry::Image image;
 
@@ -340,26 +340,26 @@ TEST(RGBDImage, CreateFromNYUFormat) {
 
 TEST(RGBDImage, FilterPyramid) {
     vector<vector<uint8_t>> ref_color = {
-            {49,  63,  46,  63,  234, 198, 45,  63,  152, 189, 39,  63,  151,
-             141, 36,  63,  165, 233, 38,  63,  44,  66,  47,  63,  54,  137,
-             40,  63,  10,  229, 34,  63,  34,  30,  36,  63,  102, 55,  42,
+            {48,  63,  46,  63,  234, 198, 45,  63,  153, 189, 39,  63,  151,
+             141, 36,  63,  166, 233, 38,  63,  44,  66,  47,  63,  54,  137,
+             40,  63,  10,  229, 34,  63,  34,  30,  36,  63,  103, 55,  42,
              63,  230, 110, 48,  63,  133, 79,  41,  63,  33,  69,  37,  63,
              126, 99,  38,  63,  234, 215, 40,  63,  91,  21,  49,  63,  92,
              34,  42,  63,  75,  230, 36,  63,  181, 45,  37,  63,  210, 213,
-             37,  63,  82,  65,  49,  63,  72,  187, 41,  63,  106, 229, 37,
-             63,  255, 106, 40,  63,  94,  171, 45,  63},
-            {159, 3, 43, 63, 135, 253, 38, 63, 128, 50, 43, 63, 2, 65, 39, 63}};
+             37,  63,  81,  65,  49,  63,  72,  187, 41,  63,  106, 229, 37,
+             63,  254, 106, 40,  63,  94,  171, 45,  63},
+            {158, 3, 43, 63, 135, 253, 38, 63, 128, 50, 43, 63, 2, 65, 39, 63}};
 
     vector<vector<uint8_t>> ref_depth = {
-            {38,  31,  30,  58,  91,  210, 16,  58,  248, 34,  42,  58,  238,
-             234, 63,  58,  236, 245, 76,  58,  110, 243, 222, 57,  98,  12,
-             254, 57,  47,  168, 17,  58,  162, 44,  25,  58,  168, 28,  48,
-             58,  39,  160, 9,   58,  4,   196, 14,  58,  243, 74,  4,   58,
-             173, 65,  5,   58,  160, 171, 45,  58,  11,  239, 20,  58,  154,
-             141, 11,  58,  214, 133, 248, 57,  250, 97,  243, 57,  128, 174,
-             11,  58,  56,  200, 138, 57,  214, 164, 156, 57,  33,  250, 200,
-             57,  206, 160, 238, 57,  123, 32,  188, 57},
-            {196, 181, 8, 58, 174, 43, 22, 58, 190, 83, 23, 58, 152, 174, 7,
+            {38,  31,  30,  58,  92,  210, 16,  58,  248, 34,  42,  58,  237,
+             234, 63,  58,  236, 245, 76,  58,  111, 243, 222, 57,  100, 12,
+             254, 57,  48,  168, 17,  58,  162, 44,  25,  58,  168, 28,  48,
+             58,  40,  160, 9,   58,  4,   196, 14,  58,  243, 74,  4,   58,
+             172, 65,  5,   58,  160, 171, 45,  58,  11,  239, 20,  58,  154,
+             141, 11,  58,  214, 133, 248, 57,  251, 97,  243, 57,  128, 174,
+             11,  58,  57,  200, 138, 57,  215, 164, 156, 57,  32,  250, 200,
+             57,  207, 160, 238, 57,  124, 32,  188, 57},
+            {196, 181, 8, 58, 174, 43, 22, 58, 191, 83, 23, 58, 152, 174, 7,
              58}};
 
     geometry::Image depth;
@@ -26,6 +26,7 @@
 
 #include "Open3D/Geometry/TriangleMesh.h"
 #include "Open3D/Geometry/BoundingVolume.h"
+#include "Open3D/Geometry/KDTreeFlann.h"
 #include "Open3D/Geometry/PointCloud.h"
 #include "TestUtility/UnitTest.h"
 
@@ -751,6 +752,46 @@ TEST(TriangleMesh, SamplePointsUniformly) {
     }
 }
 
+TEST(TriangleMesh, SamplePointsUniformlySeed) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+    mesh->ComputeVertexNormals();
+
+    auto pcd0 = mesh->SamplePointsUniformly(10000, false, 42);
+    auto pcd1 = mesh->SamplePointsUniformly(10000, false, 42);
+    auto pcd2 = mesh->SamplePointsUniformly(10000, false, 43);
+    EXPECT_EQ(pcd0->points_.size(), 10000u);
+    ExpectEQ(pcd0->points_, pcd1->points_);
+    ExpectEQ(pcd0->normals_, pcd1->normals_);
+    EXPECT_NE(pcd0->points_[0], pcd2->points_[0]);
+    for (const auto &point : pcd0->points_) {
+        EXPECT_LE(point.norm(), 1.0 + 1e-9);
+        EXPECT_GT(point.norm(), 0.9);
+    }
+}
+
+TEST(TriangleMesh, SamplePointsPoissonDisk) {
+    auto mesh = geometry::TriangleMesh::CreateSphere(1.0, 20);
+
+    size_t n_points = 2000;
+    auto pcd0 = mesh->SamplePointsPoissonDisk(n_points, 5, nullptr, false, 7);
+    auto pcd1 = mesh->SamplePointsPoissonDisk(n_points, 5, nullptr, false, 7);
+    EXPECT_EQ(pcd0->points_.size(), n_points);
+    ExpectEQ(pcd0->points_, pcd1->points_);
+
+    // Blue noise: no two samples are much closer than the average spacing.
+    geometry::KDTreeFlann kdtree(*pcd0);
+    double min_dist = std::numeric_limits<double>::max();
+    double mean_dist = 0;
+    for (const auto &point : pcd0->points_) {
+        vector<int> indices;
+        vector<double> dists2;
+        kdtree.SearchKNN(point, 2, indices, dists2);
+        min_dist = std::min(min_dist, std::sqrt(dists2[1]));
+        mean_dist += std::sqrt(dists2[1]) / n_points;
+    }
+    EXPECT_GT(min_dist, 0.5 * mean_dist);
+}
+
 TEST(TriangleMesh, FilterSharpen) {
     auto mesh = std::make_shared<geometry::TriangleMesh>();
     mesh->vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {-1, 0, 0}, {0, -1, 0}};
@@ -1430,6 +1471,68 @@ TEST(TriangleMesh, DeformAsRigidAsPossible) {
     ExpectEQ(*mesh_deform, mesh_gt);
 }
 
+TEST(TriangleMesh, SubdivideMidpoint) {
+    geometry::TriangleMesh mesh;
+    mesh.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}, {1, 1, 0}};
+    mesh.vertex_colors_ = {{1, 0, 0}, {0, 1, 0}, {0, 0, 1}, {1, 1, 1}};
+    mesh.triangles_ = {{0, 1, 2}, {2, 1, 3}};
+    for (const auto &triangle : mesh.triangles_) {
+        for (int i = 0; i < 3; ++i) {
+            mesh.triangle_uvs_.push_back(
+                    mesh.vertices_[triangle(i)].head<2>());
+        }
+    }
+
+    auto subdivided = mesh.SubdivideMidpoint(1);
+    vector<Vector3d> ref_vertices = {
+            {0, 0, 0},   {1, 0, 0},     {0, 1, 0},   {1, 1, 0},  {0.5, 0, 0},
+            {0.5, 0.5, 0}, {0, 0.5, 0}, {1, 0.5, 0}, {0.5, 1, 0}};
+    vector<Vector3i> ref_triangles = {{0, 4, 6}, {4, 1, 5}, {5, 2, 6},
+                                      {4, 5, 6}, {2, 5, 8}, {5, 1, 7},
+                                      {7, 3, 8}, {5, 7, 8}};
+    ExpectEQ(subdivided->vertices_, ref_vertices);
+    ExpectEQ(subdivided->triangles_, ref_triangles);
+    ExpectEQ(subdivided->vertex_colors_[4], Vector3d(0.5, 0.5, 0));
+    ExpectEQ(subdivided->vertex_colors_[7], Vector3d(0.5, 1, 0.5));
+
+    subdivided = mesh.SubdivideMidpoint(2);
+    EXPECT_EQ(subdivided->vertices_.size(), 25u);
+    EXPECT_EQ(subdivided->triangles_.size(), 32u);
+    EXPECT_TRUE(subdivided->HasTriangleUvs());
+    for (size_t tidx = 0; tidx < subdivided->triangles_.size(); ++tidx) {
+        for (int i = 0; i < 3; ++i) {
+            int vidx = subdivided->triangles_[tidx](i);
+            ExpectEQ(subdivided->triangle_uvs_[3 * tidx + i],
+                     Vector2d(subdivided->vertices_[vidx].head<2>()));
+        }
+    }
+}
+
+TEST(TriangleMesh, SubdivideLoop) {
+    auto mesh = geometry::TriangleMesh::CreateOctahedron(1.0);
+    auto subdivided = mesh->SubdivideLoop(1);
+    EXPECT_EQ(subdivided->vertices_.size(), 18u);
+    EXPECT_EQ(subdivided->triangles_.size(), 32u);
+    ExpectEQ(subdivided->vertices_[0], Vector3d(0.625, 0, 0));
+    ExpectEQ(subdivided->vertices_[6], Vector3d(0.375, 0.375, 0));
+    EXPECT_TRUE(subdivided->IsEdgeManifold(false));
+
+    subdivided = mesh->SubdivideLoop(3);
+    EXPECT_EQ(subdivided->triangles_.size(), 512u);
+    EXPECT_EQ(subdivided->EulerPoincareCharacteristic(), 2);
+    EXPECT_TRUE(subdivided->IsEdgeManifold(false));
+
+    // Boundary vertices only use their boundary neighbours.
+    geometry::TriangleMesh triangle;
+    triangle.vertices_ = {{0, 0, 0}, {1, 0, 0}, {0, 1, 0}};
+    triangle.triangles_ = {{0, 1, 2}};
+    subdivided = triangle.SubdivideLoop(1);
+    vector<Vector3d> ref_vertices = {{0.125, 0.125, 0}, {0.75, 0.125, 0},
+                                     {0.125, 0.75, 0},  {0.5, 0, 0},
+                                     {0.5, 0.5, 0},     {0, 0.5, 0}};
+    ExpectEQ(subdivided->vertices_, ref_vertices);
+}
+
 TEST(TriangleMesh, SelectByIndex) {
     vector<Vector3d> ref_vertices = {{349.019608, 803.921569, 917.647059},
                                      {439.215686, 117.647059, 588.235294},
@@ -1896,6 +1999,60 @@ TEST(TriangleMesh, CreateFromPointCloudAlphaShape) {
     ExpectEQ(*mesh_es, mesh_gt);
 }
 
+TEST(TriangleMesh, CreateFromPointCloudBallPivoting) {
+    // Evenly distributed points on the unit sphere, without the cocircular
+    // points of a latitude-longitude sphere.
+    const int num_points = 4000;
+    const double golden_angle = M_PI * (3.0 - std::sqrt(5.0));
+    geometry::PointCloud pcd;
+    for (int i = 0; i < num_points; i++) {
+        double z = 1.0 - 2.0 * (i + 0.5) / num_points;
+        double r = std::sqrt(1.0 - z * z);
+        Vector3d point(r * std::cos(golden_angle * i),
+                       r * std::sin(golden_angle * i), z);
+        pcd.points_.push_back(point);
+        pcd.normals_.push_back(point);
+    }
+    std::vector<double> radii = {0.06, 0.09};
+
+    // A closed triangulation of the sphere has 2 * n - 4 triangles.
+    auto mesh_serial =
+            geometry::TriangleMesh::CreateFromPointCloudBallPivoting(pcd,
+                                                                     radii);
+    EXPECT_EQ(mesh_serial->triangles_.size(), size_t(2 * num_points - 4));
+    EXPECT_EQ(mesh_serial->triangles_.size(),
+              mesh_serial->triangle_normals_.size());
+    EXPECT_TRUE(mesh_serial->IsWatertight());
+
+    // The regions are stitched together along their boundaries, so the
+    // parallel reconstruction closes the seams between the slabs.
+    auto mesh_parallel =
+            geometry::TriangleMesh::CreateFromPointCloudBallPivoting(
+                    pcd, radii, true);
+    EXPECT_EQ(mesh_parallel->triangles_.size(),
+              mesh_serial->triangles_.size());
+    EXPECT_TRUE(mesh_parallel->IsWatertight());
+    EXPECT_NEAR(mesh_parallel->GetSurfaceArea(),
+                mesh_serial->GetSurfaceArea(), 1e-6);
+
+    // The parallel reconstruction creates the same triangles, in a different
+    // order and orientation.
+    auto SortedTriangles = [](const geometry::TriangleMesh &mesh) {
+        std::vector<Eigen::Vector3i> triangles;
+        for (Eigen::Vector3i triangle : mesh.triangles_) {
+            std::sort(triangle.data(), triangle.data() + 3);
+            triangles.push_back(triangle);
+        }
+        std::sort(triangles.begin(), triangles.end(),
+                  [](const Eigen::Vector3i &a, const Eigen::Vector3i &b) {
+                      return std::lexicographical_compare(
+                              a.data(), a.data() + 3, b.data(), b.data() + 3);
+                  });
+        return triangles;
+    };
+    ExpectEQ(SortedTriangles(*mesh_parallel), SortedTriangles(*mesh_serial));
+}
+
 TEST(TriangleMesh, CreateMeshSphere) {
     vector<Vector3d> ref_vertices = {{0.000000, 0.000000, 1.000000},
                                      {0.000000, 0.000000, -1.000000},
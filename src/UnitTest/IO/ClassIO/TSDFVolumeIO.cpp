@@ -0,0 +1,250 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "Open3D/IO/ClassIO/TSDFVolumeIO.h"
+#include "TestUtility/UnitTest.h"
+
+#include <cstdio>
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+// Fills the voxels of the slabs [x_begin, x_end) of the volume with random
+// values, the other voxels are left unobserved.
+void RandomizeVoxels(integration::UniformTSDFVolume &volume,
+                     int x_begin,
+                     int x_end,
+                     int seed) {
+    srand(seed);
+    int slab_size = volume.resolution_ * volume.resolution_;
+    for (int i = x_begin * slab_size; i < x_end * slab_size; i++) {
+        float tsdf = float(rand()) / RAND_MAX * 2.0f - 1.0f;
+        int weight = rand() % 100 + 1;
+        Eigen::Vector3d color(rand() % 256, rand() % 256, rand() % 256);
+        switch (volume.storage_type_) {
+            case integration::TSDFVolumeStorageType::Float32:
+                volume.tsdf_[i] = tsdf;
+                volume.weight_[i] = float(weight);
+                break;
+            case integration::TSDFVolumeStorageType::Int16:
+                volume.tsdf_int16_[i] = int16_t(tsdf * 32767.0f);
+                volume.weight_uint16_[i] = uint16_t(weight);
+                break;
+            default:
+                volume.voxels_[i].tsdf_ = tsdf;
+                volume.voxels_[i].weight_ = float(weight);
+                if (volume.color_type_ !=
+                    integration::TSDFVolumeColorType::NoColor) {
+                    volume.voxels_[i].color_ = color / 255.0;
+                }
+                continue;
+        }
+        if (volume.color_type_ == integration::TSDFVolumeColorType::RGB8) {
+            for (int c = 0; c < 3; c++) {
+                volume.color_rgb8_[3 * i + c] = uint8_t(color(c));
+            }
+        } else if (volume.color_type_ ==
+                   integration::TSDFVolumeColorType::Gray32) {
+            volume.color_gray32_[i] = float(color(0) / 255.0);
+        }
+    }
+}
+
+void ExpectEQ(const integration::UniformTSDFVolume &volume0,
+              const integration::UniformTSDFVolume &volume1) {
+    EXPECT_EQ(volume0.storage_type_, volume1.storage_type_);
+    EXPECT_EQ(volume0.color_type_, volume1.color_type_);
+    ASSERT_EQ(volume0.resolution_, volume1.resolution_);
+    EXPECT_EQ(volume0.length_, volume1.length_);
+    EXPECT_EQ(volume0.sdf_trunc_, volume1.sdf_trunc_);
+    unit_test::ExpectEQ(volume0.origin_, volume1.origin_, 0.0);
+    for (int i = 0; i < volume0.voxel_num_; i++) {
+        ASSERT_EQ(volume0.GetTSDF(i), volume1.GetTSDF(i));
+        ASSERT_EQ(volume0.GetWeight(i), volume1.GetWeight(i));
+        ASSERT_EQ(volume0.GetColor(i), volume1.GetColor(i));
+    }
+}
+
+// Overwrites the value at `offset` of a file.
+template <typename T>
+void PatchFile(const std::string &filename, long offset, T value) {
+    FILE *file = fopen(filename.c_str(), "r+b");
+    ASSERT_TRUE(file != NULL);
+    EXPECT_EQ(fseek(file, offset, SEEK_SET), 0);
+    EXPECT_EQ(fwrite(&value, sizeof(value), 1, file), 1u);
+    fclose(file);
+}
+
+}  // unnamed namespace
+
+TEST(TSDFVolumeIO, UniformTSDFVolumeRoundTrip) {
+    const std::string filename = "tmp_uniform.tsdf";
+    for (auto storage_type : {integration::TSDFVolumeStorageType::Voxel,
+                              integration::TSDFVolumeStorageType::Float32,
+                              integration::TSDFVolumeStorageType::Int16}) {
+        for (auto color_type : {integration::TSDFVolumeColorType::NoColor,
+                                integration::TSDFVolumeColorType::RGB8,
+                                integration::TSDFVolumeColorType::Gray32}) {
+            for (bool compressed : {true, false}) {
+                integration::UniformTSDFVolume volume(
+                        2.0, 16, 0.2, color_type, Eigen::Vector3d(1, -2, 3),
+                        storage_type);
+                RandomizeVoxels(volume, 5, 9, 0);
+                EXPECT_TRUE(io::WriteTSDFVolume(filename, volume, compressed));
+                auto read = std::dynamic_pointer_cast<
+                        integration::UniformTSDFVolume>(
+                        io::CreateTSDFVolumeFromFile(filename));
+                ASSERT_TRUE(read != nullptr);
+                ExpectEQ(volume, *read);
+            }
+        }
+    }
+}
+
+TEST(TSDFVolumeIO, ScalableTSDFVolumeRoundTrip) {
+    const std::string filename = "tmp_scalable.tsdf";
+    integration::ScalableTSDFVolume volume(
+            0.01, 0.04, integration::TSDFVolumeColorType::RGB8, 8);
+    std::vector<Eigen::Vector3i> indices = {
+            {0, 0, 0}, {1, 0, 0}, {-3, 2, 7}, {5, -1, -2}};
+    for (size_t i = 0; i < indices.size(); i++) {
+        auto unit = volume.OpenVolumeUnit(indices[i]);
+        RandomizeVoxels(*unit, 0, unit->resolution_, int(i));
+    }
+
+    EXPECT_TRUE(io::WriteTSDFVolume(filename, volume));
+    auto read = std::dynamic_pointer_cast<integration::ScalableTSDFVolume>(
+            io::CreateTSDFVolumeFromFile(filename));
+    ASSERT_TRUE(read != nullptr);
+    EXPECT_EQ(read->volume_unit_resolution_, volume.volume_unit_resolution_);
+    EXPECT_EQ(read->voxel_length_, volume.voxel_length_);
+    EXPECT_EQ(read->sdf_trunc_, volume.sdf_trunc_);
+    EXPECT_EQ(read->color_type_, volume.color_type_);
+    ASSERT_EQ(read->volume_units_.Size(), volume.volume_units_.Size());
+    for (const auto &index : indices) {
+        int block = read->volume_units_.Find(index);
+        ASSERT_GE(block, 0);
+        ExpectEQ(*volume.OpenVolumeUnit(index),
+                 *read->volume_units_.GetBlock(block).volume_);
+    }
+}
+
+TEST(TSDFVolumeIO, ReadTSDFVolumeUnits) {
+    const std::string filename = "tmp_units.tsdf";
+    integration::ScalableTSDFVolume volume(
+            0.01, 0.04, integration::TSDFVolumeColorType::Gray32, 8);
+    for (int x = -4; x < 4; x++) {
+        auto unit = volume.OpenVolumeUnit(Eigen::Vector3i(x, 0, 0));
+        RandomizeVoxels(*unit, 0, unit->resolution_, x + 4);
+    }
+    EXPECT_TRUE(io::WriteTSDFVolume(filename, volume));
+
+    // Page in the units intersecting x in [0.1, 0.2], i.e. units 1 and 2.
+    integration::ScalableTSDFVolume paged(
+            0.01, 0.04, integration::TSDFVolumeColorType::Gray32, 8);
+    geometry::AxisAlignedBoundingBox bound(Eigen::Vector3d(0.1, 0.01, 0.01),
+                                           Eigen::Vector3d(0.2, 0.02, 0.02));
+    EXPECT_TRUE(io::ReadTSDFVolumeUnits(filename, paged, bound));
+    ASSERT_EQ(paged.volume_units_.Size(), 2);
+    for (int x : {1, 2}) {
+        Eigen::Vector3i index(x, 0, 0);
+        int block = paged.volume_units_.Find(index);
+        ASSERT_GE(block, 0);
+        ExpectEQ(*volume.OpenVolumeUnit(index),
+                 *paged.volume_units_.GetBlock(block).volume_);
+    }
+
+    // Page out a unit and page in another one.
+    paged.RemoveVolumeUnits({Eigen::Vector3i(1, 0, 0)});
+    EXPECT_EQ(paged.volume_units_.Size(), 1);
+    EXPECT_LT(paged.volume_units_.Find(Eigen::Vector3i(1, 0, 0)), 0);
+    bound = geometry::AxisAlignedBoundingBox(
+            Eigen::Vector3d(-0.3, 0.01, 0.01),
+            Eigen::Vector3d(-0.25, 0.02, 0.02));
+    EXPECT_TRUE(io::ReadTSDFVolumeUnits(filename, paged, bound));
+    EXPECT_EQ(paged.volume_units_.Size(), 2);
+    EXPECT_GE(paged.volume_units_.Find(Eigen::Vector3i(-4, 0, 0)), 0);
+
+    // Parameters that do not match the file are rejected.
+    integration::ScalableTSDFVolume mismatched(
+            0.02, 0.04, integration::TSDFVolumeColorType::Gray32, 8);
+    EXPECT_FALSE(io::ReadTSDFVolumeUnits(filename, mismatched, bound));
+}
+
+TEST(TSDFVolumeIO, ReadCorruptTSDF) {
+    // Offsets of the resolution and the number of blocks in the file header,
+    // and of the raw size of the first block, which follows the 88 bytes of
+    // the file header.
+    const long resolution_offset = 24;
+    const long num_blocks_offset = 80;
+    const long raw_size_offset = 88 + 12;
+
+    const std::string uniform_filename = "tmp_corrupt_uniform.tsdf";
+    integration::UniformTSDFVolume uniform(
+            2.0, 16, 0.2, integration::TSDFVolumeColorType::NoColor);
+    RandomizeVoxels(uniform, 5, 9, 0);
+    EXPECT_TRUE(io::WriteTSDFVolume(uniform_filename, uniform));
+    PatchFile(uniform_filename, resolution_offset, int32_t(1 << 20));
+    EXPECT_TRUE(io::CreateTSDFVolumeFromFile(uniform_filename) == nullptr);
+    EXPECT_EQ(std::remove(uniform_filename.c_str()), 0);
+
+    // A block of the wrong size does not leave an empty unit behind.
+    const std::string scalable_filename = "tmp_corrupt_scalable.tsdf";
+    integration::ScalableTSDFVolume scalable(
+            0.01, 0.04, integration::TSDFVolumeColorType::Gray32, 8);
+    auto unit = scalable.OpenVolumeUnit(Eigen::Vector3i(0, 0, 0));
+    RandomizeVoxels(*unit, 0, unit->resolution_, 0);
+    EXPECT_TRUE(io::WriteTSDFVolume(scalable_filename, scalable, false));
+    int32_t raw_size = int32_t(unit->voxel_num_ * (2 * sizeof(float) +
+                                                   3 * sizeof(double)));
+    PatchFile(scalable_filename, raw_size_offset, raw_size + 4);
+    EXPECT_TRUE(io::CreateTSDFVolumeFromFile(scalable_filename) == nullptr);
+    integration::ScalableTSDFVolume paged(
+            0.01, 0.04, integration::TSDFVolumeColorType::Gray32, 8);
+    geometry::AxisAlignedBoundingBox bound(Eigen::Vector3d(-1.0, -1.0, -1.0),
+                                           Eigen::Vector3d(1.0, 1.0, 1.0));
+    EXPECT_FALSE(io::ReadTSDFVolumeUnits(scalable_filename, paged, bound));
+    EXPECT_EQ(paged.volume_units_.Size(), 0);
+
+    // The original size is read again.
+    PatchFile(scalable_filename, raw_size_offset, raw_size);
+    EXPECT_TRUE(io::ReadTSDFVolumeUnits(scalable_filename, paged, bound));
+    EXPECT_EQ(paged.volume_units_.Size(), 1);
+
+    // More blocks than the file can hold are rejected before the units are
+    // allocated.
+    for (uint64_t num_blocks : {uint64_t(2), uint64_t(1) << 40,
+                                ~uint64_t(0)}) {
+        PatchFile(scalable_filename, num_blocks_offset, num_blocks);
+        EXPECT_TRUE(io::CreateTSDFVolumeFromFile(scalable_filename) ==
+                    nullptr);
+        EXPECT_FALSE(io::ReadTSDFVolumeUnits(scalable_filename, paged, bound));
+    }
+    EXPECT_EQ(std::remove(scalable_filename.c_str()), 0);
+}
@@ -24,8 +24,16 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <cstdio>
+#include <fstream>
+
+#include "Open3D/Geometry/TriangleMesh.h"
+#include "Open3D/IO/ClassIO/TriangleMeshIO.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+using namespace unit_test;
+
 TEST(TriangleMeshIO, DISABLED_CreateMeshFromFile) {
     unit_test::NotImplemented();
 }
@@ -43,3 +51,88 @@ TEST(TriangleMeshIO, DISABLED_ReadTriangleMeshFromPLY) {
 TEST(TriangleMeshIO, DISABLED_WriteTriangleMeshToPLY) {
     unit_test::NotImplemented();
 }
+
+// Streams the triangles of `filename` as a list of corners.
+std::vector<Eigen::Vector3d> ReadStreamedCorners(const std::string &filename,
+                                                 size_t max_triangles = 100) {
+    std::vector<Eigen::Vector3d> corners;
+    EXPECT_TRUE(io::ReadTriangleMeshStreamed(
+            filename, [&](const Eigen::Vector3d &v0, const Eigen::Vector3d &v1,
+                          const Eigen::Vector3d &v2) {
+                corners.push_back(v0);
+                corners.push_back(v1);
+                corners.push_back(v2);
+                return corners.size() < max_triangles * 3;
+            }));
+    return corners;
+}
+
+TEST(TriangleMeshIO, ReadTriangleMeshStreamed) {
+    geometry::TriangleMesh tm_gt;
+    tm_gt.vertices_ = {{0, 0, 0}, {0, 1, 0}, {0, 0, 1}, {1, 1, 1}};
+    tm_gt.triangles_ = {{0, 1, 2}, {1, 3, 2}};
+    tm_gt.ComputeTriangleNormals();
+
+    for (const std::string filename : {"tmp_stream.ply", "tmp_stream.stl"}) {
+        io::WriteTriangleMesh(filename, tm_gt);
+
+        std::vector<Eigen::Vector3d> corners = ReadStreamedCorners(filename);
+        ASSERT_EQ(corners.size(), tm_gt.triangles_.size() * 3);
+        for (size_t i = 0; i < tm_gt.triangles_.size(); i++) {
+            for (int j = 0; j < 3; j++) {
+                ExpectEQ(corners[i * 3 + j],
+                         tm_gt.vertices_[tm_gt.triangles_[i](j)]);
+            }
+        }
+
+        // Returning false from the callback stops the reading.
+        EXPECT_EQ(ReadStreamedCorners(filename, 1).size(), 3u);
+        EXPECT_EQ(std::remove(filename.c_str()), 0);
+    }
+}
+
+TEST(TriangleMeshIO, ReadTriangleMeshStreamedSkipsDegenerateFaces) {
+    const std::string filename = "tmp_stream_faces.ply";
+    {
+        std::ofstream file(filename);
+        file << "ply\nformat ascii 1.0\nelement vertex 4\n"
+             << "property float x\nproperty float y\nproperty float z\n"
+             << "element face 4\nproperty list uchar int vertex_indices\n"
+             << "end_header\n"
+             << "0 0 0\n1 0 0\n1 1 0\n0 1 0\n"
+             << "0\n2 0 1\n4 0 1 2 3\n3 0 2 3\n";
+    }
+    std::vector<Eigen::Vector3d> corners = ReadStreamedCorners(filename);
+    // The quad is split into two triangles, the empty face and the edge are
+    // skipped.
+    const std::vector<Eigen::Vector3d> corners_gt = {
+            {0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 0, 0}, {1, 1, 0},
+            {0, 1, 0}, {0, 0, 0}, {1, 1, 0}, {0, 1, 0}};
+    ExpectEQ(corners, corners_gt);
+    EXPECT_EQ(std::remove(filename.c_str()), 0);
+}
+
+TEST(TriangleMeshIO, ReadTriangleMeshStreamedOBJ) {
+    const std::string filename = "tmp_stream.obj";
+    {
+        std::ofstream file(filename);
+        file << "# comment\n"
+             << "v 0 0 0\nv 1 0 0\nv 1 1 0\nvt 0 0\nvn 0 0 1\n"
+             << "f 1/1/1 2/1/1 3/1/1\n"
+             << "f 1 2\n"
+             << "v 0 1 0\n"
+             << "f -4 -2 -1\n"
+             << "f 1//1 2//1 3//1 4//1\n";
+    }
+    std::vector<Eigen::Vector3d> corners = ReadStreamedCorners(filename);
+    // Texture and normal indices are ignored, negative indices count from
+    // the last vertex, and polygons are split into triangle fans.
+    const std::vector<Eigen::Vector3d> corners_gt = {
+            {0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 0, 0}, {1, 1, 0},
+            {0, 1, 0}, {0, 0, 0}, {1, 0, 0}, {1, 1, 0}, {0, 0, 0},
+            {1, 1, 0}, {0, 1, 0}};
+    ExpectEQ(corners, corners_gt);
+
+    EXPECT_EQ(ReadStreamedCorners(filename, 2).size(), 6u);
+    EXPECT_EQ(std::remove(filename.c_str()), 0);
+}
@@ -24,8 +24,22 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Integration/ScalableTSDFVolume.h"
+#include "Open3D/Integration/UniformTSDFVolume.h"
+#include "Open3D/Camera/PinholeCameraTrajectory.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
 #include "TestUtility/UnitTest.h"
 
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <unordered_map>
+
+using namespace open3d;
+using namespace unit_test;
+
 TEST(ScalableTSDFVolume, DISABLED_VolumeUnit) { unit_test::NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_Constructor) { unit_test::NotImplemented(); }
@@ -34,9 +48,94 @@ TEST(ScalableTSDFVolume, DISABLED_Destructor) { unit_test::NotImplemented(); }
 
 TEST(ScalableTSDFVolume, DISABLED_MemberData) { unit_test::NotImplemented(); }
 
-TEST(ScalableTSDFVolume, DISABLED_Reset) { unit_test::NotImplemented(); }
+// Reads the frame i of the RGBD test sequence.
+std::shared_ptr<geometry::RGBDImage> ReadRGBDFrame(size_t i) {
+    std::ostringstream suffix;
+    suffix << std::setfill('0') << std::setw(5) << i;
+    geometry::Image im_color, im_depth;
+    io::ReadImage(std::string(TEST_DATA_DIR) + "/RGBD/color/" + suffix.str() +
+                          ".jpg",
+                  im_color);
+    io::ReadImage(std::string(TEST_DATA_DIR) + "/RGBD/depth/" + suffix.str() +
+                          ".png",
+                  im_depth);
+    return geometry::RGBDImage::CreateFromColorAndDepth(
+            im_color, im_depth, /*depth_scale*/ 1000.0,
+            /*depth_func*/ 4.0, /*convert_rgb_to_intensity*/ false);
+}
+
+// Integrates the RGBD test sequence into the volume.
+void IntegrateRGBDSequence(integration::TSDFVolume& tsdf_volume) {
+    camera::PinholeCameraTrajectory trajectory;
+    io::ReadPinholeCameraTrajectory(
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log", trajectory);
+    for (size_t i = 0; i < trajectory.parameters_.size(); i++) {
+        tsdf_volume.Integrate(*ReadRGBDFrame(i),
+                              trajectory.parameters_[i].intrinsic_,
+                              trajectory.parameters_[i].extrinsic_);
+    }
+}
+
+TEST(ScalableTSDFVolume, Integrate) {
+    integration::ScalableTSDFVolume tsdf_volume(
+            4.0 / 512.0, 0.04, integration::TSDFVolumeColorType::RGB8);
+    IntegrateRGBDSequence(tsdf_volume);
 
-TEST(ScalableTSDFVolume, DISABLED_Integrate) { unit_test::NotImplemented(); }
+    // Reference values of the serial implementation, the units are
+    // integrated independently so that the result does not depend on the
+    // number of threads.
+    EXPECT_EQ(tsdf_volume.volume_units_.Size(), 1141);
+    std::shared_ptr<geometry::TriangleMesh> mesh =
+            tsdf_volume.ExtractTriangleMesh();
+    EXPECT_EQ(mesh->vertices_.size(), 146747u);
+    EXPECT_EQ(mesh->triangles_.size(), 279171u);
+    Eigen::Vector3d color_sum(0, 0, 0);
+    for (const Eigen::Vector3d& color : mesh->vertex_colors_) {
+        color_sum += color;
+    }
+    ExpectEQ(color_sum,
+             Eigen::Vector3d(123556.801534, 114682.545439, 109871.592451),
+             /*threshold*/ 0.1);
+    std::shared_ptr<geometry::PointCloud> pcd = tsdf_volume.ExtractPointCloud();
+    EXPECT_EQ(pcd->points_.size(), 140018u);
+}
+
+TEST(ScalableTSDFVolume, Reset) {
+    integration::ScalableTSDFVolume tsdf_volume(
+            4.0 / 256.0, 0.04, integration::TSDFVolumeColorType::RGB8);
+    IntegrateRGBDSequence(tsdf_volume);
+    int num_units = tsdf_volume.volume_units_.Size();
+    size_t num_vertices = tsdf_volume.ExtractTriangleMesh()->vertices_.size();
+    std::vector<const integration::UniformTSDFVolume*> volumes;
+    for (const auto& unit : tsdf_volume.volume_units_) {
+        volumes.push_back(unit.volume_.get());
+    }
+
+    tsdf_volume.Reset();
+    EXPECT_EQ(tsdf_volume.volume_units_.Size(), 0);
+    EXPECT_EQ(tsdf_volume.ExtractTriangleMesh()->vertices_.size(), 0u);
+
+    // The units are reused, in the same order since the keys are inserted
+    // sorted.
+    IntegrateRGBDSequence(tsdf_volume);
+    EXPECT_EQ(tsdf_volume.volume_units_.Size(), num_units);
+    EXPECT_EQ(tsdf_volume.ExtractTriangleMesh()->vertices_.size(),
+              num_vertices);
+    int num_reused = 0;
+    for (int i = 0; i < num_units; i++) {
+        num_reused += tsdf_volume.volume_units_.GetBlock(i).volume_.get() ==
+                      volumes[i];
+    }
+    EXPECT_EQ(num_reused, num_units);
+
+    // Units shared with a copy are not reused.
+    integration::ScalableTSDFVolume copy = tsdf_volume;
+    tsdf_volume.Reset();
+    IntegrateRGBDSequence(tsdf_volume);
+    EXPECT_NE(tsdf_volume.volume_units_.GetBlock(0).volume_,
+              copy.volume_units_.GetBlock(0).volume_);
+    EXPECT_EQ(copy.ExtractTriangleMesh()->vertices_.size(), num_vertices);
+}
 
 TEST(ScalableTSDFVolume, DISABLED_ExtractPointCloud) {
     unit_test::NotImplemented();
@@ -46,6 +145,179 @@ TEST(ScalableTSDFVolume, DISABLED_ExtractTriangleMesh) {
     unit_test::NotImplemented();
 }
 
+TEST(ScalableTSDFVolume, ExtractTriangleMeshPatches) {
+    integration::ScalableTSDFVolume tsdf_volume(
+            4.0 / 512.0, 0.04, integration::TSDFVolumeColorType::RGB8);
+    std::unordered_map<Eigen::Vector3i, std::shared_ptr<geometry::TriangleMesh>,
+                       utility::hash_eigen::hash<Eigen::Vector3i>>
+            patches;
+    auto ApplyPatches =
+            [&](const std::vector<integration::ScalableTSDFVolume::MeshPatch>&
+                        update) {
+                for (const auto& patch : update) {
+                    patches[patch.index_] = patch.mesh_;
+                }
+            };
+    // The patches must add up to the mesh of the whole volume.
+    auto ExpectPatchesEqualMesh = [&]() {
+        auto mesh = tsdf_volume.ExtractTriangleMesh();
+        size_t num_triangles = 0;
+        double area = 0.0;
+        for (const auto& it : patches) {
+            num_triangles += it.second->triangles_.size();
+            area += it.second->GetSurfaceArea();
+            EXPECT_EQ(it.second->vertex_normals_.size(),
+                      it.second->vertices_.size());
+        }
+        EXPECT_EQ(num_triangles, mesh->triangles_.size());
+        EXPECT_NEAR(area, mesh->GetSurfaceArea(), 1e-6);
+    };
+
+    IntegrateRGBDSequence(tsdf_volume);
+    auto update = tsdf_volume.ExtractTriangleMeshPatches();
+    EXPECT_EQ((int)update.size(), tsdf_volume.volume_units_.Size());
+    ApplyPatches(update);
+    ExpectPatchesEqualMesh();
+    EXPECT_TRUE(tsdf_volume.ExtractTriangleMeshPatches().empty());
+
+    // A frame whose depth is cropped to a window only changes a few units.
+    camera::PinholeCameraTrajectory trajectory;
+    io::ReadPinholeCameraTrajectory(
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log", trajectory);
+    auto rgbd = ReadRGBDFrame(0);
+    for (int v = 0; v < rgbd->depth_.height_; v++) {
+        for (int u = 0; u < rgbd->depth_.width_; u++) {
+            if (std::abs(u - rgbd->depth_.width_ / 2) > 32 ||
+                std::abs(v - rgbd->depth_.height_ / 2) > 32) {
+                *rgbd->depth_.PointerAt<float>(u, v) = 0.0f;
+            }
+        }
+    }
+    tsdf_volume.Integrate(*rgbd, trajectory.parameters_[0].intrinsic_,
+                          trajectory.parameters_[0].extrinsic_);
+    update = tsdf_volume.ExtractTriangleMeshPatches();
+    EXPECT_GT(update.size(), 0u);
+    EXPECT_LT((int)update.size(), tsdf_volume.volume_units_.Size() / 4);
+    ApplyPatches(update);
+    ExpectPatchesEqualMesh();
+
+    // Removed units get empty patches, the units around them are updated.
+    std::vector<Eigen::Vector3i> removed;
+    for (int i = 0; i < tsdf_volume.volume_units_.Size(); i += 7) {
+        removed.push_back(tsdf_volume.volume_units_.GetBlock(i).index_);
+    }
+    tsdf_volume.RemoveVolumeUnits(removed);
+    update = tsdf_volume.ExtractTriangleMeshPatches();
+    EXPECT_GT(update.size(), removed.size());
+    size_t num_empty = 0;
+    for (const auto& patch : update) {
+        bool is_removed = std::find(removed.begin(), removed.end(),
+                                    patch.index_) != removed.end();
+        EXPECT_TRUE(!is_removed || patch.mesh_->IsEmpty());
+        num_empty += is_removed ? 1 : 0;
+    }
+    EXPECT_EQ(num_empty, removed.size());
+    ApplyPatches(update);
+    ExpectPatchesEqualMesh();
+    EXPECT_TRUE(tsdf_volume.ExtractTriangleMeshPatches().empty());
+
+    tsdf_volume.Reset();
+    EXPECT_TRUE(tsdf_volume.ExtractTriangleMeshPatches().empty());
+    tsdf_volume.Integrate(*rgbd, trajectory.parameters_[0].intrinsic_,
+                          trajectory.parameters_[0].extrinsic_);
+    EXPECT_EQ((int)tsdf_volume.ExtractTriangleMeshPatches().size(),
+              tsdf_volume.volume_units_.Size());
+}
+
+TEST(ScalableTSDFVolume, RayCast) {
+    integration::ScalableTSDFVolume tsdf_volume(
+            4.0 / 512.0, 0.04, integration::TSDFVolumeColorType::RGB8);
+    IntegrateRGBDSequence(tsdf_volume);
+    camera::PinholeCameraTrajectory trajectory;
+    io::ReadPinholeCameraTrajectory(
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log", trajectory);
+    const auto& intrinsic = trajectory.parameters_[0].intrinsic_;
+    std::shared_ptr<geometry::Image> vertex_map, normal_map, color_map;
+    // The frames are integrated up to 4 meters.
+    std::tie(vertex_map, normal_map, color_map) = tsdf_volume.RayCast(
+            intrinsic, trajectory.parameters_[0].extrinsic_, 0.1, 4.0);
+    ASSERT_EQ(vertex_map->width_, intrinsic.width_);
+    ASSERT_EQ(vertex_map->height_, intrinsic.height_);
+    ASSERT_EQ(color_map->width_, intrinsic.width_);
+
+    // The rendered depth matches the depth of the frame the camera saw.
+    auto rgbd = ReadRGBDFrame(0);
+    int num_depth = 0, num_hits = 0, num_close = 0, num_facing = 0;
+    for (int v = 0; v < intrinsic.height_; v++) {
+        for (int u = 0; u < intrinsic.width_; u++) {
+            float depth = *rgbd->depth_.PointerAt<float>(u, v);
+            Eigen::Vector3d vertex(*vertex_map->PointerAt<float>(u, v, 0),
+                                   *vertex_map->PointerAt<float>(u, v, 1),
+                                   *vertex_map->PointerAt<float>(u, v, 2));
+            Eigen::Vector3d normal(*normal_map->PointerAt<float>(u, v, 0),
+                                   *normal_map->PointerAt<float>(u, v, 1),
+                                   *normal_map->PointerAt<float>(u, v, 2));
+            num_depth += depth > 0.0f ? 1 : 0;
+            if (vertex(2) == 0.0) {
+                continue;
+            }
+            num_hits++;
+            EXPECT_NEAR(normal.norm(), 1.0, 1e-5);
+            num_facing += normal.dot(vertex) < 0.0 ? 1 : 0;
+            for (int i = 0; i < 3; i++) {
+                float c = *color_map->PointerAt<float>(u, v, i);
+                EXPECT_GE(c, 0.0f);
+                EXPECT_LE(c, 1.0f + 1e-5f);
+            }
+            if (depth > 0.0f && std::abs(vertex(2) - depth) < 0.02) {
+                num_close++;
+            }
+        }
+    }
+    EXPECT_GT(num_hits, 0.9 * num_depth);
+    EXPECT_GT(num_close, 0.9 * num_hits);
+    EXPECT_GT(num_facing, 0.99 * num_hits);
+
+    // The units without surface are crossed without sampling their inside.
+    // Sampling them moves the samples after them, which moves the hits by
+    // less than a voxel.
+    int num_empty = 0;
+    for (auto& unit : tsdf_volume.volume_units_) {
+        num_empty += unit.volume_ && !unit.has_surface_ ? 1 : 0;
+        unit.has_surface_ = true;
+    }
+    EXPECT_GT(num_empty, 0);
+    std::shared_ptr<geometry::Image> sampled_vertex_map;
+    std::tie(sampled_vertex_map, std::ignore, std::ignore) =
+            tsdf_volume.RayCast(intrinsic, trajectory.parameters_[0].extrinsic_,
+                                0.1, 4.0);
+    int num_sampled_hits = 0, num_close_hits = 0;
+    for (int v = 0; v < intrinsic.height_; v++) {
+        for (int u = 0; u < intrinsic.width_; u++) {
+            float z0 = *vertex_map->PointerAt<float>(u, v, 2);
+            float z1 = *sampled_vertex_map->PointerAt<float>(u, v, 2);
+            num_sampled_hits += z1 != 0.0f ? 1 : 0;
+            num_close_hits += z1 != 0.0f && std::abs(z0 - z1) < 5e-3f ? 1 : 0;
+        }
+    }
+    EXPECT_NEAR(num_sampled_hits, num_hits, 0.01 * num_hits);
+    EXPECT_GT(num_close_hits, 0.99 * num_sampled_hits);
+
+    // Looking away from the scene.
+    Eigen::Matrix4d extrinsic = trajectory.parameters_[0].extrinsic_;
+    extrinsic.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(M_PI, Eigen::Vector3d::UnitY())
+                    .toRotationMatrix() *
+            extrinsic.block<3, 3>(0, 0);
+    std::tie(vertex_map, normal_map, color_map) =
+            tsdf_volume.RayCast(intrinsic, extrinsic);
+    for (int v = 0; v < intrinsic.height_; v++) {
+        for (int u = 0; u < intrinsic.width_; u++) {
+            ASSERT_EQ(*vertex_map->PointerAt<float>(u, v, 2), 0.0f);
+        }
+    }
+}
+
 TEST(ScalableTSDFVolume, DISABLED_ExtractVoxelPointCloud) {
     unit_test::NotImplemented();
 }
@@ -75,29 +75,8 @@ bool ReadPoses(const std::string& trajectory_path,
     return true;
 }
 
-TEST(UniformTSDFVolume, Constructor) {
-    double length = 4.0;
-    int resolution = 128;
-    double sdf_trunc = 0.04;
-    auto color_type = integration::TSDFVolumeColorType::RGB8;
-    integration::UniformTSDFVolume tsdf_volume(
-            length, resolution, sdf_trunc,
-            integration::TSDFVolumeColorType::RGB8);
-
-    // TSDFVolume base class attributes
-    EXPECT_EQ(tsdf_volume.voxel_length_, length / resolution);
-    EXPECT_EQ(tsdf_volume.sdf_trunc_, sdf_trunc);
-    EXPECT_EQ(tsdf_volume.color_type_, color_type);
-
-    // UniformTSDFVolume attributes
-    ExpectEQ(tsdf_volume.origin_, Eigen::Vector3d(0, 0, 0));
-    EXPECT_EQ(tsdf_volume.length_, length);
-    EXPECT_EQ(tsdf_volume.resolution_, resolution);
-    EXPECT_EQ(tsdf_volume.voxel_num_, resolution * resolution * resolution);
-    EXPECT_EQ(int(tsdf_volume.voxels_.size()), tsdf_volume.voxel_num_);
-}
-
-TEST(UniformTSDFVolume, RealData) {
+// Integrates the RGBD test sequence into the volume.
+void IntegrateRealData(integration::TSDFVolume& tsdf_volume) {
     std::string test_data_dir = std::string(TEST_DATA_DIR);
 
     // Poses
@@ -117,10 +96,6 @@ TEST(UniformTSDFVolume, RealData) {
     camera::PinholeCameraIntrinsic intrinsic(
             camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
 
-    // TSDF init
-    integration::UniformTSDFVolume tsdf_volume(
-            4.0, 100, 0.04, integration::TSDFVolumeColorType::RGB8);
-
     // Integrate RGBD frames
     for (size_t i = 0; i < poses.size(); ++i) {
         // Color
@@ -144,6 +119,51 @@ TEST(UniformTSDFVolume, RealData) {
                         /*depth_func*/ 4.0, /*convert_rgb_to_intensity*/ false);
         tsdf_volume.Integrate(*im_rgbd, intrinsic, extrinsics[i]);
     }
+}
+
+TEST(UniformTSDFVolume, Constructor) {
+    double length = 4.0;
+    int resolution = 128;
+    double sdf_trunc = 0.04;
+    auto color_type = integration::TSDFVolumeColorType::RGB8;
+    integration::UniformTSDFVolume tsdf_volume(
+            length, resolution, sdf_trunc,
+            integration::TSDFVolumeColorType::RGB8);
+
+    // TSDFVolume base class attributes
+    EXPECT_EQ(tsdf_volume.voxel_length_, length / resolution);
+    EXPECT_EQ(tsdf_volume.sdf_trunc_, sdf_trunc);
+    EXPECT_EQ(tsdf_volume.color_type_, color_type);
+
+    // UniformTSDFVolume attributes
+    ExpectEQ(tsdf_volume.origin_, Eigen::Vector3d(0, 0, 0));
+    EXPECT_EQ(tsdf_volume.length_, length);
+    EXPECT_EQ(tsdf_volume.resolution_, resolution);
+    EXPECT_EQ(tsdf_volume.voxel_num_, resolution * resolution * resolution);
+    EXPECT_EQ(int(tsdf_volume.voxels_.size()), tsdf_volume.voxel_num_);
+    EXPECT_EQ(tsdf_volume.storage_type_,
+              integration::TSDFVolumeStorageType::Voxel);
+
+    integration::UniformTSDFVolume compact_volume(
+            length, resolution, sdf_trunc,
+            integration::TSDFVolumeColorType::RGB8, Eigen::Vector3d::Zero(),
+            integration::TSDFVolumeStorageType::Int16);
+    EXPECT_TRUE(compact_volume.voxels_.empty());
+    EXPECT_EQ(int(compact_volume.tsdf_int16_.size()),
+              compact_volume.voxel_num_);
+    EXPECT_EQ(int(compact_volume.weight_uint16_.size()),
+              compact_volume.voxel_num_);
+    EXPECT_EQ(int(compact_volume.color_rgb8_.size()),
+              3 * compact_volume.voxel_num_);
+    EXPECT_EQ(compact_volume.GetStorageSize(),
+              size_t(7) * compact_volume.voxel_num_);
+}
+
+TEST(UniformTSDFVolume, RealData) {
+    // TSDF init
+    integration::UniformTSDFVolume tsdf_volume(
+            4.0, 100, 0.04, integration::TSDFVolumeColorType::RGB8);
+    IntegrateRealData(tsdf_volume);
 
     // These hard-coded values are for unit test only. They are used to make
     // sure that after code refactoring, the numerical values still stay the
@@ -199,13 +219,102 @@ TEST(UniformTSDFVolume, DISABLED_Destructor) {}
 
 TEST(UniformTSDFVolume, DISABLED_MemberData) {}
 
-TEST(UniformTSDFVolume, DISABLED_Reset) {}
+TEST(UniformTSDFVolume, Reset) {
+    integration::UniformTSDFVolume tsdf_volume(
+            4.0, 100, 0.04, integration::TSDFVolumeColorType::RGB8,
+            Eigen::Vector3d::Zero(),
+            integration::TSDFVolumeStorageType::Float32);
+    IntegrateRealData(tsdf_volume);
+    size_t num_vertices = tsdf_volume.ExtractTriangleMesh()->vertices_.size();
+    EXPECT_GT(num_vertices, 0u);
+
+    tsdf_volume.Reset();
+    EXPECT_EQ(tsdf_volume.ExtractTriangleMesh()->vertices_.size(), 0u);
+    IntegrateRealData(tsdf_volume);
+    EXPECT_EQ(tsdf_volume.ExtractTriangleMesh()->vertices_.size(),
+              num_vertices);
+}
+
+TEST(UniformTSDFVolume, CompactStorage) {
+    integration::UniformTSDFVolume reference(
+            4.0, 100, 0.04, integration::TSDFVolumeColorType::RGB8);
+    IntegrateRealData(reference);
+    auto reference_mesh = reference.ExtractTriangleMesh();
+    auto reference_pcd = reference.ExtractPointCloud();
+
+    for (auto storage_type : {integration::TSDFVolumeStorageType::Float32,
+                              integration::TSDFVolumeStorageType::Int16}) {
+        integration::UniformTSDFVolume tsdf_volume(
+                4.0, 100, 0.04, integration::TSDFVolumeColorType::RGB8,
+                Eigen::Vector3d::Zero(), storage_type);
+        IntegrateRealData(tsdf_volume);
+        EXPECT_LT(tsdf_volume.GetStorageSize(),
+                  reference.GetStorageSize() / 4);
+
+        // The TSDF and the colors are quantized, the surface is expected to
+        // stay the same up to the voxels where the TSDF is close to zero.
+        auto mesh = tsdf_volume.ExtractTriangleMesh();
+        EXPECT_NEAR(double(mesh->vertices_.size()),
+                    double(reference_mesh->vertices_.size()),
+                    0.01 * reference_mesh->vertices_.size());
+        EXPECT_NEAR(double(mesh->triangles_.size()),
+                    double(reference_mesh->triangles_.size()),
+                    0.01 * reference_mesh->triangles_.size());
+        Eigen::Vector3d color_sum(0, 0, 0);
+        for (const Eigen::Vector3d& color : mesh->vertex_colors_) {
+            color_sum += color;
+        }
+        Eigen::Vector3d color_mean = color_sum / double(mesh->vertices_.size());
+        ExpectEQ(color_mean, Eigen::Vector3d(0.845479, 0.800963, 0.775955),
+                 /*threshold*/ 0.01);
+
+        auto pcd = tsdf_volume.ExtractPointCloud();
+        EXPECT_NEAR(double(pcd->points_.size()),
+                    double(reference_pcd->points_.size()),
+                    0.01 * reference_pcd->points_.size());
+        EXPECT_EQ(pcd->colors_.size(), pcd->points_.size());
+        EXPECT_EQ(pcd->normals_.size(), pcd->points_.size());
+
+        auto voxel_grid = tsdf_volume.ExtractVoxelGrid();
+        EXPECT_NEAR(double(voxel_grid->voxels_.size()), 4488.0, 45.0);
+    }
+}
 
 TEST(UniformTSDFVolume, DISABLED_Integrate) {}
 
 TEST(UniformTSDFVolume, DISABLED_ExtractPointCloud) {}
 
-TEST(UniformTSDFVolume, DISABLED_ExtractTriangleMesh) {}
+TEST(UniformTSDFVolume, ExtractTriangleMesh) {
+    // The resolution is not a multiple of the marching cubes block resolution
+    // so that the blocks on the far sides of the grid are partial.
+    integration::UniformTSDFVolume tsdf_volume(
+            4.0, 100, 0.04, integration::TSDFVolumeColorType::RGB8);
+    IntegrateRealData(tsdf_volume);
+    auto mesh = tsdf_volume.ExtractTriangleMesh();
+    ASSERT_EQ(mesh->vertex_normals_.size(), mesh->vertices_.size());
+
+    // The vertices on the edges shared by blocks are only created once.
+    geometry::TriangleMesh merged = *mesh;
+    merged.RemoveDuplicatedVertices();
+    EXPECT_EQ(merged.vertices_.size(), mesh->vertices_.size());
+
+    // The TSDF gradients point to the same side as the triangles.
+    mesh->ComputeTriangleNormals();
+    size_t num_consistent = 0;
+    for (size_t i = 0; i < mesh->triangles_.size(); i++) {
+        const Eigen::Vector3i &triangle = mesh->triangles_[i];
+        Eigen::Vector3d normal = mesh->vertex_normals_[triangle(0)] +
+                                 mesh->vertex_normals_[triangle(1)] +
+                                 mesh->vertex_normals_[triangle(2)];
+        if (normal.dot(mesh->triangle_normals_[i]) > 0.0) {
+            num_consistent++;
+        }
+    }
+    for (const auto &normal : mesh->vertex_normals_) {
+        EXPECT_NEAR(normal.norm(), 1.0, 1e-6);
+    }
+    EXPECT_GT(num_consistent, mesh->triangles_.size() * 99 / 100);
+}
 
 TEST(UniformTSDFVolume, DISABLED_ExtractVoxelPointCloud) {}
 
@@ -0,0 +1,189 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include "Open3D/Integration/VoxelBlockHashMap.h"
+#include "TestUtility/UnitTest.h"
+
+#include <random>
+#include <set>
+#include <tuple>
+
+using namespace open3d;
+using namespace unit_test;
+
+namespace {
+
+std::vector<Eigen::Vector3i> RandomKeys(int n, int range, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> dist(-range, range - 1);
+    std::vector<Eigen::Vector3i> keys(n);
+    for (auto& key : keys) {
+        key = Eigen::Vector3i(dist(rng), dist(rng), dist(rng));
+    }
+    return keys;
+}
+
+int CountUnique(const std::vector<Eigen::Vector3i>& keys) {
+    std::set<std::tuple<int, int, int>> unique;
+    for (const auto& key : keys) {
+        unique.insert(std::make_tuple(key(0), key(1), key(2)));
+    }
+    return int(unique.size());
+}
+
+}  // unnamed namespace
+
+TEST(VoxelBlockHashMap, InsertFind) {
+    integration::VoxelBlockHashMap<int> map;
+    EXPECT_TRUE(map.Empty());
+    auto keys = RandomKeys(5000, 20, 0);
+    for (const auto& key : keys) {
+        // Reserve one block at a time to exercise the rehashing.
+        map.Reserve(1);
+        bool inserted;
+        int block = map.Insert(key, inserted);
+        ASSERT_GE(block, 0);
+        if (inserted) {
+            map.GetBlock(block) = key(0) + 100 * key(1) + 10000 * key(2);
+        }
+    }
+    EXPECT_EQ(map.Size(), CountUnique(keys));
+    for (const auto& key : keys) {
+        int block = map.Find(key);
+        ASSERT_GE(block, 0);
+        ExpectEQ(map.GetKey(block), key);
+        EXPECT_EQ(map.GetBlock(block), key(0) + 100 * key(1) + 10000 * key(2));
+    }
+    EXPECT_EQ(map.Find(Eigen::Vector3i(20, 0, 0)), -1);
+
+    // Keys outside of the packed range are rejected.
+    bool inserted;
+    EXPECT_EQ(map.Insert(Eigen::Vector3i(1 << 20, 0, 0), inserted), -1);
+    EXPECT_FALSE(inserted);
+    map.Reserve(1);
+    int size = map.Size();
+    EXPECT_EQ(map.Insert(Eigen::Vector3i(0, 0, -(1 << 20)), inserted), size);
+    EXPECT_TRUE(inserted);
+}
+
+TEST(VoxelBlockHashMap, ConcurrentInsert) {
+    integration::VoxelBlockHashMap<int> map;
+    // Many duplicates, so that threads race on the same keys.
+    auto keys = RandomKeys(100000, 16, 1);
+    map.Reserve(int(keys.size()));
+    std::vector<int> blocks(keys.size());
+    std::vector<char> inserted(keys.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(4)
+#endif
+    for (int i = 0; i < int(keys.size()); i++) {
+        bool is_new;
+        blocks[i] = map.Insert(keys[i], is_new);
+        inserted[i] = is_new;
+    }
+    int num_unique = CountUnique(keys);
+    EXPECT_EQ(map.Size(), num_unique);
+    int num_inserted = 0;
+    for (size_t i = 0; i < keys.size(); i++) {
+        num_inserted += inserted[i];
+        EXPECT_EQ(map.Find(keys[i]), blocks[i]);
+        ExpectEQ(map.GetKey(blocks[i]), keys[i]);
+    }
+    EXPECT_EQ(num_inserted, num_unique);
+}
+
+TEST(VoxelBlockHashMap, Reset) {
+    integration::VoxelBlockHashMap<std::vector<float>> map;
+    auto keys = RandomKeys(1000, 100, 2);
+    map.Reserve(int(keys.size()));
+    for (const auto& key : keys) {
+        bool inserted;
+        int block = map.Insert(key, inserted);
+        if (inserted) {
+            map.GetBlock(block).assign(64, 1.0f);
+        }
+    }
+    int capacity = map.Capacity();
+    int size = map.Size();
+    const float* data = map.GetBlock(0).data();
+
+    map.Reset();
+    EXPECT_TRUE(map.Empty());
+    EXPECT_EQ(map.Find(keys[0]), -1);
+    EXPECT_EQ(map.begin(), map.end());
+
+    // The blocks are handed out again with their previous values.
+    map.Reserve(size);
+    EXPECT_EQ(map.Capacity(), capacity);
+    bool inserted;
+    EXPECT_EQ(map.Insert(keys[1], inserted), 0);
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(map.GetBlock(0).data(), data);
+    EXPECT_EQ(map.GetBlock(0).size(), 64u);
+    EXPECT_EQ(map.Find(keys[1]), 0);
+    EXPECT_EQ(map.end() - map.begin(), 1);
+}
+
+TEST(VoxelBlockHashMap, Erase) {
+    integration::VoxelBlockHashMap<Eigen::Vector3i> map;
+    // Small range, so that the probe sequences are long.
+    auto keys = RandomKeys(3000, 10, 3);
+    map.Reserve(int(keys.size()));
+    for (const auto& key : keys) {
+        bool inserted;
+        int block = map.Insert(key, inserted);
+        map.GetBlock(block) = key;
+    }
+    int num_unique = map.Size();
+    std::set<std::tuple<int, int, int>> erased;
+    for (size_t i = 0; i < keys.size(); i += 2) {
+        bool present = erased.insert(std::make_tuple(keys[i](0), keys[i](1),
+                                                     keys[i](2)))
+                               .second;
+        EXPECT_EQ(map.Erase(keys[i]) >= 0, present);
+    }
+    EXPECT_EQ(map.Size(), num_unique - int(erased.size()));
+    for (const auto& key : keys) {
+        int block = map.Find(key);
+        if (erased.count(std::make_tuple(key(0), key(1), key(2)))) {
+            EXPECT_EQ(block, -1);
+        } else {
+            ASSERT_GE(block, 0);
+            ASSERT_LT(block, map.Size());
+            ExpectEQ(map.GetKey(block), key);
+            ExpectEQ(map.GetBlock(block), key);
+        }
+    }
+
+    // The erased keys can be inserted again.
+    map.Reserve(1);
+    bool inserted;
+    int block = map.Insert(keys[0], inserted);
+    EXPECT_TRUE(inserted);
+    EXPECT_EQ(block, map.Size() - 1);
+    EXPECT_EQ(map.Find(keys[0]), block);
+}
@@ -24,9 +24,116 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include "Open3D/Odometry/Odometry.h"
+#include "Open3D/Camera/PinholeCameraTrajectory.h"
+#include "Open3D/Geometry/RGBDImage.h"
+#include "Open3D/IO/ClassIO/ImageIO.h"
+#include "Open3D/IO/ClassIO/PinholeCameraTrajectoryIO.h"
 #include "TestUtility/UnitTest.h"
 
-TEST(Odometry, DISABLED_ComputeRGBDOdometry) { unit_test::NotImplemented(); }
+#include <Eigen/Dense>
+#include <iomanip>
+#include <sstream>
+
+using namespace open3d;
+using namespace unit_test;
+
+// Reads the frame i of the RGBD test sequence as an intensity image.
+std::shared_ptr<geometry::RGBDImage> ReadOdometryFrame(size_t i) {
+    std::ostringstream suffix;
+    suffix << std::setfill('0') << std::setw(5) << i;
+    geometry::Image im_color, im_depth;
+    io::ReadImage(std::string(TEST_DATA_DIR) + "/RGBD/color/" + suffix.str() +
+                          ".jpg",
+                  im_color);
+    io::ReadImage(std::string(TEST_DATA_DIR) + "/RGBD/depth/" + suffix.str() +
+                          ".png",
+                  im_depth);
+    return geometry::RGBDImage::CreateFromColorAndDepth(im_color, im_depth);
+}
+
+TEST(Odometry, ComputeRGBDOdometry) {
+    camera::PinholeCameraTrajectory trajectory;
+    io::ReadPinholeCameraTrajectory(
+            std::string(TEST_DATA_DIR) + "/RGBD/odometry.log", trajectory);
+    const camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    auto source = ReadOdometryFrame(0);
+    auto target = ReadOdometryFrame(1);
+
+    bool success;
+    Eigen::Matrix4d odometry;
+    Eigen::Matrix6d information;
+    for (int term = 0; term < 2; term++) {
+        odometry::RGBDOdometryJacobianFromHybridTerm hybrid;
+        odometry::RGBDOdometryJacobianFromColorTerm color;
+        const odometry::RGBDOdometryJacobian &jacobian =
+                term == 0 ? (const odometry::RGBDOdometryJacobian &)hybrid
+                          : color;
+        std::tie(success, odometry, information) =
+                odometry::ComputeRGBDOdometry(*source, *target, intrinsic,
+                                              Eigen::Matrix4d::Identity(),
+                                              jacobian);
+        EXPECT_TRUE(success);
+        // The logged trajectory maps the world to the cameras.
+        Eigen::Matrix4d reference =
+                trajectory.parameters_[1].extrinsic_ *
+                trajectory.parameters_[0].extrinsic_.inverse();
+        ExpectEQ(odometry, reference, 3e-3);
+        ExpectEQ(information, Eigen::Matrix6d(information.transpose()));
+    }
+
+    // Every correspondence adds one to the translation part of the
+    // information matrix.
+    std::tie(success, odometry, information) =
+            odometry::ComputeRGBDOdometry(*source, *source, intrinsic);
+    EXPECT_TRUE(success);
+    ExpectEQ(odometry, Eigen::Matrix4d(Eigen::Matrix4d::Identity()));
+    EXPECT_GT(information(3, 3), 0.5 * 640 * 480);
+    EXPECT_EQ(information(3, 3), information(4, 4));
+    EXPECT_EQ(information(3, 3), information(5, 5));
+    EXPECT_EQ(information(3, 4), 0.0);
+}
+
+TEST(Odometry, RGBDOdometryTracker) {
+    const camera::PinholeCameraIntrinsic intrinsic(
+            camera::PinholeCameraIntrinsicParameters::PrimeSenseDefault);
+    odometry::RGBDOdometryTracker tracker(intrinsic);
+    std::vector<std::shared_ptr<geometry::RGBDImage>> frames;
+    for (size_t i = 0; i < 5; i++) {
+        frames.push_back(ReadOdometryFrame(i));
+    }
+
+    bool success;
+    Eigen::Matrix4d odometry;
+    Eigen::Matrix6d information;
+    EXPECT_FALSE(tracker.HasPreviousFrame());
+    std::tie(success, odometry, information) = tracker.Track(*frames[0]);
+    EXPECT_FALSE(success);
+    EXPECT_TRUE(tracker.HasPreviousFrame());
+
+    // The pyramids are normalized after they are built, so the results only
+    // match the pairwise odometry up to rounding.
+    for (size_t i = 1; i < frames.size(); i++) {
+        bool pair_success;
+        Eigen::Matrix4d pair_odometry;
+        Eigen::Matrix6d pair_information;
+        std::tie(pair_success, pair_odometry, pair_information) =
+                odometry::ComputeRGBDOdometry(*frames[i - 1], *frames[i],
+                                              intrinsic);
+        std::tie(success, odometry, information) = tracker.Track(*frames[i]);
+        EXPECT_TRUE(success);
+        EXPECT_TRUE(pair_success);
+        ExpectEQ(odometry, pair_odometry, 1e-5);
+        ExpectEQ(information, pair_information,
+                 1e-3 * pair_information.norm());
+    }
+
+    tracker.Reset();
+    EXPECT_FALSE(tracker.HasPreviousFrame());
+    std::tie(success, odometry, information) = tracker.Track(*frames[0]);
+    EXPECT_FALSE(success);
+}
 
 TEST(Odometry, DISABLED_PinholeCameraIntrinsic) { unit_test::NotImplemented(); }
 
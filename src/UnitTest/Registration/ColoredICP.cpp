@@ -24,10 +24,101 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <Eigen/Geometry>
+#include <cmath>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/ColoredICP.h"
 #include "TestUtility/UnitTest.h"
 
-TEST(ColoredICP, DISABLED_RegistrationColoredICP) {
-    unit_test::NotImplemented();
+using namespace open3d;
+
+namespace {
+
+/// Samples a n x n grid with the given spacing on the plane z = 0, with a
+/// smooth gray pattern as colors. The pattern is evaluated at the grid
+/// coordinates shifted by offset.
+geometry::PointCloud CreateTexturedPlane(int n,
+                                         double spacing,
+                                         const Eigen::Vector2d &offset) {
+    geometry::PointCloud pcd;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            double x = i * spacing, y = j * spacing;
+            double u = x + offset(0), v = y + offset(1);
+            pcd.points_.push_back(Eigen::Vector3d(x, y, 0.0));
+            pcd.normals_.push_back(Eigen::Vector3d(0.0, 0.0, 1.0));
+            pcd.colors_.push_back(Eigen::Vector3d::Constant(
+                    0.5 + 0.25 * std::sin(4.0 * u) * std::cos(3.0 * v)));
+        }
+    }
+    return pcd;
+}
+
+}  // unnamed namespace
+
+TEST(ColoredICP, ColoredICPTarget) {
+    geometry::PointCloud pcd;
+    registration::ColoredICPTarget target;
+    EXPECT_FALSE(target.SetPointCloud(pcd, 0.1));
+    EXPECT_TRUE(target.IsEmpty());
+
+    // A linear ramp of the intensity has a constant gradient.
+    for (int i = 0; i < 40; i++) {
+        for (int j = 0; j < 40; j++) {
+            double x = i * 0.025, y = j * 0.025;
+            pcd.points_.push_back(Eigen::Vector3d(x, y, 0.0));
+            pcd.normals_.push_back(Eigen::Vector3d(0.0, 0.0, 1.0));
+            pcd.colors_.push_back(
+                    Eigen::Vector3d(0.2 + 0.5 * x, 0.2 + 0.25 * y, 0.2));
+        }
+    }
+    EXPECT_TRUE(target.SetPointCloud(pcd, 0.06));
+    EXPECT_FALSE(target.IsEmpty());
+    ASSERT_EQ(target.intensity_.size(), pcd.points_.size());
+    for (size_t k = 0; k < target.intensity_.size(); k++) {
+        const Eigen::Vector3d &color =
+                pcd.colors_[target.icp_target_.indices_[k]];
+        EXPECT_NEAR(target.intensity_[k], color.mean(), 1e-6);
+        unit_test::ExpectEQ(
+                Eigen::Vector3d(target.gx_[k], target.gy_[k], target.gz_[k]),
+                Eigen::Vector3d(0.5 / 3.0, 0.25 / 3.0, 0.0), 1e-5);
+    }
+
+    pcd.colors_.clear();
+    EXPECT_FALSE(target.SetPointCloud(pcd, 0.06));
+    EXPECT_TRUE(target.IsEmpty());
+}
+
+TEST(ColoredICP, RegistrationColoredICP) {
+    // The planes only differ by their colors, the shift along the plane is
+    // recovered from the photometric term alone.
+    geometry::PointCloud target =
+            CreateTexturedPlane(60, 0.02, Eigen::Vector2d(0.0, 0.0));
+    geometry::PointCloud source =
+            CreateTexturedPlane(60, 0.02, Eigen::Vector2d(0.03, -0.02));
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.03, -0.02, 0.0);
+
+    // The prepared target uses the gradient radius of the other overload.
+    registration::ColoredICPTarget target_c(target, 0.08);
+    registration::ICPConvergenceCriteria criteria(1e-12, 1e-12, 100);
+    auto result = registration::RegistrationColoredICP(
+            source, target, 0.04, Eigen::Matrix4d::Identity(), criteria, 0.5);
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                        transformation, 2e-3);
+    EXPECT_GT(result.fitness_, 0.9);
+    EXPECT_EQ(result.correspondence_set_.size(),
+              size_t(result.fitness_ * source.points_.size() + 0.5));
+    auto result_c = registration::RegistrationColoredICP(
+            source, target_c, 0.04, Eigen::Matrix4d::Identity(), criteria,
+            0.5);
+    unit_test::ExpectEQ(Eigen::Matrix4d(result_c.transformation_),
+                        Eigen::Matrix4d(result.transformation_));
+
+    source.colors_.clear();
+    EXPECT_ANY_THROW(registration::RegistrationColoredICP(source, target_c,
+                                                          0.04));
 }
 
 TEST(ColoredICP, DISABLED_ICPConvergenceCriteria) {
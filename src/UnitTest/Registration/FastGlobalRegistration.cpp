@@ -24,8 +24,16 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <Eigen/Geometry>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/FastGlobalRegistration.h"
+#include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/Registration.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
 TEST(FastGlobalRegistration, DISABLED_FastGlobalRegistrationOption) {
     unit_test::NotImplemented();
 }
@@ -41,3 +49,34 @@ TEST(FastGlobalRegistration, DISABLED_Constructor) {
 TEST(FastGlobalRegistration, DISABLED_MemberData) {
     unit_test::NotImplemented();
 }
+
+TEST(FastGlobalRegistration, FastGlobalRegistration) {
+    geometry::PointCloud source;
+    source.points_.resize(500);
+    unit_test::Rand(source.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+                    Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.5, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.3, -0.2, 1.0);
+    geometry::PointCloud target = source;
+    target.Transform(transformation);
+
+    // Features invariant to the transformation: the untransformed coordinates.
+    registration::Feature feature;
+    feature.Resize(3, (int)source.points_.size());
+    for (size_t i = 0; i < source.points_.size(); i++) {
+        feature.data_.col(i) = source.points_[i];
+    }
+
+    for (int maximum_feature_checks : {-1, 64}) {
+        registration::FastGlobalRegistrationOption option(
+                1.4, true, true, 0.01, 64, 0.95, 1000, maximum_feature_checks);
+        auto result = registration::FastGlobalRegistration(
+                source, target, feature, feature, option);
+        EXPECT_NEAR(result.fitness_, 1.0, 1e-12);
+        unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                            transformation, 1e-4);
+    }
+}
@@ -24,14 +24,216 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "Open3D/Geometry/KDTreeFlann.h"
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/Feature.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
+namespace {
+
+/// Random cloud with estimated normals.
+geometry::PointCloud CreatePointCloud() {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(1000);
+    unit_test::Rand(pcd.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+                    Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    pcd.EstimateNormals(geometry::KDTreeSearchParamKNN(20));
+    return pcd;
+}
+
+/// FPFH features computed with two searches per point and a pair feature per
+/// neighbor, as in PCL.
+Eigen::MatrixXd ComputeReferenceFPFHFeature(
+        const geometry::PointCloud &input,
+        const geometry::KDTreeSearchParam &search_param) {
+    geometry::KDTreeFlann kdtree(input);
+    int n = (int)input.points_.size();
+    Eigen::MatrixXd spfh = Eigen::MatrixXd::Zero(33, n);
+    Eigen::MatrixXd fpfh = Eigen::MatrixXd::Zero(33, n);
+    std::vector<int> indices;
+    std::vector<double> distance2;
+    for (int i = 0; i < n; i++) {
+        if (kdtree.Search(input.points_[i], search_param, indices, distance2) <=
+            1) {
+            continue;
+        }
+        double hist_incr = 100.0 / (double)(indices.size() - 1);
+        for (size_t k = 1; k < indices.size(); k++) {
+            Eigen::Vector3d n1 = input.normals_[i];
+            Eigen::Vector3d n2 = input.normals_[indices[k]];
+            Eigen::Vector3d dp2p1 =
+                    input.points_[indices[k]] - input.points_[i];
+            Eigen::Vector3d pf = Eigen::Vector3d::Zero();
+            double len = dp2p1.norm();
+            if (len > 0.0) {
+                double angle1 = n1.dot(dp2p1) / len;
+                double angle2 = n2.dot(dp2p1) / len;
+                if (acos(fabs(angle1)) > acos(fabs(angle2))) {
+                    std::swap(n1, n2);
+                    dp2p1 *= -1.0;
+                    pf(2) = -angle2;
+                } else {
+                    pf(2) = angle1;
+                }
+                Eigen::Vector3d v = dp2p1.cross(n1);
+                if (v.norm() > 0.0) {
+                    v.normalize();
+                    Eigen::Vector3d w = n1.cross(v);
+                    pf(1) = v.dot(n2);
+                    pf(0) = atan2(w.dot(n2), n1.dot(n2));
+                } else {
+                    pf.setZero();
+                }
+            }
+            int h0 = (int)(floor(11 * (pf(0) + M_PI) / (2.0 * M_PI)));
+            int h1 = (int)(floor(11 * (pf(1) + 1.0) * 0.5));
+            int h2 = (int)(floor(11 * (pf(2) + 1.0) * 0.5));
+            spfh(std::min(std::max(h0, 0), 10), i) += hist_incr;
+            spfh(std::min(std::max(h1, 0), 10) + 11, i) += hist_incr;
+            spfh(std::min(std::max(h2, 0), 10) + 22, i) += hist_incr;
+        }
+    }
+    for (int i = 0; i < n; i++) {
+        if (kdtree.Search(input.points_[i], search_param, indices, distance2) <=
+            1) {
+            continue;
+        }
+        double sum[3] = {0.0, 0.0, 0.0};
+        for (size_t k = 1; k < indices.size(); k++) {
+            if (distance2[k] == 0.0) continue;
+            for (int j = 0; j < 33; j++) {
+                double val = spfh(j, indices[k]) / distance2[k];
+                sum[j / 11] += val;
+                fpfh(j, i) += val;
+            }
+        }
+        for (int j = 0; j < 33; j++) {
+            if (sum[j / 11] != 0.0) fpfh(j, i) *= 100.0 / sum[j / 11];
+            fpfh(j, i) += spfh(j, i);
+        }
+    }
+    return fpfh;
+}
+
+}  // unnamed namespace
+
 TEST(Feature, DISABLED_Resize) { unit_test::NotImplemented(); }
 
 TEST(Feature, DISABLED_Dimension) { unit_test::NotImplemented(); }
 
 TEST(Feature, DISABLED_Num) { unit_test::NotImplemented(); }
 
-TEST(Feature, DISABLED_ComputeFPFHFeature) { unit_test::NotImplemented(); }
+TEST(Feature, ComputeFPFHFeature) {
+    geometry::PointCloud pcd = CreatePointCloud();
+    geometry::KDTreeSearchParamHybrid search_param(0.25, 30);
+    auto feature = registration::ComputeFPFHFeature(pcd, search_param);
+    Eigen::MatrixXd ref = ComputeReferenceFPFHFeature(pcd, search_param);
+
+    EXPECT_EQ(33, (int)feature->Dimension());
+    EXPECT_EQ(1000, (int)feature->Num());
+    EXPECT_LT((feature->data_ - ref).cwiseAbs().maxCoeff(), 1e-6);
+}
+
+TEST(Feature, ComputeFPFHFeatureNoNormals) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(10);
+    unit_test::Rand(pcd.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+                    Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    EXPECT_ANY_THROW(registration::ComputeFPFHFeature(pcd));
+    EXPECT_ANY_THROW(registration::ComputeFPFHFeatureCompact(pcd));
+}
+
+TEST(Feature, ComputeFPFHFeatureCompact) {
+    geometry::PointCloud pcd = CreatePointCloud();
+    geometry::KDTreeSearchParamHybrid search_param(0.25, 30);
+    auto feature = registration::ComputeFPFHFeature(pcd, search_param);
+
+    for (auto precision : {registration::CompactFeature::Precision::Float32,
+                           registration::CompactFeature::Precision::Float16}) {
+        auto compact = registration::ComputeFPFHFeatureCompact(
+                pcd, search_param, precision);
+        EXPECT_EQ(33, (int)compact->Dimension());
+        EXPECT_EQ(1000, (int)compact->Num());
+        EXPECT_EQ(precision, compact->precision_);
+        Eigen::MatrixXd data = compact->ToFeature()->data_;
+        // Every histogram of three sums to 200, reduced precision may move
+        // single pairs to a neighboring bin.
+        double mean_error = (data - feature->data_).cwiseAbs().mean();
+        EXPECT_LT(mean_error, 0.05);
+        EXPECT_NEAR(data.sum(), feature->data_.sum(),
+                    1e-3 * feature->data_.sum());
+    }
+}
+
+TEST(Feature, ComputeFPFHFeatureCompactChunks) {
+    // More points than the 65536 points searched at a time.
+    geometry::PointCloud pcd;
+    pcd.points_.resize(70000);
+    unit_test::Rand(pcd.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+                    Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    pcd.EstimateNormals(geometry::KDTreeSearchParamKNN(10));
+    geometry::KDTreeSearchParamKNN search_param(10);
+    auto feature = registration::ComputeFPFHFeature(pcd, search_param);
+    auto compact = registration::ComputeFPFHFeatureCompact(pcd, search_param);
+
+    Eigen::MatrixXd data = compact->ToFeature()->data_;
+    EXPECT_LT((data - feature->data_).cwiseAbs().mean(), 0.05);
+    // The points on both sides of the chunk boundary have features.
+    for (int i : {65535, 65536, 69999}) {
+        EXPECT_NEAR(data.col(i).sum(), 300.0, 1e-2);
+    }
+
+    // The chunks follow the positions of the points, the features of a point
+    // do not depend on its index.
+    std::vector<int> permutation(pcd.points_.size());
+    std::iota(permutation.begin(), permutation.end(), 0);
+    std::reverse(permutation.begin(), permutation.end());
+    geometry::PointCloud reversed;
+    for (int i : permutation) {
+        reversed.points_.push_back(pcd.points_[i]);
+        reversed.normals_.push_back(pcd.normals_[i]);
+    }
+    auto reversed_feature =
+            registration::ComputeFPFHFeature(reversed, search_param);
+    double max_error = 0.0;
+    for (size_t i = 0; i < permutation.size(); i++) {
+        max_error = std::max(max_error,
+                             (reversed_feature->data_.col(i) -
+                              feature->data_.col(permutation[i]))
+                                     .cwiseAbs()
+                                     .maxCoeff());
+    }
+    EXPECT_LT(max_error, 1e-9);
+}
+
+TEST(Feature, CompactFeatureHalfPrecision) {
+    registration::CompactFeature feature;
+    feature.Resize(4, 2, registration::CompactFeature::Precision::Float16);
+    EXPECT_EQ(8u, feature.data_float16_.size());
+    EXPECT_EQ(0u, feature.data_float32_.size());
+
+    const float values[4] = {1.0f, 0.1f, 65504.0f, 1e-7f};
+    feature.SetFeature(1, values);
+    EXPECT_EQ(0x3c00, feature.data_float16_[4]);
+    EXPECT_EQ(0x2e66, feature.data_float16_[5]);
+    EXPECT_EQ(0x7bff, feature.data_float16_[6]);
+    EXPECT_EQ(0x0002, feature.data_float16_[7]);
+    EXPECT_EQ(1.0f, feature.GetValue(0, 1));
+    EXPECT_NEAR(0.1f, feature.GetValue(1, 1), 1e-4);
+    EXPECT_EQ(65504.0f, feature.GetValue(2, 1));
+    EXPECT_EQ(std::ldexp(1.0f, -23), feature.GetValue(3, 1));
+    EXPECT_EQ(0.0f, feature.GetValue(0, 0));
+
+    auto converted = feature.ToFeature();
+    EXPECT_EQ(4, (int)converted->Dimension());
+    EXPECT_EQ(2, (int)converted->Num());
+    EXPECT_NEAR(0.1, converted->data_(1, 1), 1e-4);
+}
 
 TEST(Feature, DISABLED_KDTreeSearchParamKNN) { unit_test::NotImplemented(); }
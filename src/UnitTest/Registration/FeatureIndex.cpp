@@ -0,0 +1,152 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <random>
+
+#include "Open3D/Registration/FeatureIndex.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+
+namespace {
+
+/// Random features of dimension 33. unit_test::Rand repeats after a few
+/// hundred values, which would create duplicate features.
+registration::Feature CreateFeature(int num, int seed) {
+    registration::Feature feature;
+    feature.Resize(33, num);
+    std::mt19937 engine(seed);
+    std::uniform_real_distribution<double> distribution(0.0, 100.0);
+    for (int i = 0; i < num; i++) {
+        for (int d = 0; d < 33; d++) {
+            feature.data_(d, i) = distribution(engine);
+        }
+    }
+    return feature;
+}
+
+/// Index of the nearest column of `feature` by linear search.
+int SearchNearestLinear(const registration::Feature &feature,
+                        const Eigen::VectorXd &query) {
+    int nearest = -1;
+    (feature.data_.colwise() - query).colwise().squaredNorm().minCoeff(
+            &nearest);
+    return nearest;
+}
+
+}  // unnamed namespace
+
+TEST(FeatureIndex, SearchExact) {
+    registration::Feature feature = CreateFeature(2000, 0);
+    registration::Feature query = CreateFeature(200, 1);
+    registration::FeatureIndex index(feature);
+    EXPECT_EQ(2000, index.Num());
+
+    std::vector<int> nearest = index.SearchNearest(query);
+    EXPECT_EQ(200u, nearest.size());
+    for (int i = 0; i < 200; i++) {
+        EXPECT_EQ(SearchNearestLinear(feature, query.data_.col(i)),
+                  nearest[i]);
+    }
+
+    std::vector<int> indices;
+    std::vector<float> distance2;
+    EXPECT_EQ(200, index.SearchKNN(query, 3, indices, distance2));
+    EXPECT_EQ(600u, indices.size());
+    for (int i = 0; i < 200; i++) {
+        EXPECT_EQ(nearest[i], indices[3 * i]);
+        EXPECT_LE(distance2[3 * i], distance2[3 * i + 1]);
+        EXPECT_LE(distance2[3 * i + 1], distance2[3 * i + 2]);
+        EXPECT_NEAR((feature.data_.col(indices[3 * i]) - query.data_.col(i))
+                            .squaredNorm(),
+                    distance2[3 * i], 1e-2);
+    }
+
+    std::vector<int> subset = index.SearchNearest(query, {5, 7});
+    EXPECT_EQ(2u, subset.size());
+    EXPECT_EQ(nearest[5], subset[0]);
+    EXPECT_EQ(nearest[7], subset[1]);
+}
+
+TEST(FeatureIndex, SearchApproximate) {
+    registration::Feature feature = CreateFeature(2000, 0);
+    registration::FeatureIndex index(feature, 4, 256);
+
+    // Slightly perturbed copies of the indexed features are found again.
+    registration::Feature query = feature;
+    query.data_.array() += 0.01;
+    std::vector<int> nearest = index.SearchNearest(query);
+    int found = 0;
+    for (int i = 0; i < feature.Num(); i++) {
+        if (nearest[i] == i) found++;
+    }
+    EXPECT_GT(found, 1900);
+}
+
+TEST(FeatureIndex, SetCompactFeature) {
+    registration::Feature feature = CreateFeature(500, 0);
+    registration::CompactFeature compact;
+    compact.Resize(33, 500, registration::CompactFeature::Precision::Float16);
+    for (int i = 0; i < 500; i++) {
+        Eigen::VectorXf values = feature.data_.col(i).cast<float>();
+        compact.SetFeature(i, values.data());
+    }
+    registration::FeatureIndex index;
+    EXPECT_TRUE(index.SetFeature(compact));
+    EXPECT_EQ(500, index.Num());
+    std::vector<int> nearest = index.SearchNearest(feature);
+    for (int i = 0; i < 500; i++) {
+        EXPECT_EQ(i, nearest[i]);
+    }
+}
+
+TEST(FeatureIndex, MatchFeatures) {
+    registration::Feature source = CreateFeature(300, 0);
+    registration::Feature target = CreateFeature(500, 1);
+    // The first 100 source features have an exact copy in the target.
+    for (int i = 0; i < 100; i++) {
+        target.data_.col(2 * i) = source.data_.col(i);
+    }
+
+    registration::CorrespondenceSet corres =
+            registration::MatchFeatures(source, target);
+    EXPECT_EQ(300u, corres.size());
+    for (int i = 0; i < 300; i++) {
+        EXPECT_EQ(i, corres[i](0));
+        EXPECT_EQ(SearchNearestLinear(target, source.data_.col(i)),
+                  corres[i](1));
+    }
+
+    registration::CorrespondenceSet mutual =
+            registration::MatchFeatures(source, target, true);
+    EXPECT_GE(mutual.size(), 100u);
+    EXPECT_LT(mutual.size(), 300u);
+    for (const auto &c : mutual) {
+        EXPECT_EQ(c(0), SearchNearestLinear(source, target.data_.col(c(1))));
+        EXPECT_EQ(c(1), SearchNearestLinear(target, source.data_.col(c(0))));
+    }
+}
@@ -0,0 +1,173 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+
+#include <Eigen/Geometry>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/IO/ClassIO/PointCloudIO.h"
+#include "Open3D/Registration/FragmentRegistration.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+
+namespace {
+
+std::vector<geometry::PointCloud> CreateFragments(
+        Eigen::Matrix4d &transformation) {
+    geometry::PointCloud source;
+    io::ReadPointCloud(std::string(TEST_DATA_DIR) + "/Feature/cloud_bin_0.pcd",
+                       source);
+    transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.4, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.3, -0.2, 0.5);
+    geometry::PointCloud target = source;
+    target.Transform(transformation);
+    return {source, target};
+}
+
+}  // unnamed namespace
+
+TEST(FragmentRegistration, RegisterFragmentPairsOdometry) {
+    Eigen::Matrix4d transformation;
+    auto fragments = CreateFragments(transformation);
+    Eigen::Matrix4d init = transformation;
+    init.block<3, 1>(0, 3) += Eigen::Vector3d(0.02, -0.02, 0.01);
+
+    auto pose_graph = registration::RegisterFragmentPairs(
+            fragments, {registration::FragmentPair(0, 1, false, init)});
+
+    EXPECT_EQ(pose_graph.nodes_.size(), 2u);
+    ASSERT_EQ(pose_graph.edges_.size(), 1u);
+    const auto &edge = pose_graph.edges_[0];
+    EXPECT_EQ(edge.source_node_id_, 0);
+    EXPECT_EQ(edge.target_node_id_, 1);
+    EXPECT_FALSE(edge.uncertain_);
+    unit_test::ExpectEQ(Eigen::Matrix4d(edge.transformation_), transformation,
+                        1e-2);
+    EXPECT_GT(edge.information_(5, 5), 0.0);
+    unit_test::ExpectEQ(Eigen::Matrix4d(pose_graph.nodes_[0].pose_),
+                        Eigen::Matrix4d(Eigen::Matrix4d::Identity()));
+    unit_test::ExpectEQ(Eigen::Matrix4d(pose_graph.nodes_[1].pose_),
+                        Eigen::Matrix4d(edge.transformation_.inverse()));
+}
+
+TEST(FragmentRegistration, RegisterFragmentPairsChain) {
+    // Fragment k is the first fragment transformed by transformations[k].
+    Eigen::Matrix4d transformation;
+    geometry::PointCloud source = CreateFragments(transformation)[0];
+    const int num_fragments = 4;
+    std::vector<Eigen::Matrix4d> transformations(num_fragments);
+    std::vector<geometry::PointCloud> fragments(num_fragments);
+    for (int k = 0; k < num_fragments; k++) {
+        transformations[k] = Eigen::Matrix4d::Identity();
+        transformations[k].block<3, 3>(0, 0) =
+                Eigen::AngleAxisd(0.1 * k, Eigen::Vector3d(0.0, 0.6, 0.8))
+                        .toRotationMatrix();
+        transformations[k].block<3, 1>(0, 3) =
+                Eigen::Vector3d(0.1 * k, -0.05 * k, 0.02 * k);
+        fragments[k] = source;
+        fragments[k].Transform(transformations[k]);
+    }
+
+    // Odometry pairs in reverse order, so that the poses are only reached by
+    // chaining over several edges.
+    std::vector<registration::FragmentPair> pairs;
+    for (int k = num_fragments - 2; k >= 0; k--) {
+        Eigen::Matrix4d init =
+                transformations[k + 1] * transformations[k].inverse();
+        init.block<3, 1>(0, 3) += Eigen::Vector3d(0.01, -0.01, 0.01);
+        pairs.push_back(registration::FragmentPair(k, k + 1, false, init));
+    }
+    auto pose_graph = registration::RegisterFragmentPairs(fragments, pairs);
+
+    ASSERT_EQ(pose_graph.nodes_.size(), size_t(num_fragments));
+    ASSERT_EQ(pose_graph.edges_.size(), pairs.size());
+    for (size_t e = 0; e < pairs.size(); e++) {
+        const auto &edge = pose_graph.edges_[e];
+        EXPECT_EQ(edge.source_node_id_, pairs[e].source_id_);
+        EXPECT_EQ(edge.target_node_id_, pairs[e].target_id_);
+        unit_test::ExpectEQ(
+                Eigen::Matrix4d(edge.transformation_),
+                Eigen::Matrix4d(transformations[edge.target_node_id_] *
+                                transformations[edge.source_node_id_]
+                                        .inverse()),
+                1e-2);
+    }
+    for (int k = 0; k < num_fragments; k++) {
+        unit_test::ExpectEQ(Eigen::Matrix4d(pose_graph.nodes_[k].pose_),
+                            Eigen::Matrix4d(transformations[k].inverse()),
+                            1e-2);
+    }
+}
+
+TEST(FragmentRegistration, RegisterFragmentPairsLoopClosure) {
+    Eigen::Matrix4d transformation;
+    auto fragments = CreateFragments(transformation);
+
+    for (auto method : {registration::GlobalRegistrationMethod::RANSAC,
+                        registration::GlobalRegistrationMethod::
+                                FastGlobalRegistration}) {
+        registration::FragmentRegistrationOption option;
+        option.global_registration_ = method;
+        // The odometry pair starts from the identity, which is too far from
+        // the solution, while the loop closure is globally registered.
+        auto pose_graph = registration::RegisterFragmentPairs(
+                fragments,
+                {registration::FragmentPair(0, 1, false),
+                 registration::FragmentPair(0, 1, true)},
+                option);
+
+        ASSERT_EQ(pose_graph.edges_.size(), 2u);
+        EXPECT_TRUE(pose_graph.edges_[1].uncertain_);
+        unit_test::ExpectEQ(
+                Eigen::Matrix4d(pose_graph.edges_[1].transformation_),
+                transformation, 1e-2);
+    }
+}
+
+TEST(FragmentRegistration, RegisterFragmentPairsRejectsLowOverlap) {
+    Eigen::Matrix4d transformation;
+    auto fragments = CreateFragments(transformation);
+    registration::FragmentRegistrationOption option;
+    option.minimum_overlap_ = 1.1;
+
+    auto pose_graph = registration::RegisterFragmentPairs(
+            fragments, {registration::FragmentPair(0, 1, true)}, option);
+
+    EXPECT_EQ(pose_graph.nodes_.size(), 2u);
+    EXPECT_TRUE(pose_graph.edges_.empty());
+}
+
+TEST(FragmentRegistration, RegisterFragmentPairsInvalidPair) {
+    Eigen::Matrix4d transformation;
+    auto fragments = CreateFragments(transformation);
+
+    EXPECT_ANY_THROW(registration::RegisterFragmentPairs(
+            fragments, {registration::FragmentPair(0, 2, true)}));
+}
@@ -0,0 +1,93 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include <Eigen/Geometry>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/GeneralizedICP.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+
+TEST(GeneralizedICP, RegistrationGeneralizedICP) {
+    geometry::PointCloud source;
+    source.points_.resize(500);
+    unit_test::Rand(source.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+                    Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    source.normals_.resize(500);
+    unit_test::Rand(source.normals_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+                    Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    for (auto &normal : source.normals_) {
+        normal.normalize();
+    }
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.5, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.3, -0.2, 1.0);
+    geometry::PointCloud target = source;
+    target.Transform(transformation);
+
+    Eigen::Matrix4d perturbation = Eigen::Matrix4d::Identity();
+    perturbation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.02, Eigen::Vector3d(0.0, 0.6, 0.8))
+                    .toRotationMatrix();
+    perturbation.block<3, 1>(0, 3) = Eigen::Vector3d(0.01, 0.0, -0.01);
+
+    registration::ICPConvergenceCriteria criteria(1e-10, 1e-10, 50);
+    for (double k : {0.0, 0.05}) {
+        registration::TransformationEstimationForGeneralizedICP estimation;
+        if (k > 0.0) {
+            estimation.kernel_ = std::make_shared<registration::HuberLoss>(k);
+        }
+        auto result = registration::RegistrationGeneralizedICP(
+                source, target, 0.05, transformation * perturbation,
+                estimation, criteria);
+        EXPECT_NEAR(result.fitness_, 1.0, 1e-12);
+        EXPECT_NEAR(result.inlier_rmse_, 0.0, 1e-5);
+        unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                            transformation, 1e-5);
+    }
+
+    // The estimation converges on fixed correspondences, and its residuals
+    // vanish at the true transformation.
+    registration::CorrespondenceSet corres;
+    for (int i = 0; i < 500; i++) {
+        corres.push_back(Eigen::Vector2i(i, i));
+    }
+    registration::TransformationEstimationForGeneralizedICP estimation;
+    Eigen::Matrix4d estimate = transformation * perturbation;
+    geometry::PointCloud aligned = source;
+    aligned.Transform(estimate);
+    for (int i = 0; i < 10; i++) {
+        Eigen::Matrix4d update =
+                estimation.ComputeTransformation(aligned, target, corres);
+        estimate = update * estimate;
+        aligned.Transform(update);
+    }
+    unit_test::ExpectEQ(estimate, transformation, 1e-8);
+    EXPECT_NEAR(estimation.ComputeRMSE(aligned, target, corres), 0.0, 1e-8);
+}
@@ -24,14 +24,177 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <Eigen/Dense>
+
+#include "Open3D/Registration/GlobalOptimization.h"
+#include "Open3D/Registration/PoseGraph.h"
+#include "Open3D/Utility/Eigen.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
+namespace {
+
+/// Ring of n poses with drifting odometry edges, exact loop closures every
+/// fourth node and one wrong loop closure.
+registration::PoseGraph CreateRingPoseGraph(
+        int n,
+        std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> &poses) {
+    poses.resize(n);
+    for (int i = 0; i < n; i++) {
+        double angle = 2.0 * M_PI * i / n;
+        Eigen::Vector6d pose;
+        pose << 0.0, 0.0, angle, 2.0 * std::cos(angle), 2.0 * std::sin(angle),
+                0.0;
+        poses[i] = utility::TransformVector6dToMatrix4d(pose);
+    }
+    Eigen::Vector6d drift;
+    drift << 0.002, -0.001, 0.01, 0.01, 0.005, -0.005;
+    Eigen::Matrix4d drift_transform =
+            utility::TransformVector6dToMatrix4d(drift);
+    Eigen::Vector6d outlier;
+    outlier << 0.3, 0.0, 0.0, 1.0, 0.0, 0.0;
+
+    registration::PoseGraph pose_graph;
+    Eigen::Matrix4d odometry = poses[0];
+    pose_graph.nodes_.push_back(registration::PoseGraphNode(odometry));
+    for (int i = 1; i < n; i++) {
+        Eigen::Matrix4d relative =
+                poses[i - 1].inverse() * poses[i] * drift_transform;
+        odometry = odometry * relative;
+        pose_graph.nodes_.push_back(registration::PoseGraphNode(odometry));
+        pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                i, i - 1, relative, Eigen::Matrix6d::Identity() * 100.0,
+                false));
+    }
+    for (int i = 0; i + 4 < n; i += 4) {
+        pose_graph.edges_.push_back(registration::PoseGraphEdge(
+                i + 4, i, poses[i].inverse() * poses[i + 4],
+                Eigen::Matrix6d::Identity() * 10000.0, true));
+    }
+    pose_graph.edges_.push_back(registration::PoseGraphEdge(
+            n / 2, 1,
+            poses[1].inverse() * poses[n / 2] *
+                    utility::TransformVector6dToMatrix4d(outlier),
+            Eigen::Matrix6d::Identity() * 10000.0, true));
+    return pose_graph;
+}
+
+double ComputeTranslationError(
+        const registration::PoseGraph &pose_graph,
+        const std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator>
+                &poses) {
+    double error = 0.0;
+    for (size_t i = 0; i < poses.size(); i++) {
+        error = std::max(error, (pose_graph.nodes_[i].pose_.block<3, 1>(0, 3) -
+                                 poses[i].block<3, 1>(0, 3))
+                                        .norm());
+    }
+    return error;
+}
+
+}  // unnamed namespace
+
 TEST(GlobalOptimization, DISABLED_Constructor) { unit_test::NotImplemented(); }
 
 TEST(GlobalOptimization, DISABLED_MemberData) { unit_test::NotImplemented(); }
 
-TEST(GlobalOptimization, DISABLED_GlobalOptimizationLevenbergMarquardt) {
-    unit_test::NotImplemented();
+TEST(GlobalOptimization, GlobalOptimizationLevenbergMarquardt) {
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    registration::PoseGraph pose_graph = CreateRingPoseGraph(40, poses);
+    size_t n_edges = pose_graph.edges_.size();
+    EXPECT_GT(ComputeTranslationError(pose_graph, poses), 0.3);
+
+    registration::GlobalOptimization(
+            pose_graph, registration::GlobalOptimizationLevenbergMarquardt(),
+            registration::GlobalOptimizationConvergenceCriteria(),
+            registration::GlobalOptimizationOption(0.1, 0.25, 1.0, 0));
+
+    // The wrong loop closure is pruned, the others close the ring.
+    EXPECT_EQ(pose_graph.edges_.size(), n_edges - 1);
+    EXPECT_LT(ComputeTranslationError(pose_graph, poses), 0.05);
+}
+
+TEST(GlobalOptimization, GlobalOptimizationGaussNewton) {
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    registration::PoseGraph pose_graph = CreateRingPoseGraph(40, poses);
+    size_t n_edges = pose_graph.edges_.size();
+
+    registration::GlobalOptimization(
+            pose_graph, registration::GlobalOptimizationGaussNewton(),
+            registration::GlobalOptimizationConvergenceCriteria(),
+            registration::GlobalOptimizationOption(0.1, 0.25, 1.0, 0));
+
+    EXPECT_EQ(pose_graph.edges_.size(), n_edges - 1);
+    EXPECT_LT(ComputeTranslationError(pose_graph, poses), 0.05);
+}
+
+TEST(GlobalOptimization, IncrementalGlobalOptimization) {
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    registration::PoseGraph pose_graph = CreateRingPoseGraph(40, poses);
+
+    // Stream the graph node by node, with the edges ending at each node.
+    registration::IncrementalGlobalOptimization optimizer(
+            registration::GlobalOptimizationConvergenceCriteria(),
+            registration::GlobalOptimizationOption(0.1, 0.25, 1.0, 0));
+    for (size_t i = 0; i < pose_graph.nodes_.size(); i++) {
+        EXPECT_EQ(optimizer.AddNode(pose_graph.nodes_[i]), int(i));
+        for (const auto &edge : pose_graph.edges_) {
+            if (std::max(edge.source_node_id_, edge.target_node_id_) ==
+                int(i)) {
+                optimizer.AddEdge(edge);
+            }
+        }
+        optimizer.Optimize();
+        // The first pose is held fixed.
+        unit_test::ExpectEQ(
+                Eigen::Matrix4d(optimizer.GetPoseGraph().nodes_[0].pose_),
+                poses[0]);
+    }
+    EXPECT_LT(ComputeTranslationError(optimizer.GetPoseGraph(), poses), 0.05);
+
+    // The wrong loop closure is rejected by the line process.
+    auto pruned = registration::CreatePoseGraphWithoutInvalidEdges(
+            optimizer.GetPoseGraph(),
+            registration::GlobalOptimizationOption(0.1, 0.25, 1.0, 0));
+    EXPECT_EQ(pruned->edges_.size(), pose_graph.edges_.size() - 1);
+
+    EXPECT_THROW(optimizer.AddEdge(registration::PoseGraphEdge(0, 40)),
+                 std::runtime_error);
+}
+
+TEST(GlobalOptimization, IncrementalGlobalOptimizationWindow) {
+    std::vector<Eigen::Matrix4d, utility::Matrix4d_allocator> poses;
+    registration::PoseGraph pose_graph = CreateRingPoseGraph(40, poses);
+
+    // Loop closures reaching before the newest 6 nodes, such as the wrong one
+    // from node 20 to node 1, marginalize the older nodes.
+    registration::IncrementalGlobalOptimization optimizer(
+            registration::GlobalOptimizationConvergenceCriteria(),
+            registration::GlobalOptimizationOption(0.1, 0.25, 1.0, 0), 6);
+    for (size_t i = 0; i < pose_graph.nodes_.size(); i++) {
+        optimizer.AddNode(pose_graph.nodes_[i]);
+        for (const auto &edge : pose_graph.edges_) {
+            if (std::max(edge.source_node_id_, edge.target_node_id_) ==
+                int(i)) {
+                optimizer.AddEdge(edge);
+            }
+        }
+        optimizer.Optimize();
+        unit_test::ExpectEQ(
+                Eigen::Matrix4d(optimizer.GetPoseGraph().nodes_[0].pose_),
+                poses[0]);
+    }
+    EXPECT_LT(ComputeTranslationError(optimizer.GetPoseGraph(), poses), 0.05);
+    auto pruned = registration::CreatePoseGraphWithoutInvalidEdges(
+            optimizer.GetPoseGraph(),
+            registration::GlobalOptimizationOption(0.1, 0.25, 1.0, 0));
+    EXPECT_EQ(pruned->edges_.size(), pose_graph.edges_.size() - 1);
+
+    EXPECT_THROW(registration::IncrementalGlobalOptimization(
+                         registration::GlobalOptimizationConvergenceCriteria(),
+                         registration::GlobalOptimizationOption(), 0),
+                 std::runtime_error);
 }
 
 TEST(GlobalOptimization, DISABLED_GlobalOptimizationConvergenceCriteria) {
@@ -0,0 +1,110 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/ICPTarget.h"
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+
+TEST(ICPTarget, SetPointCloud) {
+    geometry::PointCloud pcd;
+    registration::ICPTarget target;
+    EXPECT_FALSE(target.SetPointCloud(pcd));
+    EXPECT_TRUE(target.IsEmpty());
+
+    pcd.points_.resize(1000);
+    unit_test::Rand(pcd.points_, Eigen::Vector3d(-1.0, 2.0, 0.0),
+                    Eigen::Vector3d(1.0, 3.0, 10.0), 0);
+    EXPECT_TRUE(target.SetPointCloud(pcd));
+    EXPECT_FALSE(target.IsEmpty());
+    EXPECT_FALSE(target.HasNormals());
+    unit_test::ExpectEQ(target.origin_, Eigen::Vector3d(0.0, 2.5, 5.0), 0.05);
+
+    // The buffers hold a permutation of the points relative to the origin.
+    std::vector<int> count(pcd.points_.size(), 0);
+    ASSERT_EQ(target.indices_.size(), pcd.points_.size());
+    for (size_t i = 0; i < target.indices_.size(); i++) {
+        int index = target.indices_[i];
+        count[index]++;
+        Eigen::Vector3d point =
+                Eigen::Vector3d(target.x_[i], target.y_[i], target.z_[i]) +
+                target.origin_;
+        unit_test::ExpectEQ(point, pcd.points_[index], 1e-6);
+    }
+    for (int c : count) {
+        EXPECT_EQ(c, 1);
+    }
+
+    pcd.normals_.resize(pcd.points_.size(), Eigen::Vector3d(0.0, 0.0, 1.0));
+    target.SetPointCloud(pcd);
+    EXPECT_TRUE(target.HasNormals());
+    EXPECT_EQ(target.nz_.size(), pcd.points_.size());
+}
+
+TEST(ICPTarget, SearchNearest) {
+    geometry::PointCloud pcd;
+    pcd.points_.resize(2000);
+    unit_test::Rand(pcd.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+                    Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    registration::ICPTarget target(pcd);
+
+    std::vector<Eigen::Vector3d> queries(200);
+    unit_test::Rand(queries, Eigen::Vector3d(-0.2, -0.2, -0.2),
+                    Eigen::Vector3d(1.2, 1.2, 1.2), 1);
+    for (const auto &query : queries) {
+        Eigen::Vector3f query_local = (query - target.origin_).cast<float>();
+        for (float max_distance : {0.02f, 0.1f, 10.0f}) {
+            float distance2 = max_distance * max_distance;
+            int nearest = target.SearchNearest(query_local, distance2);
+
+            int expected = -1;
+            float expected_distance2 = max_distance * max_distance;
+            for (size_t i = 0; i < target.indices_.size(); i++) {
+                float d2 = (Eigen::Vector3f(target.x_[i], target.y_[i],
+                                            target.z_[i]) -
+                            query_local)
+                                   .squaredNorm();
+                if (d2 < expected_distance2) {
+                    expected_distance2 = d2;
+                    expected = int(i);
+                }
+            }
+            // Rand() quantizes the points, compare distances to allow ties.
+            ASSERT_EQ(nearest < 0, expected < 0);
+            EXPECT_NEAR(distance2, expected_distance2, 1e-6);
+            if (nearest >= 0) {
+                EXPECT_NEAR((Eigen::Vector3f(target.x_[nearest],
+                                             target.y_[nearest],
+                                             target.z_[nearest]) -
+                             query_local)
+                                    .squaredNorm(),
+                            expected_distance2, 1e-6);
+            }
+        }
+    }
+}
@@ -0,0 +1,125 @@
+// ----------------------------------------------------------------------------
+// -                        Open3D: www.open3d.org                            -
+// ----------------------------------------------------------------------------
+// The MIT License (MIT)
+//
+// Copyright (c) 2019 www.open3d.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the "Software"), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in
+// all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+// FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+// IN THE SOFTWARE.
+// ----------------------------------------------------------------------------
+
+#include "Open3D/Registration/MultiScaleICP.h"
+
+#include <Eigen/Geometry>
+#include <cmath>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/GeneralizedICP.h"
+#include "TestUtility/UnitTest.h"
+
+using namespace open3d;
+
+namespace {
+
+/// Samples the height field z = 0.1 sin(6x) cos(4y) on a n x n grid over the
+/// unit square, shifted by offset grid cells.
+geometry::PointCloud CreateHeightField(int n, double offset) {
+    geometry::PointCloud pcd;
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            double x = (i + offset) / n, y = (j + offset) / n;
+            pcd.points_.push_back(Eigen::Vector3d(
+                    x, y, 0.1 * std::sin(6.0 * x) * std::cos(4.0 * y)));
+        }
+    }
+    return pcd;
+}
+
+}  // unnamed namespace
+
+TEST(MultiScaleICP, MultiScaleICPTarget) {
+    geometry::PointCloud pcd = CreateHeightField(100, 0.0);
+    registration::MultiScaleICPTarget target(pcd, {0.04, 0.02, 0.04, 0.0});
+
+    ASSERT_EQ(target.voxel_sizes_.size(), 3u);
+    EXPECT_EQ(target.GetLevel(0.04), 0);
+    EXPECT_EQ(target.GetLevel(0.02), 1);
+    EXPECT_EQ(target.GetLevel(0.0), 2);
+    EXPECT_EQ(target.GetLevel(-1.0), 2);
+    EXPECT_EQ(target.GetLevel(0.01), -1);
+    EXPECT_LT(target.point_clouds_[0]->points_.size(),
+              target.point_clouds_[1]->points_.size());
+    EXPECT_EQ(target.point_clouds_[2]->points_.size(), pcd.points_.size());
+    for (size_t i = 0; i < target.voxel_sizes_.size(); i++) {
+        EXPECT_TRUE(target.point_clouds_[i]->HasNormals());
+        EXPECT_TRUE(target.icp_targets_[i]->HasNormals());
+        EXPECT_EQ(target.icp_targets_[i]->indices_.size(),
+                  target.point_clouds_[i]->points_.size());
+    }
+
+    registration::MultiScaleICPTarget target_without_normals(pcd, {0.04},
+                                                             false);
+    EXPECT_FALSE(target_without_normals.point_clouds_[0]->HasNormals());
+}
+
+TEST(MultiScaleICP, RegistrationMultiScaleICP) {
+    geometry::PointCloud target = CreateHeightField(100, 0.0);
+    geometry::PointCloud source = CreateHeightField(100, 0.5);
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.1, Eigen::Vector3d(0.0, 0.6, 0.8))
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.05, -0.03, 0.02);
+    source.Transform(transformation.inverse());
+
+    std::vector<registration::MultiScaleICPLevel> levels = {
+            {0.04, 0.2, registration::ICPConvergenceCriteria(1e-6, 1e-6, 30)},
+            {0.02, 0.05, registration::ICPConvergenceCriteria(1e-6, 1e-6, 20)},
+            {0.0, 0.02, registration::ICPConvergenceCriteria(1e-6, 1e-6, 10)}};
+    auto result =
+            registration::RegistrationMultiScaleICP(source, target, levels);
+    EXPECT_GT(result.fitness_, 0.95);
+    EXPECT_LT(result.inlier_rmse_, 0.01);
+    EXPECT_EQ(result.correspondence_set_.size(),
+              size_t(result.fitness_ * source.points_.size() + 0.5));
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                        transformation, 1e-3);
+
+    // A cached pyramid gives the same result.
+    registration::MultiScaleICPTarget target_pyramid(target,
+                                                     {0.04, 0.02, 0.0});
+    auto cached_result = registration::RegistrationMultiScaleICP(
+            source, target_pyramid, levels);
+    EXPECT_EQ(cached_result.fitness_, result.fitness_);
+    unit_test::ExpectEQ(Eigen::Matrix4d(cached_result.transformation_),
+                        Eigen::Matrix4d(result.transformation_));
+
+    // Generalized ICP estimates the normals of both point clouds.
+    auto generalized_result = registration::RegistrationMultiScaleICP(
+            source, target, levels, Eigen::Matrix4d::Identity(),
+            registration::TransformationEstimationForGeneralizedICP());
+    EXPECT_GT(generalized_result.fitness_, 0.95);
+    unit_test::ExpectEQ(Eigen::Matrix4d(generalized_result.transformation_),
+                        transformation, 1e-3);
+
+    // Levels must exist in the pyramid.
+    EXPECT_ANY_THROW(registration::RegistrationMultiScaleICP(
+            source, target_pyramid,
+            {registration::MultiScaleICPLevel(0.01, 0.02)}));
+}
@@ -24,8 +24,35 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <Eigen/Geometry>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/Feature.h"
+#include "Open3D/Registration/Registration.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
+namespace {
+
+/// Random cloud and a rigidly transformed copy of it.
+void CreateTransformedPointClouds(geometry::PointCloud &source,
+                                  geometry::PointCloud &target,
+                                  Eigen::Matrix4d &transformation) {
+    source.points_.resize(500);
+    unit_test::Rand(source.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+                    Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.5, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.3, -0.2, 1.0);
+    target = source;
+    target.Transform(transformation);
+}
+
+}  // unnamed namespace
+
 TEST(Registration, DISABLED_ICPConvergenceCriteria) {
     unit_test::NotImplemented();
 }
@@ -46,18 +73,229 @@ TEST(Registration, DISABLED_EvaluateRegistration) {
     unit_test::NotImplemented();
 }
 
-TEST(Registration, DISABLED_RegistrationICP) { unit_test::NotImplemented(); }
+TEST(Registration, RegistrationICP) {
+    geometry::PointCloud source, target;
+    Eigen::Matrix4d transformation;
+    CreateTransformedPointClouds(source, target, transformation);
+    std::vector<Eigen::Vector3d> normals(target.points_.size());
+    unit_test::Rand(normals, Eigen::Vector3d(-1.0, -1.0, -1.0),
+                    Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    for (auto &normal : normals) {
+        target.normals_.push_back(normal.normalized());
+    }
+    source.normals_ = target.normals_;
+
+    Eigen::Matrix4d perturbation = Eigen::Matrix4d::Identity();
+    perturbation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.02, Eigen::Vector3d(0.0, 0.6, 0.8))
+                    .toRotationMatrix();
+    perturbation.block<3, 1>(0, 3) = Eigen::Vector3d(0.01, 0.0, -0.01);
+    Eigen::Matrix4d init = transformation * perturbation;
+
+    registration::ICPTarget icp_target(target);
+    registration::ICPConvergenceCriteria criteria(1e-10, 1e-10, 50);
+    for (bool point_to_plane : {false, true}) {
+        std::shared_ptr<registration::TransformationEstimation> estimation;
+        if (point_to_plane) {
+            estimation = std::make_shared<
+                    registration::TransformationEstimationPointToPlane>();
+        } else {
+            estimation = std::make_shared<
+                    registration::TransformationEstimationPointToPoint>();
+        }
+        auto result = registration::RegistrationICP(
+                source, target, 0.05, init, *estimation, criteria);
+        EXPECT_NEAR(result.fitness_, 1.0, 1e-12);
+        EXPECT_NEAR(result.inlier_rmse_, 0.0, 1e-5);
+        unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                            transformation, 1e-5);
+        ASSERT_EQ(result.correspondence_set_.size(), source.points_.size());
+        for (size_t i = 0; i < source.points_.size(); i++) {
+            EXPECT_EQ(result.correspondence_set_[i](0), int(i));
+            EXPECT_EQ(result.correspondence_set_[i](1), int(i));
+        }
+
+        // A prepared target gives the same result in single precision.
+        auto prepared_result = registration::RegistrationICP(
+                source, icp_target, 0.05, init, *estimation, criteria);
+        EXPECT_EQ(prepared_result.fitness_, result.fitness_);
+        EXPECT_NEAR(prepared_result.inlier_rmse_, result.inlier_rmse_, 1e-5);
+        unit_test::ExpectEQ(Eigen::Matrix4d(prepared_result.transformation_),
+                            Eigen::Matrix4d(result.transformation_), 1e-5);
+    }
+}
+
+TEST(Registration, RegistrationICPCustomEstimation) {
+    // Reports the type of a built-in estimation without deriving from it.
+    class TransformationEstimationCustom
+        : public registration::TransformationEstimation {
+    public:
+        registration::TransformationEstimationType
+        GetTransformationEstimationType() const override {
+            return registration::TransformationEstimationType::PointToPoint;
+        }
+        double ComputeRMSE(const geometry::PointCloud &source,
+                           const geometry::PointCloud &target,
+                           const registration::CorrespondenceSet &corres)
+                const override {
+            return point_to_point_.ComputeRMSE(source, target, corres);
+        }
+        Eigen::Matrix4d ComputeTransformation(
+                const geometry::PointCloud &source,
+                const geometry::PointCloud &target,
+                const registration::CorrespondenceSet &corres) const override {
+            return point_to_point_.ComputeTransformation(source, target,
+                                                         corres);
+        }
+
+    private:
+        registration::TransformationEstimationPointToPoint point_to_point_;
+    };
+
+    geometry::PointCloud source, target;
+    Eigen::Matrix4d transformation;
+    CreateTransformedPointClouds(source, target, transformation);
+    Eigen::Matrix4d init = transformation;
+    init(0, 3) += 0.01;
+
+    // The point cloud overload only uses the virtual functions.
+    TransformationEstimationCustom estimation;
+    registration::ICPConvergenceCriteria criteria(1e-10, 1e-10, 50);
+    auto result = registration::RegistrationICP(source, target, 0.05, init,
+                                                estimation, criteria);
+    EXPECT_NEAR(result.fitness_, 1.0, 1e-12);
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_),
+                        transformation, 1e-5);
+
+    // A prepared target cannot evaluate it.
+    registration::ICPTarget icp_target(target);
+    EXPECT_ANY_THROW(registration::RegistrationICP(
+            source, icp_target, 0.05, init, estimation, criteria));
+}
+
+TEST(Registration, RegistrationICPRobustKernel) {
+    geometry::PointCloud source, target;
+    Eigen::Matrix4d transformation;
+    CreateTransformedPointClouds(source, target, transformation);
+    std::vector<Eigen::Vector3d> normals(target.points_.size());
+    unit_test::Rand(normals, Eigen::Vector3d(-1.0, -1.0, -1.0),
+                    Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    for (auto &normal : normals) {
+        target.normals_.push_back(normal.normalized());
+    }
+    source.normals_ = target.normals_;
+    // Every tenth target point is displaced along its normal, within the
+    // correspondence distance, which biases least squares.
+    for (size_t i = 0; i < target.points_.size(); i += 10) {
+        target.points_[i] += 0.02 * target.normals_[i];
+    }
+
+    registration::ICPConvergenceCriteria criteria(1e-10, 1e-10, 50);
+    auto tukey = std::make_shared<registration::TukeyLoss>(0.01);
+    for (bool point_to_plane : {false, true}) {
+        std::shared_ptr<registration::TransformationEstimation> l2, robust;
+        if (point_to_plane) {
+            l2 = std::make_shared<
+                    registration::TransformationEstimationPointToPlane>();
+            robust = std::make_shared<
+                    registration::TransformationEstimationPointToPlane>(tukey);
+        } else {
+            l2 = std::make_shared<
+                    registration::TransformationEstimationPointToPoint>();
+            robust = std::make_shared<
+                    registration::TransformationEstimationPointToPoint>(
+                    false, tukey);
+        }
+        auto l2_result = registration::RegistrationICP(
+                source, target, 0.05, transformation, *l2, criteria);
+        EXPECT_GT((l2_result.transformation_ - transformation).norm(), 1e-4);
+        auto robust_result = registration::RegistrationICP(
+                source, target, 0.05, transformation, *robust, criteria);
+        unit_test::ExpectEQ(Eigen::Matrix4d(robust_result.transformation_),
+                            transformation, 1e-6);
+    }
+}
 
 TEST(Registration, DISABLED_TransformationEstimationPointToPoint) {
     unit_test::NotImplemented();
 }
 
-TEST(Registration, DISABLED_RegistrationRANSACBasedOnCorrespondence) {
-    unit_test::NotImplemented();
+TEST(Registration, RegistrationRANSACBasedOnCorrespondence) {
+    geometry::PointCloud source, target;
+    Eigen::Matrix4d transformation;
+    CreateTransformedPointClouds(source, target, transformation);
+
+    // Every fourth correspondence is wrong.
+    registration::CorrespondenceSet corres;
+    for (int i = 0; i < (int)source.points_.size(); i++) {
+        corres.push_back(Eigen::Vector2i(
+                i, i % 4 == 0 ? (i * 7 + 3) % (int)source.points_.size() : i));
+    }
+    auto result = registration::RegistrationRANSACBasedOnCorrespondence(
+            source, target, corres, 0.01,
+            registration::TransformationEstimationPointToPoint(false), 3,
+            registration::RANSACConvergenceCriteria(1000, 1000));
+
+    EXPECT_NEAR(result.fitness_, 0.75, 1e-3);
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_), transformation,
+                        1e-6);
 }
 
-TEST(Registration, DISABLED_RegistrationRANSACBasedOnFeatureMatching) {
-    unit_test::NotImplemented();
+TEST(Registration, RegistrationRANSACBasedOnFeatureMatching) {
+    geometry::PointCloud source, target;
+    Eigen::Matrix4d transformation;
+    CreateTransformedPointClouds(source, target, transformation);
+
+    // Features invariant to the transformation: the untransformed coordinates.
+    registration::Feature source_feature, target_feature;
+    source_feature.Resize(3, (int)source.points_.size());
+    for (size_t i = 0; i < source.points_.size(); i++) {
+        source_feature.data_.col(i) = source.points_[i];
+    }
+    target_feature = source_feature;
+
+    auto result = registration::RegistrationRANSACBasedOnFeatureMatching(
+            source, target, source_feature, target_feature, 0.01,
+            registration::TransformationEstimationPointToPoint(false), 3, {},
+            registration::RANSACConvergenceCriteria(1000, 100));
+
+    EXPECT_NEAR(result.fitness_, 1.0, 1e-12);
+    EXPECT_NEAR(result.inlier_rmse_, 0.0, 1e-6);
+    EXPECT_EQ(result.correspondence_set_.size(), source.points_.size());
+    for (const auto &c : result.correspondence_set_) {
+        EXPECT_EQ(c(0), c(1));
+    }
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_), transformation,
+                        1e-6);
+}
+
+TEST(Registration, RegistrationRANSACBasedOnFeatureMatchingMutualFilter) {
+    geometry::PointCloud source, target;
+    Eigen::Matrix4d transformation;
+    CreateTransformedPointClouds(source, target, transformation);
+
+    // Half of the features are replaced by random ones.
+    registration::Feature source_feature, target_feature;
+    source_feature.Resize(3, (int)source.points_.size());
+    for (size_t i = 0; i < source.points_.size(); i++) {
+        source_feature.data_.col(i) = source.points_[i];
+    }
+    target_feature = source_feature;
+    std::vector<Eigen::Vector3d> outliers(source.points_.size() / 2);
+    unit_test::Rand(outliers, Eigen::Vector3d(0.0, 0.0, 0.0),
+                    Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    for (size_t i = 0; i < outliers.size(); i++) {
+        target_feature.data_.col(2 * i) = outliers[i];
+    }
+
+    auto result = registration::RegistrationRANSACBasedOnFeatureMatching(
+            source, target, source_feature, target_feature, 0.01,
+            registration::TransformationEstimationPointToPoint(false), 3, {},
+            registration::RANSACConvergenceCriteria(1000, 100), true, 64);
+
+    EXPECT_NEAR(result.fitness_, 1.0, 1e-12);
+    unit_test::ExpectEQ(Eigen::Matrix4d(result.transformation_), transformation,
+                        1e-6);
 }
 
 TEST(Registration, DISABLED_GetInformationMatrixFromPointClouds) {
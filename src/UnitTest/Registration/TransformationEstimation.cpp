@@ -24,8 +24,64 @@
 // IN THE SOFTWARE.
 // ----------------------------------------------------------------------------
 
+#include <Eigen/Geometry>
+
+#include "Open3D/Geometry/PointCloud.h"
+#include "Open3D/Registration/TransformationEstimation.h"
 #include "TestUtility/UnitTest.h"
 
+using namespace open3d;
+
+namespace {
+
+/// Random cloud with normals and a transformed copy of it, in which every
+/// tenth point is moved away from its correspondence.
+void CreatePointCloudsWithOutliers(geometry::PointCloud &source,
+                                   geometry::PointCloud &target,
+                                   Eigen::Matrix4d &transformation) {
+    source.points_.resize(200);
+    unit_test::Rand(source.points_, Eigen::Vector3d(0.0, 0.0, 0.0),
+                    Eigen::Vector3d(1.0, 1.0, 1.0), 0);
+    source.normals_.resize(200);
+    unit_test::Rand(source.normals_, Eigen::Vector3d(-1.0, -1.0, -1.0),
+                    Eigen::Vector3d(1.0, 1.0, 1.0), 1);
+    for (auto &normal : source.normals_) {
+        normal.normalize();
+    }
+    transformation = Eigen::Matrix4d::Identity();
+    transformation.block<3, 3>(0, 0) =
+            Eigen::AngleAxisd(0.05, Eigen::Vector3d(1.0, 2.0, 3.0).normalized())
+                    .toRotationMatrix();
+    transformation.block<3, 1>(0, 3) = Eigen::Vector3d(0.02, -0.01, 0.03);
+    target = source;
+    target.Transform(transformation);
+    for (size_t i = 0; i < target.points_.size(); i += 10) {
+        target.points_[i] += 0.6 * target.normals_[i];
+    }
+}
+
+/// Iterates the estimation on fixed correspondences, as RegistrationICP does.
+Eigen::Matrix4d IterateEstimation(
+        const geometry::PointCloud &source,
+        const geometry::PointCloud &target,
+        const registration::TransformationEstimation &estimation) {
+    registration::CorrespondenceSet corres;
+    for (int i = 0; i < (int)source.points_.size(); i++) {
+        corres.push_back(Eigen::Vector2i(i, i));
+    }
+    Eigen::Matrix4d transformation = Eigen::Matrix4d::Identity();
+    geometry::PointCloud pcd = source;
+    for (int i = 0; i < 30; i++) {
+        Eigen::Matrix4d update =
+                estimation.ComputeTransformation(pcd, target, corres);
+        transformation = update * transformation;
+        pcd.Transform(update);
+    }
+    return transformation;
+}
+
+}  // unnamed namespace
+
 TEST(TransformationEstimation, DISABLED_Constructor) {
     unit_test::NotImplemented();
 }
@@ -50,10 +106,33 @@ TEST(TransformationEstimation, DISABLED_ComputeTransformation) {
     unit_test::NotImplemented();
 }
 
-TEST(TransformationEstimation, DISABLED_TransformationEstimationPointToPoint) {
-    unit_test::NotImplemented();
+TEST(TransformationEstimation, TransformationEstimationPointToPoint) {
+    geometry::PointCloud source, target;
+    Eigen::Matrix4d transformation;
+    CreatePointCloudsWithOutliers(source, target, transformation);
+
+    // The outliers bias least squares, the robust kernel ignores them.
+    registration::TransformationEstimationPointToPoint l2;
+    Eigen::Matrix4d l2_result = IterateEstimation(source, target, l2);
+    EXPECT_GT((l2_result - transformation).norm(), 1e-2);
+
+    registration::TransformationEstimationPointToPoint tukey(
+            false, std::make_shared<registration::TukeyLoss>(0.3));
+    unit_test::ExpectEQ(IterateEstimation(source, target, tukey),
+                        transformation, 1e-8);
 }
 
-TEST(TransformationEstimation, DISABLED_TransformationEstimationPointToPlane) {
-    unit_test::NotImplemented();
+TEST(TransformationEstimation, TransformationEstimationPointToPlane) {
+    geometry::PointCloud source, target;
+    Eigen::Matrix4d transformation;
+    CreatePointCloudsWithOutliers(source, target, transformation);
+
+    registration::TransformationEstimationPointToPlane l2;
+    Eigen::Matrix4d l2_result = IterateEstimation(source, target, l2);
+    EXPECT_GT((l2_result - transformation).norm(), 1e-2);
+
+    registration::TransformationEstimationPointToPlane tukey(
+            std::make_shared<registration::TukeyLoss>(0.3));
+    unit_test::ExpectEQ(IterateEstimation(source, target, tukey),
+                        transformation, 1e-8);
 }